@@ -40,6 +40,9 @@ if(PLATFORM_WIN32)
         if(WEBGPU_SUPPORTED)
             list(APPEND ENGINE_DLLS Diligent-GraphicsEngineWebGPU-shared)
         endif()
+        if(NULL_SUPPORTED)
+            list(APPEND ENGINE_DLLS Diligent-GraphicsEngineNull-shared)
+        endif()
         if(TARGET Diligent-Archiver-shared)
             list(APPEND ENGINE_DLLS Diligent-Archiver-shared)
         endif()
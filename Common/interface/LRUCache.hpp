@@ -224,6 +224,34 @@ public:
         return m_CurrSize;
     }
 
+    /// Removes all objects from the cache.
+
+    /// \remarks   Objects that are being initialized by other threads are
+    ///            returned to these threads, but are not added to the cache.
+    void Clear()
+    {
+        std::vector<std::shared_ptr<DataWrapper>> DeleteList;
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+
+            DeleteList.reserve(m_Cache.size());
+            for (auto& it : m_Cache)
+            {
+                // Accounted size can only be set while the mutex is locked
+                const size_t AccountedSize = it.second->GetAccountedSize();
+                VERIFY_EXPR(m_CurrSize >= AccountedSize);
+                m_CurrSize -= AccountedSize;
+                DeleteList.emplace_back(std::move(it.second));
+            }
+            m_Cache.clear();
+            m_LRUQueue.clear();
+            VERIFY_EXPR(m_CurrSize == 0);
+        }
+
+        // Delete objects after releasing the cache mutex
+        DeleteList.clear();
+    }
+
     ~LRUCache()
     {
 #ifdef DILIGENT_DEBUG
@@ -0,0 +1,76 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Fast LZ77-family block compression.
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Returns the maximum size of the compressed data for the given source size.
+///
+/// \remarks    A destination buffer of this size always fits the compressed data,
+///             even if the source data is not compressible.
+size_t GetLZMaxCompressedSize(size_t SrcSize);
+
+/// Returns the maximum size that the compressed data of the given size may decompress to.
+///
+/// \remarks    The value may be used to validate the decompressed size that is read
+///             from an untrusted source before allocating the destination buffer.
+size_t GetLZMaxDecompressedSize(size_t CompressedSize);
+
+/// Compresses a block of data.
+
+/// \param[in]  pSrc        - A pointer to the source data.
+/// \param[in]  SrcSize     - Source data size, in bytes.
+/// \param[out] pDst        - A pointer to the destination buffer.
+/// \param[in]  DstCapacity - Destination buffer size, in bytes.
+///
+/// \return     The size of the compressed data, or 0 if it does not fit into the destination buffer.
+///
+/// \remarks    The compressed data does not store the source size, so it must be
+///             recorded separately and passed to LZDecompress.
+size_t LZCompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity);
+
+/// Decompresses a block of data compressed by LZCompress.
+
+/// \param[in]  pSrc    - A pointer to the compressed data.
+/// \param[in]  SrcSize - Compressed data size, in bytes.
+/// \param[out] pDst    - A pointer to the destination buffer.
+/// \param[in]  DstSize - Decompressed data size, in bytes.
+///
+/// \return     true if the data was successfully decompressed and its size
+///             matches DstSize exactly, and false otherwise.
+///
+/// \remarks    The function validates the compressed stream and never reads or
+///             writes outside of the source and destination buffers.
+bool LZDecompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize);
+
+} // namespace Diligent
@@ -30,9 +30,11 @@
 #include <array>
 #include <cstring>
 #include <atomic>
+#include <vector>
 
 #include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/MemoryAllocator.h"
+#include "../../Primitives/interface/FileStream.h"
 #include "../../Primitives/interface/CheckBaseStructAlignment.hpp"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 #include "DynamicLinearAllocator.hpp"
@@ -111,6 +113,109 @@ private:
 };
 
 
+/// Growable output buffer for the single-pass write serializer.
+
+/// The data is written into a list of chunks, so that growing the buffer never
+/// moves or copies the data that has already been written. Chunk sizes start small
+/// and double up to the maximum chunk size, so that serializing small objects
+/// does not require large allocations.
+/// If the file stream is provided, full chunks are written to the stream
+/// instead of being kept in memory.
+///
+/// Any previously written range may be overwritten, which allows back-patching
+/// values that are not known until the following data is serialized.
+class SerializationBuffer
+{
+public:
+    static constexpr size_t MinChunkSize     = 256;
+    static constexpr size_t DefaultChunkSize = size_t{64} << 10;
+
+    explicit SerializationBuffer(IMemoryAllocator& Allocator, size_t MaxChunkSize = DefaultChunkSize) noexcept;
+
+    /// Writes the data to the stream starting at the current stream position.
+    /// A single chunk of MaxChunkSize bytes is used to buffer the data.
+    SerializationBuffer(IFileStream* pStream, IMemoryAllocator& Allocator, size_t MaxChunkSize = DefaultChunkSize) noexcept;
+
+    ~SerializationBuffer();
+
+    // clang-format off
+    SerializationBuffer           (const SerializationBuffer&)  = delete;
+    SerializationBuffer           (      SerializationBuffer&&) = delete;
+    SerializationBuffer& operator=(const SerializationBuffer&)  = delete;
+    SerializationBuffer& operator=(      SerializationBuffer&&) = delete;
+    // clang-format on
+
+    /// Appends Size bytes from pData to the buffer.
+    /// If pData is null, Size zero bytes are appended.
+    bool Append(const void* pData, size_t Size)
+    {
+        if (Size <= static_cast<size_t>(m_ChunkEnd - m_Ptr))
+        {
+            if (pData != nullptr)
+                std::memcpy(m_Ptr, pData, Size);
+            else
+                std::memset(m_Ptr, 0, Size);
+            m_Ptr += Size;
+            return true;
+        }
+        return AppendToNewChunk(static_cast<const Uint8*>(pData), Size);
+    }
+
+    /// Overwrites Size bytes at the given offset with the data from pData.
+    /// The range must have been written before.
+    bool Overwrite(size_t Offset, const void* pData, size_t Size);
+
+    /// Returns the total number of bytes written to the buffer.
+    size_t GetSize() const
+    {
+        return m_ChunkOffset + static_cast<size_t>(m_Ptr - m_ChunkStart);
+    }
+
+    /// Copies the data to a contiguous memory block.
+    /// Not allowed when the buffer writes to a stream.
+    SerializedData GetData(IMemoryAllocator& Allocator) const;
+
+    /// Copies GetSize() bytes to pDst.
+    /// Not allowed when the buffer writes to a stream.
+    void CopyTo(void* pDst) const;
+
+    /// Writes all data that is kept in memory to the stream.
+    bool Flush();
+
+    /// Returns false if writing to the stream failed.
+    bool IsValid() const { return m_IsValid; }
+
+private:
+    bool AppendToNewChunk(const Uint8* pData, size_t Size);
+    bool FlushChunk();
+
+    struct Chunk
+    {
+        Uint8* pData  = nullptr;
+        size_t Offset = 0;
+        size_t Size   = 0;
+    };
+
+    IMemoryAllocator& m_Allocator;
+    IFileStream* const m_pStream     = nullptr;
+    size_t             m_StreamStart = 0;
+
+    const size_t m_MaxChunkSize;
+
+    // In memory mode, all chunks are kept in the list.
+    // In stream mode, only one chunk is used and it is flushed to the stream when full.
+    std::vector<Chunk> m_Chunks;
+
+    // Current chunk
+    Uint8* m_ChunkStart  = nullptr;
+    Uint8* m_ChunkEnd    = nullptr;
+    Uint8* m_Ptr         = nullptr;
+    size_t m_ChunkOffset = 0;
+
+    bool m_IsValid = true;
+};
+
+
 
 template <typename T>
 struct IsTriviallySerializable
@@ -189,6 +294,14 @@ public:
         static_assert(Mode == SerializerMode::Read || Mode == SerializerMode::Write, "Only Read or Write mode is supported");
     }
 
+    /// Single-pass write mode: the data is written to the growable buffer,
+    /// so there is no need to measure the data size first.
+    explicit Serializer(SerializationBuffer& Buffer) :
+        m_pBuffer{&Buffer}
+    {
+        static_assert(Mode == SerializerMode::Write, "Only Write mode is supported");
+    }
+
     template <typename T>
     TEnable<T> Serialize(ConstQual<T>& Value)
     {
@@ -236,6 +349,23 @@ public:
                            ElemPtrType&            Elements,
                            CountType&              Count);
 
+    /// Reserves space for a trivially serializable value that is not known yet, e.g. a size
+    /// prefix of the data that follows, and returns its offset. The value must then be
+    /// written with Patch(). Only allowed in Write and Measure modes.
+    template <typename T>
+    size_t Reserve()
+    {
+        static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure, "Only Write or Measure mode is supported");
+        static_assert(IsTriviallySerializable<T>::value, "Only trivially serializable values can be patched");
+        const size_t Offset = GetSize();
+        const T      Value{};
+        return Copy(&Value, sizeof(Value)) ? Offset : ~size_t{0};
+    }
+
+    /// Writes the value to the space previously reserved with Reserve().
+    template <typename T>
+    bool Patch(size_t Offset, const T& Value);
+
     template <typename T>
     TReadOnly<T> Cast()
     {
@@ -264,6 +394,9 @@ public:
 
     size_t GetSize() const
     {
+        if (m_pBuffer != nullptr)
+            return m_pBuffer->GetSize();
+
         VERIFY_EXPR(m_Ptr >= m_Start);
         return m_Ptr - m_Start;
     }
@@ -300,6 +433,12 @@ private:
     {
         const size_t Size       = GetSize();
         const size_t AlignShift = AlignUp(Size, Alignment) - Size;
+        if (m_pBuffer != nullptr)
+        {
+            // Alignment gaps are filled with zeros
+            m_pBuffer->Append(nullptr, AlignShift);
+            return;
+        }
         VERIFY_EXPR(m_Ptr + AlignShift <= m_End);
         m_Ptr += AlignShift;
     }
@@ -309,6 +448,9 @@ private:
     TPointer const m_End   = nullptr;
 
     TPointer m_Ptr = nullptr;
+
+    // Growable buffer used by the single-pass write mode
+    SerializationBuffer* const m_pBuffer = nullptr;
 };
 
 #define CHECK_REMAINING_SIZE(Size, ...) \
@@ -337,6 +479,9 @@ template <typename T>
 bool Serializer<SerializerMode::Write>::Copy(T* pData, size_t Size)
 {
     static_assert(IsAlignedBaseClass<T>::Value, "There is unused space at the end of the structure that may be filled with garbage. Use padding to zero-initialize this space and avoid nasty issues.");
+    if (m_pBuffer != nullptr)
+        return m_pBuffer->Append(pData, Size);
+
     CHECK_REMAINING_SIZE(Size, "Note enough data to write ", Size, " bytes");
     std::memcpy(m_Ptr, pData, Size);
     m_Ptr += Size;
@@ -352,6 +497,30 @@ bool Serializer<SerializerMode::Measure>::Copy(T* pData, size_t Size)
     return true;
 }
 
+template <>
+template <typename T>
+bool Serializer<SerializerMode::Write>::Patch(size_t Offset, const T& Value)
+{
+    if (m_pBuffer != nullptr)
+        return m_pBuffer->Overwrite(Offset, &Value, sizeof(Value));
+
+    if (Offset + sizeof(Value) > GetSize())
+    {
+        UNEXPECTED("The patched range has not been written yet");
+        return false;
+    }
+    std::memcpy(m_Start + Offset, &Value, sizeof(Value));
+    return true;
+}
+
+template <>
+template <typename T>
+bool Serializer<SerializerMode::Measure>::Patch(size_t Offset, const T& Value)
+{
+    VERIFY_EXPR(Offset + sizeof(Value) <= GetSize());
+    return true;
+}
+
 template <>
 template <typename T>
 typename Serializer<SerializerMode::Read>::TEnableStr<T> Serializer<SerializerMode::Read>::Serialize(CharPtr Str)
@@ -31,9 +31,11 @@
 
 #include "ThreadPool.h"
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <thread>
+#include <vector>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -226,4 +228,56 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+/// Calls Handler(i) for every i in the range [0, Count) and waits until all calls are complete.
+
+/// \param[in] pThreadPool - Thread pool to distribute the work between. If null, all items
+///                           are processed by the calling thread.
+/// \param[in] Count       - The number of items to process.
+/// \param[in] Handler     - Function to call for each item. The function may be called
+///                           simultaneously from multiple threads.
+/// \param[in] MaxTasks    - The maximum number of tasks to enqueue.
+///
+/// The calling thread also processes the items, so the function makes progress
+/// even if all worker threads are busy. Tasks that did not start by the time all items
+/// have been processed are removed from the queue.
+template <typename HanlderType>
+void ProcessInParallel(IThreadPool*       pThreadPool,
+                       size_t             Count,
+                       const HanlderType& Handler,
+                       size_t             MaxTasks = 64)
+{
+    if (pThreadPool == nullptr || Count < 2 || MaxTasks == 0)
+    {
+        for (size_t i = 0; i < Count; ++i)
+            Handler(i);
+        return;
+    }
+
+    std::atomic<size_t> NextIdx{0};
+
+    auto ProcessItems = [&NextIdx, &Handler, Count]() {
+        for (size_t i = NextIdx.fetch_add(1); i < Count; i = NextIdx.fetch_add(1))
+            Handler(i);
+    };
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(std::min(Count - 1, MaxTasks));
+    for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+    {
+        pTask = EnqueueAsyncWork(pThreadPool,
+                                 [&ProcessItems](Uint32 /*ThreadId*/) {
+                                     ProcessItems();
+                                     return ASYNC_TASK_STATUS_COMPLETE;
+                                 });
+    }
+
+    ProcessItems();
+
+    // Tasks reference local variables, so wait for all of them to finish
+    for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+    {
+        if (!pThreadPool->RemoveTask(pTask))
+            pTask->WaitForCompletion();
+    }
+}
+
 } // namespace Diligent
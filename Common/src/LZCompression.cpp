@@ -0,0 +1,281 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "LZCompression.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace Diligent
+{
+
+// The compressed stream is a sequence of blocks:
+//
+//  | Token | Literal length ext | Literals | Match offset | Match length ext |
+//
+//  * Token: high 4 bits - literal count, low 4 bits - match length minus MinMatch.
+//    The value of 15 indicates that the length continues in the extension bytes.
+//  * Length extension: a sequence of bytes that are added to the length. All bytes
+//    except for the last one are 255.
+//  * Match offset: 16-bit little-endian distance back from the current position.
+//
+// The last block contains only literals (possibly none) and ends the stream.
+
+namespace
+{
+
+constexpr size_t MinMatch    = 4;
+constexpr size_t MaxOffset   = 65535;
+constexpr Uint32 HashLog     = 14;
+constexpr Uint32 InvalidPos  = ~0u;
+constexpr Uint32 LengthMask  = 15;
+constexpr Uint32 SkipTrigger = 6;
+
+inline Uint32 Read32(const Uint8* p)
+{
+    Uint32 Val;
+    std::memcpy(&Val, p, sizeof(Val));
+    return Val;
+}
+
+inline Uint32 HashSequence(Uint32 Seq)
+{
+    return (Seq * 2654435761u) >> (32 - HashLog);
+}
+
+class LZWriter
+{
+public:
+    LZWriter(Uint8* pDst, size_t Capacity) :
+        m_Ptr{pDst},
+        m_End{pDst + Capacity}
+    {}
+
+    bool WriteSequence(const Uint8* pLiterals, size_t NumLiterals, size_t MatchLen, size_t Offset)
+    {
+        Uint8* const pToken = m_Ptr;
+        if (!Reserve(1))
+            return false;
+
+        const size_t LitCode   = NumLiterals < LengthMask ? NumLiterals : LengthMask;
+        const size_t MatchCode = MatchLen == 0 ? 0 : (MatchLen - MinMatch < LengthMask ? MatchLen - MinMatch : LengthMask);
+        *pToken                = static_cast<Uint8>((LitCode << 4) | MatchCode);
+
+        if (LitCode == LengthMask && !WriteLength(NumLiterals - LengthMask))
+            return false;
+
+        if (!Reserve(NumLiterals))
+            return false;
+        std::memcpy(m_Ptr - NumLiterals, pLiterals, NumLiterals);
+
+        if (MatchLen == 0)
+            return true;
+
+        if (!Reserve(2))
+            return false;
+        m_Ptr[-2] = static_cast<Uint8>(Offset & 0xFF);
+        m_Ptr[-1] = static_cast<Uint8>(Offset >> 8);
+
+        if (MatchCode == LengthMask && !WriteLength(MatchLen - MinMatch - LengthMask))
+            return false;
+
+        return true;
+    }
+
+    Uint8* GetPtr() const { return m_Ptr; }
+
+private:
+    bool Reserve(size_t Size)
+    {
+        if (static_cast<size_t>(m_End - m_Ptr) < Size)
+            return false;
+        m_Ptr += Size;
+        return true;
+    }
+
+    bool WriteLength(size_t Len)
+    {
+        for (; Len >= 255; Len -= 255)
+        {
+            if (!Reserve(1))
+                return false;
+            m_Ptr[-1] = 255;
+        }
+        if (!Reserve(1))
+            return false;
+        m_Ptr[-1] = static_cast<Uint8>(Len);
+        return true;
+    }
+
+private:
+    Uint8*       m_Ptr;
+    Uint8* const m_End;
+};
+
+inline bool ReadLength(const Uint8*& pSrc, const Uint8* pSrcEnd, size_t& Len)
+{
+    Uint8 Byte = 0;
+    do
+    {
+        if (pSrc >= pSrcEnd)
+            return false;
+        Byte = *pSrc++;
+        Len += Byte;
+    } while (Byte == 255);
+    return true;
+}
+
+} // namespace
+
+size_t GetLZMaxCompressedSize(size_t SrcSize)
+{
+    // Incompressible data is stored as a single literal block
+    return SrcSize + SrcSize / 255 + 16;
+}
+
+size_t GetLZMaxDecompressedSize(size_t CompressedSize)
+{
+    // Every block has at least a token and a match offset. Each length extension byte
+    // adds at most 255 bytes, so a single input byte never produces more than 255 output bytes.
+    return CompressedSize * 255;
+}
+
+size_t LZCompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity)
+{
+    if ((pSrc == nullptr && SrcSize != 0) || pDst == nullptr)
+        return 0;
+
+    // Positions are stored as 32-bit values in the hash table
+    if (SrcSize >= InvalidPos)
+        return 0;
+
+    const Uint8* const pIn = static_cast<const Uint8*>(pSrc);
+    LZWriter           Writer{static_cast<Uint8*>(pDst), DstCapacity};
+
+    std::vector<Uint32> HashTable(size_t{1} << HashLog, InvalidPos);
+
+    size_t Anchor = 0;
+    size_t Pos    = 0;
+    while (Pos + MinMatch <= SrcSize)
+    {
+        const Uint32 Seq  = Read32(pIn + Pos);
+        const Uint32 Hash = HashSequence(Seq);
+        const Uint32 Ref  = HashTable[Hash];
+        HashTable[Hash]   = static_cast<Uint32>(Pos);
+
+        if (Ref == InvalidPos || Pos - Ref > MaxOffset || Read32(pIn + Ref) != Seq)
+        {
+            // Skip faster over incompressible data
+            Pos += 1 + ((Pos - Anchor) >> SkipTrigger);
+            continue;
+        }
+
+        size_t MatchLen = MinMatch;
+        while (Pos + MatchLen < SrcSize && pIn[Ref + MatchLen] == pIn[Pos + MatchLen])
+            ++MatchLen;
+
+        if (!Writer.WriteSequence(pIn + Anchor, Pos - Anchor, MatchLen, Pos - Ref))
+            return 0;
+
+        Pos += MatchLen;
+        Anchor = Pos;
+
+        // Index the position inside the match to improve the next match search
+        if (Pos >= 2 && Pos + MinMatch <= SrcSize + 2)
+            HashTable[HashSequence(Read32(pIn + Pos - 2))] = static_cast<Uint32>(Pos - 2);
+    }
+
+    // The last block always contains only literals
+    if (!Writer.WriteSequence(pIn + Anchor, SrcSize - Anchor, 0, 0))
+        return 0;
+
+    return Writer.GetPtr() - static_cast<Uint8*>(pDst);
+}
+
+bool LZDecompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize)
+{
+    if ((pSrc == nullptr && SrcSize != 0) || (pDst == nullptr && DstSize != 0))
+        return false;
+
+    const Uint8*       pIn     = static_cast<const Uint8*>(pSrc);
+    const Uint8* const pInEnd  = pIn + SrcSize;
+    Uint8* const       pOutBeg = static_cast<Uint8*>(pDst);
+    Uint8*             pOut    = pOutBeg;
+    Uint8* const       pOutEnd = pOutBeg + DstSize;
+
+    for (;;)
+    {
+        if (pIn >= pInEnd)
+            return false;
+
+        const Uint32 Token = *pIn++;
+
+        size_t NumLiterals = Token >> 4;
+        if (NumLiterals == LengthMask && !ReadLength(pIn, pInEnd, NumLiterals))
+            return false;
+
+        if (NumLiterals > static_cast<size_t>(pInEnd - pIn) || NumLiterals > static_cast<size_t>(pOutEnd - pOut))
+            return false;
+        std::memcpy(pOut, pIn, NumLiterals);
+        pIn += NumLiterals;
+        pOut += NumLiterals;
+
+        if (pOut == pOutEnd)
+        {
+            // The last block must not contain a match
+            return (Token & LengthMask) == 0 && pIn == pInEnd;
+        }
+
+        if (pInEnd - pIn < 2)
+            return false;
+        const size_t Offset = size_t{pIn[0]} | (size_t{pIn[1]} << 8);
+        pIn += 2;
+
+        size_t MatchLen = Token & LengthMask;
+        if (MatchLen == LengthMask && !ReadLength(pIn, pInEnd, MatchLen))
+            return false;
+        MatchLen += MinMatch;
+
+        if (Offset == 0 || Offset > static_cast<size_t>(pOut - pOutBeg) || MatchLen > static_cast<size_t>(pOutEnd - pOut))
+            return false;
+
+        const Uint8* pMatch = pOut - Offset;
+        if (Offset >= MatchLen)
+        {
+            std::memcpy(pOut, pMatch, MatchLen);
+            pOut += MatchLen;
+        }
+        else
+        {
+            // Overlapping match repeats the last Offset bytes
+            for (size_t i = 0; i < MatchLen; ++i)
+                *pOut++ = *pMatch++;
+        }
+    }
+}
+
+} // namespace Diligent
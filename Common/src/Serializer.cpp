@@ -26,7 +26,10 @@
 
 #include "Serializer.hpp"
 
+#include <algorithm>
+
 #include "HashUtils.hpp"
+#include "BasicFileSystem.hpp"
 
 namespace Diligent
 {
@@ -115,4 +118,209 @@ SerializedData SerializedData::MakeCopy(IMemoryAllocator& Allocator) const
     return Copy;
 }
 
+SerializationBuffer::SerializationBuffer(IMemoryAllocator& Allocator, size_t MaxChunkSize) noexcept :
+    m_Allocator{Allocator},
+    m_MaxChunkSize{std::max(MaxChunkSize, MinChunkSize)}
+{
+}
+
+SerializationBuffer::SerializationBuffer(IFileStream* pStream, IMemoryAllocator& Allocator, size_t MaxChunkSize) noexcept :
+    m_Allocator{Allocator},
+    m_pStream{pStream},
+    m_StreamStart{pStream != nullptr ? pStream->GetPos() : 0},
+    m_MaxChunkSize{std::max(MaxChunkSize, MinChunkSize)}
+{
+    VERIFY(m_pStream != nullptr, "File stream must not be null");
+}
+
+SerializationBuffer::~SerializationBuffer()
+{
+    for (Chunk& chunk : m_Chunks)
+        m_Allocator.Free(chunk.pData);
+}
+
+bool SerializationBuffer::FlushChunk()
+{
+    VERIFY_EXPR(m_pStream != nullptr);
+
+    const size_t Size = static_cast<size_t>(m_Ptr - m_ChunkStart);
+    if (Size != 0 && m_IsValid)
+        m_IsValid = m_pStream->Write(m_ChunkStart, Size);
+
+    // Reuse the chunk memory for the next data
+    m_ChunkOffset += Size;
+    m_Ptr = m_ChunkStart;
+
+    return m_IsValid;
+}
+
+bool SerializationBuffer::AppendToNewChunk(const Uint8* pData, size_t Size)
+{
+    // Fill the remaining space in the current chunk
+    const size_t NumBytes = static_cast<size_t>(m_ChunkEnd - m_Ptr);
+    if (NumBytes != 0)
+    {
+        if (pData != nullptr)
+        {
+            std::memcpy(m_Ptr, pData, NumBytes);
+            pData += NumBytes;
+        }
+        else
+        {
+            std::memset(m_Ptr, 0, NumBytes);
+        }
+        m_Ptr += NumBytes;
+        Size -= NumBytes;
+    }
+
+    if (m_pStream != nullptr)
+    {
+        if (m_ChunkStart == nullptr)
+        {
+            Chunk NewChunk;
+            NewChunk.Size  = m_MaxChunkSize;
+            NewChunk.pData = static_cast<Uint8*>(m_Allocator.Allocate(NewChunk.Size, "Serialization buffer chunk", __FILE__, __LINE__));
+            m_Chunks.emplace_back(NewChunk);
+
+            m_ChunkStart = NewChunk.pData;
+            m_ChunkEnd   = NewChunk.pData + NewChunk.Size;
+            m_Ptr        = m_ChunkStart;
+        }
+        else if (!FlushChunk())
+        {
+            return false;
+        }
+
+        // Write large data directly to the stream
+        if (Size >= m_MaxChunkSize && pData == nullptr)
+            std::memset(m_ChunkStart, 0, m_MaxChunkSize);
+        while (Size >= m_MaxChunkSize)
+        {
+            if (m_IsValid)
+                m_IsValid = m_pStream->Write(pData != nullptr ? pData : m_ChunkStart, m_MaxChunkSize);
+            if (pData != nullptr)
+                pData += m_MaxChunkSize;
+            m_ChunkOffset += m_MaxChunkSize;
+            Size -= m_MaxChunkSize;
+        }
+        if (!m_IsValid)
+            return false;
+    }
+    else
+    {
+        // Chunks are never reallocated, so the data that has been written is not moved.
+        const size_t LastChunkSize = !m_Chunks.empty() ? m_Chunks.back().Size : 0;
+
+        Chunk NewChunk;
+        NewChunk.Offset = GetSize();
+        NewChunk.Size   = std::max(std::min(std::max(LastChunkSize * 2, MinChunkSize), m_MaxChunkSize), Size);
+        NewChunk.pData  = static_cast<Uint8*>(m_Allocator.Allocate(NewChunk.Size, "Serialization buffer chunk", __FILE__, __LINE__));
+        m_Chunks.emplace_back(NewChunk);
+
+        m_ChunkStart  = NewChunk.pData;
+        m_ChunkEnd    = NewChunk.pData + NewChunk.Size;
+        m_Ptr         = m_ChunkStart;
+        m_ChunkOffset = NewChunk.Offset;
+    }
+
+    VERIFY_EXPR(Size <= static_cast<size_t>(m_ChunkEnd - m_Ptr));
+    if (pData != nullptr)
+        std::memcpy(m_Ptr, pData, Size);
+    else
+        std::memset(m_Ptr, 0, Size);
+    m_Ptr += Size;
+
+    return true;
+}
+
+bool SerializationBuffer::Overwrite(size_t Offset, const void* pData, size_t Size)
+{
+    if (Offset + Size > GetSize())
+    {
+        UNEXPECTED("The range [", Offset, ", ", Offset + Size, ") has not been written yet");
+        return false;
+    }
+
+    const Uint8* pSrc = static_cast<const Uint8*>(pData);
+    if (m_pStream != nullptr)
+    {
+        // The part of the range that has already been written to the stream
+        if (Offset < m_ChunkOffset)
+        {
+            const size_t NumBytes = std::min(Size, m_ChunkOffset - Offset);
+            if (m_IsValid)
+            {
+                m_IsValid = (m_pStream->SetPos(m_StreamStart + Offset, static_cast<int>(FilePosOrigin::Start)) &&
+                             m_pStream->Write(pSrc, NumBytes) &&
+                             m_pStream->SetPos(m_StreamStart + m_ChunkOffset, static_cast<int>(FilePosOrigin::Start)));
+            }
+            pSrc += NumBytes;
+            Offset += NumBytes;
+            Size -= NumBytes;
+        }
+
+        if (Size != 0)
+            std::memcpy(m_ChunkStart + (Offset - m_ChunkOffset), pSrc, Size);
+
+        return m_IsValid;
+    }
+
+    // Find the first chunk that contains the range
+    auto chunk_it = std::upper_bound(m_Chunks.begin(), m_Chunks.end(), Offset,
+                                     [](size_t Offset, const Chunk& chunk) {
+                                         return Offset < chunk.Offset;
+                                     });
+    VERIFY_EXPR(chunk_it != m_Chunks.begin());
+    --chunk_it;
+    while (Size != 0)
+    {
+        VERIFY_EXPR(chunk_it != m_Chunks.end() && Offset >= chunk_it->Offset);
+        const size_t OffsetInChunk = Offset - chunk_it->Offset;
+        const size_t NumBytes      = std::min(Size, chunk_it->Size - OffsetInChunk);
+        std::memcpy(chunk_it->pData + OffsetInChunk, pSrc, NumBytes);
+        pSrc += NumBytes;
+        Offset += NumBytes;
+        Size -= NumBytes;
+        ++chunk_it;
+    }
+
+    return true;
+}
+
+void SerializationBuffer::CopyTo(void* pDst) const
+{
+    if (m_pStream != nullptr)
+    {
+        UNEXPECTED("The data has been written to the stream");
+        return;
+    }
+
+    const size_t TotalSize = GetSize();
+    for (const Chunk& chunk : m_Chunks)
+    {
+        if (chunk.Offset >= TotalSize)
+            break;
+        std::memcpy(static_cast<Uint8*>(pDst) + chunk.Offset, chunk.pData, std::min(chunk.Size, TotalSize - chunk.Offset));
+    }
+}
+
+SerializedData SerializationBuffer::GetData(IMemoryAllocator& Allocator) const
+{
+    SerializedData Data{GetSize(), Allocator};
+    if (Data)
+        CopyTo(Data.Ptr());
+    return Data;
+}
+
+bool SerializationBuffer::Flush()
+{
+    if (m_pStream == nullptr)
+    {
+        UNEXPECTED("The buffer does not write to a stream");
+        return false;
+    }
+
+    return m_ChunkStart != nullptr ? FlushChunk() : m_IsValid;
+}
+
 } // namespace Diligent
@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Builds a device object archive from a pipeline description file.
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ArchiverFactory.h"
+#include "RefCntAutoPtr.hpp"
+
+#include "PipelineDescFile.hpp"
+
+namespace Diligent
+{
+
+/// Archive builder settings
+struct ArchiveBuilderSettings
+{
+    /// Path to the pipeline description file.
+    std::string DescFilePath;
+
+    /// Path to the output archive.
+    std::string OutputPath;
+
+    /// Directory where per-pipeline archives are cached for incremental builds.
+    /// If empty, all pipelines are rebuilt every time.
+    std::string CacheDir;
+
+    /// Path to the pipeline usage trace written by IDearchiver::WriteUsageTrace()
+    /// or IRenderStateCache::WriteUsageTrace().
+    /// If not empty, only the pipelines recorded in the trace are built,
+    /// in the order of their first use.
+    std::string TracePath;
+
+    /// Additional shader search directories.
+    std::vector<std::string> ShaderDirs;
+
+    /// Devices for which the data will be serialized.
+    ARCHIVE_DEVICE_DATA_FLAGS DeviceFlags = ARCHIVE_DEVICE_DATA_FLAG_NONE;
+
+    /// The number of shader compilation threads.
+    /// 0xFFFFFFFF means that the number of threads is determined automatically.
+    Uint32 NumThreads = ~0u;
+
+    /// Archive content version.
+    Uint32 ContentVersion = 0;
+
+    /// Archive compression.
+    ARCHIVE_COMPRESSION Compression = ARCHIVE_COMPRESSION_NONE;
+};
+
+/// Compiles all pipelines and their permutations from the pipeline description file
+/// and writes them to the archive.
+///
+/// When the cache directory is specified, every pipeline permutation is serialized into
+/// its own archive that is stored in the cache together with the list of source files
+/// it depends on. Pipelines whose description and source files have not changed
+/// are loaded from the cache instead of being rebuilt.
+class ArchiveBuilder
+{
+public:
+    ArchiveBuilder(IArchiverFactory* pArchiverFactory, const ArchiveBuilderSettings& Settings);
+    ~ArchiveBuilder();
+
+    // clang-format off
+    ArchiveBuilder           (const ArchiveBuilder&)  = delete;
+    ArchiveBuilder           (      ArchiveBuilder&&) = delete;
+    ArchiveBuilder& operator=(const ArchiveBuilder&)  = delete;
+    ArchiveBuilder& operator=(      ArchiveBuilder&&) = delete;
+    // clang-format on
+
+    /// Builds the archive. Returns true on success and false otherwise.
+    bool Build();
+
+    struct StageStatistics
+    {
+        const char* Name = nullptr;
+
+        // Stage duration, in seconds
+        double Time = 0;
+
+        // The size of the data produced by the stage, in bytes
+        size_t Size = 0;
+    };
+
+    struct Statistics
+    {
+        std::vector<StageStatistics> Stages;
+
+        size_t NumPipelines        = 0;
+        size_t NumSkippedPipelines = 0; // Pipelines that are not in the usage trace
+        size_t NumBuiltPipelines   = 0;
+        size_t NumCachedPipelines  = 0;
+        size_t NumShaders          = 0;
+        size_t ArchiveSize         = 0;
+    };
+
+    const Statistics& GetStatistics() const { return m_Stats; }
+
+    /// Prints timing and size statistics of the last build.
+    void PrintStatistics(std::ostream& Stream) const;
+
+private:
+    struct ShaderVariant;
+    struct PipelineVariant;
+
+    template <typename HandlerType>
+    bool RunStage(const char* Name, HandlerType&& Handler);
+
+    bool ParseDescription();
+    bool ApplyTrace();
+    bool LookUpCache();
+    bool CompileShaders();
+    bool CreatePipelines();
+    bool SerializePipelines(StageStatistics& Stage);
+    bool MergePipelines(IDataBlob** ppArchive, StageStatistics& Stage);
+
+    size_t AddShaderVariant(const PipelineDescFile::Section& Section,
+                            SHADER_TYPE                      Stage,
+                            const std::vector<std::pair<std::string, std::string>>& PermutationMacros);
+
+    bool IsCacheEntryValid(const std::string& DepsPath) const;
+    bool WriteCacheEntry(const PipelineVariant& Pipeline) const;
+    std::string GetCachePath(const PipelineVariant& Pipeline, const char* Extension) const;
+
+private:
+    RefCntAutoPtr<IArchiverFactory>                m_pArchiverFactory;
+    const ArchiveBuilderSettings                   m_Settings;
+    RefCntAutoPtr<ISerializationDevice>            m_pDevice;
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pSourceFactory;
+
+    PipelineDescFile         m_DescFile;
+    std::vector<std::string> m_SearchDirs;
+
+    std::vector<std::unique_ptr<ShaderVariant>>   m_Shaders;
+    std::unordered_map<std::string, size_t>       m_ShaderVariantToIdx;
+    std::vector<std::unique_ptr<PipelineVariant>> m_Pipelines;
+
+    Statistics m_Stats;
+};
+
+} // namespace Diligent
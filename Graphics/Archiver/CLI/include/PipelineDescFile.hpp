@@ -0,0 +1,79 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Parser of the pipeline description files used by the archiver command-line tool.
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace Diligent
+{
+
+/// Pipeline description file.
+
+/// The file consists of sections that start with a header in square brackets
+/// followed by `Key = Value` lines:
+///
+///     # Comment
+///     [Shader BasicVS]
+///     File = Basic.vsh
+///     Type = Vertex
+///
+/// The header contains the section type and an optional section name.
+struct PipelineDescFile
+{
+    struct Section
+    {
+        std::string Type;
+        std::string Name;
+
+        // Key-value pairs in the order they appear in the file
+        std::vector<std::pair<std::string, std::string>> Values;
+
+        // Line number of the section header, for diagnostics
+        size_t Line = 0;
+
+        // Returns the value of the key or null if the key is not present.
+        // Keys are case-insensitive.
+        const std::string* Find(const char* Key) const;
+    };
+
+    std::vector<Section> Sections;
+
+    /// Parses the pipeline description text.
+    ///
+    /// \param [in] Text     - Description text.
+    /// \param [in] FileName - File name used in error messages.
+    /// \return     true if the text was parsed successfully, and false otherwise.
+    bool Parse(const std::string& Text, const char* FileName);
+};
+
+} // namespace Diligent
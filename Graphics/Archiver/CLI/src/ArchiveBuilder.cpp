@@ -0,0 +1,1346 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ArchiveBuilder.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+#include "Archiver.h"
+#include "SerializationDevice.h"
+
+#include "BasicFileStream.hpp"
+#include "DataBlobImpl.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "GraphicsAccessories.hpp"
+#include "ObjectBase.hpp"
+#include "PipelineUsageTrace.hpp"
+#include "StringTools.hpp"
+#include "Timer.hpp"
+#include "XXH128Hasher.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Change the tag whenever the cache format or the way pipelines are built changes
+// to invalidate existing cache entries.
+constexpr char CacheVersionTag[] = "ArchiverCLI cache 1";
+
+using Section   = PipelineDescFile::Section;
+using MacroList = std::vector<std::pair<std::string, std::string>>;
+
+struct ShaderStageInfo
+{
+    const char* Key;
+    SHADER_TYPE Type;
+};
+
+// clang-format off
+constexpr ShaderStageInfo GraphicsStages[] =
+{
+    {"VS", SHADER_TYPE_VERTEX},
+    {"PS", SHADER_TYPE_PIXEL},
+    {"GS", SHADER_TYPE_GEOMETRY},
+    {"HS", SHADER_TYPE_HULL},
+    {"DS", SHADER_TYPE_DOMAIN},
+    {"AS", SHADER_TYPE_AMPLIFICATION},
+    {"MS", SHADER_TYPE_MESH},
+};
+
+constexpr ShaderStageInfo ComputeStages[] =
+{
+    {"CS", SHADER_TYPE_COMPUTE},
+};
+
+// clang-format on
+
+/// Shader source stream factory that records the names of all files it opens.
+class DependencyRecorder final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    using TBase = ObjectBase<IShaderSourceInputStreamFactory>;
+
+    DependencyRecorder(IReferenceCounters* pRefCounters, IShaderSourceInputStreamFactory* pFactory) :
+        TBase{pRefCounters},
+        m_pFactory{pFactory}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char*   Name,
+                                                      IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        m_pFactory->CreateInputStream2(Name, Flags, ppStream);
+        if (*ppStream != nullptr)
+        {
+            // Shaders may be compiled asynchronously
+            std::lock_guard<std::mutex> Lock{m_FilesMtx};
+            m_Files.emplace(Name);
+        }
+    }
+
+    std::set<std::string> GetFiles() const
+    {
+        std::lock_guard<std::mutex> Lock{m_FilesMtx};
+        return m_Files;
+    }
+
+private:
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pFactory;
+
+    mutable std::mutex    m_FilesMtx;
+    std::set<std::string> m_Files;
+};
+
+std::string HashToString(const XXH128Hash& Hash)
+{
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0') << std::setw(16) << Hash.HighPart << std::setw(16) << Hash.LowPart;
+    return ss.str();
+}
+
+// Returns the hash of the source file contents or an empty string if the file is not found
+std::string HashSourceFile(IShaderSourceInputStreamFactory* pFactory, const char* Name)
+{
+    RefCntAutoPtr<IFileStream> pStream;
+    pFactory->CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pStream);
+    if (!pStream)
+        return {};
+
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create();
+    pStream->ReadBlob(pData);
+
+    XXH128State Hasher;
+    Hasher.UpdateRaw(pData->GetConstDataPtr(), pData->GetSize());
+    return HashToString(Hasher.Digest());
+}
+
+void HashSection(XXH128State& Hasher, const Section& Sec)
+{
+    Hasher.Update(Sec.Type, Sec.Name);
+    for (const auto& KeyValue : Sec.Values)
+        Hasher.Update(StrToLower(KeyValue.first), KeyValue.second);
+}
+
+std::vector<std::string> SplitList(const std::string& Str, const char* Delimiters = " \t,")
+{
+    return SplitString(Str.begin(), Str.end(), Delimiters);
+}
+
+bool ParseBool(const std::string& Str, bool& Value)
+{
+    if (StrCmpNoCase(Str.c_str(), "true") == 0 || StrCmpNoCase(Str.c_str(), "yes") == 0 || Str == "1")
+        Value = true;
+    else if (StrCmpNoCase(Str.c_str(), "false") == 0 || StrCmpNoCase(Str.c_str(), "no") == 0 || Str == "0")
+        Value = false;
+    else
+        return false;
+    return true;
+}
+
+// Matches the string against the full enum name (e.g. CULL_MODE_BACK) or the name without the prefix (e.g. Back)
+bool MatchEnumName(const std::string& Str, const char* FullName, const char* Prefix)
+{
+    if (StrCmpNoCase(Str.c_str(), FullName) == 0)
+        return true;
+
+    const size_t PrefixLen = strlen(Prefix);
+    if (strncmp(FullName, Prefix, PrefixLen) != 0)
+        return false;
+
+    // Ignore underscores so that e.g. 'TriangleList' matches 'TRIANGLE_LIST'
+    const char* Name = FullName + PrefixLen;
+    size_t      Pos  = 0;
+    for (; *Name != '\0'; ++Name)
+    {
+        if (*Name == '_')
+            continue;
+        if (Pos >= Str.length() || std::tolower(static_cast<unsigned char>(Str[Pos])) != std::tolower(static_cast<unsigned char>(*Name)))
+            return false;
+        ++Pos;
+    }
+    return Pos == Str.length();
+}
+
+bool ParseShaderType(const std::string& Str, SHADER_TYPE& Type)
+{
+    for (Int32 i = 0; i <= GetShaderTypeIndex(SHADER_TYPE_LAST); ++i)
+    {
+        const SHADER_TYPE ShaderType = GetShaderTypeFromIndex(i);
+        if (MatchEnumName(Str, GetShaderTypeLiteralName(ShaderType), "SHADER_TYPE_"))
+        {
+            Type = ShaderType;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParseTextureFormat(const std::string& Str, TEXTURE_FORMAT& Format)
+{
+    for (Uint32 Fmt = TEX_FORMAT_UNKNOWN; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
+    {
+        const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(static_cast<TEXTURE_FORMAT>(Fmt));
+        if (MatchEnumName(Str, FmtAttribs.Name, "TEX_FORMAT_"))
+        {
+            Format = FmtAttribs.Format;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParseCullMode(const std::string& Str, CULL_MODE& Mode)
+{
+    for (Uint32 i = CULL_MODE_NONE; i < CULL_MODE_NUM_MODES; ++i)
+    {
+        if (MatchEnumName(Str, GetCullModeLiteralName(static_cast<CULL_MODE>(i), /*GetEnumString = */ true), "CULL_MODE_"))
+        {
+            Mode = static_cast<CULL_MODE>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParseVariableType(const std::string& Str, SHADER_RESOURCE_VARIABLE_TYPE& Type)
+{
+    for (Uint32 i = 0; i < SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES; ++i)
+    {
+        if (MatchEnumName(Str, GetShaderVariableTypeLiteralName(static_cast<SHADER_RESOURCE_VARIABLE_TYPE>(i), /*bGetFullName = */ true), "SHADER_RESOURCE_VARIABLE_TYPE_"))
+        {
+            Type = static_cast<SHADER_RESOURCE_VARIABLE_TYPE>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParseTopology(const std::string& Str, PRIMITIVE_TOPOLOGY& Topology)
+{
+    static_assert(PRIMITIVE_TOPOLOGY_NUM_TOPOLOGIES == 42, "Please update the table below to handle the new primitive topology");
+    // clang-format off
+    static constexpr std::pair<const char*, PRIMITIVE_TOPOLOGY> Topologies[] =
+    {
+        {"PRIMITIVE_TOPOLOGY_TRIANGLE_LIST",      PRIMITIVE_TOPOLOGY_TRIANGLE_LIST},
+        {"PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP",     PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP},
+        {"PRIMITIVE_TOPOLOGY_POINT_LIST",         PRIMITIVE_TOPOLOGY_POINT_LIST},
+        {"PRIMITIVE_TOPOLOGY_LINE_LIST",          PRIMITIVE_TOPOLOGY_LINE_LIST},
+        {"PRIMITIVE_TOPOLOGY_LINE_STRIP",         PRIMITIVE_TOPOLOGY_LINE_STRIP},
+        {"PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_ADJ",  PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_ADJ},
+        {"PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ", PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ},
+        {"PRIMITIVE_TOPOLOGY_LINE_LIST_ADJ",      PRIMITIVE_TOPOLOGY_LINE_LIST_ADJ},
+        {"PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ",     PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ},
+    };
+    // clang-format on
+    for (const auto& Topo : Topologies)
+    {
+        if (MatchEnumName(Str, Topo.first, "PRIMITIVE_TOPOLOGY_"))
+        {
+            Topology = Topo.second;
+            return true;
+        }
+    }
+
+    // Patch lists: PatchList1 ... PatchList32
+    static constexpr char PatchListPrefix[] = "PatchList";
+    if (StrCmpNoCase(Str.c_str(), PatchListPrefix, sizeof(PatchListPrefix) - 1) == 0)
+    {
+        const int NumControlPoints = std::atoi(Str.c_str() + sizeof(PatchListPrefix) - 1);
+        if (NumControlPoints >= 1 && NumControlPoints <= 32)
+        {
+            Topology = static_cast<PRIMITIVE_TOPOLOGY>(PRIMITIVE_TOPOLOGY_1_CONTROL_POINT_PATCHLIST + NumControlPoints - 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParseSourceLanguage(const std::string& Str, SHADER_SOURCE_LANGUAGE& Language)
+{
+    static_assert(SHADER_SOURCE_LANGUAGE_COUNT == 8, "Please update the table below to handle the new shader source language");
+    // clang-format off
+    static constexpr std::pair<const char*, SHADER_SOURCE_LANGUAGE> Languages[] =
+    {
+        {"SHADER_SOURCE_LANGUAGE_DEFAULT",       SHADER_SOURCE_LANGUAGE_DEFAULT},
+        {"SHADER_SOURCE_LANGUAGE_HLSL",          SHADER_SOURCE_LANGUAGE_HLSL},
+        {"SHADER_SOURCE_LANGUAGE_GLSL",          SHADER_SOURCE_LANGUAGE_GLSL},
+        {"SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM", SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM},
+        {"SHADER_SOURCE_LANGUAGE_MSL",           SHADER_SOURCE_LANGUAGE_MSL},
+        {"SHADER_SOURCE_LANGUAGE_MSL_VERBATIM",  SHADER_SOURCE_LANGUAGE_MSL_VERBATIM},
+        {"SHADER_SOURCE_LANGUAGE_MTLB",          SHADER_SOURCE_LANGUAGE_MTLB},
+        {"SHADER_SOURCE_LANGUAGE_WGSL",          SHADER_SOURCE_LANGUAGE_WGSL},
+    };
+    // clang-format on
+    for (const auto& Lang : Languages)
+    {
+        if (MatchEnumName(Str, Lang.first, "SHADER_SOURCE_LANGUAGE_"))
+        {
+            Language = Lang.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Parses an input layout element such as 'Float32x3', 'Uint8x4n' or 'Float32x2@1',
+// where 'n' marks normalized values and '@' specifies the buffer slot.
+bool ParseLayoutElement(const std::string& Str, Uint32 InputIndex, LayoutElement& Elem)
+{
+    // clang-format off
+    static constexpr std::pair<const char*, VALUE_TYPE> ValueTypes[] =
+    {
+        {"Int8",    VT_INT8},
+        {"Int16",   VT_INT16},
+        {"Int32",   VT_INT32},
+        {"Uint8",   VT_UINT8},
+        {"Uint16",  VT_UINT16},
+        {"Uint32",  VT_UINT32},
+        {"Float16", VT_FLOAT16},
+        {"Float32", VT_FLOAT32},
+    };
+    // clang-format on
+
+    const size_t XPos = Str.find('x');
+    if (XPos == std::string::npos)
+        return false;
+
+    Elem            = LayoutElement{};
+    Elem.InputIndex = InputIndex;
+
+    const std::string TypeStr = Str.substr(0, XPos);
+    Elem.ValueType            = VT_UNDEFINED;
+    for (const auto& VT : ValueTypes)
+    {
+        if (StrCmpNoCase(TypeStr.c_str(), VT.first) == 0)
+            Elem.ValueType = VT.second;
+    }
+    if (Elem.ValueType == VT_UNDEFINED)
+        return false;
+
+    const char* Ptr = Str.c_str() + XPos + 1;
+    if (*Ptr < '1' || *Ptr > '4')
+        return false;
+    Elem.NumComponents = static_cast<Uint32>(*Ptr++ - '0');
+
+    Elem.IsNormalized = false;
+    if (*Ptr == 'n')
+    {
+        Elem.IsNormalized = true;
+        ++Ptr;
+    }
+
+    if (*Ptr == '@')
+    {
+        ++Ptr;
+        if (*Ptr < '0' || *Ptr > '9')
+            return false;
+        Elem.BufferSlot = static_cast<Uint32>(std::atoi(Ptr));
+        while (*Ptr >= '0' && *Ptr <= '9')
+            ++Ptr;
+    }
+
+    return *Ptr == '\0';
+}
+
+// Parses a space-separated list of macros, e.g. 'USE_FOG=1 MAX_LIGHTS=4'.
+// Macros without a value are defined as 1.
+MacroList ParseMacros(const std::string& Str)
+{
+    MacroList Macros;
+    for (const std::string& Macro : SplitList(Str, " \t"))
+    {
+        const size_t EqualPos = Macro.find('=');
+        if (EqualPos == std::string::npos)
+            Macros.emplace_back(Macro, "1");
+        else
+            Macros.emplace_back(Macro.substr(0, EqualPos), Macro.substr(EqualPos + 1));
+    }
+    return Macros;
+}
+
+// Parses the permutation list, e.g. 'USE_FOG=0,1 USE_SHADOWS=0,1', and returns
+// the macros of all permutations (the Cartesian product of macro values).
+bool ParsePermutations(const std::string& Str, std::vector<MacroList>& Permutations)
+{
+    Permutations = {MacroList{}};
+    for (const std::string& Macro : SplitList(Str, " \t"))
+    {
+        const size_t EqualPos = Macro.find('=');
+        if (EqualPos == std::string::npos || EqualPos == 0)
+            return false;
+
+        const std::string              Name   = Macro.substr(0, EqualPos);
+        const std::vector<std::string> Values = SplitList(Macro.substr(EqualPos + 1), ",");
+        if (Values.empty())
+            return false;
+
+        std::vector<MacroList> NewPermutations;
+        NewPermutations.reserve(Permutations.size() * Values.size());
+        for (const MacroList& Permutation : Permutations)
+        {
+            for (const std::string& Value : Values)
+            {
+                NewPermutations.emplace_back(Permutation);
+                NewPermutations.back().emplace_back(Name, Value);
+            }
+        }
+        Permutations = std::move(NewPermutations);
+    }
+    return true;
+}
+
+// Returns the name of the object permutation, e.g. 'Name(USE_FOG=0,USE_SHADOWS=1)'
+std::string GetVariantName(const std::string& Name, const MacroList& Macros)
+{
+    if (Macros.empty())
+        return Name;
+
+    std::string VariantName = Name + '(';
+    for (size_t i = 0; i < Macros.size(); ++i)
+    {
+        if (i > 0)
+            VariantName += ',';
+        VariantName += Macros[i].first + '=' + Macros[i].second;
+    }
+    VariantName += ')';
+    return VariantName;
+}
+
+void CheckKeys(const Section& Sec, const std::vector<const char*>& KnownKeys, const char* FileName)
+{
+    for (const auto& KeyValue : Sec.Values)
+    {
+        const bool IsKnown = std::any_of(KnownKeys.begin(), KnownKeys.end(), [&KeyValue](const char* Key) {
+            return StrCmpNoCase(KeyValue.first.c_str(), Key) == 0;
+        });
+        if (!IsKnown)
+            LOG_WARNING_MESSAGE(FileName, '(', Sec.Line, "): unknown key '", KeyValue.first, "' in section [", Sec.Type, ' ', Sec.Name, "] is ignored");
+    }
+}
+
+} // namespace
+
+struct ArchiveBuilder::ShaderVariant
+{
+    const Section* pSection = nullptr;
+
+    std::string Name;
+    std::string FilePath;
+    std::string EntryPoint = "main";
+
+    SHADER_TYPE            Type                       = SHADER_TYPE_UNKNOWN;
+    SHADER_SOURCE_LANGUAGE Language                   = SHADER_SOURCE_LANGUAGE_DEFAULT;
+    bool                   UseCombinedTextureSamplers = false;
+
+    MacroList                Macros;
+    std::vector<ShaderMacro> ShaderMacros;
+
+    RefCntAutoPtr<DependencyRecorder> pRecorder;
+    RefCntAutoPtr<IShader>            pShader;
+};
+
+struct ArchiveBuilder::PipelineVariant
+{
+    const Section* pSection = nullptr;
+
+    std::string Name;
+    MacroList   Macros;
+
+    PIPELINE_TYPE Type = PIPELINE_TYPE_GRAPHICS;
+
+    // Shader stages and indices of shader variants in m_Shaders
+    std::vector<std::pair<SHADER_TYPE, size_t>> Shaders;
+
+    GraphicsPipelineDesc                    GraphicsPipeline;
+    std::vector<LayoutElement>              LayoutElements;
+    SHADER_RESOURCE_VARIABLE_TYPE           DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+    std::vector<std::string>                VariableNames;
+    std::vector<ShaderResourceVariableDesc> Variables;
+
+    // Hash of everything the pipeline is built from except the source files
+    XXH128Hash Key;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+
+    // Archive that contains the pipeline only
+    RefCntAutoPtr<IDataBlob> pArchive;
+};
+
+ArchiveBuilder::ArchiveBuilder(IArchiverFactory* pArchiverFactory, const ArchiveBuilderSettings& Settings) :
+    m_pArchiverFactory{pArchiverFactory},
+    m_Settings{Settings}
+{
+}
+
+ArchiveBuilder::~ArchiveBuilder()
+{
+}
+
+template <typename HandlerType>
+bool ArchiveBuilder::RunStage(const char* Name, HandlerType&& Handler)
+{
+    StageStatistics Stage;
+    Stage.Name = Name;
+
+    Timer      StageTimer;
+    const bool Result = Handler(Stage);
+    Stage.Time        = StageTimer.GetElapsedTime();
+
+    m_Stats.Stages.emplace_back(Stage);
+    if (!Result)
+        LOG_ERROR_MESSAGE("Archive build failed at stage '", Name, "'.");
+
+    return Result;
+}
+
+bool ArchiveBuilder::Build()
+{
+    m_Stats = {};
+    m_Shaders.clear();
+    m_ShaderVariantToIdx.clear();
+    m_Pipelines.clear();
+
+    if (!RunStage("Parse", [this](StageStatistics&) { return ParseDescription(); }))
+        return false;
+
+    if (!m_Settings.TracePath.empty())
+    {
+        if (!RunStage("Trace", [this](StageStatistics&) { return ApplyTrace(); }))
+            return false;
+    }
+
+    if (!RunStage("Cache lookup", [this](StageStatistics&) { return LookUpCache(); }))
+        return false;
+
+    if (m_Stats.NumBuiltPipelines > 0)
+    {
+        if (!RunStage("Shader compilation", [this](StageStatistics&) { return CompileShaders(); }))
+            return false;
+
+        if (!RunStage("Pipeline creation", [this](StageStatistics&) { return CreatePipelines(); }))
+            return false;
+    }
+
+    const bool UseCache = !m_Settings.CacheDir.empty();
+    if (!UseCache && m_Settings.Compression == ARCHIVE_COMPRESSION_NONE)
+    {
+        // Write the archive directly to the file
+        return RunStage("Serialization", [this](StageStatistics& Stage) {
+            RefCntAutoPtr<IArchiver> pArchiver;
+            m_pArchiverFactory->CreateArchiver(m_pDevice, &pArchiver);
+            if (!pArchiver)
+                return false;
+
+            for (const auto& pPipeline : m_Pipelines)
+            {
+                if (!pArchiver->AddPipelineState(pPipeline->pPSO))
+                    return false;
+            }
+
+            RefCntAutoPtr<BasicFileStream> pStream = BasicFileStream::Create(m_Settings.OutputPath.c_str(), EFileAccessMode::Overwrite);
+            if (!pStream->IsValid())
+            {
+                LOG_ERROR_MESSAGE("Failed to open output file '", m_Settings.OutputPath, "'.");
+                return false;
+            }
+            if (!pArchiver->SerializeToStream(m_Settings.ContentVersion, pStream))
+                return false;
+
+            Stage.Size = m_Stats.ArchiveSize = pStream->GetSize();
+            return true;
+        });
+    }
+
+    RefCntAutoPtr<IDataBlob> pArchive;
+    if (UseCache)
+    {
+        if (!RunStage("Serialization", [this](StageStatistics& Stage) { return SerializePipelines(Stage); }))
+            return false;
+
+        if (!RunStage("Merge", [&](StageStatistics& Stage) { return MergePipelines(&pArchive, Stage); }))
+            return false;
+    }
+    else
+    {
+        if (!RunStage("Serialization", [&](StageStatistics& Stage) {
+                RefCntAutoPtr<IArchiver> pArchiver;
+                m_pArchiverFactory->CreateArchiver(m_pDevice, &pArchiver);
+                if (!pArchiver)
+                    return false;
+
+                for (const auto& pPipeline : m_Pipelines)
+                {
+                    if (!pArchiver->AddPipelineState(pPipeline->pPSO))
+                        return false;
+                }
+
+                if (!pArchiver->SerializeToBlob(m_Settings.ContentVersion, &pArchive))
+                    return false;
+
+                Stage.Size = pArchive->GetSize();
+                return true;
+            }))
+            return false;
+    }
+
+    if (m_Settings.Compression != ARCHIVE_COMPRESSION_NONE)
+    {
+        if (!RunStage("Compression", [&](StageStatistics& Stage) {
+                RefCntAutoPtr<IDataBlob> pCompressedArchive;
+                if (!m_pArchiverFactory->CompressArchive(pArchive, m_Settings.Compression, &pCompressedArchive))
+                    return false;
+
+                pArchive   = std::move(pCompressedArchive);
+                Stage.Size = pArchive->GetSize();
+                return true;
+            }))
+            return false;
+    }
+
+    return RunStage("Write", [&](StageStatistics& Stage) {
+        if (!FileWrapper::WriteFile(m_Settings.OutputPath.c_str(), pArchive->GetConstDataPtr(), pArchive->GetSize()))
+            return false;
+
+        Stage.Size = m_Stats.ArchiveSize = pArchive->GetSize();
+        return true;
+    });
+}
+
+size_t ArchiveBuilder::AddShaderVariant(const Section& ShaderSection, SHADER_TYPE Stage, const MacroList& PermutationMacros)
+{
+    MacroList Macros;
+    if (const std::string* pMacros = ShaderSection.Find("Macros"))
+        Macros = ParseMacros(*pMacros);
+    Macros.insert(Macros.end(), PermutationMacros.begin(), PermutationMacros.end());
+
+    // The same shader may be used by several pipelines and permutations, but is only compiled once
+    std::string Name = GetVariantName(ShaderSection.Name, PermutationMacros);
+
+    auto it_inserted = m_ShaderVariantToIdx.emplace(Name, m_Shaders.size());
+    if (!it_inserted.second)
+    {
+        const ShaderVariant& Shader = *m_Shaders[it_inserted.first->second];
+        if (Shader.Type != Stage)
+        {
+            LOG_ERROR_MESSAGE(m_Settings.DescFilePath, '(', ShaderSection.Line, "): shader '", ShaderSection.Name, "' is used as both ",
+                              GetShaderTypeLiteralName(Shader.Type), " and ", GetShaderTypeLiteralName(Stage));
+            return ~size_t{0};
+        }
+        return it_inserted.first->second;
+    }
+
+    std::unique_ptr<ShaderVariant> pShader = std::make_unique<ShaderVariant>();
+    pShader->pSection                      = &ShaderSection;
+    pShader->Name                          = std::move(Name);
+    pShader->Type                          = Stage;
+    pShader->Macros                        = std::move(Macros);
+
+    auto ReportError = [&](const char* Key, const std::string& Value) {
+        LOG_ERROR_MESSAGE(m_Settings.DescFilePath, '(', ShaderSection.Line, "): invalid value '", Value, "' of key '", Key, "' in shader '", ShaderSection.Name, "'");
+        m_ShaderVariantToIdx.erase(pShader->Name);
+        return ~size_t{0};
+    };
+
+    if (const std::string* pFile = ShaderSection.Find("File"))
+        pShader->FilePath = *pFile;
+    if (pShader->FilePath.empty())
+        return ReportError("File", "");
+
+    if (const std::string* pType = ShaderSection.Find("Type"))
+    {
+        SHADER_TYPE Type = SHADER_TYPE_UNKNOWN;
+        if (!ParseShaderType(*pType, Type))
+            return ReportError("Type", *pType);
+        if (Type != Stage)
+        {
+            LOG_ERROR_MESSAGE(m_Settings.DescFilePath, '(', ShaderSection.Line, "): ", GetShaderTypeLiteralName(Type), " '", ShaderSection.Name,
+                              "' can't be used as ", GetShaderTypeLiteralName(Stage));
+            m_ShaderVariantToIdx.erase(pShader->Name);
+            return ~size_t{0};
+        }
+    }
+
+    if (const std::string* pEntry = ShaderSection.Find("Entry"))
+        pShader->EntryPoint = *pEntry;
+
+    if (const std::string* pLanguage = ShaderSection.Find("Language"))
+    {
+        if (!ParseSourceLanguage(*pLanguage, pShader->Language))
+            return ReportError("Language", *pLanguage);
+    }
+
+    if (const std::string* pCombinedSamplers = ShaderSection.Find("CombinedSamplers"))
+    {
+        if (!ParseBool(*pCombinedSamplers, pShader->UseCombinedTextureSamplers))
+            return ReportError("CombinedSamplers", *pCombinedSamplers);
+    }
+
+    pShader->ShaderMacros.reserve(pShader->Macros.size());
+    for (const auto& Macro : pShader->Macros)
+        pShader->ShaderMacros.emplace_back(Macro.first.c_str(), Macro.second.c_str());
+
+    m_Shaders.emplace_back(std::move(pShader));
+    return m_Shaders.size() - 1;
+}
+
+bool ArchiveBuilder::ParseDescription()
+{
+    const char* DescFilePath = m_Settings.DescFilePath.c_str();
+
+    std::vector<Uint8> Data;
+    if (!FileWrapper::ReadWholeFile(DescFilePath, Data))
+        return false;
+
+    if (!m_DescFile.Parse(std::string{Data.begin(), Data.end()}, DescFilePath))
+        return false;
+
+    // Shader files are searched relative to the description file first
+    std::string DescDir;
+    FileSystem::GetPathComponents(m_Settings.DescFilePath, &DescDir, nullptr);
+
+    m_SearchDirs.clear();
+    if (!DescDir.empty())
+        m_SearchDirs.emplace_back(DescDir);
+
+    std::unordered_map<std::string, const Section*> ShaderSections;
+    std::vector<const Section*>                     PipelineSections;
+    for (const Section& Sec : m_DescFile.Sections)
+    {
+        if (StrCmpNoCase(Sec.Type.c_str(), "Options") == 0)
+        {
+            CheckKeys(Sec, {"ShaderDirs"}, DescFilePath);
+
+            if (const std::string* pShaderDirs = Sec.Find("ShaderDirs"))
+            {
+                for (const std::string& Dir : SplitList(*pShaderDirs, ";"))
+                {
+                    if (FileSystem::IsPathAbsolute(Dir.c_str()) || DescDir.empty())
+                        m_SearchDirs.emplace_back(Dir);
+                    else
+                        m_SearchDirs.emplace_back(DescDir + FileSystem::SlashSymbol + Dir);
+                }
+            }
+        }
+        else if (StrCmpNoCase(Sec.Type.c_str(), "Shader") == 0)
+        {
+            CheckKeys(Sec, {"File", "Type", "Entry", "Language", "Macros", "CombinedSamplers"}, DescFilePath);
+            if (Sec.Name.empty() || !ShaderSections.emplace(Sec.Name, &Sec).second)
+            {
+                LOG_ERROR_MESSAGE(DescFilePath, '(', Sec.Line, "): shader name must be unique and not empty");
+                return false;
+            }
+        }
+        else if (StrCmpNoCase(Sec.Type.c_str(), "GraphicsPipeline") == 0)
+        {
+            std::vector<const char*> Keys = {"Permutations", "DefaultVariableType", "Variables", "RTVFormats", "DSVFormat",
+                                             "Topology", "CullMode", "FrontCCW", "DepthEnable", "DepthWrite", "InputLayout"};
+            for (const ShaderStageInfo& Stage : GraphicsStages)
+                Keys.emplace_back(Stage.Key);
+            CheckKeys(Sec, Keys, DescFilePath);
+            PipelineSections.emplace_back(&Sec);
+        }
+        else if (StrCmpNoCase(Sec.Type.c_str(), "ComputePipeline") == 0)
+        {
+            CheckKeys(Sec, {"Permutations", "DefaultVariableType", "Variables", ComputeStages[0].Key}, DescFilePath);
+            PipelineSections.emplace_back(&Sec);
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE(DescFilePath, '(', Sec.Line, "): unknown section type '", Sec.Type, "'");
+            return false;
+        }
+    }
+
+    for (const std::string& Dir : m_Settings.ShaderDirs)
+        m_SearchDirs.emplace_back(Dir);
+
+    std::string SearchDirs;
+    for (const std::string& Dir : m_SearchDirs)
+        SearchDirs += Dir + ';';
+    m_pArchiverFactory->CreateDefaultShaderSourceStreamFactory(SearchDirs.c_str(), &m_pSourceFactory);
+    if (!m_pSourceFactory)
+        return false;
+
+    std::set<std::string> PipelineNames;
+    for (const Section* pSection : PipelineSections)
+    {
+        const Section& Sec        = *pSection;
+        const bool     IsCompute  = StrCmpNoCase(Sec.Type.c_str(), "ComputePipeline") == 0;
+        auto           ReportError = [&](const char* Key, const std::string& Value) {
+            LOG_ERROR_MESSAGE(DescFilePath, '(', Sec.Line, "): invalid value '", Value, "' of key '", Key, "' in pipeline '", Sec.Name, "'");
+            return false;
+        };
+
+        if (Sec.Name.empty() || !PipelineNames.emplace(Sec.Name).second)
+        {
+            LOG_ERROR_MESSAGE(DescFilePath, '(', Sec.Line, "): pipeline name must be unique and not empty");
+            return false;
+        }
+
+        std::vector<MacroList> Permutations{MacroList{}};
+        if (const std::string* pPermutations = Sec.Find("Permutations"))
+        {
+            if (!ParsePermutations(*pPermutations, Permutations))
+                return ReportError("Permutations", *pPermutations);
+        }
+
+        // Attributes shared by all permutations
+        PipelineVariant Attribs;
+        Attribs.pSection = pSection;
+        Attribs.Type     = IsCompute ? PIPELINE_TYPE_COMPUTE : PIPELINE_TYPE_GRAPHICS;
+
+        if (const std::string* pVarType = Sec.Find("DefaultVariableType"))
+        {
+            if (!ParseVariableType(*pVarType, Attribs.DefaultVariableType))
+                return ReportError("DefaultVariableType", *pVarType);
+        }
+
+        // Variables are specified as 'Name:Type', e.g. 'g_Texture:Mutable'
+        if (const std::string* pVariables = Sec.Find("Variables"))
+        {
+            for (const std::string& Var : SplitList(*pVariables))
+            {
+                const size_t ColonPos = Var.find(':');
+                if (ColonPos == std::string::npos || ColonPos == 0)
+                    return ReportError("Variables", Var);
+
+                SHADER_RESOURCE_VARIABLE_TYPE VarType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+                if (!ParseVariableType(Var.substr(ColonPos + 1), VarType))
+                    return ReportError("Variables", Var);
+
+                Attribs.VariableNames.emplace_back(Var.substr(0, ColonPos));
+                Attribs.Variables.emplace_back(SHADER_TYPE_ALL_GRAPHICS | SHADER_TYPE_COMPUTE, nullptr, VarType);
+            }
+        }
+
+        if (!IsCompute)
+        {
+            GraphicsPipelineDesc& GraphicsPipeline = Attribs.GraphicsPipeline;
+
+            if (const std::string* pRTVFormats = Sec.Find("RTVFormats"))
+            {
+                for (const std::string& Fmt : SplitList(*pRTVFormats))
+                {
+                    if (GraphicsPipeline.NumRenderTargets >= DILIGENT_MAX_RENDER_TARGETS || !ParseTextureFormat(Fmt, GraphicsPipeline.RTVFormats[GraphicsPipeline.NumRenderTargets]))
+                        return ReportError("RTVFormats", Fmt);
+                    ++GraphicsPipeline.NumRenderTargets;
+                }
+            }
+
+            if (const std::string* pDSVFormat = Sec.Find("DSVFormat"))
+            {
+                if (!ParseTextureFormat(*pDSVFormat, GraphicsPipeline.DSVFormat))
+                    return ReportError("DSVFormat", *pDSVFormat);
+            }
+
+            if (const std::string* pTopology = Sec.Find("Topology"))
+            {
+                if (!ParseTopology(*pTopology, GraphicsPipeline.PrimitiveTopology))
+                    return ReportError("Topology", *pTopology);
+            }
+
+            if (const std::string* pCullMode = Sec.Find("CullMode"))
+            {
+                if (!ParseCullMode(*pCullMode, GraphicsPipeline.RasterizerDesc.CullMode))
+                    return ReportError("CullMode", *pCullMode);
+            }
+
+            struct BoolKey
+            {
+                const char* Key;
+                Bool&       Value;
+            };
+            const BoolKey BoolKeys[] = {
+                {"FrontCCW", GraphicsPipeline.RasterizerDesc.FrontCounterClockwise},
+                {"DepthEnable", GraphicsPipeline.DepthStencilDesc.DepthEnable},
+                {"DepthWrite", GraphicsPipeline.DepthStencilDesc.DepthWriteEnable},
+            };
+            for (const BoolKey& Key : BoolKeys)
+            {
+                if (const std::string* pValue = Sec.Find(Key.Key))
+                {
+                    bool Value = false;
+                    if (!ParseBool(*pValue, Value))
+                        return ReportError(Key.Key, *pValue);
+                    Key.Value = Value;
+                }
+            }
+
+            if (const std::string* pInputLayout = Sec.Find("InputLayout"))
+            {
+                for (const std::string& ElemStr : SplitList(*pInputLayout))
+                {
+                    LayoutElement Elem;
+                    if (!ParseLayoutElement(ElemStr, static_cast<Uint32>(Attribs.LayoutElements.size()), Elem))
+                        return ReportError("InputLayout", ElemStr);
+                    Attribs.LayoutElements.emplace_back(Elem);
+                }
+            }
+        }
+
+        for (const MacroList& Permutation : Permutations)
+        {
+            std::unique_ptr<PipelineVariant> pPipeline = std::make_unique<PipelineVariant>(Attribs);
+            pPipeline->Name                            = GetVariantName(Sec.Name, Permutation);
+            pPipeline->Macros                          = Permutation;
+
+            const ShaderStageInfo* Stages    = IsCompute ? ComputeStages : GraphicsStages;
+            const size_t           NumStages = IsCompute ? _countof(ComputeStages) : _countof(GraphicsStages);
+            for (size_t s = 0; s < NumStages; ++s)
+            {
+                const std::string* pShaderName = Sec.Find(Stages[s].Key);
+                if (pShaderName == nullptr)
+                    continue;
+
+                auto shader_it = ShaderSections.find(*pShaderName);
+                if (shader_it == ShaderSections.end())
+                {
+                    LOG_ERROR_MESSAGE(DescFilePath, '(', Sec.Line, "): shader '", *pShaderName, "' referenced by pipeline '", Sec.Name, "' is not defined");
+                    return false;
+                }
+
+                const size_t ShaderIdx = AddShaderVariant(*shader_it->second, Stages[s].Type, Permutation);
+                if (ShaderIdx == ~size_t{0})
+                    return false;
+
+                pPipeline->Shaders.emplace_back(Stages[s].Type, ShaderIdx);
+                if (Stages[s].Type == SHADER_TYPE_MESH)
+                    pPipeline->Type = PIPELINE_TYPE_MESH;
+            }
+
+            if (pPipeline->Shaders.empty())
+            {
+                LOG_ERROR_MESSAGE(DescFilePath, '(', Sec.Line, "): pipeline '", Sec.Name, "' does not use any shaders");
+                return false;
+            }
+
+            m_Pipelines.emplace_back(std::move(pPipeline));
+        }
+    }
+
+    if (m_Pipelines.empty())
+    {
+        LOG_ERROR_MESSAGE(DescFilePath, ": no pipelines are defined");
+        return false;
+    }
+
+    m_Stats.NumPipelines = m_Pipelines.size();
+    return true;
+}
+
+bool ArchiveBuilder::ApplyTrace()
+{
+    std::vector<Uint8> Data;
+    if (!FileWrapper::ReadWholeFile(m_Settings.TracePath.c_str(), Data))
+        return false;
+
+    std::vector<PipelineUsageTrace::Entry> Entries;
+    if (!PipelineUsageTrace::Deserialize(Data.data(), Data.size(), Entries))
+    {
+        LOG_ERROR_MESSAGE("Failed to read pipeline usage trace '", m_Settings.TracePath, "'.");
+        return false;
+    }
+
+    // Pipeline name -> the order of the first use.
+    // The trace may contain several entries with the same name, e.g. when the render state
+    // cache was used to create pipelines that have the same name, but different create info.
+    std::unordered_map<std::string, size_t> FirstUse;
+    for (const PipelineUsageTrace::Entry& Entry : Entries)
+    {
+        if (!Entry.IsShader())
+            FirstUse.emplace(Entry.Name, FirstUse.size());
+    }
+
+    std::vector<std::pair<size_t, std::unique_ptr<PipelineVariant>>> TracedPipelines;
+    for (auto& pPipeline : m_Pipelines)
+    {
+        auto it = FirstUse.find(pPipeline->Name);
+        if (it == FirstUse.end())
+            continue;
+
+        TracedPipelines.emplace_back(it->second, std::move(pPipeline));
+        FirstUse.erase(it);
+    }
+
+    for (const auto& it : FirstUse)
+        LOG_WARNING_MESSAGE("Pipeline '", it.first, "' from the usage trace is not defined in the description file.");
+
+    // Shaders are compiled and pipelines are created in the order of their first use
+    std::sort(TracedPipelines.begin(), TracedPipelines.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    m_Stats.NumSkippedPipelines = m_Pipelines.size() - TracedPipelines.size();
+
+    m_Pipelines.clear();
+    for (auto& Pipeline : TracedPipelines)
+        m_Pipelines.emplace_back(std::move(Pipeline.second));
+
+    if (m_Pipelines.empty())
+    {
+        LOG_ERROR_MESSAGE("None of the pipelines from the usage trace '", m_Settings.TracePath, "' is defined in the description file.");
+        return false;
+    }
+
+    m_Stats.NumPipelines = m_Pipelines.size();
+    return true;
+}
+
+std::string ArchiveBuilder::GetCachePath(const PipelineVariant& Pipeline, const char* Extension) const
+{
+    return m_Settings.CacheDir + FileSystem::SlashSymbol + HashToString(Pipeline.Key) + Extension;
+}
+
+bool ArchiveBuilder::IsCacheEntryValid(const std::string& DepsPath) const
+{
+    if (!FileSystem::FileExists(DepsPath.c_str()))
+        return false;
+
+    std::vector<Uint8> Data;
+    if (!FileWrapper::ReadWholeFile(DepsPath.c_str(), Data, /*Silent = */ true))
+        return false;
+
+    // Every line contains the hash of the file contents followed by the file name
+    const std::string Deps{Data.begin(), Data.end()};
+    std::stringstream Stream{Deps};
+    for (std::string Line; std::getline(Stream, Line);)
+    {
+        if (Line.empty())
+            continue;
+
+        const size_t SpacePos = Line.find(' ');
+        if (SpacePos == std::string::npos)
+            return false;
+
+        const std::string FileName = Line.substr(SpacePos + 1);
+        if (HashSourceFile(m_pSourceFactory, FileName.c_str()) != Line.substr(0, SpacePos))
+            return false;
+    }
+
+    return true;
+}
+
+bool ArchiveBuilder::WriteCacheEntry(const PipelineVariant& Pipeline) const
+{
+    const std::string ArchivePath = GetCachePath(Pipeline, ".archive");
+    if (!FileWrapper::WriteFile(ArchivePath.c_str(), Pipeline.pArchive->GetConstDataPtr(), Pipeline.pArchive->GetSize()))
+        return false;
+
+    std::set<std::string> Files;
+    for (const auto& Shader : Pipeline.Shaders)
+    {
+        const std::set<std::string> ShaderFiles = m_Shaders[Shader.second]->pRecorder->GetFiles();
+        Files.insert(ShaderFiles.begin(), ShaderFiles.end());
+    }
+
+    std::string Deps;
+    for (const std::string& File : Files)
+        Deps += HashSourceFile(m_pSourceFactory, File.c_str()) + ' ' + File + '\n';
+
+    // The dependency file is written last, so that an incomplete entry is never considered valid
+    const std::string DepsPath = GetCachePath(Pipeline, ".deps");
+    return FileWrapper::WriteFile(DepsPath.c_str(), Deps.data(), Deps.size());
+}
+
+bool ArchiveBuilder::LookUpCache()
+{
+    for (auto& pPipeline : m_Pipelines)
+    {
+        XXH128State Hasher;
+        Hasher.Update(CacheVersionTag, Uint32{m_Settings.DeviceFlags}, m_Settings.ContentVersion);
+        for (const std::string& Dir : m_SearchDirs)
+            Hasher.Update(Dir);
+
+        HashSection(Hasher, *pPipeline->pSection);
+        for (const auto& Macro : pPipeline->Macros)
+            Hasher.Update(Macro.first, Macro.second);
+        for (const auto& Shader : pPipeline->Shaders)
+            HashSection(Hasher, *m_Shaders[Shader.second]->pSection);
+
+        pPipeline->Key = Hasher.Digest();
+    }
+
+    if (m_Settings.CacheDir.empty())
+    {
+        m_Stats.NumBuiltPipelines = m_Pipelines.size();
+        return true;
+    }
+
+    if (!FileSystem::PathExists(m_Settings.CacheDir.c_str()) && !FileSystem::CreateDirectory(m_Settings.CacheDir.c_str()))
+    {
+        LOG_ERROR_MESSAGE("Failed to create cache directory '", m_Settings.CacheDir, "'.");
+        return false;
+    }
+
+    for (auto& pPipeline : m_Pipelines)
+    {
+        if (IsCacheEntryValid(GetCachePath(*pPipeline, ".deps")) &&
+            FileWrapper::ReadWholeFile(GetCachePath(*pPipeline, ".archive").c_str(), &pPipeline->pArchive, /*Silent = */ true))
+        {
+            ++m_Stats.NumCachedPipelines;
+        }
+        else
+        {
+            pPipeline->pArchive.Release();
+            ++m_Stats.NumBuiltPipelines;
+        }
+    }
+
+    return true;
+}
+
+bool ArchiveBuilder::CompileShaders()
+{
+    SerializationDeviceCreateInfo DeviceCI;
+    DeviceCI.NumAsyncShaderCompilationThreads = m_Settings.NumThreads;
+    m_pArchiverFactory->CreateSerializationDevice(DeviceCI, &m_pDevice);
+    if (!m_pDevice)
+    {
+        LOG_ERROR_MESSAGE("Failed to create serialization device.");
+        return false;
+    }
+
+    ShaderArchiveInfo ArchiveInfo;
+    ArchiveInfo.DeviceFlags = m_Settings.DeviceFlags;
+
+    // Start compiling shaders asynchronously on the shader compilation thread pool.
+    // Only compile shaders used by pipelines that are not in the cache. Shaders are
+    // started in the order of pipelines, so that the pipelines used first become ready first.
+    for (const auto& pPipeline : m_Pipelines)
+    {
+        if (pPipeline->pArchive)
+            continue;
+
+        for (const auto& PipelineShader : pPipeline->Shaders)
+        {
+            ShaderVariant& Shader = *m_Shaders[PipelineShader.second];
+            if (Shader.pShader)
+                continue;
+
+            Shader.pRecorder = MakeNewRCObj<DependencyRecorder>()(m_pSourceFactory.RawPtr());
+
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.Desc.Name                       = Shader.Name.c_str();
+            ShaderCI.Desc.ShaderType                 = Shader.Type;
+            ShaderCI.Desc.UseCombinedTextureSamplers = Shader.UseCombinedTextureSamplers;
+            ShaderCI.FilePath                        = Shader.FilePath.c_str();
+            ShaderCI.EntryPoint                      = Shader.EntryPoint.c_str();
+            ShaderCI.SourceLanguage                  = Shader.Language;
+            ShaderCI.Macros                          = ShaderMacroArray{Shader.ShaderMacros.data(), static_cast<Uint32>(Shader.ShaderMacros.size())};
+            ShaderCI.pShaderSourceStreamFactory      = Shader.pRecorder;
+            ShaderCI.CompileFlags                    = SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+
+            m_pDevice->CreateShader(ShaderCI, ArchiveInfo, &Shader.pShader);
+            if (!Shader.pShader)
+            {
+                LOG_ERROR_MESSAGE("Failed to create shader '", Shader.Name, "'.");
+                return false;
+            }
+            ++m_Stats.NumShaders;
+        }
+    }
+
+    bool Success = true;
+    for (const auto& pShader : m_Shaders)
+    {
+        if (!pShader->pShader)
+            continue;
+
+        const SHADER_STATUS Status = pShader->pShader->GetStatus(/*WaitForCompletion = */ true);
+        if (Status != SHADER_STATUS_READY)
+        {
+            LOG_ERROR_MESSAGE("Failed to compile shader '", pShader->Name, "' (", pShader->FilePath, ").");
+            Success = false;
+        }
+    }
+
+    return Success;
+}
+
+bool ArchiveBuilder::CreatePipelines()
+{
+    PipelineStateArchiveInfo ArchiveInfo;
+    ArchiveInfo.DeviceFlags = m_Settings.DeviceFlags;
+
+    // Start creating all pipelines asynchronously
+    for (auto& pPipeline : m_Pipelines)
+    {
+        PipelineVariant& Pipeline = *pPipeline;
+        if (Pipeline.pArchive)
+            continue;
+
+        for (size_t i = 0; i < Pipeline.Variables.size(); ++i)
+            Pipeline.Variables[i].Name = Pipeline.VariableNames[i].c_str();
+
+        auto InitCommonAttribs = [&](PipelineStateCreateInfo& PSOCreateInfo) {
+            PSOCreateInfo.PSODesc.Name                                  = Pipeline.Name.c_str();
+            PSOCreateInfo.PSODesc.PipelineType                          = Pipeline.Type;
+            PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType    = Pipeline.DefaultVariableType;
+            PSOCreateInfo.PSODesc.ResourceLayout.Variables              = Pipeline.Variables.data();
+            PSOCreateInfo.PSODesc.ResourceLayout.NumVariables           = static_cast<Uint32>(Pipeline.Variables.size());
+            PSOCreateInfo.Flags                                         = PSO_CREATE_FLAG_ASYNCHRONOUS;
+        };
+
+        if (Pipeline.Type == PIPELINE_TYPE_COMPUTE)
+        {
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            InitCommonAttribs(PSOCreateInfo);
+            PSOCreateInfo.pCS = m_Shaders[Pipeline.Shaders[0].second]->pShader;
+            m_pDevice->CreateComputePipelineState(PSOCreateInfo, ArchiveInfo, &Pipeline.pPSO);
+        }
+        else
+        {
+            GraphicsPipelineStateCreateInfo PSOCreateInfo;
+            InitCommonAttribs(PSOCreateInfo);
+            PSOCreateInfo.GraphicsPipeline                          = Pipeline.GraphicsPipeline;
+            PSOCreateInfo.GraphicsPipeline.InputLayout.LayoutElements = Pipeline.LayoutElements.data();
+            PSOCreateInfo.GraphicsPipeline.InputLayout.NumElements    = static_cast<Uint32>(Pipeline.LayoutElements.size());
+
+            for (const auto& Shader : Pipeline.Shaders)
+            {
+                IShader* pShader = m_Shaders[Shader.second]->pShader;
+                switch (Shader.first)
+                {
+                    // clang-format off
+                    case SHADER_TYPE_VERTEX:        PSOCreateInfo.pVS = pShader; break;
+                    case SHADER_TYPE_PIXEL:         PSOCreateInfo.pPS = pShader; break;
+                    case SHADER_TYPE_GEOMETRY:      PSOCreateInfo.pGS = pShader; break;
+                    case SHADER_TYPE_HULL:          PSOCreateInfo.pHS = pShader; break;
+                    case SHADER_TYPE_DOMAIN:        PSOCreateInfo.pDS = pShader; break;
+                    case SHADER_TYPE_AMPLIFICATION: PSOCreateInfo.pAS = pShader; break;
+                    case SHADER_TYPE_MESH:          PSOCreateInfo.pMS = pShader; break;
+                    // clang-format on
+                    default:
+                        UNEXPECTED("Unexpected shader stage");
+                }
+            }
+            m_pDevice->CreateGraphicsPipelineState(PSOCreateInfo, ArchiveInfo, &Pipeline.pPSO);
+        }
+
+        if (!Pipeline.pPSO)
+        {
+            LOG_ERROR_MESSAGE("Failed to create pipeline '", Pipeline.Name, "'.");
+            return false;
+        }
+    }
+
+    bool Success = true;
+    for (const auto& pPipeline : m_Pipelines)
+    {
+        if (!pPipeline->pPSO)
+            continue;
+
+        const PIPELINE_STATE_STATUS Status = pPipeline->pPSO->GetStatus(/*WaitForCompletion = */ true);
+        if (Status != PIPELINE_STATE_STATUS_READY)
+        {
+            LOG_ERROR_MESSAGE("Failed to create pipeline '", pPipeline->Name, "'.");
+            Success = false;
+        }
+    }
+
+    return Success;
+}
+
+bool ArchiveBuilder::SerializePipelines(StageStatistics& Stage)
+{
+    // Every pipeline is serialized into its own archive so that it can be cached
+    for (auto& pPipeline : m_Pipelines)
+    {
+        if (pPipeline->pArchive)
+            continue;
+
+        RefCntAutoPtr<IArchiver> pArchiver;
+        m_pArchiverFactory->CreateArchiver(m_pDevice, &pArchiver);
+        if (!pArchiver || !pArchiver->AddPipelineState(pPipeline->pPSO))
+            return false;
+
+        if (!pArchiver->SerializeToBlob(m_Settings.ContentVersion, &pPipeline->pArchive))
+            return false;
+
+        if (!WriteCacheEntry(*pPipeline))
+            LOG_WARNING_MESSAGE("Failed to write cache entry for pipeline '", pPipeline->Name, "'.");
+
+        Stage.Size += pPipeline->pArchive->GetSize();
+    }
+
+    return true;
+}
+
+bool ArchiveBuilder::MergePipelines(IDataBlob** ppArchive, StageStatistics& Stage)
+{
+    std::vector<const IDataBlob*> Archives;
+    Archives.reserve(m_Pipelines.size());
+    for (const auto& pPipeline : m_Pipelines)
+        Archives.emplace_back(pPipeline->pArchive);
+
+    // Identical shader byte code is only stored once in the merged archive
+    if (!m_pArchiverFactory->MergeArchives(Archives.data(), static_cast<Uint32>(Archives.size()), ppArchive))
+        return false;
+
+    Stage.Size = (*ppArchive)->GetSize();
+    return true;
+}
+
+void ArchiveBuilder::PrintStatistics(std::ostream& Stream) const
+{
+    double TotalTime = 0;
+
+    Stream << std::left << std::setw(20) << "Stage" << std::right << std::setw(12) << "Time (ms)" << std::setw(16) << "Size (bytes)" << '\n';
+    for (const StageStatistics& Stage : m_Stats.Stages)
+    {
+        Stream << std::left << std::setw(20) << Stage.Name << std::right << std::setw(12) << std::fixed << std::setprecision(2) << Stage.Time * 1000.0;
+        if (Stage.Size != 0)
+            Stream << std::setw(16) << Stage.Size;
+        Stream << '\n';
+        TotalTime += Stage.Time;
+    }
+    Stream << std::left << std::setw(20) << "Total" << std::right << std::setw(12) << TotalTime * 1000.0 << "\n\n";
+
+    Stream << "Pipelines:    " << m_Stats.NumPipelines << " (" << m_Stats.NumBuiltPipelines << " built, " << m_Stats.NumCachedPipelines << " cached";
+    if (m_Stats.NumSkippedPipelines != 0)
+        Stream << ", " << m_Stats.NumSkippedPipelines << " not in the trace";
+    Stream << ")\n"
+           << "Shaders:      " << m_Stats.NumShaders << " compiled\n"
+           << "Archive size: " << m_Stats.ArchiveSize << " bytes\n";
+}
+
+} // namespace Diligent
@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "PipelineDescFile.hpp"
+
+#include "DebugUtilities.hpp"
+#include "StringTools.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+std::string TrimString(const std::string& Str, size_t Start, size_t End)
+{
+    while (Start < End && IsSpace(Str[Start]))
+        ++Start;
+    while (End > Start && IsSpace(Str[End - 1]))
+        --End;
+    return Str.substr(Start, End - Start);
+}
+
+} // namespace
+
+const std::string* PipelineDescFile::Section::Find(const char* Key) const
+{
+    for (const auto& KeyValue : Values)
+    {
+        if (StrCmpNoCase(KeyValue.first.c_str(), Key) == 0)
+            return &KeyValue.second;
+    }
+    return nullptr;
+}
+
+bool PipelineDescFile::Parse(const std::string& Text, const char* FileName)
+{
+    Sections.clear();
+
+    size_t LineNum = 0;
+    for (size_t LineStart = 0; LineStart < Text.length();)
+    {
+        size_t LineEnd = Text.find('\n', LineStart);
+        if (LineEnd == std::string::npos)
+            LineEnd = Text.length();
+        ++LineNum;
+
+        const std::string Line = TrimString(Text, LineStart, LineEnd);
+        LineStart              = LineEnd + 1;
+        // Skip empty lines and comments. Note that ';' is also used as the
+        // path list separator, so only full-line comments are supported.
+        if (Line.empty() || Line.front() == '#' || Line.front() == ';')
+            continue;
+
+        if (Line.front() == '[')
+        {
+            if (Line.back() != ']')
+            {
+                LOG_ERROR_MESSAGE(FileName, '(', LineNum, "): missing closing bracket in section header");
+                return false;
+            }
+
+            const std::string Header = TrimString(Line, 1, Line.length() - 1);
+            if (Header.empty())
+            {
+                LOG_ERROR_MESSAGE(FileName, '(', LineNum, "): empty section header");
+                return false;
+            }
+
+            Section NewSection;
+            NewSection.Line = LineNum;
+
+            size_t TypeEnd = 0;
+            while (TypeEnd < Header.length() && !IsSpace(Header[TypeEnd]))
+                ++TypeEnd;
+            NewSection.Type = Header.substr(0, TypeEnd);
+            NewSection.Name = TrimString(Header, TypeEnd, Header.length());
+
+            Sections.emplace_back(std::move(NewSection));
+            continue;
+        }
+
+        const size_t EqualPos = Line.find('=');
+        if (EqualPos == std::string::npos)
+        {
+            LOG_ERROR_MESSAGE(FileName, '(', LineNum, "): expected 'Key = Value'");
+            return false;
+        }
+
+        if (Sections.empty())
+        {
+            LOG_ERROR_MESSAGE(FileName, '(', LineNum, "): key-value pair outside of a section");
+            return false;
+        }
+
+        std::string Key = TrimString(Line, 0, EqualPos);
+        if (Key.empty())
+        {
+            LOG_ERROR_MESSAGE(FileName, '(', LineNum, "): empty key");
+            return false;
+        }
+
+        Section& CurrSection = Sections.back();
+        if (CurrSection.Find(Key.c_str()) != nullptr)
+        {
+            LOG_ERROR_MESSAGE(FileName, '(', LineNum, "): duplicate key '", Key, "' in section [", CurrSection.Type, ' ', CurrSection.Name, ']');
+            return false;
+        }
+
+        CurrSection.Values.emplace_back(std::move(Key), TrimString(Line, EqualPos + 1, Line.length()));
+    }
+
+    return true;
+}
+
+} // namespace Diligent
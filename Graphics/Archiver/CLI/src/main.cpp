@@ -0,0 +1,210 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "ArchiveBuilder.hpp"
+#include "ArchiverFactoryLoader.h"
+#include "StringTools.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct DeviceInfo
+{
+    const char*               Name;
+    ARCHIVE_DEVICE_DATA_FLAGS Flag;
+};
+
+// clang-format off
+constexpr DeviceInfo Devices[] =
+{
+    {"d3d11",       ARCHIVE_DEVICE_DATA_FLAG_D3D11},
+    {"d3d12",       ARCHIVE_DEVICE_DATA_FLAG_D3D12},
+    {"gl",          ARCHIVE_DEVICE_DATA_FLAG_GL},
+    {"gles",        ARCHIVE_DEVICE_DATA_FLAG_GLES},
+    {"vulkan",      ARCHIVE_DEVICE_DATA_FLAG_VULKAN},
+    {"metal_macos", ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS},
+    {"metal_ios",   ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS},
+    {"webgpu",      ARCHIVE_DEVICE_DATA_FLAG_WEBGPU},
+};
+// clang-format on
+
+ARCHIVE_DEVICE_DATA_FLAGS GetSupportedDeviceFlags()
+{
+    ARCHIVE_DEVICE_DATA_FLAGS Flags = ARCHIVE_DEVICE_DATA_FLAG_NONE;
+#if D3D11_SUPPORTED
+    Flags |= ARCHIVE_DEVICE_DATA_FLAG_D3D11;
+#endif
+#if D3D12_SUPPORTED
+    Flags |= ARCHIVE_DEVICE_DATA_FLAG_D3D12;
+#endif
+#if GL_SUPPORTED
+    Flags |= ARCHIVE_DEVICE_DATA_FLAG_GL;
+#endif
+#if GLES_SUPPORTED
+    Flags |= ARCHIVE_DEVICE_DATA_FLAG_GLES;
+#endif
+#if VULKAN_SUPPORTED
+    Flags |= ARCHIVE_DEVICE_DATA_FLAG_VULKAN;
+#endif
+#if METAL_SUPPORTED
+    Flags |= ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS | ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS;
+#endif
+#if WEBGPU_SUPPORTED
+    Flags |= ARCHIVE_DEVICE_DATA_FLAG_WEBGPU;
+#endif
+    return Flags;
+}
+
+void PrintUsage()
+{
+    std::cout << "Usage: ArchiverCLI -i <pipelines file> -o <archive> [options]\n"
+                 "\n"
+                 "Options:\n"
+                 "  -i, --input <path>         Pipeline description file\n"
+                 "  -o, --output <path>        Output archive\n"
+                 "  -d, --devices <list>       Comma-separated list of devices to serialize data for:\n"
+                 "                             d3d11, d3d12, gl, gles, vulkan, metal_macos, metal_ios, webgpu.\n"
+                 "                             All devices supported by the build are used by default.\n"
+                 "  -t, --threads <count>      Number of shader compilation threads (default: number of cores)\n"
+                 "  -I, --shader-dir <path>    Additional shader search directory (may be repeated)\n"
+                 "  --cache <dir>              Cache directory for incremental builds\n"
+                 "  --trace <path>             Pipeline usage trace. Only the pipelines from the trace are built.\n"
+                 "  --compress                 Compress the archive\n"
+                 "  --content-version <ver>    Archive content version\n"
+                 "  -h, --help                 Print this message\n";
+}
+
+bool ParseDevices(const char* List, ARCHIVE_DEVICE_DATA_FLAGS& Flags)
+{
+    Flags = ARCHIVE_DEVICE_DATA_FLAG_NONE;
+    for (const std::string& Name : SplitString(List, List + strlen(List), ", "))
+    {
+        bool Found = false;
+        for (const DeviceInfo& Device : Devices)
+        {
+            if (StrCmpNoCase(Name.c_str(), Device.Name) == 0)
+            {
+                Flags |= Device.Flag;
+                Found = true;
+            }
+        }
+        if (!Found)
+        {
+            std::cerr << "Unknown device '" << Name << "'\n";
+            return false;
+        }
+    }
+    return Flags != ARCHIVE_DEVICE_DATA_FLAG_NONE;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    ArchiveBuilderSettings Settings;
+    Settings.DeviceFlags = GetSupportedDeviceFlags();
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* Arg = argv[i];
+
+        auto IsArg = [Arg](const char* ShortName, const char* LongName) {
+            return (ShortName != nullptr && strcmp(Arg, ShortName) == 0) || strcmp(Arg, LongName) == 0;
+        };
+
+        if (IsArg("-h", "--help"))
+        {
+            PrintUsage();
+            return 0;
+        }
+        if (IsArg(nullptr, "--compress"))
+        {
+            Settings.Compression = ARCHIVE_COMPRESSION_LZ;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Unknown argument or missing value for '" << Arg << "'\n";
+            PrintUsage();
+            return 1;
+        }
+
+        const char* Value = argv[++i];
+        if (IsArg("-i", "--input"))
+            Settings.DescFilePath = Value;
+        else if (IsArg("-o", "--output"))
+            Settings.OutputPath = Value;
+        else if (IsArg("-I", "--shader-dir"))
+            Settings.ShaderDirs.emplace_back(Value);
+        else if (IsArg(nullptr, "--cache"))
+            Settings.CacheDir = Value;
+        else if (IsArg(nullptr, "--trace"))
+            Settings.TracePath = Value;
+        else if (IsArg("-t", "--threads"))
+            Settings.NumThreads = static_cast<Uint32>(std::strtoul(Value, nullptr, 10));
+        else if (IsArg(nullptr, "--content-version"))
+            Settings.ContentVersion = static_cast<Uint32>(std::strtoul(Value, nullptr, 10));
+        else if (IsArg("-d", "--devices"))
+        {
+            if (!ParseDevices(Value, Settings.DeviceFlags))
+                return 1;
+        }
+        else
+        {
+            std::cerr << "Unknown argument '" << Arg << "'\n";
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (Settings.DescFilePath.empty() || Settings.OutputPath.empty())
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    IArchiverFactory* pArchiverFactory = GetArchiverFactory();
+    if (pArchiverFactory == nullptr)
+    {
+        std::cerr << "Failed to get the archiver factory\n";
+        return 1;
+    }
+
+    ArchiveBuilder Builder{pArchiverFactory, Settings};
+
+    const bool Success = Builder.Build();
+    Builder.PrintStatistics(std::cout);
+
+    return Success ? 0 : 1;
+}
@@ -93,6 +93,9 @@ public:
 private:
     bool AddRenderPass(IRenderPass* pRP);
 
+    // Adds all objects to the archive. The archive references the data owned by the objects.
+    void PrepareArchive(DeviceObjectArchive& Archive);
+
 private:
     using DeviceType   = DeviceObjectArchive::DeviceType;
     using ResourceType = DeviceObjectArchive::ResourceType;
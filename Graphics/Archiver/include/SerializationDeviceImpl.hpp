@@ -30,6 +30,7 @@
 #include <memory>
 #include <string>
 #include <array>
+#include <mutex>
 
 #include "ArchiverFactory.h"
 
@@ -37,6 +38,7 @@
 #include "ObjectBase.hpp"
 #include "DXCompiler.hpp"
 #include "RenderDeviceBase.hpp"
+#include "ShaderToolsCommon.hpp"
 
 namespace Diligent
 {
@@ -178,6 +180,10 @@ public:
         return m_RenderDevices[Type];
     }
 
+    /// Unrolls all include files of the shader into a single source string.
+    /// Include files are loaded once and are shared by all shaders created by this device.
+    std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) const noexcept(false);
+
 protected:
     static PipelineResourceBinding ResDescToPipelineResBinding(const PipelineResourceDesc& ResDesc, SHADER_TYPE Stages, Uint32 Register, Uint32 Space);
 
@@ -215,6 +221,10 @@ private:
     std::vector<PipelineResourceBinding> m_ResourceBindings;
 
     std::array<RefCntAutoPtr<IRenderDevice>, RENDER_DEVICE_TYPE_COUNT> m_RenderDevices;
+
+    // Shaders may be compiled by multiple threads
+    mutable std::mutex                m_IncludePreprocessorMtx;
+    mutable ShaderIncludePreprocessor m_IncludePreprocessor;
 };
 
 } // namespace Diligent
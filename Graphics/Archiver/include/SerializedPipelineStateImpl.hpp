@@ -39,6 +39,7 @@
 #include "ObjectBase.hpp"
 #include "PipelineStateBase.hpp"
 #include "DeviceObjectArchive.hpp"
+#include "../../GraphicsTools/interface/XXH128Hasher.hpp"
 
 namespace Diligent
 {
@@ -111,7 +112,7 @@ public:
         struct ShaderInfo
         {
             SerializedData Data;
-            size_t         Hash  = 0;
+            XXH128Hash     Hash;
             SHADER_TYPE    Stage = SHADER_TYPE_UNKNOWN;
         };
         std::array<std::vector<ShaderInfo>, DeviceDataCount> Shaders;
@@ -76,6 +76,7 @@ public:
     UNSUPPORTED_CONST_METHOD(void,     InitializeStaticSRBResources, IShaderResourceBinding* pShaderResourceBinding)
     UNSUPPORTED_CONST_METHOD(void,     CopyStaticResources,          IPipelineResourceSignature* pPRS)
     UNSUPPORTED_CONST_METHOD(bool,     IsCompatibleWith,             const IPipelineResourceSignature* pPRS)
+    UNSUPPORTED_CONST_METHOD(Uint32,   GetSRBVariableIndex,          SHADER_TYPE ShaderType, const Char* Name)
     UNSUPPORTED_CONST_METHOD(Int32,    GetUniqueID)
     UNSUPPORTED_METHOD      (void,     SetUserData, IObject* pUserData)
     UNSUPPORTED_CONST_METHOD(IObject*, GetUserData)
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <array>
+#include <mutex>
 
 #include "SerializedShader.h"
 #include "SerializationEngineImplTraits.hpp"
@@ -35,6 +36,7 @@
 #include "STDAllocator.hpp"
 #include "Serializer.hpp"
 #include "DeviceObjectArchive.hpp"
+#include "../../GraphicsTools/interface/XXH128Hasher.hpp"
 
 namespace Diligent
 {
@@ -96,8 +98,19 @@ public:
         return static_cast<CompiledShaderType*>(m_Shaders[static_cast<size_t>(Type)].get());
     }
 
+    struct DeviceData
+    {
+        SerializedData Data;
+        XXH128Hash     Hash;
+    };
+
     SerializedData GetCommonData() const { return SerializedData{}; }
-    SerializedData GetDeviceData(DeviceType Type) const;
+
+    // Returns the serialized device data and its content hash.
+    // The data is serialized and hashed only once; subsequent calls return the cached data.
+    const DeviceData& GetDeviceData(DeviceType Type) const;
+
+    static XXH128Hash ComputeHash(const SerializedData& Data);
 
     const ShaderCreateInfo& GetCreateInfo() const
     {
@@ -120,6 +133,9 @@ private:
 
     std::array<std::unique_ptr<CompiledShader>, static_cast<size_t>(DeviceType::Count)> m_Shaders;
 
+    mutable std::array<std::once_flag, static_cast<size_t>(DeviceType::Count)> m_DeviceDataFlags;
+    mutable std::array<DeviceData, static_cast<size_t>(DeviceType::Count)>     m_DeviceData;
+
     template <typename ShaderType, typename... ArgTypes>
     void CreateShader(DeviceType              Type,
                       IReferenceCounters*     pRefCounters,
@@ -31,6 +31,7 @@
 
 #include "../../../Primitives/interface/Object.h"
 #include "../../../Primitives/interface/DebugOutput.h"
+#include "../../../Primitives/interface/FileStream.h"
 #include "SerializationDevice.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
@@ -48,6 +49,21 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_ArchiverFactory =
 
 // clang-format off
 
+/// Archive data compression
+DILIGENT_TYPED_ENUM(ARCHIVE_COMPRESSION, Uint32)
+{
+    /// Archive data is not compressed.
+    ARCHIVE_COMPRESSION_NONE = 0,
+
+    /// Fast LZ77-family compression.
+
+    /// Every resource and shader is compressed separately and is only
+    /// decompressed when it is unpacked from the archive.
+    ARCHIVE_COMPRESSION_LZ,
+
+    ARCHIVE_COMPRESSION_COUNT
+};
+
 /// Serialization device attributes for Direct3D11 backend
 struct SerializationDeviceD3D11Info
 {
@@ -323,6 +339,54 @@ DILIGENT_BEGIN_INTERFACE(IArchiverFactory, IObject)
                                        IDataBlob**      ppDstArchive) CONST PURE;
 
 
+    /// Merges multiple archives read from the streams into one and writes it to the destination stream.
+
+    /// \param [in]  ppSrcStreams  - An array of pointers to the source archive streams.
+    /// \param [in]  NumSrcStreams - The number of elements in `ppSrcStreams` array.
+    /// \param [in]  pDstStream    - Stream to write the merged archive to.
+    /// \return     `true` if the archives were successfully merged, and `false` otherwise.
+    ///
+    /// \remarks    Unlike MergeArchives, the archives are not loaded into memory. Only the archive
+    ///             indices are read, and resource and shader data is copied between the streams
+    ///             without decompression. Shaders with identical data are only written once.
+    VIRTUAL Bool METHOD(MergeArchiveStreams)(THIS_
+                                             IFileStream* ppSrcStreams[],
+                                             Uint32       NumSrcStreams,
+                                             IFileStream* pDstStream) CONST PURE;
+
+
+    /// Compares the resources of two archives read from the streams and prints the differences.
+
+    /// \param [in]  pArchive0        - Stream of the first archive.
+    /// \param [in]  pArchive1        - Stream of the second archive.
+    /// \param [out] pNumDifferences  - Optional pointer to the variable where the number of
+    ///                                 added, removed and modified resources will be written.
+    /// \return     `true` if the archives were successfully compared, and `false` otherwise.
+    ///
+    /// \remarks    Resources are compared by their uncompressed content, so archives that only differ
+    ///             in compression or in the order of the shaders are considered identical.
+    VIRTUAL Bool METHOD(DiffArchiveStreams)(THIS_
+                                            IFileStream* pArchive0,
+                                            IFileStream* pArchive1,
+                                            Uint32*      pNumDifferences DEFAULT_VALUE(nullptr)) CONST PURE;
+
+
+    /// Compresses or decompresses the archive data and writes a new archive to the stream.
+
+    /// \param [in]  pSrcArchive  - Source archive.
+    /// \param [in]  Compression  - Compression to use in the new archive, see Diligent::ARCHIVE_COMPRESSION.
+    ///                            Use ARCHIVE_COMPRESSION_NONE to decompress the archive.
+    /// \param [out] ppDstArchive - Memory address where a pointer to the new archive will be written.
+    /// \return     `true` if the archive was successfully written, and `false` otherwise.
+    ///
+    /// \remarks    Archives with compressed and uncompressed data can be loaded by the dearchiver in the same way.
+    ///             Data that does not benefit from compression is always stored uncompressed.
+    VIRTUAL Bool METHOD(CompressArchive)(THIS_
+                                         const IDataBlob*    pSrcArchive,
+                                         ARCHIVE_COMPRESSION Compression,
+                                         IDataBlob**         ppDstArchive) CONST PURE;
+
+
     /// Prints archive content for debugging and validation.
     VIRTUAL Bool METHOD(PrintArchiveContent)(THIS_
                                              const IDataBlob* pArchive) CONST PURE;
@@ -351,6 +415,9 @@ DILIGENT_END_INTERFACE
 #    define IArchiverFactory_RemoveDeviceData(This, ...)                        CALL_IFACE_METHOD(ArchiverFactory, RemoveDeviceData,                       This, __VA_ARGS__)
 #    define IArchiverFactory_AppendDeviceData(This, ...)                        CALL_IFACE_METHOD(ArchiverFactory, AppendDeviceData,                       This, __VA_ARGS__)
 #    define IArchiverFactory_MergeArchives(This, ...)                           CALL_IFACE_METHOD(ArchiverFactory, MergeArchives,                          This, __VA_ARGS__)
+#    define IArchiverFactory_MergeArchiveStreams(This, ...)                     CALL_IFACE_METHOD(ArchiverFactory, MergeArchiveStreams,                    This, __VA_ARGS__)
+#    define IArchiverFactory_DiffArchiveStreams(This, ...)                      CALL_IFACE_METHOD(ArchiverFactory, DiffArchiveStreams,                     This, __VA_ARGS__)
+#    define IArchiverFactory_CompressArchive(This, ...)                         CALL_IFACE_METHOD(ArchiverFactory, CompressArchive,                        This, __VA_ARGS__)
 #    define IArchiverFactory_PrintArchiveContent(This, ...)                     CALL_IFACE_METHOD(ArchiverFactory, PrintArchiveContent,                    This, __VA_ARGS__)
 #    define IArchiverFactory_SetMessageCallback(This, ...)                      CALL_IFACE_METHOD(ArchiverFactory, SetMessageCallback,                     This, __VA_ARGS__)
 #    define IEngineFactory_SetBreakOnError(This, ...)                           CALL_IFACE_METHOD(EngineFactory,   SetBreakOnError,                        This, __VA_ARGS__)
@@ -137,6 +137,21 @@ public:
         Uint32           NumSrcArchives,
         IDataBlob**      ppDstArchive) const override final;
 
+    virtual Bool DILIGENT_CALL_TYPE MergeArchiveStreams(
+        IFileStream* ppSrcStreams[],
+        Uint32       NumSrcStreams,
+        IFileStream* pDstStream) const override final;
+
+    virtual Bool DILIGENT_CALL_TYPE DiffArchiveStreams(
+        IFileStream* pArchive0,
+        IFileStream* pArchive1,
+        Uint32*      pNumDifferences) const override final;
+
+    virtual Bool DILIGENT_CALL_TYPE CompressArchive(
+        const IDataBlob*    pSrcArchive,
+        ARCHIVE_COMPRESSION Compression,
+        IDataBlob**         ppDstArchive) const override final;
+
     virtual Bool DILIGENT_CALL_TYPE PrintArchiveContent(const IDataBlob* pArchive) const override final;
 
     virtual void DILIGENT_CALL_TYPE SetMessageCallback(DebugMessageCallbackType MessageCallback) const override final;
@@ -309,11 +324,18 @@ Bool ArchiverFactoryImpl::MergeArchives(
     try
     {
         DeviceObjectArchive MergedArchive{DeviceObjectArchive::CreateInfo{ppSrcArchives[0]}};
+
+        // Archives reference the source data blobs and do not copy them
+        std::vector<std::unique_ptr<DeviceObjectArchive>> SrcArchives;
+        std::vector<const DeviceObjectArchive*>           pSrcArchives;
+        SrcArchives.reserve(NumSrcArchives - 1);
+        pSrcArchives.reserve(NumSrcArchives - 1);
         for (Uint32 i = 1; i < NumSrcArchives; ++i)
         {
-            const DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{ppSrcArchives[i]}};
-            MergedArchive.Merge(Archive);
+            SrcArchives.emplace_back(std::make_unique<DeviceObjectArchive>(DeviceObjectArchive::CreateInfo{ppSrcArchives[i]}));
+            pSrcArchives.emplace_back(SrcArchives.back().get());
         }
+        MergedArchive.Merge(pSrcArchives.data(), pSrcArchives.size());
 
         MergedArchive.Serialize(ppDstArchive);
         return *ppDstArchive != nullptr;
@@ -324,6 +346,109 @@ Bool ArchiverFactoryImpl::MergeArchives(
     }
 }
 
+Bool ArchiverFactoryImpl::MergeArchiveStreams(
+    IFileStream* ppSrcStreams[],
+    Uint32       NumSrcStreams,
+    IFileStream* pDstStream) const
+{
+    if (NumSrcStreams == 0)
+        return false;
+
+    DEV_CHECK_ERR(ppSrcStreams != nullptr, "ppSrcStreams must not be null");
+    DEV_CHECK_ERR(pDstStream != nullptr, "pDstStream must not be null");
+
+    if (ppSrcStreams == nullptr || pDstStream == nullptr)
+        return false;
+
+    return DeviceObjectArchive::MergeStreams(ppSrcStreams, NumSrcStreams, pDstStream);
+}
+
+Bool ArchiverFactoryImpl::DiffArchiveStreams(IFileStream* pArchive0,
+                                             IFileStream* pArchive1,
+                                             Uint32*      pNumDifferences) const
+{
+    if (pNumDifferences != nullptr)
+        *pNumDifferences = 0;
+
+    if (pArchive0 == nullptr || pArchive1 == nullptr)
+    {
+        DEV_ERROR("Archive streams must not be null");
+        return false;
+    }
+
+    std::vector<DeviceObjectArchive::ResourceDiff> Diffs;
+    if (!DeviceObjectArchive::DiffStreams(pArchive0, pArchive1, Diffs))
+        return false;
+
+    for (const DeviceObjectArchive::ResourceDiff& Diff : Diffs)
+    {
+        const char* DiffTypeStr = "";
+        switch (Diff.Type)
+        {
+            // clang-format off
+            case DeviceObjectArchive::DiffType::Added:    DiffTypeStr = "added";    break;
+            case DeviceObjectArchive::DiffType::Removed:  DiffTypeStr = "removed";  break;
+            case DeviceObjectArchive::DiffType::Modified: DiffTypeStr = "modified"; break;
+            // clang-format on
+            default:
+                UNEXPECTED("Unexpected diff type");
+        }
+        LOG_INFO_MESSAGE(DeviceObjectArchive::ResourceTypeToString(Diff.ResType), ": '", Diff.Name, "' is ", DiffTypeStr);
+    }
+    if (Diffs.empty())
+        LOG_INFO_MESSAGE("Archives are identical");
+
+    if (pNumDifferences != nullptr)
+        *pNumDifferences = static_cast<Uint32>(Diffs.size());
+    return true;
+}
+
+Bool ArchiverFactoryImpl::CompressArchive(const IDataBlob*    pSrcArchive,
+                                          ARCHIVE_COMPRESSION Compression,
+                                          IDataBlob**         ppDstArchive) const
+{
+    if (pSrcArchive == nullptr)
+    {
+        DEV_ERROR("pSrcArchive must not be null");
+        return false;
+    }
+    if (ppDstArchive == nullptr)
+    {
+        DEV_ERROR("ppDstArchive must not be null");
+        return false;
+    }
+    DEV_CHECK_ERR(*ppDstArchive == nullptr, "*ppDstArchive must be null");
+
+    static_assert(ARCHIVE_COMPRESSION_COUNT == 2, "Please handle the new compression type below");
+    DeviceObjectArchive::CompressionInfo CompressionInfo;
+    switch (Compression)
+    {
+        case ARCHIVE_COMPRESSION_NONE:
+            break;
+
+        case ARCHIVE_COMPRESSION_LZ:
+            CompressionInfo.pCodec = &DeviceObjectArchive::GetLZCodec();
+            break;
+
+        default:
+            DEV_ERROR("Unknown archive compression ", Uint32{Compression});
+            return false;
+    }
+
+    try
+    {
+        DeviceObjectArchive ObjectArchive{DeviceObjectArchive::CreateInfo{pSrcArchive}};
+
+        ObjectArchive.SetCompression(CompressionInfo);
+        ObjectArchive.Serialize(ppDstArchive);
+        return *ppDstArchive != nullptr;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
 Bool ArchiverFactoryImpl::PrintArchiveContent(const IDataBlob* pArchive) const
 {
     try
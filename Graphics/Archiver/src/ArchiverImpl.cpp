@@ -27,9 +27,11 @@
 #include "ArchiverImpl.hpp"
 #include "Archiver_Inc.hpp"
 
+#include <unordered_map>
 #include <vector>
 
 #include "PSOSerializer.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -69,18 +71,15 @@ ArchiverImpl::~ArchiverImpl()
 {
 }
 
-Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+void ArchiverImpl::PrepareArchive(DeviceObjectArchive& Archive)
 {
-    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
-    if (ppBlob == nullptr)
-        return false;
+    IThreadPool* pThreadPool = m_pSerializationDevice->GetShaderCompilationThreadPool();
 
-    DeviceObjectArchive Archive{ContentVersion};
-
-    // A hash map that maps shader byte code to the index in the archive, for each device type
-    std::array<std::unordered_map<size_t, Uint32>, static_cast<size_t>(DeviceType::Count)> BytecodeHashToIdx;
+    // Pipelines that are ready to be serialized and their archive data
+    std::vector<std::pair<const SerializedPipelineStateImpl*, ResourceData*>> Pipelines;
+    Pipelines.reserve(m_Pipelines.size());
 
-    // Add pipelines and patched shaders
+    // Add pipelines
     for (const auto& pso_it : m_Pipelines)
     {
         const char*                  Name    = pso_it.first.GetName();
@@ -117,43 +116,7 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
         // NB: since the Archive object is temporary, we do not need to copy the data
         DstData.Common = SerializedData{SrcData.Common.Ptr(), SrcData.Common.Size()};
 
-        // Add shaders for each device type, if present
-        for (size_t device_type = 0; device_type < SrcData.Shaders.size(); ++device_type)
-        {
-            const auto& SrcShaders = SrcData.Shaders[device_type];
-            if (SrcShaders.empty())
-                continue; // No shaders for this device type
-
-            auto& DstShaders = Archive.GetDeviceShaders(static_cast<DeviceType>(device_type));
-
-            std::vector<Uint32> ShaderIndices;
-            ShaderIndices.reserve(SrcShaders.size());
-            for (const SerializedPipelineStateImpl::Data::ShaderInfo& SrcShader : SrcShaders)
-            {
-                VERIFY_EXPR(SrcShader.Data);
-
-                auto it_inserted = BytecodeHashToIdx[device_type].emplace(SrcShader.Hash, StaticCast<Uint32>(DstShaders.size()));
-                if (it_inserted.second)
-                {
-                    // New byte code - add it
-                    DstShaders.emplace_back(SrcShader.Data.Ptr(), SrcShader.Data.Size());
-                }
-                ShaderIndices.emplace_back(it_inserted.first->second);
-            }
-
-            DeviceObjectArchive::ShaderIndexArray Indices{ShaderIndices.data(), StaticCast<Uint32>(ShaderIndices.size())};
-
-            // For pipelines, device-specific data is the shader indices
-            SerializedData& SerializedIndices = DstData.DeviceSpecific[device_type];
-
-            Serializer<SerializerMode::Measure> MeasureSer;
-            PSOSerializer<SerializerMode::Measure>::SerializeShaderIndices(MeasureSer, Indices, nullptr);
-            SerializedIndices = MeasureSer.AllocateData(GetRawAllocator());
-
-            Serializer<SerializerMode::Write> Ser{SerializedIndices};
-            PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, Indices, nullptr);
-            VERIFY_EXPR(Ser.IsEnded());
-        }
+        Pipelines.emplace_back(&SrcPSO, &DstData);
     }
 
     // Add resource signatures
@@ -187,6 +150,10 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
         DstData.Common        = SerializedData{SrcData.Ptr(), SrcData.Size()};
     }
 
+    // Standalone shaders that are ready to be serialized and their archive data
+    std::vector<std::pair<const SerializedShaderImpl*, ResourceData*>> Shaders;
+    Shaders.reserve(m_Shaders.size());
+
     // Add standalone shaders
     for (const auto& shader_it : m_Shaders)
     {
@@ -207,51 +174,117 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
         ResourceData& DstData = Archive.GetResourceData(ResourceType::StandaloneShader, Name);
         DstData.Common        = SrcShader.GetCommonData();
 
-        for (size_t device_type = 0; device_type < static_cast<size_t>(DeviceType::Count); ++device_type)
-        {
-            SerializedData DeviceData = SrcShader.GetDeviceData(static_cast<DeviceType>(device_type));
-            if (!DeviceData)
-                continue;
+        Shaders.emplace_back(&SrcShader, &DstData);
+    }
 
-            auto& DstShaders  = Archive.GetDeviceShaders(static_cast<DeviceType>(device_type));
-            auto  it_inserted = BytecodeHashToIdx[device_type].emplace(DeviceData.GetHash(), StaticCast<Uint32>(DstShaders.size()));
-            if (it_inserted.second)
+    // Serialize device data of the shaders that were added while compiling.
+    // Device data of other shaders is serialized and hashed when the shader is added to the archiver.
+    ProcessInParallel(pThreadPool, Shaders.size(),
+                      [&](size_t i) {
+                          for (size_t device_type = 0; device_type < static_cast<size_t>(DeviceType::Count); ++device_type)
+                              Shaders[i].first->GetDeviceData(static_cast<DeviceType>(device_type));
+                      });
+
+    std::array<std::vector<SerializedData>*, static_cast<size_t>(DeviceType::Count)> DeviceShaders{};
+    for (size_t device_type = 0; device_type < DeviceShaders.size(); ++device_type)
+        DeviceShaders[device_type] = &Archive.GetDeviceShaders(static_cast<DeviceType>(device_type));
+
+    // Each device type only writes its own device-specific data and shader list,
+    // so device types can be processed in parallel.
+    ProcessInParallel(
+        pThreadPool, static_cast<size_t>(DeviceType::Count),
+        [&](size_t device_type) {
+            std::vector<SerializedData>& DstShaders = *DeviceShaders[device_type];
+
+            // A hash map that maps shader byte code to the index in the archive
+            std::unordered_map<XXH128Hash, Uint32> BytecodeHashToIdx;
+
+            // Add patched pipeline shaders
+            std::vector<Uint32> ShaderIndices;
+            for (const auto& PSO : Pipelines)
             {
-                // New byte code
-                DstShaders.emplace_back(std::move(DeviceData));
+                const auto& SrcShaders = PSO.first->GetData().Shaders[device_type];
+                if (SrcShaders.empty())
+                    continue; // No shaders for this device type
+
+                ShaderIndices.clear();
+                for (const SerializedPipelineStateImpl::Data::ShaderInfo& SrcShader : SrcShaders)
+                {
+                    VERIFY_EXPR(SrcShader.Data);
+
+                    auto it_inserted = BytecodeHashToIdx.emplace(SrcShader.Hash, StaticCast<Uint32>(DstShaders.size()));
+                    if (it_inserted.second)
+                    {
+                        // New byte code - add it
+                        DstShaders.emplace_back(SrcShader.Data.Ptr(), SrcShader.Data.Size());
+                    }
+                    ShaderIndices.emplace_back(it_inserted.first->second);
+                }
+
+                DeviceObjectArchive::ShaderIndexArray Indices{ShaderIndices.data(), StaticCast<Uint32>(ShaderIndices.size())};
+
+                // For pipelines, device-specific data is the shader indices
+                SerializedData& SerializedIndices = PSO.second->DeviceSpecific[device_type];
+
+                SerializationBuffer Buffer{GetRawAllocator()};
+
+                Serializer<SerializerMode::Write> Ser{Buffer};
+                PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, Indices, nullptr);
+                SerializedIndices = Buffer.GetData(GetRawAllocator());
             }
-            const Uint32 Index = it_inserted.first->second;
 
-            // For shaders, device-specific data is the serialized shader bytecode index
-            SerializedData& SerializedIndex = DstData.DeviceSpecific[device_type];
+            // Add standalone shaders
+            for (const auto& Shader : Shaders)
+            {
+                const SerializedShaderImpl::DeviceData& DeviceData = Shader.first->GetDeviceData(static_cast<DeviceType>(device_type));
+                if (!DeviceData.Data)
+                    continue;
 
-            Serializer<SerializerMode::Measure> MeasureSer;
-            MeasureSer(Index);
-            SerializedIndex = MeasureSer.AllocateData(GetRawAllocator());
+                auto it_inserted = BytecodeHashToIdx.emplace(DeviceData.Hash, StaticCast<Uint32>(DstShaders.size()));
+                if (it_inserted.second)
+                {
+                    // New byte code
+                    // NB: the data is owned by the shader object, so we do not need to copy it
+                    DstShaders.emplace_back(DeviceData.Data.Ptr(), DeviceData.Data.Size());
+                }
+                const Uint32 Index = it_inserted.first->second;
 
-            Serializer<SerializerMode::Write> Ser{SerializedIndex};
-            Ser(Index);
-            VERIFY_EXPR(Ser.IsEnded());
-        }
-    }
+                // For shaders, device-specific data is the serialized shader bytecode index
+                SerializedData& SerializedIndex = Shader.second->DeviceSpecific[device_type];
+
+                SerializedIndex = SerializedData{sizeof(Index), GetRawAllocator()};
+
+                Serializer<SerializerMode::Write> Ser{SerializedIndex};
+                Ser(Index);
+                VERIFY_EXPR(Ser.IsEnded());
+            }
+        });
+}
+
+Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+{
+    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
+    if (ppBlob == nullptr)
+        return false;
 
+    DeviceObjectArchive Archive{ContentVersion};
+    PrepareArchive(Archive);
     Archive.Serialize(ppBlob);
 
     return *ppBlob != nullptr;
 }
 
-
 Bool ArchiverImpl::SerializeToStream(Uint32 ContentVersion, IFileStream* pStream)
 {
     DEV_CHECK_ERR(pStream != nullptr, "pStream must not be null");
     if (pStream == nullptr)
         return false;
 
-    RefCntAutoPtr<IDataBlob> pDataBlob;
-    if (!SerializeToBlob(ContentVersion, &pDataBlob))
-        return false;
+    DeviceObjectArchive Archive{ContentVersion};
+    PrepareArchive(Archive);
 
-    return pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
+    // Write the archive directly to the stream without assembling it in memory
+    return Archive.Serialize(pStream);
 }
 
 template <typename ObjectImplType,
@@ -294,7 +327,19 @@ Bool ArchiverImpl::AddShader(IShader* pShader)
     if (pShader == nullptr)
         return false;
 
-    return AddObjectToArchive<SerializedShaderImpl>(pShader, "Shader", IID_SerializedShader, m_ShadersMtx, m_Shaders);
+    if (!AddObjectToArchive<SerializedShaderImpl>(pShader, "Shader", IID_SerializedShader, m_ShadersMtx, m_Shaders))
+        return false;
+
+    // Serialize and hash the device data once, so that it does not need to be
+    // processed every time the archive is serialized.
+    RefCntAutoPtr<SerializedShaderImpl> pSerializedShader{pShader, IID_SerializedShader};
+    if (pSerializedShader && !pSerializedShader->IsCompiling())
+    {
+        for (size_t device_type = 0; device_type < static_cast<size_t>(DeviceType::Count); ++device_type)
+            pSerializedShader->GetDeviceData(static_cast<DeviceType>(device_type));
+    }
+
+    return true;
 }
 
 bool ArchiverImpl::AddPipelineResourceSignature(IPipelineResourceSignature* pPRS)
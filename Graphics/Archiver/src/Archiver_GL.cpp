@@ -255,7 +255,7 @@ public:
         }
         if (m_UnrolledSource.empty())
         {
-            m_UnrolledSource = UnrollSource(m_ShaderCI);
+            m_UnrolledSource = UnrollSource(m_ShaderCI, *m_pSerializationDevice);
         }
         VERIFY_EXPR(!m_UnrolledSource.empty());
 
@@ -344,7 +344,7 @@ public:
     }
 
 private:
-    static String UnrollSource(const ShaderCreateInfo& CI)
+    static String UnrollSource(const ShaderCreateInfo& CI, const SerializationDeviceImpl& SerializationDevice)
     {
         String Source;
         if (CI.Macros)
@@ -354,7 +354,7 @@ private:
             else
                 DEV_ERROR("Shader macros are ignored when compiling GLSL verbatim in OpenGL backend");
         }
-        Source.append(UnrollShaderIncludes(CI));
+        Source.append(SerializationDevice.UnrollShaderIncludes(CI));
         return Source;
     }
 
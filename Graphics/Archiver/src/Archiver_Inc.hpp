@@ -131,9 +131,8 @@ void SerializedResourceSignatureImpl::CreateDeviceSignature(DeviceType
                                                             const PipelineResourceSignatureDesc& Desc,
                                                             SHADER_TYPE                          ShaderStages)
 {
-    using Traits                = SignatureTraits<SignatureImplType>;
-    using MeasureSerializerType = typename Traits::template PRSSerializerType<SerializerMode::Measure>;
-    using WriteSerializerType   = typename Traits::template PRSSerializerType<SerializerMode::Write>;
+    using Traits              = SignatureTraits<SignatureImplType>;
+    using WriteSerializerType = typename Traits::template PRSSerializerType<SerializerMode::Write>;
 
     VERIFY_EXPR(Type == Traits::Type || (Type == DeviceType::Metal_iOS && Traits::Type == DeviceType::Metal_MacOS));
     VERIFY(!m_pDeviceSignatures[static_cast<size_t>(Type)], "Signature for this device type has already been initialized");
@@ -153,29 +152,17 @@ void SerializedResourceSignatureImpl::CreateDeviceSignature(DeviceType
     // Check if the device signature description differs from common description
     bool SpecialDesc = !(CommonDesc == SignDesc);
 
-    {
-        Serializer<SerializerMode::Measure> MeasureSer;
-
-        MeasureSer(SpecialDesc);
-        if (SpecialDesc)
-            MeasureSerializerType::SerializeDesc(MeasureSer, SignDesc, nullptr);
+    SerializationBuffer Buffer{GetRawAllocator()};
 
-        MeasureSerializerType::SerializeInternalData(MeasureSer, InternalData, nullptr);
+    Serializer<SerializerMode::Write> Ser{Buffer};
 
-        DeviceSignature.Data = MeasureSer.AllocateData(GetRawAllocator());
-    }
+    Ser(SpecialDesc);
+    if (SpecialDesc)
+        WriteSerializerType::SerializeDesc(Ser, SignDesc, nullptr);
 
-    {
-        Serializer<SerializerMode::Write> Ser{DeviceSignature.Data};
+    WriteSerializerType::SerializeInternalData(Ser, InternalData, nullptr);
 
-        Ser(SpecialDesc);
-        if (SpecialDesc)
-            WriteSerializerType::SerializeDesc(Ser, SignDesc, nullptr);
-
-        WriteSerializerType::SerializeInternalData(Ser, InternalData, nullptr);
-
-        VERIFY_EXPR(Ser.IsEnded());
-    }
+    DeviceSignature.Data = Buffer.GetData(GetRawAllocator());
 }
 
 } // namespace Diligent
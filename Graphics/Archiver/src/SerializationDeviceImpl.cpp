@@ -279,6 +279,12 @@ PipelineResourceBinding SerializationDeviceImpl::ResDescToPipelineResBinding(con
     return BindigDesc;
 }
 
+std::string SerializationDeviceImpl::UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) const noexcept(false)
+{
+    std::lock_guard<std::mutex> Lock{m_IncludePreprocessorMtx};
+    return m_IncludePreprocessor.UnrollIncludes(ShaderCI);
+}
+
 void SerializationDeviceImpl::AddRenderDevice(IRenderDevice* pDevice)
 {
     if (pDevice == nullptr)
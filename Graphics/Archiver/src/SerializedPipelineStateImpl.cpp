@@ -280,24 +280,13 @@ void SerializedPipelineStateImpl::Initialize(const PSOCreateInfoType&        Cre
             PRSNames[i]     = pSignature->GetDesc().Name;
         }
 
-        auto SerializePsoCI = [&](auto& Ser) //
-        {
-            SerializePSOCreateInfo(Ser, CreateInfo, PRSNames);
-            constexpr auto SerMode = std::remove_reference<decltype(Ser)>::type::GetMode();
-            PSOSerializer<SerMode>::SerializeAuxData(Ser, m_Data.Aux, nullptr);
-        };
+        SerializationBuffer Buffer{GetRawAllocator()};
 
-        {
-            Serializer<SerializerMode::Measure> Ser;
-            SerializePsoCI(Ser);
-            m_Data.Common = Ser.AllocateData(GetRawAllocator());
-        }
+        Serializer<SerializerMode::Write> Ser{Buffer};
+        SerializePSOCreateInfo(Ser, CreateInfo, PRSNames);
+        PSOSerializer<SerializerMode::Write>::SerializeAuxData(Ser, m_Data.Aux, nullptr);
 
-        {
-            Serializer<SerializerMode::Write> Ser{m_Data.Common};
-            SerializePsoCI(Ser);
-            VERIFY_EXPR(Ser.IsEnded());
-        }
+        m_Data.Common = Buffer.GetData(GetRawAllocator());
     }
 
     m_Status.store(PIPELINE_STATE_STATUS_READY);
@@ -447,10 +436,10 @@ void SerializedPipelineStateImpl::SerializeShaderCreateInfo(DeviceType
     Data::ShaderInfo ShaderData;
     ShaderData.Data  = SerializedShaderImpl::SerializeCreateInfo(CI);
     ShaderData.Stage = CI.Desc.ShaderType;
-    ShaderData.Hash  = ShaderData.Data.GetHash();
+    ShaderData.Hash  = SerializedShaderImpl::ComputeHash(ShaderData.Data);
 #ifdef DILIGENT_DEBUG
     for (const SerializedPipelineStateImpl::Data::ShaderInfo& Data : m_Data.Shaders[static_cast<size_t>(Type)])
-        VERIFY(Data.Hash != ShaderData.Hash, "Shader with the same hash is already in the list.");
+        VERIFY(!(Data.Hash == ShaderData.Hash), "Shader with the same hash is already in the list.");
 #endif
     m_Data.Shaders[static_cast<size_t>(Type)].emplace_back(std::move(ShaderData));
 }
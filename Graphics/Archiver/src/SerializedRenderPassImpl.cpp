@@ -40,14 +40,12 @@ SerializedRenderPassImpl::SerializedRenderPassImpl(IReferenceCounters*      pRef
     if (Desc.Name == nullptr || Desc.Name[0] == '\0')
         LOG_ERROR_AND_THROW("Serialized render pass name can't be null or empty");
 
-    Serializer<SerializerMode::Measure> MeasureSer;
-    RPSerializer<SerializerMode::Measure>::SerializeDesc(MeasureSer, m_Desc, nullptr);
+    SerializationBuffer Buffer{GetRawAllocator()};
 
-    m_CommonData = MeasureSer.AllocateData(GetRawAllocator());
-
-    Serializer<SerializerMode::Write> Ser{m_CommonData};
+    Serializer<SerializerMode::Write> Ser{Buffer};
     RPSerializer<SerializerMode::Write>::SerializeDesc(Ser, m_Desc, nullptr);
-    VERIFY_EXPR(Ser.IsEnded());
+
+    m_CommonData = Buffer.GetData(GetRawAllocator());
 }
 
 SerializedRenderPassImpl::~SerializedRenderPassImpl()
@@ -143,13 +143,12 @@ void SerializedResourceSignatureImpl::InitCommonData(const PipelineResourceSigna
         // Note that since Desc is kept by the device signatures, there is no need to copy the data.
         m_pDesc = &Desc;
 
-        Serializer<SerializerMode::Measure> MeasureSer;
-        PRSSerializer<SerializerMode::Measure>::SerializeDesc(MeasureSer, Desc, nullptr);
+        SerializationBuffer Buffer{GetRawAllocator()};
 
-        m_CommonData = MeasureSer.AllocateData(GetRawAllocator());
-        Serializer<SerializerMode::Write> WSer{m_CommonData};
-        PRSSerializer<SerializerMode::Write>::SerializeDesc(WSer, Desc, nullptr);
-        VERIFY_EXPR(WSer.IsEnded());
+        Serializer<SerializerMode::Write> Ser{Buffer};
+        PRSSerializer<SerializerMode::Write>::SerializeDesc(Ser, Desc, nullptr);
+
+        m_CommonData = Buffer.GetData(GetRawAllocator());
 
         VERIFY_EXPR(GetDesc() == Desc);
     }
@@ -35,6 +35,8 @@
 #include "BasicMath.hpp"
 #include "PSOSerializer.hpp"
 
+#include "xxhash.h"
+
 namespace Diligent
 {
 
@@ -156,31 +158,40 @@ bool SerializedShaderImpl::operator==(const SerializedShaderImpl& Rhs) const noe
 
 SerializedData SerializedShaderImpl::SerializeCreateInfo(const ShaderCreateInfo& CI)
 {
-    SerializedData ShaderData;
+    // Serialize the data in a single pass. This avoids running the serializer twice
+    // to measure the size first, which is expensive for large shader sources.
+    SerializationBuffer Buffer{GetRawAllocator()};
 
-    {
-        Serializer<SerializerMode::Measure> Ser;
-        ShaderSerializer<SerializerMode::Measure>::SerializeCI(Ser, CI);
-        ShaderData = Ser.AllocateData(GetRawAllocator());
-    }
+    Serializer<SerializerMode::Write> Ser{Buffer};
+    ShaderSerializer<SerializerMode::Write>::SerializeCI(Ser, CI);
 
-    {
-        Serializer<SerializerMode::Write> Ser{ShaderData};
-        ShaderSerializer<SerializerMode::Write>::SerializeCI(Ser, CI);
-        VERIFY_EXPR(Ser.IsEnded());
-    }
+    return Buffer.GetData(GetRawAllocator());
+}
 
-    return ShaderData;
+XXH128Hash SerializedShaderImpl::ComputeHash(const SerializedData& Data)
+{
+    const XXH128_hash_t Hash = XXH3_128bits(Data.Ptr(), Data.Size());
+    return XXH128Hash{Hash.low64, Hash.high64};
 }
 
-SerializedData SerializedShaderImpl::GetDeviceData(DeviceType Type) const
+const SerializedShaderImpl::DeviceData& SerializedShaderImpl::GetDeviceData(DeviceType Type) const
 {
     DEV_CHECK_ERR(!IsCompiling(), "Device data is not available until compilation is complete. Use GetStatus() to check the shader status.");
 
-    const std::unique_ptr<CompiledShader>& pCompiledShader = m_Shaders[static_cast<size_t>(Type)];
-    return pCompiledShader ?
-        pCompiledShader->Serialize(GetCreateInfo()) :
-        SerializedData{};
+    const size_t TypeIdx = static_cast<size_t>(Type);
+    std::call_once(m_DeviceDataFlags[TypeIdx],
+                   [&]() {
+                       const std::unique_ptr<CompiledShader>& pCompiledShader = m_Shaders[TypeIdx];
+                       if (!pCompiledShader)
+                           return;
+
+                       DeviceData& Data = m_DeviceData[TypeIdx];
+                       Data.Data        = pCompiledShader->Serialize(GetCreateInfo());
+                       if (Data.Data)
+                           Data.Hash = ComputeHash(Data.Data);
+                   });
+
+    return m_DeviceData[TypeIdx];
 }
 
 IShader* SerializedShaderImpl::GetDeviceShader(RENDER_DEVICE_TYPE Type) const
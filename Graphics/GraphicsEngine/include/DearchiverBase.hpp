@@ -37,12 +37,14 @@
 #include "Dearchiver.h"
 #include "RenderDevice.h"
 #include "Shader.h"
+#include "ThreadPool.h"
 
 #include "ObjectBase.hpp"
 #include "EngineMemory.h"
 #include "RefCntAutoPtr.hpp"
 #include "DeviceObjectArchive.hpp"
 #include "DynamicLinearAllocator.hpp"
+#include "PipelineUsageTrace.hpp"
 
 namespace Diligent
 {
@@ -55,10 +57,9 @@ class DearchiverBase : public ObjectBase<IDearchiver>
 public:
     using TObjectBase = ObjectBase<IDearchiver>;
 
-    DearchiverBase(IReferenceCounters* pRefCounters, const DearchiverCreateInfo& CI) noexcept :
-        TObjectBase{pRefCounters}
-    {
-    }
+    DearchiverBase(IReferenceCounters* pRefCounters, const DearchiverCreateInfo& CI) noexcept;
+
+    ~DearchiverBase();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_Dearchiver, TObjectBase)
 
@@ -73,6 +74,20 @@ public:
     virtual void DILIGENT_CALL_TYPE UnpackPipelineState(const PipelineStateUnpackInfo& DeArchiveInfo,
                                                         IPipelineState**               ppPSO) override final;
 
+    /// Implementation of IDearchiver::UnpackPipelineStates().
+    virtual Uint32 DILIGENT_CALL_TYPE UnpackPipelineStates(const PipelineStateBatchUnpackInfo& BatchInfo,
+                                                           IPipelineState**                    ppPSOs,
+                                                           PSO_UNPACK_STATUS*                  pStatuses) override final;
+
+    /// Implementation of IDearchiver::PrefetchPipelineStates().
+    virtual Uint32 DILIGENT_CALL_TYPE PrefetchPipelineStates(const PipelineStatePrefetchInfo& PrefetchInfo) override final;
+
+    /// Implementation of IDearchiver::GetPrefetchStats().
+    virtual void DILIGENT_CALL_TYPE GetPrefetchStats(DearchiverPrefetchStats& Stats) const override final;
+
+    /// Implementation of IDearchiver::WriteUsageTrace().
+    virtual Bool DILIGENT_CALL_TYPE WriteUsageTrace(IFileStream* pStream) const override final;
+
     /// Implementation of IDearchiver::UnpackResourceSignature().
     virtual void DILIGENT_CALL_TYPE UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo,
                                                             IPipelineResourceSignature**       ppSignature) override final;
@@ -157,6 +172,8 @@ protected:
     static DeviceType GetArchiveDeviceType(const IRenderDevice* pDevice);
 
 private:
+    struct PSODataBase;
+
     template <typename CreateInfoType>
     struct PSOData;
 
@@ -202,16 +219,69 @@ private:
     template <typename CreateInfoType>
     bool UnpackPSORenderPass(PSOData<CreateInfoType>& PSO, IRenderDevice* pDevice) { return true; }
 
+    bool UnpackPSOShaders(ArchiveData&   Archive,
+                          PSODataBase&   PSO,
+                          IRenderDevice* pDevice);
+
+    RefCntAutoPtr<IShader> UnpackArchivedShader(ArchiveData&   Archive,
+                                                DeviceType     DevType,
+                                                Uint32         Idx,
+                                                bool           SkipReflection,
+                                                IRenderDevice* pDevice);
+
     template <typename CreateInfoType>
-    bool UnpackPSOShaders(ArchiveData&             Archive,
-                          PSOData<CreateInfoType>& PSO,
-                          IRenderDevice*           pDevice);
+    bool LoadPSOData(const ArchiveData&             Archive,
+                     const PipelineStateUnpackInfo& UnpackInfo,
+                     PSOData<CreateInfoType>&       PSO);
+
+    template <typename CreateInfoType>
+    void CreatePSO(ArchiveData&                   Archive,
+                   const PipelineStateUnpackInfo& UnpackInfo,
+                   PSOData<CreateInfoType>&       PSO,
+                   PSO_CREATE_FLAGS               CreateFlags,
+                   IPipelineState**               ppPSO);
 
     template <typename CreateInfoType>
     void UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO);
 
+    static std::unique_ptr<PSODataBase> CreatePSOData(PIPELINE_TYPE PipelineType);
+
     ArchiveData* FindArchive(ResourceType ResType, const char* ResName);
 
+    struct PrefetchedPSO
+    {
+        ArchiveData&         Archive;
+        const PIPELINE_TYPE  PipelineType;
+        const char* const    Name;
+        IRenderDevice* const pDevice;
+        const Uint64         MaxPendingDataSize;
+
+        // Null until the prefetch is complete
+        std::unique_ptr<PSODataBase> pData;
+
+        // The size of the data counted towards the pending data size
+        Uint64 DataSize = 0;
+
+        // The entry has been removed from the map before the prefetch was complete
+        bool IsAbandoned = false;
+
+        PrefetchedPSO(ArchiveData& _Archive, PIPELINE_TYPE _PipelineType, const char* _Name, IRenderDevice* _pDevice, Uint64 _MaxPendingDataSize) noexcept :
+            Archive{_Archive},
+            PipelineType{_PipelineType},
+            Name{_Name},
+            pDevice{_pDevice},
+            MaxPendingDataSize{_MaxPendingDataSize}
+        {}
+    };
+
+    void PrefetchPSO(PrefetchedPSO& Entry);
+
+    // Returns the prefetched data of the pipeline state and removes it from the prefetch map.
+    std::unique_ptr<PSODataBase> TakePrefetchedPSO(ResourceType ResType, const char* Name, IRenderDevice* pDevice);
+
+    // Waits until all prefetch tasks are complete. If Cancel is true, the tasks that have not started are removed from the queue.
+    void WaitForPrefetchTasks(bool Cancel);
+
 private:
     // Resource type and name -> archive index that contains this resource.
     // Names must be unique for each resource type.
@@ -219,6 +289,21 @@ private:
     std::unordered_map<NamedResourceKey, size_t, NamedResourceKey::Hasher> m_ResNameToArchiveIdx;
 
     std::vector<ArchiveData> m_Archives;
+
+    struct PrefetchState
+    {
+        mutable std::mutex Mtx;
+
+        // Names are owned by the archives
+        std::unordered_map<NamedResourceKey, std::shared_ptr<PrefetchedPSO>, NamedResourceKey::Hasher> PSOs;
+
+        std::vector<std::pair<RefCntAutoPtr<IThreadPool>, RefCntAutoPtr<IAsyncTask>>> Tasks;
+
+        DearchiverPrefetchStats Stats;
+    } m_Prefetch;
+
+    // Null if the usage trace is disabled
+    std::unique_ptr<PipelineUsageTrace> m_pUsageTrace;
 };
 
 
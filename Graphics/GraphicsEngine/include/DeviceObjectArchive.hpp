@@ -32,9 +32,13 @@
 #include <array>
 #include <vector>
 #include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <string>
 
 #include "GraphicsTypes.h"
 #include "FileStream.h"
+#include "ThreadPool.h"
 
 #include "HashUtils.hpp"
 #include "RefCntAutoPtr.hpp"
@@ -44,22 +48,34 @@
 
 // Device object archive structure:
 //
-// | Header |  Resource Data  |  Shader Data  |
+// | Header |  Index  |  Resource Data  |  Shader Data  |
 //
-//     |  Resource Data  | = | Res1 | Res2 | ... | ResN |
+//     |  Index  | = | NumResources | Res1 Entry | ... | ResN Entry | OpenGL shader table | ... | Metal-iOS shader table |
 //
-//         | ResI | = | Type | Name | Common Data |  OpenGL data | D3D11 data | ...  | Metal-iOS data |
+//         | ResI Entry | = | Type | Name | Common data location | OpenGL data location | ... | Metal-iOS data location |
+//
+//         | Shader table | = | NumShaders | Shader 0 location | ... | Shader M location |
+//
+//     |  Resource Data  | = | Res1 data | Res2 data | ... | ResN data |
+//
+//         | ResI data | = | Common Data |  OpenGL data | D3D11 data | ...  | Metal-iOS data |
 //
 //     |  Shader Data  | =  |  OpenGL shaders | D3D11 shaders | ...  | Metal-iOS shaders |
 //
 // The header contains general information such as:
 // - Magic number
 // - Archive version
+// - Index size
 // - API version
-
+//
+// The index contains one entry for every resource sorted by type and name, followed
+// by the shader location tables for each device type. Every location is the offset of the
+// data blob from the beginning of the archive, its size, the compression codec and the
+// uncompressed size. Reading the index is all that is needed to open the archive, so the
+// resource and shader data (e.g. in a memory-mapped file) is not touched until the resource
+// is actually unpacked. Compressed blobs are decompressed on first access.
+//
 // Resource data contains an array of resources. Each resource contains:
-// - Type (Signature, Graphics Pipeline, Render Pass, etc.)
-// - Name
 // - Common data (e.g. a resource description)
 // - Device-specific data (e.g. shader indices)
 //
@@ -69,12 +85,16 @@
 // For pipelines, device-specific data is the array of shader indices in the
 // archive's shader array, e.g.:
 //
-// | PsoX | = |   Type   |   Name   |   Common Data   |   OpenGL data   |    D3D11 data   | ...
-//              Graphics   "My PSO"    <Description>        {0, 1}             {1, 2}
-//                                                                  ____________|  |
-//                                                                 |               |
-//                                                                 V               V
+// | PsoX | = |   Common Data   |   OpenGL data   |    D3D11 data   | ...
+//              <Description>        {0, 1}             {1, 2}
+//                                         ____________|  |
+//                                        |               |
+//                                        V               V
 // | GL Shader 0 | GL Shader 1 |  ... | D3D11 Shader 0 | D3D11 Shader 1 | D3D11 Shader 2 | ...
+//
+// Archives of version 8 do not have the index: resource type, name and data are stored
+// sequentially, and each data blob is prefixed with its size. Such archives can still be
+// read, but the whole archive has to be traversed when it is opened.
 
 namespace Diligent
 {
@@ -128,7 +148,59 @@ public:
     };
 
     static constexpr Uint32 HeaderMagicNumber = 0xDE00000A;
-    static constexpr Uint32 ArchiveVersion    = 8;
+    static constexpr Uint32 ArchiveVersion    = 9;
+
+    // The oldest archive version that can still be deserialized.
+    static constexpr Uint32 MinSupportedArchiveVersion = 8;
+
+    // Built-in data compression codecs.
+    enum class CodecId : Uint32
+    {
+        None = 0,
+        LZ,
+
+        // Custom codecs must use identifiers starting from this value.
+        FirstCustom = 256
+    };
+
+    // Data blob compression codec.
+    // The codec identifier is recorded in the archive for every compressed blob,
+    // so the same codec must be available when the archive is loaded.
+    class Codec
+    {
+    public:
+        virtual ~Codec() {}
+
+        virtual Uint32 GetId() const = 0;
+
+        // Returns the destination buffer size that is sufficient to compress SrcSize bytes.
+        virtual size_t GetMaxCompressedSize(size_t SrcSize) const = 0;
+
+        // Returns the compressed data size, or 0 if the data could not be compressed.
+        virtual size_t Compress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity) const = 0;
+
+        // Returns the maximum size of the data that SrcSize compressed bytes may expand to.
+        // Uncompressed sizes recorded in the archive are validated against this value
+        // before any memory is allocated.
+        virtual size_t GetMaxDecompressedSize(size_t SrcSize) const = 0;
+
+        virtual bool Decompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize) const = 0;
+    };
+
+    // Returns the built-in LZ codec.
+    static const Codec& GetLZCodec();
+
+    struct CompressionInfo
+    {
+        // Codec to compress the data blobs with. If null, the data is not compressed.
+        const Codec* pCodec = nullptr;
+
+        // Blobs smaller than this size are always stored uncompressed.
+        Uint32 MinBlobSize = 64;
+
+        // An optional thread pool to compress the data in parallel.
+        IThreadPool* pThreadPool = nullptr;
+    };
 
     struct ArchiveHeader
     {
@@ -136,6 +208,7 @@ public:
 
         Uint32      MagicNumber    = HeaderMagicNumber;
         Uint32      Version        = ArchiveVersion;
+        Uint32      IndexSize      = 0; // Including the header; data blobs follow the index
         Uint32      APIVersion     = DILIGENT_API_VERSION;
         Uint32      ContentVersion = 0;
         const char* GitHash        = nullptr;
@@ -215,6 +288,94 @@ public:
         HashMapStringKey   Name;
     };
 
+    // Location of the data blob in the indexed archive
+    struct BlobLocation
+    {
+        // Offset from the beginning of the archive
+        Uint64 Offset = 0;
+        Uint32 Size   = 0;
+
+        // Compression codec, see DeviceObjectArchive::CodecId
+        Uint32 CodecId          = 0;
+        Uint32 UncompressedSize = 0;
+    };
+
+    // Data blobs are aligned the same way as SerializedData in the sequential archive
+    static constexpr size_t BlobAlignment = 8;
+
+    // Archive index: resource names and locations of all data blobs.
+    // The index can be read from a stream without loading the resource and shader data.
+    struct ArchiveIndex
+    {
+        struct Resource
+        {
+            ResourceType Type = ResourceType::Undefined;
+            const char*  Name = nullptr;
+
+            // Common data location followed by device-specific data locations
+            std::array<BlobLocation, 1 + static_cast<size_t>(DeviceType::Count)> Blobs;
+        };
+
+        Uint32 Version        = ArchiveVersion;
+        Uint32 ContentVersion = 0;
+
+        std::vector<Resource> Resources;
+
+        std::array<std::vector<BlobLocation>, static_cast<size_t>(DeviceType::Count)> Shaders;
+
+        // Index data that resource names point to
+        std::vector<Uint8> Data;
+    };
+
+    // Reads the archive index from the stream. Resource and shader data are not read.
+    // The archive must start at the beginning of the stream. The index size is taken from
+    // the header, so exactly the index is read from the stream.
+    static bool ReadIndex(IFileStream* pStream, ArchiveIndex& Index) noexcept;
+
+    // Writes the index to the buffer. Data blobs are placed after the index in the order of
+    // resources (common data first) followed by shaders of each device type. Blob offsets
+    // in the index are updated; all other location fields must be set by the caller.
+    // Returns the total archive size, or 0 if the index could not be written.
+    static size_t WriteIndex(ArchiveIndex& Index, SerializationBuffer& Buffer);
+
+    // Merges archives read from the source streams and writes the result to the destination stream.
+    // The archives are not loaded into memory: only the indices and pipeline shader indices are read,
+    // while resource and shader data is copied between the streams as is, without decompression.
+    // Shaders whose stored data is identical are only written once.
+    // If the resource is present in several archives, the first one is used.
+    //
+    // Custom codecs are only required to read compressed pipeline shader indices.
+    static bool MergeStreams(IFileStream* const* ppSrcStreams,
+                             Uint32              NumSrcStreams,
+                             IFileStream*        pDstStream,
+                             const Codec* const* ppCodecs  = nullptr,
+                             Uint32              NumCodecs = 0) noexcept;
+
+    enum class DiffType : Uint32
+    {
+        Added,
+        Removed,
+        Modified
+    };
+
+    struct ResourceDiff
+    {
+        DiffType     Type    = DiffType::Modified;
+        ResourceType ResType = ResourceType::Undefined;
+        std::string  Name;
+    };
+
+    // Compares resources of two archives read from the streams. The result is sorted by resource type and name.
+    // Data is compared by the uncompressed content, so the compression and the shader order in the archives
+    // do not matter. Pipelines and standalone shaders are compared by the content of the shaders they reference.
+    static bool DiffStreams(IFileStream*               pStream0,
+                            IFileStream*               pStream1,
+                            std::vector<ResourceDiff>& Diffs,
+                            const Codec* const*        ppCodecs  = nullptr,
+                            Uint32                     NumCodecs = 0) noexcept;
+
+    static const char* ResourceTypeToString(ResourceType Type);
+
     const IDataBlob* GetData() const
     {
         return m_pArchiveData;
@@ -231,6 +392,11 @@ public:
         const IDataBlob* pData          = nullptr;
         Uint32           ContentVersion = ~0u;
         bool             MakeCopy       = false;
+
+        // Custom codecs in addition to the built-in ones.
+        // Codec objects must outlive the archive.
+        const Codec* const* ppCodecs  = nullptr;
+        Uint32              NumCodecs = 0;
     };
     /// Initializes a new device object archive from pData.
     explicit DeviceObjectArchive(const CreateInfo& CI) noexcept(false);
@@ -240,14 +406,53 @@ public:
 
     void RemoveDeviceData(DeviceType Dev) noexcept(false);
     void AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false);
-    void Merge(const DeviceObjectArchive& Src) noexcept(false);
+    // Merges the source archives into this archive. Identical shader byte code is only stored once.
+    // If the resource is present in several archives, the first one is used.
+    void Merge(const DeviceObjectArchive* const* ppSrcArchives, size_t NumSrcArchives) noexcept(false);
+    void Merge(const DeviceObjectArchive& Src) noexcept(false)
+    {
+        const DeviceObjectArchive* pSrc = &Src;
+        Merge(&pSrc, 1);
+    }
 
     bool Deserialize(const CreateInfo& CI) noexcept;
-    void Serialize(IFileStream* pStream) const;
+    // Writes the archive to the stream. The data is written directly to the stream
+    // without assembling the archive in memory.
+    bool Serialize(IFileStream* pStream) const;
     void Serialize(IDataBlob** ppDataBlob) const;
 
     std::string ToString() const;
 
+    // Sets the compression that is used when the archive is serialized.
+    void SetCompression(const CompressionInfo& Compression) noexcept
+    {
+        m_Compression = Compression;
+    }
+
+    // Decompresses all compressed data blobs, optionally in parallel.
+    // This is not required as the data is decompressed on first access,
+    // but may be used to move the decompression off the critical path.
+    //
+    // The method is thread-safe.
+    void Decompress(IThreadPool* pThreadPool = nullptr) const noexcept;
+
+    // Returns the uncompressed data for the data blob of this archive (e.g. resource data
+    // returned by GetNamedResources). If the blob is compressed, it is decompressed on first access.
+    // Compressed blobs are identified by their location in the archive data, so the method may be
+    // called for any data slot that references the blob.
+    //
+    // The method is thread-safe.
+    const SerializedData& GetUncompressedData(const SerializedData& Data) const noexcept
+    {
+        return m_CompressedBlobs.empty() ? Data : DecompressBlob(Data);
+    }
+
+    // Returns the size of the uncompressed data for the data blob of this archive
+    // without decompressing it.
+    //
+    // The method is thread-safe.
+    size_t GetUncompressedSize(const SerializedData& Data) const noexcept;
+
     template <typename ReourceDataType>
     bool LoadResourceCommonData(ResourceType     Type,
                                 const char*      Name,
@@ -263,7 +468,7 @@ public:
         // Use string copy from the map
         Name = it->first.GetName();
 
-        Serializer<SerializerMode::Read> Ser{it->second.Common};
+        Serializer<SerializerMode::Read> Ser{GetUncompressedData(it->second.Common)};
 
         auto Res = ResData.Deserialize(Name, Ser);
         VERIFY_EXPR(Ser.IsEnded());
@@ -276,12 +481,14 @@ public:
 
     ResourceData& GetResourceData(ResourceType Type, const char* Name) noexcept
     {
+        ResolveCompressedBlobs();
         constexpr bool MakeCopy = true;
         return m_NamedResources[NamedResourceKey{Type, Name, MakeCopy}];
     }
 
     auto& GetDeviceShaders(DeviceType Type) noexcept
     {
+        ResolveCompressedBlobs();
         return m_DeviceShaders[static_cast<size_t>(Type)];
     }
 
@@ -289,12 +496,20 @@ public:
     {
         const auto& DeviceShaders = m_DeviceShaders[static_cast<size_t>(Type)];
         if (Idx < DeviceShaders.size())
-            return DeviceShaders[Idx];
+            return GetUncompressedData(DeviceShaders[Idx]);
 
         static const SerializedData NullData;
         return NullData;
     }
 
+    // Returns the uncompressed size of the serialized shader without decompressing it.
+    size_t GetSerializedShaderSize(DeviceType Type, size_t Idx) const noexcept
+    {
+        const auto& DeviceShaders = m_DeviceShaders[static_cast<size_t>(Type)];
+        return Idx < DeviceShaders.size() ? GetUncompressedSize(DeviceShaders[Idx]) : 0;
+    }
+
+    // Note that the resource data may be compressed, use GetUncompressedData() to access it.
     const auto& GetNamedResources() const
     {
         return m_NamedResources;
@@ -302,6 +517,39 @@ public:
 
     void Clear() noexcept;
 
+private:
+    bool ReadIndexedResources(Serializer<SerializerMode::Read>& Reader, const CreateInfo& CI) noexcept;
+    bool ReadSequentialResources(Serializer<SerializerMode::Read>& Reader) noexcept;
+
+    const SerializedData& DecompressBlob(const SerializedData& Data) const noexcept;
+
+    struct SerializationLayout;
+    void PrepareSerialization(SerializationLayout& Layout) const;
+
+    // For every device type, maps the shader byte code to its index in m_DeviceShaders.
+    // Keys reference the data owned by m_DeviceShaders.
+    using ShaderIndexMapsType = std::array<std::unordered_map<SerializedData, Uint32, SerializedData::Hasher>, static_cast<size_t>(DeviceType::Count)>;
+    void MergeArchive(const DeviceObjectArchive& Src, ShaderIndexMapsType& DstShaderToIdx) noexcept(false);
+
+    // Moves decompressed data to the resource and shader data. Must be called before the archive is modified.
+    void ResolveCompressedBlobs() noexcept
+    {
+        if (!m_CompressedBlobs.empty())
+            ResolveCompressedBlobsImpl();
+    }
+    void ResolveCompressedBlobsImpl() noexcept;
+
+    struct CompressedBlob
+    {
+        const Codec* pCodec           = nullptr;
+        const void*  pData            = nullptr;
+        Uint32       Size             = 0;
+        Uint32       UncompressedSize = 0;
+
+        std::once_flag DecompressFlag;
+        SerializedData Uncompressed;
+    };
+
 private:
     // Named resources
     std::unordered_map<NamedResourceKey, ResourceData, NamedResourceKey::Hasher> m_NamedResources;
@@ -309,11 +557,18 @@ private:
     // Shaders
     std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)> m_DeviceShaders;
 
+    // Compressed data blobs, keyed by their location in the archive data.
+    // Resource and shader data slots reference the compressed bytes until the blobs are resolved.
+    // The map is not modified after the archive is loaded, so it can be safely accessed by multiple threads.
+    std::unordered_map<const void*, std::unique_ptr<CompressedBlob>> m_CompressedBlobs;
+
     // Strong reference to the original data blob.
     // Resources will not make copies and reference this data.
     RefCntAutoPtr<IDataBlob> m_pArchiveData;
 
     Uint32 m_ContentVersion = 0;
+
+    CompressionInfo m_Compression;
 };
 
 DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVICE_TYPE Type);
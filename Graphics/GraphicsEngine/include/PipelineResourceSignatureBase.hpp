@@ -623,6 +623,40 @@ public:
         return true;
     }
 
+    /// Implementation of IPipelineResourceSignature::GetSRBVariableIndex.
+    virtual Uint32 DILIGENT_CALL_TYPE GetSRBVariableIndex(SHADER_TYPE ShaderType, const Char* Name) const override final
+    {
+        if (!IsConsistentShaderType(ShaderType, m_PipelineType))
+        {
+            LOG_WARNING_MESSAGE("Unable to find mutable/dynamic variable '", Name, "' in shader stage ", GetShaderTypeLiteralName(ShaderType),
+                                " as the stage is invalid for ", GetPipelineTypeString(m_PipelineType), " pipeline resource signature '", this->m_Desc.Name, "'.");
+            return ~0u;
+        }
+
+        if ((m_ShaderStages & ShaderType) == 0)
+            return ~0u;
+
+        // Active shader stages are enumerated from the least significant bit, see GetActiveShaderStageType()
+        const Uint32  StageIndex       = PlatformMisc::CountOneBits(Uint32{m_ShaderStages} & (Uint32{ShaderType} - 1u));
+        const Uint32  FirstSRBResource = m_ResourceOffsets[SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE];
+        const Uint32* pStageVarIndices = m_pSRBVariableIndices + size_t{StageIndex} * GetNumSRBResources();
+
+        const std::pair<const Uint32*, const Uint32*> Range = GetResourceNameRange(Name);
+        for (const Uint32* pResIdx = Range.first; pResIdx != Range.second; ++pResIdx)
+        {
+            // Static resources precede mutable and dynamic ones and have no SRB variables
+            if (*pResIdx < FirstSRBResource)
+                continue;
+
+            // The index is only set for the resources that have a variable in this stage
+            const Uint32 VarIndex = pStageVarIndices[*pResIdx - FirstSRBResource];
+            if (VarIndex != ~0u)
+                return VarIndex;
+        }
+
+        return ~0u;
+    }
+
     bool IsIncompatibleWith(const PipelineResourceSignatureImplType& Other) const
     {
         return GetHash() != Other.GetHash();
@@ -645,6 +679,12 @@ public:
         return std::pair<Uint32, Uint32>{m_ResourceOffsets[VarType], m_ResourceOffsets[size_t{VarType} + 1]};
     }
 
+    // Returns the number of mutable and dynamic resources.
+    Uint32 GetNumSRBResources() const
+    {
+        return m_ResourceOffsets[SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES] - m_ResourceOffsets[SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE];
+    }
+
     // Returns the number of shader stages that have resources.
     Uint32 GetNumActiveShaderStages() const
     {
@@ -679,7 +719,26 @@ public:
     /// index in m_Desc.Resources[], or InvalidPipelineResourceIndex if the resource is not found.
     Uint32 FindResource(SHADER_TYPE ShaderStage, const char* ResourceName) const
     {
-        return Diligent::FindResource(this->m_Desc.Resources, this->m_Desc.NumResources, ShaderStage, ResourceName);
+        if (m_pResourceNameIndex == nullptr)
+            return Diligent::FindResource(this->m_Desc.Resources, this->m_Desc.NumResources, ShaderStage, ResourceName);
+
+        const std::pair<const Uint32*, const Uint32*> Range = GetResourceNameRange(ResourceName);
+        for (const Uint32* pResIdx = Range.first; pResIdx != Range.second; ++pResIdx)
+        {
+            if ((this->m_Desc.Resources[*pResIdx].ShaderStages & ShaderStage) != 0)
+                return *pResIdx;
+        }
+        return InvalidPipelineResourceIndex;
+    }
+
+    /// Returns the range of indices in m_Desc.Resources[] of all resources with the given name.
+    /// The indices in the range are sorted in ascending order.
+    std::pair<const Uint32*, const Uint32*> GetResourceNameRange(const char* ResourceName) const
+    {
+        VERIFY(m_pResourceNameIndex != nullptr || this->m_Desc.NumResources == 0, "Resource name index has not been initialized");
+        const PipelineResourceDesc* const Resources = this->m_Desc.Resources;
+        return std::equal_range(m_pResourceNameIndex, m_pResourceNameIndex + this->m_Desc.NumResources, ResourceName,
+                                ResourceNameIndexCompare{Resources});
     }
 
     /// Finds an immutable with the given name in the specified shader stage and returns its
@@ -819,6 +878,16 @@ protected:
             Allocator.AddSpace<RefCntAutoPtr<SamplerImplType>>(Desc.NumImmutableSamplers);
         }
 
+        Allocator.AddSpace<Uint32>(Desc.NumResources);
+
+        Uint32 NumSRBResources = 0;
+        for (Uint32 r = 0; r < Desc.NumResources; ++r)
+        {
+            if (Desc.Resources[r].VarType != SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+                ++NumSRBResources;
+        }
+        Allocator.AddSpace<Uint32>(size_t{GetNumActiveShaderStages()} * NumSRBResources);
+
         Allocator.Reserve();
         // The memory is now owned by PipelineResourceSignatureBase and will be freed by Destruct().
         m_pRawMemory = decltype(m_pRawMemory){Allocator.ReleaseOwnership(), STDDeleterRawMem<void>{RawAllocator}};
@@ -870,10 +939,20 @@ protected:
             }
         }
 
+        m_pResourceNameIndex = Allocator.Allocate<Uint32>(Desc.NumResources);
+        for (Uint32 r = 0; r < this->m_Desc.NumResources; ++r)
+            m_pResourceNameIndex[r] = r;
+        std::sort(m_pResourceNameIndex, m_pResourceNameIndex + this->m_Desc.NumResources, ResourceNameIndexCompare{this->m_Desc.Resources});
+
+        VERIFY_EXPR(GetNumSRBResources() == NumSRBResources);
+        m_pSRBVariableIndices = Allocator.Allocate<Uint32>(size_t{GetNumActiveShaderStages()} * NumSRBResources);
+
         InitResourceLayout();
 
         PipelineResourceSignatureImplType* const pThisImpl = static_cast<PipelineResourceSignatureImplType*>(this);
 
+        InitSRBVariableIndices();
+
         if (NumStaticResStages > 0)
         {
             constexpr SHADER_RESOURCE_VARIABLE_TYPE AllowedVarTypes[] = {SHADER_RESOURCE_VARIABLE_TYPE_STATIC};
@@ -970,6 +1049,29 @@ protected:
         return UpdatedDesc;
     }
 
+private:
+    // Computes the SRB variable indices of mutable and dynamic resources, see GetSRBVariableIndex().
+    void InitSRBVariableIndices()
+    {
+        const PipelineResourceSignatureImplType* const pThisImpl = static_cast<const PipelineResourceSignatureImplType*>(this);
+
+        const Uint32 FirstSRBResource = m_ResourceOffsets[SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE];
+        const Uint32 NumSRBResources  = GetNumSRBResources();
+
+        std::vector<Uint32> VarIndices(this->m_Desc.NumResources);
+        for (Uint32 s = 0; s < GetNumActiveShaderStages(); ++s)
+        {
+            std::fill(VarIndices.begin(), VarIndices.end(), ~0u);
+
+            // Use the same variable types as ShaderResourceBindingBase
+            constexpr SHADER_RESOURCE_VARIABLE_TYPE AllowedVarTypes[] = {SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC};
+            ShaderVariableManagerImplType::GetVariableIndices(*pThisImpl, AllowedVarTypes, _countof(AllowedVarTypes), GetActiveShaderStageType(s), VarIndices.data());
+
+            std::copy(VarIndices.begin() + FirstSRBResource, VarIndices.begin() + FirstSRBResource + NumSRBResources,
+                      m_pSRBVariableIndices + size_t{s} * NumSRBResources);
+        }
+    }
+
 protected:
     void Destruct()
     {
@@ -1006,6 +1108,8 @@ protected:
         m_pResourceAttribs = nullptr;
         static_assert(std::is_trivially_destructible<ImmutableSamplerAttribsType>::value, "Destructors for m_pImmutableSamplerAttribs[] are required");
         m_pImmutableSamplerAttribs = nullptr;
+        m_pResourceNameIndex       = nullptr;
+        m_pSRBVariableIndices      = nullptr;
 
         if (m_pImmutableSamplers != nullptr)
         {
@@ -1049,6 +1153,26 @@ protected:
         return SamplerInd;
     }
 
+    // Orders resource indices by resource name, and then by index.
+    struct ResourceNameIndexCompare
+    {
+        const PipelineResourceDesc* const Resources;
+
+        bool operator()(Uint32 Idx0, Uint32 Idx1) const
+        {
+            const int Cmp = strcmp(Resources[Idx0].Name, Resources[Idx1].Name);
+            return Cmp != 0 ? Cmp < 0 : Idx0 < Idx1;
+        }
+        bool operator()(Uint32 Idx, const char* Name) const
+        {
+            return strcmp(Resources[Idx].Name, Name) < 0;
+        }
+        bool operator()(const char* Name, Uint32 Idx) const
+        {
+            return strcmp(Name, Resources[Idx].Name) < 0;
+        }
+    };
+
     void CalculateHash()
     {
         const PipelineResourceSignatureImplType* const pThisImpl = static_cast<const PipelineResourceSignatureImplType*>(this);
@@ -1079,6 +1203,13 @@ protected:
     // Static variables manager for every shader stage
     ShaderVariableManagerImplType* m_StaticVarsMgrs = nullptr; // [GetNumStaticResStages()]
 
+    // Indices of resources in m_Desc.Resources[] sorted by resource name, and then by index.
+    Uint32* m_pResourceNameIndex = nullptr; // [m_Desc.NumResources]
+
+    // For every active shader stage, the index of the variable that SRBs create for every
+    // mutable and dynamic resource, or ~0u if the resource has no variable in this stage.
+    Uint32* m_pSRBVariableIndices = nullptr; // [GetNumActiveShaderStages() * GetNumSRBResources()]
+
     size_t m_Hash = 0;
 
     // Resource offsets (e.g. index of the first resource), for each variable type.
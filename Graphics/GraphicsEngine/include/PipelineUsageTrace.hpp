@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::PipelineUsageTrace class
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "GraphicsTypes.h"
+#include "DataBlob.h"
+#include "FileStream.h"
+
+#include "HashUtils.hpp"
+#include "Timer.hpp"
+
+namespace Diligent
+{
+
+/// Records the shaders and pipeline states requested by the application.
+
+/// Every object is recorded once, at the time of its first request, so that the trace
+/// lists the objects in the order of first use. The trace can be used to build an archive
+/// that only contains the objects the application actually needs.
+///
+/// All methods are thread-safe.
+class PipelineUsageTrace
+{
+public:
+    static constexpr Uint32 MagicNumber  = 0xDE00715E;
+    static constexpr Uint32 TraceVersion = 1;
+
+    struct Entry
+    {
+        /// Pipeline type, or PIPELINE_TYPE_INVALID for standalone shaders.
+        PIPELINE_TYPE PipelineType = PIPELINE_TYPE_INVALID;
+
+        /// The name the object was requested with.
+        std::string Name;
+
+        /// 128-bit hash of the object create info, or zero if the create info is not known.
+        Uint64 HashLow  = 0;
+        Uint64 HashHigh = 0;
+
+        /// Time of the first request, in microseconds since the trace was started.
+        Uint64 FirstUseTime = 0;
+
+        /// The total number of requests.
+        Uint32 NumRequests = 0;
+
+        bool IsShader() const { return PipelineType == PIPELINE_TYPE_INVALID; }
+
+        bool operator==(const Entry& RHS) const;
+    };
+
+    PipelineUsageTrace();
+
+    // clang-format off
+    PipelineUsageTrace           (const PipelineUsageTrace&)  = delete;
+    PipelineUsageTrace           (      PipelineUsageTrace&&) = delete;
+    PipelineUsageTrace& operator=(const PipelineUsageTrace&)  = delete;
+    PipelineUsageTrace& operator=(      PipelineUsageTrace&&) = delete;
+    // clang-format on
+
+    /// Records the request of a standalone shader.
+    void RecordShader(const char* Name, Uint64 HashLow = 0, Uint64 HashHigh = 0)
+    {
+        Record(PIPELINE_TYPE_INVALID, Name, HashLow, HashHigh);
+    }
+
+    /// Records the request of a pipeline state.
+    void RecordPipeline(PIPELINE_TYPE PipelineType, const char* Name, Uint64 HashLow = 0, Uint64 HashHigh = 0)
+    {
+        VERIFY_EXPR(PipelineType != PIPELINE_TYPE_INVALID);
+        Record(PipelineType, Name, HashLow, HashHigh);
+    }
+
+    /// Returns the recorded entries in the order of first use.
+    std::vector<Entry> GetEntries() const;
+
+    size_t GetNumEntries() const;
+
+    /// Removes all entries and restarts the timer.
+    void Clear();
+
+    /// Writes the trace to the data blob.
+    void Serialize(IDataBlob** ppBlob) const;
+
+    /// Writes the trace to the file stream.
+    bool Serialize(IFileStream* pStream) const;
+
+    /// Reads the trace written by Serialize().
+    static bool Deserialize(const void* pData, size_t Size, std::vector<Entry>& Entries);
+
+private:
+    void Record(PIPELINE_TYPE PipelineType, const char* Name, Uint64 HashLow, Uint64 HashHigh);
+
+    struct EntryKey
+    {
+        PIPELINE_TYPE    PipelineType;
+        Uint64           HashLow;
+        Uint64           HashHigh;
+        HashMapStringKey Name;
+
+        bool operator==(const EntryKey& RHS) const noexcept
+        {
+            return PipelineType == RHS.PipelineType && HashLow == RHS.HashLow && HashHigh == RHS.HashHigh && Name == RHS.Name;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const EntryKey& Key) const noexcept
+            {
+                return ComputeHash(Key.PipelineType, Key.HashLow, Key.HashHigh, Key.Name.GetHash());
+            }
+        };
+    };
+
+    mutable std::mutex m_Mtx;
+
+    Timer m_Timer;
+
+    std::vector<Entry> m_Entries;
+
+    // Entry key -> index in m_Entries
+    std::unordered_map<EntryKey, size_t, EntryKey::Hasher> m_EntryIdx;
+};
+
+} // namespace Diligent
@@ -122,6 +122,16 @@ public:
                 // Note that the cache has space for all variable types
                 const SHADER_RESOURCE_VARIABLE_TYPE VarTypes[] = {SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC};
                 m_pShaderVarMgrs[MgrInd].Initialize(*pPRS, VarDataAllocator, VarTypes, _countof(VarTypes), ShaderType);
+
+#ifdef DILIGENT_DEBUG
+                for (Uint32 v = 0; v < m_pShaderVarMgrs[MgrInd].GetVariableCount(); ++v)
+                {
+                    ShaderResourceDesc ResDesc;
+                    m_pShaderVarMgrs[MgrInd].GetVariable(v)->GetResourceDesc(ResDesc);
+                    VERIFY(pPRS->GetSRBVariableIndex(ShaderType, ResDesc.Name) == v,
+                           "Variable index of '", ResDesc.Name, "' does not match the index computed by the signature");
+                }
+#endif
             }
         }
         catch (...)
@@ -236,6 +246,34 @@ public:
         return m_pShaderVarMgrs[MgrInd].GetVariable(Index);
     }
 
+    /// Implementation of IShaderResourceBinding::SetResources().
+    virtual void DILIGENT_CALL_TYPE SetResources(const ShaderResourceVariableBinding* pBindings,
+                                                 Uint32                               NumBindings,
+                                                 SET_SHADER_RESOURCE_FLAGS            Flags) override
+    {
+        // Validate all records before binding anything so that an invalid batch leaves the SRB unchanged
+        if (!ValidateResourceBindings(pBindings, NumBindings))
+            return;
+
+        // Records are typically sorted by shader stage, so resolve the variable manager only when the stage changes
+        SHADER_TYPE                    CurrShaderType = SHADER_TYPE_UNKNOWN;
+        ShaderVariableManagerImplType* pVarMgr        = nullptr;
+        for (Uint32 i = 0; i < NumBindings; ++i)
+        {
+            const ShaderResourceVariableBinding& Binding = pBindings[i];
+            if (Binding.NumElements == 0)
+                continue;
+
+            if (Binding.ShaderType != CurrShaderType)
+            {
+                CurrShaderType = Binding.ShaderType;
+                pVarMgr        = GetShaderVariableManager(CurrShaderType);
+                VERIFY_EXPR(pVarMgr != nullptr);
+            }
+            pVarMgr->GetVariable(Binding.VariableIndex)->SetArray(Binding.ppObjects, Binding.FirstElement, Binding.NumElements, Flags);
+        }
+    }
+
     /// Implementation of IShaderResourceBinding::BindResources().
     virtual void DILIGENT_CALL_TYPE BindResources(SHADER_TYPE                 ShaderStages,
                                                   IResourceMapping*           pResMapping,
@@ -306,6 +344,77 @@ private:
         }
     }
 
+    // Returns the variable manager of the given shader stage, or null if the stage is not active in this SRB.
+    ShaderVariableManagerImplType* GetShaderVariableManager(SHADER_TYPE ShaderType) const
+    {
+        const PIPELINE_TYPE PipelineType = GetPipelineType();
+        if (!IsConsistentShaderType(ShaderType, PipelineType))
+            return nullptr;
+
+        const int MgrInd = m_ActiveShaderStageIndex[GetShaderTypePipelineIndex(ShaderType, PipelineType)];
+        if (MgrInd < 0)
+            return nullptr;
+
+        VERIFY_EXPR(static_cast<Uint32>(MgrInd) < GetNumShaders());
+        return &m_pShaderVarMgrs[MgrInd];
+    }
+
+    // Checks that every record of a SetResources() batch references an existing variable and
+    // that the element range is within the variable's array.
+    // Objects themselves are validated by the variables when they are bound.
+    bool ValidateResourceBindings(const ShaderResourceVariableBinding* pBindings, Uint32 NumBindings) const
+    {
+        if (pBindings == nullptr && NumBindings != 0)
+        {
+            LOG_ERROR_MESSAGE("Unable to set resources in SRB of pipeline resource signature '", m_pPRS->GetDesc().Name,
+                              "': pBindings is null while NumBindings is ", NumBindings, '.');
+            return false;
+        }
+
+        const PIPELINE_TYPE PipelineType = GetPipelineType();
+        for (Uint32 i = 0; i < NumBindings; ++i)
+        {
+            const ShaderResourceVariableBinding& Binding = pBindings[i];
+            if (Binding.NumElements == 0)
+                continue;
+
+            if (!IsConsistentShaderType(Binding.ShaderType, PipelineType))
+            {
+                LOG_ERROR_MESSAGE("Unable to set resources: shader stage ", GetShaderTypeLiteralName(Binding.ShaderType), " of binding ", i,
+                                  " is invalid for ", GetPipelineTypeString(PipelineType), " pipeline resource signature '", m_pPRS->GetDesc().Name, "'.");
+                return false;
+            }
+
+            ShaderVariableManagerImplType* pVarMgr = GetShaderVariableManager(Binding.ShaderType);
+
+            const Uint32 NumVariables = pVarMgr != nullptr ? pVarMgr->GetVariableCount() : 0;
+            if (Binding.VariableIndex >= NumVariables)
+            {
+                LOG_ERROR_MESSAGE("Unable to set resources: variable index ", Binding.VariableIndex, " of binding ", i, " is out of range for shader stage ",
+                                  GetShaderTypeLiteralName(Binding.ShaderType), " of pipeline resource signature '", m_pPRS->GetDesc().Name,
+                                  "' that defines ", NumVariables, " variables.");
+                return false;
+            }
+
+            if (Binding.ppObjects == nullptr)
+            {
+                LOG_ERROR_MESSAGE("Unable to set resources: ppObjects of binding ", i, " is null.");
+                return false;
+            }
+
+            ShaderResourceDesc ResDesc;
+            pVarMgr->GetVariable(Binding.VariableIndex)->GetResourceDesc(ResDesc);
+            if (Binding.FirstElement >= ResDesc.ArraySize || Binding.NumElements > ResDesc.ArraySize - Binding.FirstElement)
+            {
+                LOG_ERROR_MESSAGE("Unable to set resources: element range (", Binding.FirstElement, " .. ", Binding.FirstElement + Binding.NumElements - 1,
+                                  ") of binding ", i, " is out of array bounds 0 .. ", ResDesc.ArraySize - 1, " of variable '", ResDesc.Name, "'.");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
 protected:
     /// Strong reference to pipeline resource signature. We must use strong reference, because
     /// shader resource binding uses pipeline resource signature's memory allocator to allocate
@@ -31,6 +31,8 @@
 /// Implementation of the Diligent::ShaderBase template class
 
 #include <vector>
+#include <algorithm>
+#include <utility>
 
 #include "ShaderResourceVariable.h"
 #include "PipelineState.h"
@@ -805,6 +807,8 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
     const PipelineResourceDesc& GetDesc() const { return m_ParentManager.GetResourceDesc(m_ResIndex); }
 
+    Uint32 GetResourceIndex() const { return m_ResIndex; }
+
 protected:
     // Variable manager that owns this variable
     VarManagerType& m_ParentManager;
@@ -861,6 +865,44 @@ protected:
 #endif
     }
 
+    // Finds the variable with the given name.
+    // Variables are created in the order of resource indices in the signature, so instead
+    // of comparing the name with every variable, we look up the indices of all resources with
+    // this name in the signature's name index and binary-search the variables by resource index.
+    VariableType* FindVariableByName(const Char* Name) const
+    {
+        const Uint32 NumVariables = static_cast<const ThisImplType*>(this)->m_NumVariables;
+        if (NumVariables == 0)
+            return nullptr;
+
+        VariableType* const pVarsEnd = m_pVariables + NumVariables;
+
+        const std::pair<const Uint32*, const Uint32*> ResRange = m_pSignature->GetResourceNameRange(Name);
+        for (const Uint32* pResIdx = ResRange.first; pResIdx != ResRange.second; ++pResIdx)
+        {
+            VariableType* pVar = std::lower_bound(m_pVariables, pVarsEnd, *pResIdx,
+                                                  [](const VariableType& Var, Uint32 ResIndex) {
+                                                      return Var.GetResourceIndex() < ResIndex;
+                                                  });
+            if (pVar != pVarsEnd && pVar->GetResourceIndex() == *pResIdx)
+                return pVar;
+        }
+
+        return nullptr;
+    }
+
+#ifdef DILIGENT_DEBUG
+    void DvpVerifyVariableOrder() const
+    {
+        const Uint32 NumVariables = static_cast<const ThisImplType*>(this)->m_NumVariables;
+        for (Uint32 v = 1; v < NumVariables; ++v)
+        {
+            VERIFY(m_pVariables[v - 1].GetResourceIndex() < m_pVariables[v].GetResourceIndex(),
+                   "Shader variables must be sorted by resource index");
+        }
+    }
+#endif
+
     void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
     {
         DEV_CHECK_ERR(pResourceMapping != nullptr, "Failed to bind resources: resource mapping is null");
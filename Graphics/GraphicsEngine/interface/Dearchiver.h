@@ -30,6 +30,7 @@
 /// Definition of the Diligent::IDearchiver interface and related data structures
 
 #include "../../../Primitives/interface/DataBlob.h"
+#include "../../../Primitives/interface/FileStream.h"
 #include "PipelineResourceSignature.h"
 #include "PipelineState.h"
 
@@ -178,6 +179,142 @@ struct PipelineStateUnpackInfo
 typedef struct PipelineStateUnpackInfo PipelineStateUnpackInfo;
 
 
+/// Pipeline state unpack status, see IDearchiver::UnpackPipelineStates().
+DILIGENT_TYPED_ENUM(PSO_UNPACK_STATUS, Uint32)
+{
+    /// The pipeline state has been unpacked successfully.
+
+    /// \remarks   If the pipeline was unpacked asynchronously, it may still be compiling.
+    ///             An application should use the IPipelineState::GetStatus() method to
+    ///             check the pipeline status.
+    PSO_UNPACK_STATUS_SUCCESS = 0,
+
+    /// Pipeline state unpack parameters are invalid.
+    PSO_UNPACK_STATUS_INVALID_PARAMETERS,
+
+    /// The pipeline state was not found in any of the loaded archives.
+    PSO_UNPACK_STATUS_NOT_FOUND,
+
+    /// Failed to unpack the pipeline state or any of the objects it depends on
+    /// (resource signatures, render pass, shaders).
+    PSO_UNPACK_STATUS_FAILED,
+
+    PSO_UNPACK_STATUS_COUNT
+};
+
+
+/// Pipeline state batch unpack parameters, see IDearchiver::UnpackPipelineStates().
+struct PipelineStateBatchUnpackInfo
+{
+    /// A pointer to the array of NumPipelines pipeline state unpack parameters.
+
+    /// \remarks   Unlike IDearchiver::UnpackPipelineState(), the ModifyPipelineStateCreateInfo
+    ///             callback may be called from the thread pool worker threads.
+    const PipelineStateUnpackInfo* pUnpackInfos DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of elements in the pUnpackInfos array.
+    Uint32 NumPipelines DEFAULT_INITIALIZER(0);
+
+    /// An optional thread pool to use to deserialize and create objects in parallel.
+
+    /// If null, all objects will be unpacked by the calling thread.
+    /// The calling thread always participates in the work, so the method will make progress
+    /// even if all worker threads are busy.
+    ///
+    /// \note   The method must not be called from the worker threads of the same pool.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to create pipeline states asynchronously.
+
+    /// When this member is true, pipeline states are created with the
+    /// Diligent::PSO_CREATE_FLAG_ASYNCHRONOUS flag. If the device supports the
+    /// AsyncShaderCompilation feature, the method will return before the pipelines
+    /// are compiled, and an application should use the IPipelineState::GetStatus()
+    /// method to check the pipeline status.
+    Bool Asynchronous DEFAULT_INITIALIZER(False);
+};
+typedef struct PipelineStateBatchUnpackInfo PipelineStateBatchUnpackInfo;
+
+
+/// Pipeline state to prefetch, see Diligent::PipelineStatePrefetchInfo.
+struct PipelineStatePrefetchItem
+{
+    /// Name of the pipeline state.
+    const Char* Name DEFAULT_INITIALIZER(nullptr);
+
+    /// The type of the pipeline state.
+    PIPELINE_TYPE PipelineType DEFAULT_INITIALIZER(PIPELINE_TYPE_INVALID);
+};
+typedef struct PipelineStatePrefetchItem PipelineStatePrefetchItem;
+
+
+/// Pipeline state prefetch parameters, see IDearchiver::PrefetchPipelineStates().
+struct PipelineStatePrefetchInfo
+{
+    /// Render device that will be used to unpack the pipeline states.
+
+    /// Prefetched data is only used when the pipeline state is unpacked with the same device.
+    struct IRenderDevice* pDevice DEFAULT_INITIALIZER(nullptr);
+
+    /// A pointer to the array of NumPipelines pipeline states to prefetch.
+    const PipelineStatePrefetchItem* pPipelines DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of elements in the pPipelines array.
+    Uint32 NumPipelines DEFAULT_INITIALIZER(0);
+
+    /// An optional usage trace to take the pipeline states to prefetch from.
+
+    /// The trace must be in the format written by IDearchiver::WriteUsageTrace().
+    /// Pipeline states recorded in the trace are looked up by name and prefetched in the order
+    /// of their first use, after the pipeline states in the pPipelines array.
+    /// Shaders recorded in the trace are ignored.
+    IDataBlob* pUsageTrace DEFAULT_INITIALIZER(nullptr);
+
+    /// An optional thread pool to prefetch the pipeline states with.
+
+    /// If null, the pipeline states are prefetched by the calling thread before the method returns.
+    /// Otherwise, the method returns immediately and the data is prefetched by the worker threads.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
+
+    /// The maximum total size, in bytes, of the prefetched data that has not been used yet.
+
+    /// The size includes the pipeline data and the byte code of the shaders it uses.
+    /// Pipeline states that do not fit into this budget are skipped.
+    Uint64 MaxPendingDataSize DEFAULT_INITIALIZER(64 << 20);
+};
+typedef struct PipelineStatePrefetchInfo PipelineStatePrefetchInfo;
+
+
+/// Dearchiver prefetch statistics, see IDearchiver::GetPrefetchStats().
+struct DearchiverPrefetchStats
+{
+    /// The number of pipeline states requested to be prefetched.
+    Uint32 NumRequested DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline states whose data has been prefetched.
+    Uint32 NumPrefetched DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline states that were not prefetched because they are not in the archive,
+    /// have already been unpacked or prefetched, or do not fit into the memory budget.
+    Uint32 NumSkipped DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline states that failed to prefetch.
+    Uint32 NumFailed DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline states unpacked using the prefetched data.
+    Uint32 NumHits DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline states unpacked without the prefetched data.
+
+    /// Pipeline states that are found in the dearchiver's cache of unpacked objects are not counted.
+    Uint32 NumMisses DEFAULT_INITIALIZER(0);
+
+    /// The total size, in bytes, of the prefetched data that has not been used yet.
+    Uint64 PendingDataSize DEFAULT_INITIALIZER(0);
+};
+typedef struct DearchiverPrefetchStats DearchiverPrefetchStats;
+
+
 /// Render pass unpack parameters
 struct RenderPassUnpackInfo
 {
@@ -272,6 +409,71 @@ DILIGENT_BEGIN_INTERFACE(IDearchiver, IObject)
                                              const PipelineStateUnpackInfo REF UnpackInfo,
                                              IPipelineState**                  ppPSO) PURE;
 
+    /// Unpacks multiple pipeline state objects from the device object archive.
+
+    /// \param [in]  BatchInfo - Batch unpack parameters, see Diligent::PipelineStateBatchUnpackInfo.
+    /// \param [out] ppPSOs    - A pointer to the array of BatchInfo.NumPipelines elements where
+    ///                          pointers to the unpacked pipeline states will be written.
+    ///                          The function calls AddRef() for every unpacked pipeline.
+    ///                          If a pipeline fails to unpack, the corresponding element is set to null.
+    /// \param [out] pStatuses - An optional pointer to the array of BatchInfo.NumPipelines elements
+    ///                          where the unpack status of every pipeline will be written,
+    ///                          see Diligent::PSO_UNPACK_STATUS.
+    ///
+    /// \return     The number of pipeline states that have been unpacked successfully.
+    ///
+    /// \remarks    Resource signatures, render passes and shaders shared by the pipelines in the batch
+    ///             are unpacked only once. If a thread pool is provided, pipeline data is deserialized
+    ///             and all objects are created in parallel.
+    ///
+    /// \note   This method is thread-safe.
+    VIRTUAL Uint32 METHOD(UnpackPipelineStates)(THIS_
+                                                const PipelineStateBatchUnpackInfo REF BatchInfo,
+                                                IPipelineState**                       ppPSOs,
+                                                PSO_UNPACK_STATUS*                     pStatuses DEFAULT_VALUE(nullptr)) PURE;
+
+    /// Prefetches the data of pipeline states that are expected to be unpacked soon.
+
+    /// \param [in] PrefetchInfo - Prefetch parameters, see Diligent::PipelineStatePrefetchInfo.
+    ///
+    /// \return     The number of pipeline states that have been scheduled for prefetching.
+    ///
+    /// \remarks    The method decompresses and deserializes the pipeline data and creates the shaders
+    ///             the pipelines use, so that UnpackPipelineState() and UnpackPipelineStates()
+    ///             only need to create the pipeline state objects.
+    ///             The prefetched data of a pipeline is released when the pipeline is unpacked.
+    ///
+    /// \note       The render device must stay alive until the prefetching is complete.
+    ///
+    /// \note       This method is thread-safe.
+    VIRTUAL Uint32 METHOD(PrefetchPipelineStates)(THIS_
+                                                  const PipelineStatePrefetchInfo REF PrefetchInfo) PURE;
+
+    /// Returns the prefetch statistics, see Diligent::DearchiverPrefetchStats.
+
+    /// \note   This method is thread-safe.
+    VIRTUAL void METHOD(GetPrefetchStats)(THIS_
+                                          DearchiverPrefetchStats REF Stats) CONST PURE;
+
+    /// Writes the usage trace to the file stream.
+
+    /// \param [in] pStream - Pointer to the IFileStream interface to use for writing.
+    ///
+    /// \return     true if the trace was written successfully, and false otherwise.
+    ///
+    /// \remarks    The trace lists the shaders and pipeline states requested from the dearchiver
+    ///             in the order of their first request, along with the request timestamps.
+    ///             It can be passed to the archiver command-line tool to build an archive
+    ///             that only contains these objects.
+    ///
+    ///             The trace is only recorded if the dearchiver was created with the
+    ///             `EnableUsageTrace` member of Diligent::DearchiverCreateInfo set to true.
+    ///             The trace is not cleared by Reset().
+    ///
+    /// \note   This method is thread-safe.
+    VIRTUAL Bool METHOD(WriteUsageTrace)(THIS_
+                                         IFileStream* pStream) CONST PURE;
+
     /// Unpacks resource signature from the device object archive.
 
     /// \param [in]  UnpackInfo  - Resource signature unpack info, see Diligent::ResourceSignatureUnpackInfo.
@@ -329,6 +531,10 @@ DILIGENT_END_INTERFACE
 #    define IDearchiver_LoadArchive(This, ...)             CALL_IFACE_METHOD(Dearchiver, LoadArchive,             This, __VA_ARGS__)
 #    define IDearchiver_UnpackShader(This, ...)            CALL_IFACE_METHOD(Dearchiver, UnpackShader,            This, __VA_ARGS__)
 #    define IDearchiver_UnpackPipelineState(This, ...)     CALL_IFACE_METHOD(Dearchiver, UnpackPipelineState,     This, __VA_ARGS__)
+#    define IDearchiver_UnpackPipelineStates(This, ...)    CALL_IFACE_METHOD(Dearchiver, UnpackPipelineStates,    This, __VA_ARGS__)
+#    define IDearchiver_PrefetchPipelineStates(This, ...)  CALL_IFACE_METHOD(Dearchiver, PrefetchPipelineStates,  This, __VA_ARGS__)
+#    define IDearchiver_GetPrefetchStats(This, ...)        CALL_IFACE_METHOD(Dearchiver, GetPrefetchStats,        This, __VA_ARGS__)
+#    define IDearchiver_WriteUsageTrace(This, ...)         CALL_IFACE_METHOD(Dearchiver, WriteUsageTrace,         This, __VA_ARGS__)
 #    define IDearchiver_UnpackResourceSignature(This, ...) CALL_IFACE_METHOD(Dearchiver, UnpackResourceSignature, This, __VA_ARGS__)
 #    define IDearchiver_UnpackRenderPass(This, ...)        CALL_IFACE_METHOD(Dearchiver, UnpackRenderPass,        This, __VA_ARGS__)
 #    define IDearchiver_Store(This, ...)                   CALL_IFACE_METHOD(Dearchiver, Store,                   This, __VA_ARGS__)
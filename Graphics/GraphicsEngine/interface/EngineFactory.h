@@ -64,6 +64,10 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_EngineFactory =
 struct DearchiverCreateInfo
 {
     void* pDummy DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to record the names of the shaders and pipeline states requested
+    /// from the dearchiver, see IDearchiver::WriteUsageTrace().
+    Bool EnableUsageTrace DEFAULT_INITIALIZER(False);
 };
 typedef struct DearchiverCreateInfo DearchiverCreateInfo;
 
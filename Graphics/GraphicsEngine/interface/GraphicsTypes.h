@@ -1614,6 +1614,7 @@ enum RENDER_DEVICE_TYPE
     RENDER_DEVICE_TYPE_VULKAN,         ///< Vulkan device
     RENDER_DEVICE_TYPE_METAL,          ///< Metal device
     RENDER_DEVICE_TYPE_WEBGPU,         ///< WebGPU device
+    RENDER_DEVICE_TYPE_NULL,           ///< Null device that does not execute any GPU work
     RENDER_DEVICE_TYPE_COUNT           ///< The total number of device types
 };
 
@@ -2544,6 +2545,10 @@ struct RenderDeviceInfo
     {
         return Type == RENDER_DEVICE_TYPE_WEBGPU;
     }
+    constexpr bool IsNullDevice() const
+    {
+        return Type == RENDER_DEVICE_TYPE_NULL;
+    }
 
     // for backward compatibility
     const NDCAttribs& GetNDCAttribs()const
@@ -3975,17 +3980,25 @@ struct DeviceFeaturesVk
     /// If the extension is not supported, the texture is initialized on the device.
     DEVICE_FEATURE_STATE HostImageCopy DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates whether the device supports descriptor update templates (Vulkan 1.1 core).
+
+    /// Descriptor update templates are used to write dynamic descriptor sets
+    /// with a single vkUpdateDescriptorSetWithTemplate call when shader resources are committed.
+    /// If the feature is not supported, descriptor sets are written with vkUpdateDescriptorSets.
+    DEVICE_FEATURE_STATE DescriptorUpdateTemplate DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
 
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeaturesVk() noexcept {}
 
 #define ENUMERATE_VK_DEVICE_FEATURES(Handler) \
-    Handler(DynamicRendering) \
-    Handler(HostImageCopy)
+    Handler(DynamicRendering)                 \
+    Handler(HostImageCopy)                    \
+    Handler(DescriptorUpdateTemplate)
 
     explicit constexpr DeviceFeaturesVk(DEVICE_FEATURE_STATE State) noexcept
     {
-        static_assert(sizeof(*this) == 2, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
+        static_assert(sizeof(*this) == 3, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
     #define INIT_FEATURE(Feature) Feature = State;
         ENUMERATE_VK_DEVICE_FEATURES(INIT_FEATURE)
     #undef INIT_FEATURE
@@ -4071,6 +4084,104 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 #endif
     ;
 
+    /// Whether to use push descriptors for dynamic shader variables.
+
+    /// When this flag is set and the device supports VK_KHR_push_descriptor extension,
+    /// the dynamic descriptor set of the resource signature with binding index 0 is
+    /// declared as a push descriptor set. Dynamic resources of such signature are written
+    /// directly into the command buffer with vkCmdPushDescriptorSetKHR instead of being
+    /// allocated from the dynamic descriptor pool every time the SRB is committed.
+    ///
+    /// Push descriptor sets can't contain uniform or storage buffers with dynamic offsets,
+    /// so the dynamic resources of the signature must use PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS
+    /// flag, and the total number of dynamic descriptors must not exceed maxPushDescriptors
+    /// device limit. If any of the conditions is not met or the extension is not supported,
+    /// the engine falls back to the regular dynamic descriptor sets.
+    Bool UsePushDescriptors DEFAULT_INITIALIZER(False);
+
+    /// Whether to use descriptor buffers instead of descriptor pools.
+
+    /// When this flag is set and the device supports VK_EXT_descriptor_buffer extension
+    /// as well as buffer device address, descriptors of all resource signatures are written
+    /// directly into host-visible buffer memory with vkGetDescriptorEXT instead of being
+    /// allocated from descriptor pools and updated with vkUpdateDescriptorSets.
+    /// Descriptor pool sizes are ignored in this mode, and push descriptors are not used.
+    ///
+    /// If the extension is not supported, the engine falls back to the regular descriptor sets.
+    Bool UseDescriptorBuffers DEFAULT_INITIALIZER(False);
+
+    /// The size of the descriptor buffer, in bytes, when UseDescriptorBuffers is enabled.
+
+    /// Descriptors of static and mutable shader variables of all SRBs as well as
+    /// dynamic descriptors of all device contexts are suballocated from this buffer.
+    Uint32 DescriptorBufferSize DEFAULT_INITIALIZER(8 << 20);
+
+    /// The size of the page that every device context allocates from the descriptor buffer
+    /// to write dynamic descriptors, when UseDescriptorBuffers is enabled.
+    Uint32 DynamicDescriptorBufferPageSize DEFAULT_INITIALIZER(64 << 10);
+
+    /// Whether to build graphics pipelines from cached pipeline libraries.
+
+    /// When this flag is set and the device supports VK_EXT_graphics_pipeline_library extension,
+    /// graphics pipelines are assembled from the four library parts (vertex input interface,
+    /// pre-rasterization shaders, fragment shader, and fragment output interface) that are
+    /// cached by the device and shared between pipelines with identical sub-states.
+    ///
+    /// Pipelines created with PSO_CREATE_FLAG_ASYNCHRONOUS flag are quickly linked without
+    /// link-time optimization and become ready as soon as the libraries are available.
+    /// The fully optimized pipeline is then built in the background and used once it is ready.
+    /// Other pipelines are linked with link-time optimization right away.
+    ///
+    /// Mesh pipelines and pipelines that use explicit render passes are always created monolithically.
+    /// If the extension is not supported, all pipelines are created monolithically.
+    Bool UseGraphicsPipelineLibrary DEFAULT_INITIALIZER(False);
+
+    /// Whether to use extended dynamic states in graphics pipelines.
+
+    /// When this flag is set and the device supports VK_EXT_extended_dynamic_state extension,
+    /// cull mode, front face, primitive topology as well as depth and stencil states are not
+    /// baked into Vulkan pipelines, but are set when the pipeline state is bound to the context.
+    /// If VK_EXT_extended_dynamic_state2 and VK_EXT_extended_dynamic_state3 extensions are
+    /// supported, depth bias, primitive restart, patch control points, fill mode, depth clamp
+    /// and color blend states are set dynamically too.
+    ///
+    /// Pipeline states that only differ by the dynamic states share the same Vulkan pipeline.
+    /// The number of shared pipelines is reported when the device is destroyed.
+    ///
+    /// If the extension is not supported, all states are baked into pipelines.
+    Bool UseExtendedDynamicState DEFAULT_INITIALIZER(False);
+
+    /// Whether to use VK_KHR_synchronization2 extension for resource state transitions.
+
+    /// When this flag is set and the device supports the extension, resource barriers
+    /// are recorded with vkCmdPipelineBarrier2 that keeps individual stage and access
+    /// masks for every resource. All transitions accumulated between two commands
+    /// are issued by a single call.
+    ///
+    /// Additionally, split barriers are enabled: a STATE_TRANSITION_TYPE_BEGIN barrier
+    /// signals an event, and the matching STATE_TRANSITION_TYPE_END barrier recorded
+    /// in the same command buffer waits for it. Begin-split barriers that have not
+    /// been ended when the command buffer is submitted or finished are completed at the
+    /// end of that command buffer, and the matching end barrier only updates the resource state.
+    ///
+    /// If the extension is not supported, legacy pipeline barriers are used
+    /// and begin-split barriers are ignored.
+    Bool UseSynchronization2 DEFAULT_INITIALIZER(False);
+
+    /// Whether to keep device memory allocations within the budget reported by VK_EXT_memory_budget extension.
+
+    /// When this flag is set and the device supports the extension, the memory manager queries
+    /// the heap budget before allocating a new memory page. If the heap usage would exceed
+    /// MemoryBudgetThreshold of the budget, the engine first releases all empty pages in the heap,
+    /// including the pages kept in the reserve (see DeviceLocalMemoryReserveSize and HostVisibleMemoryReserveSize).
+    /// While the heap usage stays above the threshold, empty pages are not kept in the reserve.
+    ///
+    /// If the extension is not supported, the reserve sizes are the only limits.
+    Bool UseMemoryBudget DEFAULT_INITIALIZER(False);
+
+    /// The fraction of the heap budget that the engine tries not to exceed when UseMemoryBudget is enabled.
+    Float32 MemoryBudgetThreshold DEFAULT_INITIALIZER(0.9f);
+
     /// Allocation granularity for device-local memory.
 
     /// Device-local memory is used for USAGE_DEFAULT and USAGE_IMMUTABLE
@@ -4299,6 +4410,25 @@ struct EngineWebGPUCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 };
 typedef struct EngineWebGPUCreateInfo EngineWebGPUCreateInfo;
 
+/// Attributes of the Null engine implementation.
+
+/// The Null backend implements the full device and context interfaces without
+/// a GPU: objects are created and commands are validated and recorded, but no
+/// work is executed. It is intended to measure CPU-side overhead of the engine.
+struct EngineNullCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
+
+#if DILIGENT_CPP_INTERFACE
+    EngineNullCreateInfo() noexcept :
+        EngineNullCreateInfo{EngineCreateInfo{}}
+    {}
+
+    explicit EngineNullCreateInfo(const EngineCreateInfo &EngineCI) noexcept :
+        EngineCreateInfo{EngineCI}
+    {}
+#endif
+};
+typedef struct EngineNullCreateInfo EngineNullCreateInfo;
+
 /// Box
 struct Box
 {
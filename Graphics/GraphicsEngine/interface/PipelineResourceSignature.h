@@ -571,6 +571,24 @@ DILIGENT_BEGIN_INTERFACE(IPipelineResourceSignature, IDeviceObject)
     /// defined in the same order disregarding their names.
     VIRTUAL Bool METHOD(IsCompatibleWith)(THIS_
                                           const struct IPipelineResourceSignature* pPRS) CONST PURE;
+
+    /// Returns the index of a mutable or dynamic shader resource variable in shader resource binding objects.
+
+    /// \param [in] ShaderType - Type of the shader to look up the variable.
+    ///                          Must be one of Diligent::SHADER_TYPE.
+    /// \param [in] Name       - Variable name.
+    ///
+    /// \return     The variable index, or ~0u if the variable is not found.
+    ///
+    /// Variables are laid out identically in all shader resource binding objects created by this
+    /// signature, so the index can be resolved once and then passed to IShaderResourceBinding::GetVariableByIndex()
+    /// for any of these objects. This avoids looking the variable up by name in every
+    /// shader resource binding.
+    ///
+    /// \note  This operation may be expensive and should not be performed on a hot path.
+    VIRTUAL Uint32 METHOD(GetSRBVariableIndex)(THIS_
+                                               SHADER_TYPE ShaderType,
+                                               const Char* Name) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -590,6 +608,7 @@ DILIGENT_END_INTERFACE
 #    define IPipelineResourceSignature_InitializeStaticSRBResources(This, ...) CALL_IFACE_METHOD(PipelineResourceSignature, InitializeStaticSRBResources,This, __VA_ARGS__)
 #    define IPipelineResourceSignature_CopyStaticResources(This, ...)          CALL_IFACE_METHOD(PipelineResourceSignature, CopyStaticResources,         This, __VA_ARGS__)
 #    define IPipelineResourceSignature_IsCompatibleWith(This, ...)             CALL_IFACE_METHOD(PipelineResourceSignature, IsCompatibleWith,            This, __VA_ARGS__)
+#    define IPipelineResourceSignature_GetSRBVariableIndex(This, ...)          CALL_IFACE_METHOD(PipelineResourceSignature, GetSRBVariableIndex,         This, __VA_ARGS__)
 
 // clang-format on
 
@@ -44,6 +44,46 @@ struct IPipelineResourceSignature;
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_ShaderResourceBinding =
     {0x61f8774, 0x9a09, 0x48e8, {0x84, 0x11, 0xb5, 0xbd, 0x20, 0x56, 0x1, 0x4}};
 
+// clang-format off
+
+/// Describes a single record of the IShaderResourceBinding::SetResources() method.
+struct ShaderResourceVariableBinding
+{
+    /// Shader stage of the variable. Must be one of Diligent::SHADER_TYPE.
+    SHADER_TYPE           ShaderType    DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// Variable index, see IShaderResourceBinding::GetVariableByIndex().
+    Uint32                VariableIndex DEFAULT_INITIALIZER(0);
+
+    /// A pointer to the array of NumElements objects to bind.
+    IDeviceObject* const* ppObjects     DEFAULT_INITIALIZER(nullptr);
+
+    /// First array element to set.
+    Uint32                FirstElement  DEFAULT_INITIALIZER(0);
+
+    /// The number of objects in ppObjects array.
+    Uint32                NumElements   DEFAULT_INITIALIZER(1);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr ShaderResourceVariableBinding() noexcept {}
+
+    constexpr ShaderResourceVariableBinding(SHADER_TYPE           _ShaderType,
+                                            Uint32                _VariableIndex,
+                                            IDeviceObject* const* _ppObjects,
+                                            Uint32                _FirstElement = ShaderResourceVariableBinding{}.FirstElement,
+                                            Uint32                _NumElements  = ShaderResourceVariableBinding{}.NumElements) noexcept :
+        ShaderType   {_ShaderType   },
+        VariableIndex{_VariableIndex},
+        ppObjects    {_ppObjects    },
+        FirstElement {_FirstElement },
+        NumElements  {_NumElements  }
+    {}
+#endif
+};
+typedef struct ShaderResourceVariableBinding ShaderResourceVariableBinding;
+
+// clang-format on
+
 
 #define DILIGENT_INTERFACE_NAME IShaderResourceBinding
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
@@ -146,12 +186,39 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
     /// Only mutable and dynamic variables can be accessed through this method.
     /// Static variables are accessed through the Shader object.
     ///
+    /// Variable indices are the same in all shader resource binding objects created by the same
+    /// resource signature. Use IPipelineResourceSignature::GetSRBVariableIndex() to resolve
+    /// the index of a variable by its name once.
+    ///
     /// \note   This operation may potentially be expensive. If the variable will be used often, it is
     ///         recommended to store and reuse the pointer as it never changes.
     VIRTUAL IShaderResourceVariable* METHOD(GetVariableByIndex)(THIS_
                                                                 SHADER_TYPE ShaderType,
                                                                 Uint32      Index) PURE;
 
+    /// Binds resources to multiple variables in one call.
+
+    /// \param [in] pBindings   - A pointer to the array of NumBindings binding records,
+    ///                           see Diligent::ShaderResourceVariableBinding.
+    /// \param [in] NumBindings - The number of records in pBindings array.
+    /// \param [in] Flags       - Flags, see Diligent::SET_SHADER_RESOURCE_FLAGS.
+    ///
+    /// The method is equivalent to calling IShaderResourceVariable::SetArray() for every
+    /// record, but lets the backend coalesce descriptor writes. In Vulkan, descriptor set
+    /// updates for all records are submitted in as few vkUpdateDescriptorSets calls as possible.
+    ///
+    /// Shader stages, variable indices and element ranges of all records are validated before
+    /// any resource is bound. If any record is invalid, an error is logged and no resources
+    /// are bound. Objects are validated by the variables when they are bound, in the same
+    /// way as by IShaderResourceVariable::SetArray().
+    ///
+    /// Variable indices are resolved once with IPipelineResourceSignature::GetSRBVariableIndex()
+    /// and are valid for all SRBs created by the same signature.
+    VIRTUAL void METHOD(SetResources)(THIS_
+                                      const ShaderResourceVariableBinding* pBindings,
+                                      Uint32                               NumBindings,
+                                      SET_SHADER_RESOURCE_FLAGS            Flags DEFAULT_VALUE(SET_SHADER_RESOURCE_FLAG_NONE)) PURE;
+
     /// Returns true if static resources have been initialized in this SRB.
     VIRTUAL Bool METHOD(StaticResourcesInitialized)(THIS) CONST PURE;
 };
@@ -169,6 +236,7 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceBinding_GetVariableByName(This, ...)       CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByName,            This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableCount(This, ...)        CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableCount,             This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByIndex(This, ...)      CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByIndex,           This, __VA_ARGS__)
+#    define IShaderResourceBinding_SetResources(This, ...)            CALL_IFACE_METHOD(ShaderResourceBinding, SetResources,                 This, __VA_ARGS__)
 #    define IShaderResourceBinding_StaticResourcesInitialized(This)   CALL_IFACE_METHOD(ShaderResourceBinding, StaticResourcesInitialized,   This)
 
 // clang-format on
@@ -73,7 +73,29 @@ DILIGENT_TYPED_ENUM(MISC_TEXTURE_FLAGS, Uint8)
     /// Requires SHADING_RATE_CAP_FLAG_SUBSAMPLED_RENDER_TARGET capability.
     /// 
     /// \note  Copy operations are not supported for subsampled textures.
-    MISC_TEXTURE_FLAG_SUBSAMPLED      = 1u << 3
+    MISC_TEXTURE_FLAG_SUBSAMPLED      = 1u << 3,
+
+    /// The texture content will be updated by the host rather than by the GPU when possible.
+
+    /// In Vulkan, IDeviceContext::UpdateTexture() writes the data directly to the texture
+    /// with vkCopyMemoryToImageEXT (VK_EXT_host_image_copy) instead of recording a copy
+    /// from the upload heap. The data is written immediately, so the application must make
+    /// sure that the updated subresources are not accessed by the GPU, including by the commands
+    /// that have been recorded but not yet executed (e.g. when streaming mip levels that are
+    /// excluded by the minimum LOD of the sampler).
+    ///
+    /// The host write is only performed when the texture state is known and is the state that
+    /// corresponds to the texture usage (e.g. RESOURCE_STATE_SHADER_RESOURCE for a shader resource),
+    /// and the engine assumes that the image is in this layout. Since the texture state is updated
+    /// when the transitions are recorded, all commands that transition the texture to this state
+    /// must have been submitted and completed (e.g. with IDeviceContext::Flush() and a fence wait)
+    /// before the texture is updated. In any other state, the update is recorded in the command
+    /// buffer as usual.
+    /// The flag requires HostImageCopy feature and is ignored by other backends and by the devices
+    /// that do not support host copies of the texture format.
+    ///
+    /// \note  The flag is only allowed for USAGE_DEFAULT textures.
+    MISC_TEXTURE_FLAG_HOST_UPLOAD     = 1u << 4
 };
 DEFINE_FLAG_ENUM_OPERATORS(MISC_TEXTURE_FLAGS)
 
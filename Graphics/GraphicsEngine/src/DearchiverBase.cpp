@@ -25,8 +25,13 @@
  */
 
 #include "DearchiverBase.hpp"
+
+#include <algorithm>
+
+#include "EngineFactory.h"
 #include "PipelineStateBase.hpp"
 #include "PSOSerializer.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -44,9 +49,8 @@ namespace
 
 bool VerifyPipelineStateUnpackInfo(const PipelineStateUnpackInfo& DeArchiveInfo, IPipelineState** ppPSO)
 {
-#define CHECK_UNPACK_PSO_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER("Invalid PSO unpack parameter: ", ##__VA_ARGS__)
+#define CHECK_UNPACK_PSO_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER(Expr, "Invalid PSO unpack parameter: ", ##__VA_ARGS__)
     CHECK_UNPACK_PSO_PARAM(ppPSO != nullptr, "ppPSO must not be null");
-    CHECK_UNPACK_PSO_PARAM(DeArchiveInfo.pArchive != nullptr, "pArchive must not be null");
     CHECK_UNPACK_PSO_PARAM(DeArchiveInfo.Name != nullptr, "Name must not be null");
     CHECK_UNPACK_PSO_PARAM(DeArchiveInfo.pDevice != nullptr, "pDevice must not be null");
     CHECK_UNPACK_PSO_PARAM(DeArchiveInfo.PipelineType <= PIPELINE_TYPE_LAST, "PipelineType must be valid");
@@ -57,9 +61,8 @@ bool VerifyPipelineStateUnpackInfo(const PipelineStateUnpackInfo& DeArchiveInfo,
 
 bool VerifyResourceSignatureUnpackInfo(const ResourceSignatureUnpackInfo& DeArchiveInfo, IPipelineResourceSignature** ppSignature)
 {
-#define CHECK_UNPACK_SIGN_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER("Invalid signature unpack parameter: ", ##__VA_ARGS__)
+#define CHECK_UNPACK_SIGN_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER(Expr, "Invalid signature unpack parameter: ", ##__VA_ARGS__)
     CHECK_UNPACK_SIGN_PARAM(ppSignature != nullptr, "ppSignature must not be null");
-    CHECK_UNPACK_SIGN_PARAM(DeArchiveInfo.pArchive != nullptr, "pArchive must not be null");
     CHECK_UNPACK_SIGN_PARAM(DeArchiveInfo.Name != nullptr, "Name must not be null");
     CHECK_UNPACK_SIGN_PARAM(DeArchiveInfo.pDevice != nullptr, "pDevice must not be null");
 #undef CHECK_UNPACK_SIGN_PARAM
@@ -69,9 +72,8 @@ bool VerifyResourceSignatureUnpackInfo(const ResourceSignatureUnpackInfo& DeArch
 
 bool VerifyRenderPassUnpackInfo(const RenderPassUnpackInfo& DeArchiveInfo, IRenderPass** ppRP)
 {
-#define CHECK_UNPACK_RENDER_PASS_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER("Invalid signature unpack parameter: ", ##__VA_ARGS__)
+#define CHECK_UNPACK_RENDER_PASS_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER(Expr, "Invalid render pass unpack parameter: ", ##__VA_ARGS__)
     CHECK_UNPACK_RENDER_PASS_PARAM(ppRP != nullptr, "ppRP must not be null");
-    CHECK_UNPACK_RENDER_PASS_PARAM(DeArchiveInfo.pArchive != nullptr, "pArchive must not be null");
     CHECK_UNPACK_RENDER_PASS_PARAM(DeArchiveInfo.Name != nullptr, "Name must not be null");
     CHECK_UNPACK_RENDER_PASS_PARAM(DeArchiveInfo.pDevice != nullptr, "pDevice must not be null");
 #undef CHECK_UNPACK_RENDER_PASS_PARAM
@@ -81,16 +83,37 @@ bool VerifyRenderPassUnpackInfo(const RenderPassUnpackInfo& DeArchiveInfo, IRend
 
 bool VerifShaderUnpackInfo(const ShaderUnpackInfo& DeArchiveInfo, IShader** ppShader)
 {
-#define CHECK_UNPACK_RENDER_PASS_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER("Invalid shader unpack parameter: ", ##__VA_ARGS__)
-    CHECK_UNPACK_RENDER_PASS_PARAM(ppShader != nullptr, "ppShader must not be null");
-    CHECK_UNPACK_RENDER_PASS_PARAM(DeArchiveInfo.pArchive != nullptr, "pArchive must not be null");
-    CHECK_UNPACK_RENDER_PASS_PARAM(DeArchiveInfo.Name != nullptr, "Name must not be null");
-    CHECK_UNPACK_RENDER_PASS_PARAM(DeArchiveInfo.pDevice != nullptr, "pDevice must not be null");
-#undef CHECK_UNPACK_RENDER_PASS_PARAM
+#define CHECK_UNPACK_SHADER_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER(Expr, "Invalid shader unpack parameter: ", ##__VA_ARGS__)
+    CHECK_UNPACK_SHADER_PARAM(ppShader != nullptr, "ppShader must not be null");
+    CHECK_UNPACK_SHADER_PARAM(DeArchiveInfo.Name != nullptr, "Name must not be null");
+    CHECK_UNPACK_SHADER_PARAM(DeArchiveInfo.pDevice != nullptr, "pDevice must not be null");
+#undef CHECK_UNPACK_SHADER_PARAM
 
     return true;
 }
 
+DeviceObjectArchive::ResourceType PipelineTypeToArchiveResourceType(PIPELINE_TYPE PipelineType)
+{
+    switch (PipelineType)
+    {
+        case PIPELINE_TYPE_GRAPHICS:
+        case PIPELINE_TYPE_MESH:
+            return DeviceObjectArchive::ResourceType::GraphicsPipeline;
+
+        case PIPELINE_TYPE_COMPUTE:
+            return DeviceObjectArchive::ResourceType::ComputePipeline;
+
+        case PIPELINE_TYPE_RAY_TRACING:
+            return DeviceObjectArchive::ResourceType::RayTracingPipeline;
+
+        case PIPELINE_TYPE_TILE:
+            return DeviceObjectArchive::ResourceType::TilePipeline;
+
+        default:
+            return DeviceObjectArchive::ResourceType::Undefined;
+    }
+}
+
 } // namespace
 
 
@@ -101,26 +124,80 @@ DearchiverBase::DeviceType DearchiverBase::GetArchiveDeviceType(const IRenderDev
     return RenderDeviceTypeToArchiveDeviceType(Type);
 }
 
-template <typename CreateInfoType>
-struct DearchiverBase::PSOData
+DearchiverBase::DearchiverBase(IReferenceCounters* pRefCounters, const DearchiverCreateInfo& CI) noexcept :
+    TObjectBase{pRefCounters}
+{
+    if (CI.EnableUsageTrace)
+        m_pUsageTrace = std::make_unique<PipelineUsageTrace>();
+}
+
+DearchiverBase::~DearchiverBase()
+{
+    // Prefetch tasks reference the archives
+    WaitForPrefetchTasks(/*Cancel = */ true);
+}
+
+struct DearchiverBase::PSODataBase
 {
     DynamicLinearAllocator Allocator;
-    CreateInfoType         CreateInfo{};
     PSOCreateInternalInfo  InternalCI;
     SerializedPSOAuxData   AuxData;
     TPRSNames              PRSNames{};
     const char*            RenderPassName = nullptr;
 
+    DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+
     // Strong references to pipeline resource signatures, render pass, etc.
     std::vector<RefCntAutoPtr<IDeviceObject>> Objects;
     std::vector<RefCntAutoPtr<IShader>>       Shaders;
 
+    PSODataBase(IMemoryAllocator& Allocator, Uint32 BlockSize) :
+        Allocator{Allocator, BlockSize}
+    {}
+    virtual ~PSODataBase() {}
+
+    virtual const PipelineStateCreateInfo& GetCreateInfo() const = 0;
+
+    // Type-erased versions of DearchiverBase::LoadPSOData and DearchiverBase::CreatePSO
+    // used by DearchiverBase::UnpackPipelineStates.
+    virtual bool Load(DearchiverBase& Dearchiver, const ArchiveData& Archive, const PipelineStateUnpackInfo& UnpackInfo) = 0;
+    virtual void Create(DearchiverBase&                Dearchiver,
+                        ArchiveData&                   Archive,
+                        const PipelineStateUnpackInfo& UnpackInfo,
+                        PSO_CREATE_FLAGS               CreateFlags,
+                        IPipelineState**               ppPSO)                                                      = 0;
+};
+
+template <typename CreateInfoType>
+struct DearchiverBase::PSOData final : PSODataBase
+{
+    CreateInfoType CreateInfo{};
+
     static const ResourceType ArchiveResType;
 
     explicit PSOData(IMemoryAllocator& Allocator, Uint32 BlockSize = 2 << 10) :
-        Allocator{Allocator, BlockSize}
+        PSODataBase{Allocator, BlockSize}
     {}
 
+    virtual const PipelineStateCreateInfo& GetCreateInfo() const override final
+    {
+        return CreateInfo;
+    }
+
+    virtual bool Load(DearchiverBase& Dearchiver, const ArchiveData& Archive, const PipelineStateUnpackInfo& UnpackInfo) override final
+    {
+        return Dearchiver.LoadPSOData(Archive, UnpackInfo, *this);
+    }
+
+    virtual void Create(DearchiverBase&                Dearchiver,
+                        ArchiveData&                   Archive,
+                        const PipelineStateUnpackInfo& UnpackInfo,
+                        PSO_CREATE_FLAGS               CreateFlags,
+                        IPipelineState**               ppPSO) override final
+    {
+        Dearchiver.CreatePSO(Archive, UnpackInfo, *this, CreateFlags, ppPSO);
+    }
+
     bool Deserialize(const char* Name, Serializer<SerializerMode::Read>& Ser);
     void AssignShaders();
     void CreatePipeline(IRenderDevice* pDevice, IPipelineState** ppPSO);
@@ -173,7 +250,13 @@ void DearchiverBase::NamedResourceCache<ResType>::Set(ResourceType Type, const c
     VERIFY_EXPR(pResource != nullptr);
 
     std::unique_lock<std::mutex> Lock{m_Mtx};
-    m_Map.emplace(NamedResourceKey{Type, Name, /*CopyName = */ true}, pResource);
+
+    // The map may contain an expired reference to the resource with the same name
+    auto it = m_Map.find(NamedResourceKey{Type, Name});
+    if (it != m_Map.end())
+        it->second = RefCntWeakPtr<ResType>{pResource};
+    else
+        m_Map.emplace(NamedResourceKey{Type, Name, /*CopyName = */ true}, pResource);
 }
 
 // Instantiation is required by UnpackResourceSignatureImpl
@@ -404,82 +487,75 @@ void DearchiverBase::PSOData<RayTracingPipelineStateCreateInfo>::CreatePipeline(
     pDevice->CreateRayTracingPipelineState(CreateInfo, ppPSO);
 }
 
-template <typename CreateInfoType>
-bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
-                                      PSOData<CreateInfoType>& PSO,
-                                      IRenderDevice*           pDevice)
+RefCntAutoPtr<IShader> DearchiverBase::UnpackArchivedShader(ArchiveData&   Archive,
+                                                            DeviceType     DevType,
+                                                            Uint32         Idx,
+                                                            bool           SkipReflection,
+                                                            IRenderDevice* pDevice)
 {
-    const auto& pObjArchive = Archive.pObjArchive;
-    VERIFY_EXPR(pObjArchive);
-    const DeviceType      DevType       = GetArchiveDeviceType(pDevice);
-    const SerializedData& ShaderIdxData = pObjArchive->GetDeviceSpecificData(PSO.ArchiveResType, PSO.CreateInfo.PSODesc.Name, DevType);
-    if (!ShaderIdxData)
-        return false;
-
-    DynamicLinearAllocator Allocator{GetRawAllocator()};
+    ShaderCacheData& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
 
-    DeviceObjectArchive::ShaderIndexArray ShaderIndices;
     {
-        Serializer<SerializerMode::Read> Ser{ShaderIdxData};
-        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator))
+        std::unique_lock<std::mutex> ReadLock{ShaderCache.Mtx};
+        if (Idx < ShaderCache.Shaders.size())
         {
-            LOG_ERROR_MESSAGE("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
-            return false;
+            // Try to get cached shader
+            if (ShaderCache.Shaders[Idx])
+                return ShaderCache.Shaders[Idx];
         }
-        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
     }
 
-    ShaderCacheData& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
+    const SerializedData& SerializedShader = Archive.pObjArchive->GetSerializedShader(DevType, Idx);
+    if (!SerializedShader)
+        return {};
 
-    PSO.Shaders.resize(ShaderIndices.Count);
-    for (Uint32 i = 0; i < ShaderIndices.Count; ++i)
+    ShaderCreateInfo ShaderCI;
     {
-        RefCntAutoPtr<IShader>& pShader{PSO.Shaders[i]};
-
-        const Uint32 Idx = ShaderIndices.pIndices[i];
-
+        Serializer<SerializerMode::Read> ShaderSer{SerializedShader};
+        if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(ShaderSer, ShaderCI))
         {
-            std::unique_lock<std::mutex> ReadLock{ShaderCache.Mtx};
-            if (Idx < ShaderCache.Shaders.size())
-            {
-                // Try to get cached shader
-                pShader = ShaderCache.Shaders[Idx];
-                if (pShader)
-                    continue;
-            }
+            LOG_ERROR_MESSAGE("Failed to deserialize shader create info. Archive file may be corrupted or invalid.");
+            return {};
         }
+        VERIFY_EXPR(ShaderSer.IsEnded());
+    }
 
-        const SerializedData& SerializedShader = pObjArchive->GetSerializedShader(DevType, Idx);
-        if (!SerializedShader)
-            return false;
+    if (SkipReflection)
+        ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_SKIP_REFLECTION;
 
-        {
-            ShaderCreateInfo ShaderCI;
-            {
-                Serializer<SerializerMode::Read> ShaderSer{SerializedShader};
-                if (!ShaderSerializer<SerializerMode::Read>::SerializeCI(ShaderSer, ShaderCI))
-                {
-                    LOG_ERROR_MESSAGE("Failed to deserialize shader create info. Archive file may be corrupted or invalid.");
-                    return false;
-                }
-                VERIFY_EXPR(ShaderSer.IsEnded());
-            }
+    RefCntAutoPtr<IShader> pShader = UnpackShader(ShaderCI, pDevice);
+    if (!pShader)
+        return {};
 
-            if ((PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0)
-                ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_SKIP_REFLECTION;
+    // Add to the cache
+    {
+        std::unique_lock<std::mutex> WriteLock{ShaderCache.Mtx};
+        if (Idx >= ShaderCache.Shaders.size())
+            ShaderCache.Shaders.resize(size_t{Idx} + 1);
 
-            pShader = UnpackShader(ShaderCI, pDevice);
-            if (!pShader)
-                return false;
-        }
+        // The shader may have been unpacked by another thread
+        if (ShaderCache.Shaders[Idx])
+            return ShaderCache.Shaders[Idx];
 
-        // Add to the cache
-        {
-            std::unique_lock<std::mutex> WriteLock{ShaderCache.Mtx};
-            if (Idx >= ShaderCache.Shaders.size())
-                ShaderCache.Shaders.resize(size_t{Idx} + 1);
-            ShaderCache.Shaders[Idx] = pShader;
-        }
+        ShaderCache.Shaders[Idx] = pShader;
+    }
+
+    return pShader;
+}
+
+bool DearchiverBase::UnpackPSOShaders(ArchiveData&   Archive,
+                                      PSODataBase&   PSO,
+                                      IRenderDevice* pDevice)
+{
+    const DeviceType DevType        = GetArchiveDeviceType(pDevice);
+    const bool       SkipReflection = (PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0;
+
+    PSO.Shaders.resize(PSO.ShaderIndices.Count);
+    for (Uint32 i = 0; i < PSO.ShaderIndices.Count; ++i)
+    {
+        PSO.Shaders[i] = UnpackArchivedShader(Archive, DevType, PSO.ShaderIndices.pIndices[i], SkipReflection, pDevice);
+        if (!PSO.Shaders[i])
+            return false;
     }
 
     return true;
@@ -590,30 +666,18 @@ static bool ModifyPipelineStateCreateInfo(PSOCreateInfoType&             CreateI
 }
 
 template <typename CreateInfoType>
-void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
-                                             IPipelineState**               ppPSO)
+bool DearchiverBase::LoadPSOData(const ArchiveData&             Archive,
+                                 const PipelineStateUnpackInfo& UnpackInfo,
+                                 PSOData<CreateInfoType>&       PSO)
 {
     VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
 
     constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
 
-    // Do not cache modified PSOs
-    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
-    {
-        // Since PSO names must be unique (for each PSO type), we use a single cache for all
-        // loaded archives.
-        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
-            return;
-    }
-
-    // Find the archive that contains this PSO
-    ArchiveData* pArchiveData = FindArchive(ResType, UnpackInfo.Name);
-    if (pArchiveData == nullptr)
-        return;
-
-    PSOData<CreateInfoType> PSO{GetRawAllocator()};
-    if (!pArchiveData->pObjArchive->LoadResourceCommonData(ResType, UnpackInfo.Name, PSO))
-        return;
+    const auto& pObjArchive = Archive.pObjArchive;
+    VERIFY_EXPR(pObjArchive);
+    if (!pObjArchive->LoadResourceCommonData(ResType, UnpackInfo.Name, PSO))
+        return false;
 
 #ifdef DILIGENT_DEVELOPMENT
     if (UnpackInfo.pDevice->GetDeviceInfo().IsD3DDevice())
@@ -624,13 +688,38 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
     }
 #endif
 
+    const DeviceType      DevType       = GetArchiveDeviceType(UnpackInfo.pDevice);
+    const SerializedData& ShaderIdxData = pObjArchive->GetDeviceSpecificData(ResType, PSO.CreateInfo.PSODesc.Name, DevType);
+    if (!ShaderIdxData)
+        return false;
+
+    Serializer<SerializerMode::Read> Ser{ShaderIdxData};
+    if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, PSO.ShaderIndices, &PSO.Allocator))
+    {
+        LOG_ERROR_MESSAGE("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
+        return false;
+    }
+    VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
+
+    return true;
+}
+
+template <typename CreateInfoType>
+void DearchiverBase::CreatePSO(ArchiveData&                   Archive,
+                               const PipelineStateUnpackInfo& UnpackInfo,
+                               PSOData<CreateInfoType>&       PSO,
+                               PSO_CREATE_FLAGS               CreateFlags,
+                               IPipelineState**               ppPSO)
+{
+    constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
+
     if (!UnpackPSORenderPass(PSO, UnpackInfo.pDevice))
         return;
 
     if (!UnpackPSOSignatures(PSO, UnpackInfo.pDevice))
         return;
 
-    if (!UnpackPSOShaders(*pArchiveData, PSO, UnpackInfo.pDevice))
+    if (!UnpackPSOShaders(Archive, PSO, UnpackInfo.pDevice))
         return;
 
     PSO.AssignShaders();
@@ -638,21 +727,84 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
     PSO.CreateInfo.PSODesc.SRBAllocationGranularity = UnpackInfo.SRBAllocationGranularity;
     PSO.CreateInfo.PSODesc.ImmediateContextMask     = UnpackInfo.ImmediateContextMask;
     PSO.CreateInfo.pPSOCache                        = UnpackInfo.pCache;
+    PSO.CreateInfo.Flags |= CreateFlags;
 
     if (!ModifyPipelineStateCreateInfo(PSO.CreateInfo, UnpackInfo))
         return;
 
     PSO.CreatePipeline(UnpackInfo.pDevice, ppPSO);
 
-    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
+    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr && *ppPSO != nullptr)
         m_Cache.PSO.Set(ResType, UnpackInfo.Name, *ppPSO);
 }
 
+template <typename CreateInfoType>
+void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
+                                             IPipelineState**               ppPSO)
+{
+    VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
+
+    constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
+
+    // Do not cache modified PSOs
+    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
+    {
+        // Since PSO names must be unique (for each PSO type), we use a single cache for all
+        // loaded archives.
+        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
+            return;
+    }
+
+    // Find the archive that contains this PSO
+    ArchiveData* pArchiveData = FindArchive(ResType, UnpackInfo.Name);
+    if (pArchiveData == nullptr)
+        return;
+
+    std::unique_ptr<PSODataBase> pPrefetchedData = TakePrefetchedPSO(ResType, UnpackInfo.Name, UnpackInfo.pDevice);
+    if (pPrefetchedData)
+    {
+        CreatePSO(*pArchiveData, UnpackInfo, static_cast<PSOData<CreateInfoType>&>(*pPrefetchedData), PSO_CREATE_FLAG_NONE, ppPSO);
+        return;
+    }
+
+    PSOData<CreateInfoType> PSO{GetRawAllocator()};
+    if (!LoadPSOData(*pArchiveData, UnpackInfo, PSO))
+        return;
+
+    CreatePSO(*pArchiveData, UnpackInfo, PSO, PSO_CREATE_FLAG_NONE, ppPSO);
+}
+
+std::unique_ptr<DearchiverBase::PSODataBase> DearchiverBase::CreatePSOData(PIPELINE_TYPE PipelineType)
+{
+    switch (PipelineType)
+    {
+        case PIPELINE_TYPE_GRAPHICS:
+        case PIPELINE_TYPE_MESH:
+            return std::make_unique<PSOData<GraphicsPipelineStateCreateInfo>>(GetRawAllocator());
+
+        case PIPELINE_TYPE_COMPUTE:
+            return std::make_unique<PSOData<ComputePipelineStateCreateInfo>>(GetRawAllocator());
+
+        case PIPELINE_TYPE_RAY_TRACING:
+            return std::make_unique<PSOData<RayTracingPipelineStateCreateInfo>>(GetRawAllocator());
+
+        case PIPELINE_TYPE_TILE:
+            return std::make_unique<PSOData<TilePipelineStateCreateInfo>>(GetRawAllocator());
+
+        default:
+            UNEXPECTED("Unexpected pipeline type");
+            return {};
+    }
+}
+
 bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVersion, bool MakeCopy)
 {
     if (pArchiveData == nullptr)
         return false;
 
+    // Prefetch tasks reference the elements of m_Archives that may be relocated
+    WaitForPrefetchTasks(/*Cancel = */ false);
+
     for (const ArchiveData& Archive : m_Archives)
     {
         if (Archive.pObjArchive->GetData() == pArchiveData)
@@ -678,12 +830,18 @@ bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVe
         const auto it_inserted = m_ResNameToArchiveIdx.emplace(NamedResourceKey{ResType, ResName, MakeNameCopy}, ArchiveIdx);
         if (!it_inserted.second)
         {
-            const auto& OtherArchiveResources = m_Archives[it_inserted.first->second].pObjArchive->GetNamedResources();
-            const auto  it_other              = OtherArchiveResources.find(NamedResourceKey{ResType, ResName});
-
-            const bool IsDuplicate =
-                (it_other != OtherArchiveResources.end()) &&
-                (it.second == it_other->second);
+            const DeviceObjectArchive& OtherArchive          = *m_Archives[it_inserted.first->second].pObjArchive;
+            const auto&                OtherArchiveResources = OtherArchive.GetNamedResources();
+            const auto                 it_other              = OtherArchiveResources.find(NamedResourceKey{ResType, ResName});
+
+            // Archives may use different compression, so compare the uncompressed data
+            auto IsSameData = [&](const SerializedData& Data, const SerializedData& OtherData) {
+                return pObjArchive->GetUncompressedData(Data) == OtherArchive.GetUncompressedData(OtherData);
+            };
+
+            bool IsDuplicate = (it_other != OtherArchiveResources.end()) && IsSameData(it.second.Common, it_other->second.Common);
+            for (size_t i = 0; i < it.second.DeviceSpecific.size() && IsDuplicate; ++i)
+                IsDuplicate = IsSameData(it.second.DeviceSpecific[i], it_other->second.DeviceSpecific[i]);
             if (!IsDuplicate)
             {
                 LOG_ERROR_MESSAGE("Resource with name '", ResName, "' already exists in the archive.");
@@ -703,6 +861,9 @@ void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackIn
 
     *ppPSO = nullptr;
 
+    if (m_pUsageTrace)
+        m_pUsageTrace->RecordPipeline(UnpackInfo.PipelineType, UnpackInfo.Name);
+
     switch (UnpackInfo.PipelineType)
     {
         case PIPELINE_TYPE_GRAPHICS:
@@ -729,6 +890,557 @@ void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackIn
     }
 }
 
+Uint32 DearchiverBase::UnpackPipelineStates(const PipelineStateBatchUnpackInfo& BatchInfo,
+                                            IPipelineState**                    ppPSOs,
+                                            PSO_UNPACK_STATUS*                  pStatuses)
+{
+    const Uint32 NumPipelines = BatchInfo.NumPipelines;
+    if (NumPipelines == 0)
+        return 0;
+
+    if (BatchInfo.pUnpackInfos == nullptr || ppPSOs == nullptr)
+    {
+        DEV_ERROR(BatchInfo.pUnpackInfos == nullptr ? "pUnpackInfos" : "ppPSOs", " must not be null when NumPipelines is not zero");
+        if (pStatuses != nullptr)
+        {
+            for (Uint32 i = 0; i < NumPipelines; ++i)
+                pStatuses[i] = PSO_UNPACK_STATUS_INVALID_PARAMETERS;
+        }
+        return 0;
+    }
+
+    struct BatchItem
+    {
+        PSO_UNPACK_STATUS             Status   = PSO_UNPACK_STATUS_FAILED;
+        ArchiveData*                  pArchive = nullptr;
+        std::unique_ptr<PSODataBase>  pData;
+        RefCntAutoPtr<IPipelineState> pPSO;
+
+        // Whether the pipeline data has been prefetched
+        bool IsLoaded = false;
+
+        // Index of the item that unpacks the same pipeline state
+        size_t SrcItemIdx = ~size_t{0};
+
+        // Indices of the shared objects in the Dependencies array
+        std::vector<size_t> Dependencies;
+    };
+    std::vector<BatchItem> Items(NumPipelines);
+    std::vector<size_t>    ItemsToUnpack;
+
+    // Step 1 - verify parameters, check the cache and find the archives.
+    //          Pipelines requested multiple times are unpacked only once.
+    std::unordered_map<NamedResourceKey, size_t, NamedResourceKey::Hasher> UniquePSOs;
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        const PipelineStateUnpackInfo& UnpackInfo = BatchInfo.pUnpackInfos[i];
+        BatchItem&                     Item       = Items[i];
+
+        ppPSOs[i] = nullptr;
+        if (!VerifyPipelineStateUnpackInfo(UnpackInfo, &ppPSOs[i]))
+        {
+            Item.Status = PSO_UNPACK_STATUS_INVALID_PARAMETERS;
+            continue;
+        }
+
+        const ResourceType ResType = PipelineTypeToArchiveResourceType(UnpackInfo.PipelineType);
+        if (ResType == ResourceType::Undefined)
+        {
+            LOG_ERROR_MESSAGE("Unsupported pipeline type");
+            Item.Status = PSO_UNPACK_STATUS_INVALID_PARAMETERS;
+            continue;
+        }
+
+        if (m_pUsageTrace)
+            m_pUsageTrace->RecordPipeline(UnpackInfo.PipelineType, UnpackInfo.Name);
+
+        // Do not cache or share modified PSOs
+        if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
+        {
+            if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, Item.pPSO.RawDblPtr()))
+            {
+                Item.Status = PSO_UNPACK_STATUS_SUCCESS;
+                continue;
+            }
+
+            const auto it_inserted = UniquePSOs.emplace(NamedResourceKey{ResType, UnpackInfo.Name}, i);
+            if (!it_inserted.second && BatchInfo.pUnpackInfos[it_inserted.first->second].pDevice == UnpackInfo.pDevice)
+            {
+                Item.SrcItemIdx = it_inserted.first->second;
+                continue;
+            }
+        }
+
+        Item.pArchive = FindArchive(ResType, UnpackInfo.Name);
+        if (Item.pArchive == nullptr)
+        {
+            Item.Status = PSO_UNPACK_STATUS_NOT_FOUND;
+            continue;
+        }
+
+        Item.pData    = TakePrefetchedPSO(ResType, UnpackInfo.Name, UnpackInfo.pDevice);
+        Item.IsLoaded = Item.pData != nullptr;
+        if (!Item.IsLoaded)
+            Item.pData = CreatePSOData(UnpackInfo.PipelineType);
+        ItemsToUnpack.push_back(i);
+    }
+
+    // Step 2 - deserialize pipeline create infos and shader indices, unless they have been prefetched.
+    ProcessInParallel(BatchInfo.pThreadPool, ItemsToUnpack.size(),
+                      [&](size_t i) {
+                          const size_t ItemIdx = ItemsToUnpack[i];
+                          BatchItem&   Item    = Items[ItemIdx];
+                          if (!Item.IsLoaded && !Item.pData->Load(*this, *Item.pArchive, BatchInfo.pUnpackInfos[ItemIdx]))
+                              Item.pData.reset();
+                      });
+
+    // Step 3 - collect render passes, resource signatures and shaders shared by the pipelines.
+    struct Dependency
+    {
+        enum class Type
+        {
+            RenderPass,
+            Signature,
+            Shader
+        } DepType;
+
+        IRenderDevice* pDevice = nullptr;
+
+        // Render pass or signature name
+        const char* Name                     = nullptr;
+        Uint32      SRBAllocationGranularity = 1;
+
+        ArchiveData* pArchive       = nullptr;
+        DeviceType   DevType        = DeviceType::Count;
+        Uint32       ShaderIdx      = 0;
+        bool         SkipReflection = false;
+
+        RefCntAutoPtr<IDeviceObject> pObject;
+    };
+    std::vector<Dependency> Dependencies;
+
+    // Objects are created by the device, so pipelines that are unpacked
+    // for different devices never share dependencies.
+    struct DeviceDependencies
+    {
+        std::unordered_map<NamedResourceKey, size_t, NamedResourceKey::Hasher> Named;
+        // (Archive index, device type, shader index) -> dependency index
+        std::unordered_map<Uint64, size_t> Shaders;
+    };
+    std::unordered_map<IRenderDevice*, DeviceDependencies> DependencyIndices;
+
+    auto AddNamedDependency = [&](BatchItem& Item, Dependency::Type DepType, ResourceType ResType, const char* Name, IRenderDevice* pDevice, Uint32 SRBAllocationGranularity) {
+        const auto it_inserted = DependencyIndices[pDevice].Named.emplace(NamedResourceKey{ResType, Name}, Dependencies.size());
+        if (it_inserted.second)
+        {
+            Dependency Dep{DepType};
+            Dep.pDevice                  = pDevice;
+            Dep.Name                     = Name;
+            Dep.SRBAllocationGranularity = SRBAllocationGranularity;
+            Dependencies.emplace_back(std::move(Dep));
+        }
+        Item.Dependencies.push_back(it_inserted.first->second);
+    };
+
+    for (size_t ItemIdx : ItemsToUnpack)
+    {
+        BatchItem& Item = Items[ItemIdx];
+        if (!Item.pData)
+            continue;
+
+        const PSODataBase&             PSO        = *Item.pData;
+        const PipelineStateCreateInfo& CreateInfo = PSO.GetCreateInfo();
+        IRenderDevice* const           pDevice    = BatchInfo.pUnpackInfos[ItemIdx].pDevice;
+
+        if (PSO.RenderPassName != nullptr && *PSO.RenderPassName != 0)
+            AddNamedDependency(Item, Dependency::Type::RenderPass, ResourceType::RenderPass, PSO.RenderPassName, pDevice, 1);
+
+        // Implicit signatures are never shared
+        if ((PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_IMPLICIT_SIGNATURE0) == 0)
+        {
+            for (Uint32 i = 0; i < CreateInfo.ResourceSignaturesCount; ++i)
+                AddNamedDependency(Item, Dependency::Type::Signature, ResourceType::ResourceSignature, PSO.PRSNames[i], pDevice, CreateInfo.PSODesc.SRBAllocationGranularity);
+        }
+
+        const DeviceType    DevType    = GetArchiveDeviceType(pDevice);
+        const Uint64        ArchiveIdx = static_cast<Uint64>(Item.pArchive - m_Archives.data());
+        DeviceDependencies& DevDeps    = DependencyIndices[pDevice];
+        for (Uint32 i = 0; i < PSO.ShaderIndices.Count; ++i)
+        {
+            const Uint32 ShaderIdx = PSO.ShaderIndices.pIndices[i];
+            const Uint64 Key       = (ArchiveIdx << 40u) | (Uint64{static_cast<Uint8>(DevType)} << 32u) | ShaderIdx;
+
+            const auto it_inserted = DevDeps.Shaders.emplace(Key, Dependencies.size());
+            if (it_inserted.second)
+            {
+                Dependency Dep{Dependency::Type::Shader};
+                Dep.pDevice        = pDevice;
+                Dep.pArchive       = Item.pArchive;
+                Dep.DevType        = DevType;
+                Dep.ShaderIdx      = ShaderIdx;
+                Dep.SkipReflection = (PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION) != 0;
+                Dependencies.emplace_back(std::move(Dep));
+            }
+            Item.Dependencies.push_back(it_inserted.first->second);
+        }
+    }
+
+    // Step 4 - unpack shared objects. They are added to the caches, and we keep strong
+    //          references so that the pipelines find them there.
+    ProcessInParallel(BatchInfo.pThreadPool, Dependencies.size(),
+                      [&](size_t i) {
+                          Dependency& Dep = Dependencies[i];
+                          switch (Dep.DepType)
+                          {
+                              case Dependency::Type::RenderPass:
+                              {
+                                  RefCntAutoPtr<IRenderPass> pRenderPass;
+                                  UnpackRenderPass(RenderPassUnpackInfo{Dep.pDevice, Dep.Name}, &pRenderPass);
+                                  Dep.pObject = std::move(pRenderPass);
+                                  break;
+                              }
+
+                              case Dependency::Type::Signature:
+                              {
+                                  ResourceSignatureUnpackInfo UnpackInfo{Dep.pDevice, Dep.Name};
+                                  UnpackInfo.SRBAllocationGranularity = Dep.SRBAllocationGranularity;
+
+                                  Dep.pObject = UnpackResourceSignature(UnpackInfo, false /*IsImplicit*/);
+                                  break;
+                              }
+
+                              case Dependency::Type::Shader:
+                                  Dep.pObject = UnpackArchivedShader(*Dep.pArchive, Dep.DevType, Dep.ShaderIdx, Dep.SkipReflection, Dep.pDevice);
+                                  break;
+                          }
+                      });
+
+    // Step 5 - create pipeline states.
+    const PSO_CREATE_FLAGS CreateFlags = BatchInfo.Asynchronous ? PSO_CREATE_FLAG_ASYNCHRONOUS : PSO_CREATE_FLAG_NONE;
+    ProcessInParallel(BatchInfo.pThreadPool, ItemsToUnpack.size(),
+                      [&](size_t i) {
+                          const size_t ItemIdx = ItemsToUnpack[i];
+                          BatchItem&   Item    = Items[ItemIdx];
+                          if (!Item.pData)
+                              return;
+
+                          // Errors for shared objects that failed to unpack have already been reported
+                          const bool DependenciesUnpacked =
+                              std::all_of(Item.Dependencies.begin(), Item.Dependencies.end(),
+                                          [&Dependencies](size_t DepIdx) { return Dependencies[DepIdx].pObject != nullptr; });
+                          if (DependenciesUnpacked)
+                          {
+                              Item.pData->Create(*this, *Item.pArchive, BatchInfo.pUnpackInfos[ItemIdx], CreateFlags, &Item.pPSO);
+                              if (Item.pPSO)
+                                  Item.Status = PSO_UNPACK_STATUS_SUCCESS;
+                          }
+                          Item.pData.reset();
+                      });
+
+    // Step 6 - write the results.
+    Uint32 NumUnpacked = 0;
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        BatchItem& Item = Items[i];
+        if (Item.SrcItemIdx != ~size_t{0})
+        {
+            VERIFY_EXPR(Item.SrcItemIdx < i);
+            Item.Status = Items[Item.SrcItemIdx].Status;
+            Item.pPSO   = Items[Item.SrcItemIdx].pPSO;
+        }
+
+        if (Item.Status == PSO_UNPACK_STATUS_SUCCESS)
+            ++NumUnpacked;
+        if (pStatuses != nullptr)
+            pStatuses[i] = Item.Status;
+    }
+    // Detach the pointers after all duplicates have been resolved
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+        ppPSOs[i] = Items[i].pPSO.Detach();
+
+    return NumUnpacked;
+}
+
+Uint32 DearchiverBase::PrefetchPipelineStates(const PipelineStatePrefetchInfo& PrefetchInfo)
+{
+    if (PrefetchInfo.NumPipelines == 0 && PrefetchInfo.pUsageTrace == nullptr)
+        return 0;
+
+    if (PrefetchInfo.pDevice == nullptr || (PrefetchInfo.pPipelines == nullptr && PrefetchInfo.NumPipelines != 0))
+    {
+        DEV_ERROR(PrefetchInfo.pDevice == nullptr ? "pDevice" : "pPipelines", " must not be null when NumPipelines is not zero");
+        return 0;
+    }
+
+    std::vector<PipelineStatePrefetchItem> Items{PrefetchInfo.pPipelines, PrefetchInfo.pPipelines + PrefetchInfo.NumPipelines};
+
+    // Names are owned by the trace entries
+    std::vector<PipelineUsageTrace::Entry> TraceEntries;
+    if (const IDataBlob* pTrace = PrefetchInfo.pUsageTrace)
+    {
+        if (PipelineUsageTrace::Deserialize(pTrace->GetConstDataPtr(), pTrace->GetSize(), TraceEntries))
+        {
+            for (const PipelineUsageTrace::Entry& TraceEntry : TraceEntries)
+            {
+                if (!TraceEntry.IsShader())
+                    Items.push_back({TraceEntry.Name.c_str(), TraceEntry.PipelineType});
+            }
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to read the pipeline usage trace. Only the pipelines in the pPipelines array will be prefetched.");
+        }
+    }
+
+    std::vector<std::shared_ptr<PrefetchedPSO>> Entries;
+    {
+        std::lock_guard<std::mutex> Lock{m_Prefetch.Mtx};
+
+        DearchiverPrefetchStats& Stats = m_Prefetch.Stats;
+        for (size_t i = 0; i < Items.size(); ++i)
+        {
+            const PipelineStatePrefetchItem& Item = Items[i];
+            ++Stats.NumRequested;
+
+            const ResourceType ResType = PipelineTypeToArchiveResourceType(Item.PipelineType);
+            if (Item.Name == nullptr || Item.Name[0] == '\0' || ResType == ResourceType::Undefined)
+            {
+                DEV_ERROR("Pipeline state ", i, " can't be prefetched: name must not be empty and pipeline type must be valid");
+                ++Stats.NumSkipped;
+                continue;
+            }
+
+            ArchiveData* pArchive = FindArchive(ResType, Item.Name);
+            if (pArchive == nullptr)
+            {
+                ++Stats.NumSkipped;
+                continue;
+            }
+
+            // Use the name string owned by the archive
+            const auto& Resources = pArchive->pObjArchive->GetNamedResources();
+            const auto  res_it    = Resources.find(NamedResourceKey{ResType, Item.Name});
+            VERIFY_EXPR(res_it != Resources.end());
+            const char* Name = res_it->first.GetName();
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            if (m_Cache.PSO.Get(ResType, Name, pPSO.RawDblPtr()) || m_Prefetch.PSOs.find(NamedResourceKey{ResType, Name}) != m_Prefetch.PSOs.end())
+            {
+                ++Stats.NumSkipped;
+                continue;
+            }
+
+            auto pEntry = std::make_shared<PrefetchedPSO>(*pArchive, Item.PipelineType, Name, PrefetchInfo.pDevice, PrefetchInfo.MaxPendingDataSize);
+            m_Prefetch.PSOs.emplace(NamedResourceKey{ResType, Name}, pEntry);
+            Entries.emplace_back(std::move(pEntry));
+        }
+    }
+
+    if (PrefetchInfo.pThreadPool == nullptr)
+    {
+        for (const std::shared_ptr<PrefetchedPSO>& pEntry : Entries)
+            PrefetchPSO(*pEntry);
+        return static_cast<Uint32>(Entries.size());
+    }
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+    Tasks.reserve(Entries.size());
+    for (std::shared_ptr<PrefetchedPSO>& pEntry : Entries)
+    {
+        Tasks.emplace_back(EnqueueAsyncWork(PrefetchInfo.pThreadPool,
+                                            [this, pEntry](Uint32 /*ThreadId*/) {
+                                                PrefetchPSO(*pEntry);
+                                                return ASYNC_TASK_STATUS_COMPLETE;
+                                            }));
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Prefetch.Mtx};
+
+        // Release finished tasks so that the list does not grow indefinitely
+        auto& PrefetchTasks = m_Prefetch.Tasks;
+        PrefetchTasks.erase(std::remove_if(PrefetchTasks.begin(), PrefetchTasks.end(),
+                                           [](const std::pair<RefCntAutoPtr<IThreadPool>, RefCntAutoPtr<IAsyncTask>>& Task) {
+                                               return Task.second->IsFinished();
+                                           }),
+                            PrefetchTasks.end());
+        for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+            PrefetchTasks.emplace_back(PrefetchInfo.pThreadPool, std::move(pTask));
+    }
+
+    return static_cast<Uint32>(Entries.size());
+}
+
+void DearchiverBase::PrefetchPSO(PrefetchedPSO& Entry)
+{
+    const ResourceType ResType = PipelineTypeToArchiveResourceType(Entry.PipelineType);
+
+    // Must be called while the mutex is locked
+    auto RemoveEntry = [&]() {
+        if (!Entry.IsAbandoned)
+        {
+            VERIFY_EXPR(m_Prefetch.PSOs.find(NamedResourceKey{ResType, Entry.Name})->second.get() == &Entry);
+            m_Prefetch.PSOs.erase(NamedResourceKey{ResType, Entry.Name});
+        }
+        VERIFY_EXPR(m_Prefetch.Stats.PendingDataSize >= Entry.DataSize);
+        m_Prefetch.Stats.PendingDataSize -= Entry.DataSize;
+        Entry.DataSize = 0;
+    };
+
+    // Adds the size to the memory budget reserved by the entry, or removes the entry if it does not fit
+    auto ReserveDataSize = [&](Uint64 DataSize) {
+        std::lock_guard<std::mutex> Lock{m_Prefetch.Mtx};
+
+        DearchiverPrefetchStats& Stats = m_Prefetch.Stats;
+
+        // The pipeline has already been unpacked without the prefetched data
+        if (Entry.IsAbandoned)
+        {
+            RemoveEntry();
+            return false;
+        }
+
+        if (Stats.PendingDataSize + DataSize > Entry.MaxPendingDataSize)
+        {
+            ++Stats.NumSkipped;
+            RemoveEntry();
+            return false;
+        }
+
+        Entry.DataSize += DataSize;
+        Stats.PendingDataSize += DataSize;
+        return true;
+    };
+
+    const DeviceObjectArchive& ObjArchive = *Entry.Archive.pObjArchive;
+    const DeviceType           DevType    = GetArchiveDeviceType(Entry.pDevice);
+
+    // Reserve the budget for the pipeline data using the sizes recorded in the archive,
+    // so that pipelines that do not fit are skipped before their data is decompressed.
+    {
+        const auto res_it = ObjArchive.GetNamedResources().find(NamedResourceKey{ResType, Entry.Name});
+        VERIFY_EXPR(res_it != ObjArchive.GetNamedResources().end());
+        const Uint64 DataSize =
+            ObjArchive.GetUncompressedSize(res_it->second.Common) +
+            ObjArchive.GetUncompressedSize(res_it->second.DeviceSpecific[static_cast<size_t>(DevType)]);
+        if (!ReserveDataSize(DataSize))
+            return;
+    }
+
+    PipelineStateUnpackInfo UnpackInfo;
+    UnpackInfo.pDevice      = Entry.pDevice;
+    UnpackInfo.PipelineType = Entry.PipelineType;
+    UnpackInfo.Name         = Entry.Name;
+
+    // Decompress and deserialize the pipeline data
+    std::unique_ptr<PSODataBase> pData = CreatePSOData(Entry.PipelineType);
+    if (!pData || !pData->Load(*this, Entry.Archive, UnpackInfo))
+    {
+        std::lock_guard<std::mutex> Lock{m_Prefetch.Mtx};
+        ++m_Prefetch.Stats.NumFailed;
+        RemoveEntry();
+        return;
+    }
+
+    // Reserve the budget for the shaders before creating them
+    {
+        Uint64 ShadersSize = 0;
+        for (Uint32 i = 0; i < pData->ShaderIndices.Count; ++i)
+            ShadersSize += ObjArchive.GetSerializedShaderSize(DevType, pData->ShaderIndices.pIndices[i]);
+        if (!ReserveDataSize(ShadersSize))
+            return;
+    }
+
+    // Shaders are added to the archive's shader cache and will be found there when the pipeline is created
+    const bool ShadersUnpacked = UnpackPSOShaders(Entry.Archive, *pData, Entry.pDevice);
+
+    std::lock_guard<std::mutex> Lock{m_Prefetch.Mtx};
+    if (!ShadersUnpacked)
+    {
+        ++m_Prefetch.Stats.NumFailed;
+        RemoveEntry();
+    }
+    else if (Entry.IsAbandoned)
+    {
+        RemoveEntry();
+    }
+    else
+    {
+        ++m_Prefetch.Stats.NumPrefetched;
+        Entry.pData = std::move(pData);
+    }
+}
+
+std::unique_ptr<DearchiverBase::PSODataBase> DearchiverBase::TakePrefetchedPSO(ResourceType ResType, const char* Name, IRenderDevice* pDevice)
+{
+    std::lock_guard<std::mutex> Lock{m_Prefetch.Mtx};
+
+    DearchiverPrefetchStats& Stats = m_Prefetch.Stats;
+
+    auto it = m_Prefetch.PSOs.find(NamedResourceKey{ResType, Name});
+    if (it == m_Prefetch.PSOs.end())
+    {
+        ++Stats.NumMisses;
+        return {};
+    }
+
+    // The entry is removed even if the data can't be used, so that it does not occupy the memory budget
+    std::shared_ptr<PrefetchedPSO> pEntry = std::move(it->second);
+    m_Prefetch.PSOs.erase(it);
+
+    if (!pEntry->pData)
+    {
+        // The prefetch is still in progress. The task will release the data when it is complete.
+        pEntry->IsAbandoned = true;
+        ++Stats.NumMisses;
+        return {};
+    }
+
+    VERIFY_EXPR(Stats.PendingDataSize >= pEntry->DataSize);
+    Stats.PendingDataSize -= pEntry->DataSize;
+
+    if (pEntry->pDevice != pDevice)
+    {
+        ++Stats.NumMisses;
+        return {};
+    }
+
+    ++Stats.NumHits;
+    return std::move(pEntry->pData);
+}
+
+void DearchiverBase::WaitForPrefetchTasks(bool Cancel)
+{
+    std::vector<std::pair<RefCntAutoPtr<IThreadPool>, RefCntAutoPtr<IAsyncTask>>> Tasks;
+    {
+        std::lock_guard<std::mutex> Lock{m_Prefetch.Mtx};
+        Tasks.swap(m_Prefetch.Tasks);
+    }
+
+    for (const auto& Task : Tasks)
+    {
+        if (!Cancel || !Task.first->RemoveTask(Task.second))
+            Task.second->WaitForCompletion();
+    }
+}
+
+void DearchiverBase::GetPrefetchStats(DearchiverPrefetchStats& Stats) const
+{
+    std::lock_guard<std::mutex> Lock{m_Prefetch.Mtx};
+    Stats = m_Prefetch.Stats;
+}
+
+Bool DearchiverBase::WriteUsageTrace(IFileStream* pStream) const
+{
+    if (!m_pUsageTrace)
+    {
+        DEV_ERROR("Usage trace is disabled. Set EnableUsageTrace member of DearchiverCreateInfo to true.");
+        return false;
+    }
+
+    return m_pUsageTrace->Serialize(pStream);
+}
+
 static bool ModifyShaderDesc(ShaderDesc&             Desc,
                              const ShaderUnpackInfo& UnpackInfo)
 {
@@ -756,6 +1468,9 @@ void DearchiverBase::UnpackShader(const ShaderUnpackInfo& UnpackInfo,
 
     *ppShader = nullptr;
 
+    if (m_pUsageTrace)
+        m_pUsageTrace->RecordShader(UnpackInfo.Name);
+
     constexpr ResourceType ResType = ResourceType::StandaloneShader;
 
     // Find the archive that contains this shader.
@@ -870,13 +1585,17 @@ bool DearchiverBase::Store(IDataBlob** ppArchive) const
 
     try
     {
-        DeviceObjectArchive MergedArchive{!m_Archives.empty() ? m_Archives.front().pObjArchive->GetContentVersion() : 0};
+        std::vector<const DeviceObjectArchive*> pSrcArchives;
+        pSrcArchives.reserve(m_Archives.size());
         for (const ArchiveData& Archive : m_Archives)
         {
             if (Archive.pObjArchive)
-                MergedArchive.Merge(*Archive.pObjArchive);
+                pSrcArchives.emplace_back(Archive.pObjArchive.get());
         }
 
+        DeviceObjectArchive MergedArchive{!m_Archives.empty() ? m_Archives.front().pObjArchive->GetContentVersion() : 0};
+        MergedArchive.Merge(pSrcArchives.data(), pSrcArchives.size());
+
         MergedArchive.Serialize(ppArchive);
         return *ppArchive != nullptr;
     }
@@ -888,7 +1607,16 @@ bool DearchiverBase::Store(IDataBlob** ppArchive) const
 
 void DearchiverBase::Reset()
 {
+    WaitForPrefetchTasks(/*Cancel = */ true);
+    {
+        std::lock_guard<std::mutex> Lock{m_Prefetch.Mtx};
+        m_Prefetch.PSOs.clear();
+        m_Prefetch.Stats = {};
+    }
+
     m_Archives.clear();
+    // Archive indices are no longer valid
+    m_ResNameToArchiveIdx.clear();
 }
 
 Uint32 DearchiverBase::GetContentVersion() const
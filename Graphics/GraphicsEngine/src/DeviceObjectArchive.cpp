@@ -27,19 +27,23 @@
 #include "DeviceObjectArchive.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 
 #include "Shader.h"
 #include "EngineMemory.h"
 #include "DataBlobImpl.hpp"
 #include "PSOSerializer.hpp"
+#include "ThreadPool.hpp"
+#include "LZCompression.hpp"
+#include "BasicFileSystem.hpp"
 
 namespace Diligent
 {
 
 DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVICE_TYPE Type)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Did you add a new render device type? Please handle it here.");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Did you add a new render device type? Please handle it here.");
     switch (Type)
     {
             // clang-format off
@@ -73,6 +77,8 @@ DeviceObjectArchive::ArchiveHeader::ArchiveHeader() noexcept
 namespace
 {
 
+using BlobLocation = DeviceObjectArchive::BlobLocation;
+
 template <SerializerMode Mode>
 struct ArchiveSerializer
 {
@@ -87,9 +93,16 @@ struct ArchiveSerializer
 
     bool SerializeHeader(ConstQual<ArchiveHeader>& Header) const
     {
-        ASSERT_SIZEOF64(Header, 24, "Please handle new members here");
+        ASSERT_SIZEOF64(Header, 32, "Please handle new members here");
         // NB: this must match header deserialization in DeviceObjectArchive::Deserialize
-        return Ser(Header.MagicNumber, Header.Version, Header.APIVersion, Header.ContentVersion, Header.GitHash);
+        return Ser(Header.MagicNumber, Header.Version, Header.IndexSize, Header.APIVersion, Header.ContentVersion, Header.GitHash);
+    }
+
+    // Overwrites the index size in the header previously written at the beginning of the archive
+    bool PatchIndexSize(Uint32 IndexSize) const
+    {
+        // NB: this must match SerializeHeader
+        return Ser.Patch(sizeof(ArchiveHeader::MagicNumber) + sizeof(ArchiveHeader::Version), IndexSize);
     }
 
     bool SerializeResourceData(ConstQual<ResourceData>& ResData) const
@@ -107,6 +120,21 @@ struct ArchiveSerializer
     }
 
     bool SerializeShaders(ConstQual<ShadersVector>& Shaders) const;
+
+    bool SerializeBlobLocation(ConstQual<BlobLocation>& Location) const
+    {
+        return Ser(Location.Offset, Location.Size, Location.CodecId, Location.UncompressedSize);
+    }
+
+    // Overwrites the location previously written at the given offset
+    bool PatchBlobLocation(size_t Offset, const BlobLocation& Location) const
+    {
+        // NB: this must match SerializeBlobLocation
+        return (Ser.Patch(Offset, Location.Offset) &&
+                Ser.Patch(Offset + sizeof(Location.Offset), Location.Size) &&
+                Ser.Patch(Offset + sizeof(Location.Offset) + sizeof(Location.Size), Location.CodecId) &&
+                Ser.Patch(Offset + sizeof(Location.Offset) + sizeof(Location.Size) + sizeof(Location.CodecId), Location.UncompressedSize));
+    }
 };
 
 template <SerializerMode Mode>
@@ -144,8 +172,78 @@ bool ArchiveSerializer<SerializerMode::Read>::SerializeShaders(ShadersVector& Sh
     return true;
 }
 
+class LZCodec final : public DeviceObjectArchive::Codec
+{
+public:
+    virtual Uint32 GetId() const override final
+    {
+        return static_cast<Uint32>(DeviceObjectArchive::CodecId::LZ);
+    }
+
+    virtual size_t GetMaxCompressedSize(size_t SrcSize) const override final
+    {
+        return GetLZMaxCompressedSize(SrcSize);
+    }
+
+    virtual size_t Compress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity) const override final
+    {
+        return LZCompress(pSrc, SrcSize, pDst, DstCapacity);
+    }
+
+    virtual size_t GetMaxDecompressedSize(size_t SrcSize) const override final
+    {
+        return GetLZMaxDecompressedSize(SrcSize);
+    }
+
+    virtual bool Decompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize) const override final
+    {
+        return LZDecompress(pSrc, SrcSize, pDst, DstSize);
+    }
+};
+
+const DeviceObjectArchive::Codec* FindCodec(Uint32 Id, const DeviceObjectArchive::Codec* const* ppCodecs, Uint32 NumCodecs)
+{
+    if (Id == static_cast<Uint32>(DeviceObjectArchive::CodecId::LZ))
+        return &DeviceObjectArchive::GetLZCodec();
+    for (Uint32 i = 0; i < NumCodecs; ++i)
+    {
+        if (ppCodecs[i] != nullptr && ppCodecs[i]->GetId() == Id)
+            return ppCodecs[i];
+    }
+    return nullptr;
+}
+
+// Returns the codec for the compressed data blob, or null if the codec is unknown
+// or the uncompressed size recorded in the archive can't be produced by the codec.
+const DeviceObjectArchive::Codec* GetBlobCodec(const BlobLocation& Location, const DeviceObjectArchive::Codec* const* ppCodecs, Uint32 NumCodecs)
+{
+    const DeviceObjectArchive::Codec* pCodec = FindCodec(Location.CodecId, ppCodecs, NumCodecs);
+    if (pCodec == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Data blob is compressed with unknown codec ", Location.CodecId, '.');
+        return nullptr;
+    }
+
+    // The uncompressed size is not trusted as it is used to allocate the destination buffer
+    const size_t MaxUncompressedSize = pCodec->GetMaxDecompressedSize(Location.Size);
+    if (Location.UncompressedSize > MaxUncompressedSize)
+    {
+        LOG_ERROR_MESSAGE("Uncompressed size of the data blob (", Location.UncompressedSize, " bytes) exceeds the maximum size (",
+                          MaxUncompressedSize, " bytes) that ", Location.Size, " compressed bytes may expand to.");
+        return nullptr;
+    }
+
+    return pCodec;
+}
+
 } // namespace
 
+const DeviceObjectArchive::Codec& DeviceObjectArchive::GetLZCodec()
+{
+    static const LZCodec Codec;
+    return Codec;
+}
+
 DeviceObjectArchive::DeviceObjectArchive(Uint32 ContentVersion) noexcept :
     m_ContentVersion{ContentVersion}
 {
@@ -153,6 +251,7 @@ DeviceObjectArchive::DeviceObjectArchive(Uint32 ContentVersion) noexcept :
 
 void DeviceObjectArchive::Clear() noexcept
 {
+    m_CompressedBlobs.clear();
     m_NamedResources.clear();
     m_DeviceShaders = {};
     m_pArchiveData.Release();
@@ -181,24 +280,35 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
         DataBlobImpl::MakeCopy(CI.pData) :
         const_cast<IDataBlob*>(CI.pData); // Need to remove const for AddRef/Release
 
+    // Resources reference the data of the blob we keep, which may be a copy
     Serializer<SerializerMode::Read> Reader{
         SerializedData{
-            const_cast<void*>(CI.pData->GetConstDataPtr()),
-            CI.pData->GetSize(),
+            const_cast<void*>(m_pArchiveData->GetConstDataPtr()),
+            m_pArchiveData->GetSize(),
         },
     };
     ArchiveSerializer<SerializerMode::Read> ArchiveReader{Reader};
 
     // NB: this must match header serialization in DeviceObjectArchive::SerializeHeader
     ArchiveHeader Header;
-    ASSERT_SIZEOF64(Header, 24, "Please handle new members here");
+    ASSERT_SIZEOF64(Header, 32, "Please handle new members here");
     CHECK_ARCHIVE(ArchiveReader.Ser(Header.MagicNumber), "Failed to read device object archive header magic number.");
 
     CHECK_ARCHIVE(Header.MagicNumber == HeaderMagicNumber, "Invalid device object archive header.");
 
     CHECK_ARCHIVE(ArchiveReader.Ser(Header.Version), "Failed to read device object archive version.");
 
-    CHECK_ARCHIVE(Header.Version == ArchiveVersion, "Unsupported device object archive version: ", Header.Version, ". Expected version: ", Uint32{ArchiveVersion});
+    CHECK_ARCHIVE(Header.Version >= MinSupportedArchiveVersion && Header.Version <= ArchiveVersion,
+                  "Unsupported device object archive version: ", Header.Version, ". Expected version: ", Uint32{ArchiveVersion});
+
+    // Version 8 archives do not have the index
+    const bool IsIndexed = Header.Version >= 9;
+    if (IsIndexed)
+    {
+        CHECK_ARCHIVE(ArchiveReader.Ser(Header.IndexSize), "Failed to read device object archive index size.");
+        CHECK_ARCHIVE(Header.IndexSize <= m_pArchiveData->GetSize(),
+                      "Device object archive index size (", Header.IndexSize, ") exceeds the archive size (", m_pArchiveData->GetSize(), ").");
+    }
 
     CHECK_ARCHIVE(ArchiveReader.Ser(Header.APIVersion), "Failed to read Diligent API version.");
 
@@ -210,86 +320,455 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
 
     CHECK_ARCHIVE(ArchiveReader.Ser(Header.GitHash), "Failed to read Git Hash.");
 
+    static_assert(ArchiveVersion == 9, "Please handle the new archive version below");
+    if (IsIndexed)
+    {
+        CHECK_ARCHIVE(ReadIndexedResources(Reader, CI), "Failed to read the device object archive index.");
+        CHECK_ARCHIVE(Reader.GetSize() == Header.IndexSize,
+                      "Device object archive index size recorded in the header (", Header.IndexSize, ") does not match the actual size (", Reader.GetSize(), ").");
+    }
+    else
+    {
+        CHECK_ARCHIVE(ReadSequentialResources(Reader), "Failed to read the device object archive resources.");
+    }
+#undef CHECK_ARCHIVE
+
+    return true;
+}
+
+bool DeviceObjectArchive::ReadIndexedResources(Serializer<SerializerMode::Read>& Reader, const CreateInfo& CI) noexcept
+{
+    const size_t ArchiveSize = m_pArchiveData->GetSize();
+    Uint8* const pArchiveData =
+        static_cast<Uint8*>(const_cast<void*>(m_pArchiveData->GetConstDataPtr()));
+
+    // Only the location is validated here. The data itself is not accessed
+    // until the resource is unpacked.
+    auto ReadBlob = [&](SerializedData& Data) {
+        BlobLocation Location;
+        if (!ArchiveSerializer<SerializerMode::Read>{Reader}.SerializeBlobLocation(Location))
+            return false;
+
+        if (Location.Size == 0)
+            return true;
+
+        if (Location.Offset > ArchiveSize || Location.Size > ArchiveSize - Location.Offset)
+        {
+            LOG_ERROR_MESSAGE("Data blob [", Location.Offset, ", ", Location.Offset + Location.Size, ") is out of the archive bounds (", ArchiveSize, " bytes).");
+            return false;
+        }
+        if (Location.Offset % BlobAlignment != 0)
+        {
+            LOG_ERROR_MESSAGE("Data blob offset (", Location.Offset, ") is not aligned to ", Uint32{BlobAlignment}, " bytes.");
+            return false;
+        }
+
+        if (Location.CodecId == static_cast<Uint32>(CodecId::None))
+        {
+            Data = SerializedData{pArchiveData + Location.Offset, Location.Size};
+            return true;
+        }
+
+        const Codec* pCodec = GetBlobCodec(Location, CI.ppCodecs, CI.NumCodecs);
+        if (pCodec == nullptr)
+            return false;
+
+        // The data slot references the compressed bytes, which are decompressed on first access.
+        // Identical blobs may be shared by several slots, in which case they use the same entry.
+        Data = SerializedData{pArchiveData + Location.Offset, Location.Size};
+
+        auto it = m_CompressedBlobs.find(Data.Ptr());
+        if (it != m_CompressedBlobs.end())
+        {
+            const CompressedBlob& Blob = *it->second;
+            if (Blob.pCodec != pCodec || Blob.Size != Location.Size || Blob.UncompressedSize != Location.UncompressedSize)
+            {
+                LOG_ERROR_MESSAGE("Data blob at offset ", Location.Offset, " is referenced with inconsistent compression parameters.");
+                return false;
+            }
+            return true;
+        }
+
+        auto pBlob{std::make_unique<CompressedBlob>()};
+        pBlob->pCodec           = pCodec;
+        pBlob->pData            = Data.Ptr();
+        pBlob->Size             = Location.Size;
+        pBlob->UncompressedSize = Location.UncompressedSize;
+        m_CompressedBlobs.emplace(Data.Ptr(), std::move(pBlob));
+        return true;
+    };
+
     Uint32 NumResources = 0;
-    CHECK_ARCHIVE(Reader(NumResources), "Failed to read the number of named resources in the device object archive.");
+    if (!Reader(NumResources))
+    {
+        LOG_ERROR_MESSAGE("Failed to read the number of named resources in the device object archive.");
+        return false;
+    }
 
+    m_NamedResources.reserve(NumResources);
     for (Uint32 res = 0; res < NumResources; ++res)
     {
         const char*  Name    = nullptr;
         ResourceType ResType = ResourceType::Undefined;
-        CHECK_ARCHIVE(Reader(ResType, Name), "Failed to read the type and name of resource ", res, "/", NumResources, '.');
+        if (!Reader(ResType, Name))
+        {
+            LOG_ERROR_MESSAGE("Failed to read the type and name of resource ", res, "/", NumResources, '.');
+            return false;
+        }
         VERIFY_EXPR(Name != nullptr);
 
         // No need to make the name copy as we keep the source data blob alive.
         constexpr bool MakeNameCopy = false;
         ResourceData&  ResData      = m_NamedResources[NamedResourceKey{ResType, Name, MakeNameCopy}];
 
-        CHECK_ARCHIVE(ArchiveReader.SerializeResourceData(ResData), "Failed to read data of resource '", Name, "'.");
+        bool Res = ReadBlob(ResData.Common);
+        for (size_t i = 0; i < ResData.DeviceSpecific.size() && Res; ++i)
+            Res = ReadBlob(ResData.DeviceSpecific[i]);
+
+        if (!Res)
+        {
+            LOG_ERROR_MESSAGE("Failed to read the data location of resource '", Name, "'.");
+            return false;
+        }
     }
 
     for (std::vector<SerializedData>& Shaders : m_DeviceShaders)
     {
-        CHECK_ARCHIVE(ArchiveReader.SerializeShaders(Shaders), "Failed to read shader data from the device object archive.");
+        Uint32 NumShaders = 0;
+        if (!Reader(NumShaders))
+        {
+            LOG_ERROR_MESSAGE("Failed to read the number of shaders in the device object archive.");
+            return false;
+        }
+
+        Shaders.resize(NumShaders);
+        for (SerializedData& Shader : Shaders)
+        {
+            if (!ReadBlob(Shader))
+            {
+                LOG_ERROR_MESSAGE("Failed to read the shader data location.");
+                return false;
+            }
+        }
     }
-#undef CHECK_ARCHIVE
 
     return true;
 }
 
-void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
+bool DeviceObjectArchive::ReadSequentialResources(Serializer<SerializerMode::Read>& Reader) noexcept
 {
-    if (ppDataBlob == nullptr)
+    ArchiveSerializer<SerializerMode::Read> ArchiveReader{Reader};
+
+    Uint32 NumResources = 0;
+    if (!Reader(NumResources))
     {
-        DEV_ERROR("Pointer to the data blob object must not be null");
-        return;
+        LOG_ERROR_MESSAGE("Failed to read the number of named resources in the device object archive.");
+        return false;
     }
-    DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
 
-    auto SerializeThis = [this](auto& Ser) {
-        constexpr auto SerMode    = std::remove_reference<decltype(Ser)>::type::GetMode();
-        const auto     ArchiveSer = ArchiveSerializer<SerMode>{Ser};
-
-        ArchiveHeader Header;
-        Header.ContentVersion = m_ContentVersion;
+    for (Uint32 res = 0; res < NumResources; ++res)
+    {
+        const char*  Name    = nullptr;
+        ResourceType ResType = ResourceType::Undefined;
+        if (!Reader(ResType, Name))
+        {
+            LOG_ERROR_MESSAGE("Failed to read the type and name of resource ", res, "/", NumResources, '.');
+            return false;
+        }
+        VERIFY_EXPR(Name != nullptr);
 
-        auto res = ArchiveSer.SerializeHeader(Header);
-        VERIFY(res, "Failed to serialize header");
+        // No need to make the name copy as we keep the source data blob alive.
+        constexpr bool MakeNameCopy = false;
+        ResourceData&  ResData      = m_NamedResources[NamedResourceKey{ResType, Name, MakeNameCopy}];
 
-        Uint32 NumResources = StaticCast<Uint32>(m_NamedResources.size());
-        res                 = Ser(NumResources);
-        VERIFY(res, "Failed to serialize the number of resources");
+        if (!ArchiveReader.SerializeResourceData(ResData))
+        {
+            LOG_ERROR_MESSAGE("Failed to read data of resource '", Name, "'.");
+            return false;
+        }
+    }
 
-        for (const auto& res_it : m_NamedResources)
+    for (std::vector<SerializedData>& Shaders : m_DeviceShaders)
+    {
+        if (!ArchiveReader.SerializeShaders(Shaders))
         {
-            const char*        Name    = res_it.first.GetName();
-            const ResourceType ResType = res_it.first.GetType();
+            LOG_ERROR_MESSAGE("Failed to read shader data from the device object archive.");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+struct DeviceObjectArchive::SerializationLayout
+{
+    // All uncompressed data blobs in the order they are written to the archive
+    std::vector<const SerializedData*> Blobs;
+
+    // Compressed data for each blob. Blobs that are not compressed are written as is.
+    std::vector<std::vector<Uint8>> CompressedBlobs;
+
+    ArchiveIndex Index;
+
+    // Blob locations in the index, in the same order as Blobs
+    std::vector<const BlobLocation*> Locations;
+
+    size_t IndexSize   = 0;
+    size_t ArchiveSize = 0;
+
+    const void* GetBlobData(size_t i) const
+    {
+        return !CompressedBlobs[i].empty() ? CompressedBlobs[i].data() : Blobs[i]->Ptr();
+    }
+};
+
+void DeviceObjectArchive::PrepareSerialization(SerializationLayout& Layout) const
+{
+    // Sort resources by type and name so that the index is deterministic
+    std::vector<const decltype(m_NamedResources)::value_type*> SortedResources;
+    SortedResources.reserve(m_NamedResources.size());
+    for (const auto& res_it : m_NamedResources)
+        SortedResources.emplace_back(&res_it);
+    std::sort(SortedResources.begin(), SortedResources.end(),
+              [](const auto* pLhs, const auto* pRhs) {
+                  if (pLhs->first.GetType() != pRhs->first.GetType())
+                      return pLhs->first.GetType() < pRhs->first.GetType();
+                  return strcmp(pLhs->first.GetName(), pRhs->first.GetName()) < 0;
+              });
+
+    // Decompress the data loaded from a compressed archive
+    Decompress(m_Compression.pThreadPool);
+
+    std::vector<const SerializedData*>& Blobs = Layout.Blobs;
+    for (const auto* pRes : SortedResources)
+    {
+        Blobs.emplace_back(&GetUncompressedData(pRes->second.Common));
+        for (const SerializedData& DevData : pRes->second.DeviceSpecific)
+            Blobs.emplace_back(&GetUncompressedData(DevData));
+    }
+    for (const std::vector<SerializedData>& Shaders : m_DeviceShaders)
+    {
+        for (const SerializedData& Shader : Shaders)
+            Blobs.emplace_back(&GetUncompressedData(Shader));
+    }
+
+    std::vector<std::vector<Uint8>>& CompressedBlobs = Layout.CompressedBlobs;
+    CompressedBlobs.resize(Blobs.size());
+    if (const Codec* pCodec = m_Compression.pCodec)
+    {
+        ProcessInParallel(m_Compression.pThreadPool, Blobs.size(),
+                          [&](size_t i) {
+                              const SerializedData& Data = *Blobs[i];
+                              if (Data.Size() == 0 || Data.Size() < m_Compression.MinBlobSize)
+                                  return;
+
+                              std::vector<Uint8>& Compressed = CompressedBlobs[i];
+                              Compressed.resize(pCodec->GetMaxCompressedSize(Data.Size()));
+
+                              const size_t CompressedSize = pCodec->Compress(Data.Ptr(), Data.Size(), Compressed.data(), Compressed.size());
+                              // Only keep the compressed data if it is actually smaller
+                              if (CompressedSize != 0 && CompressedSize < Data.Size())
+                                  Compressed.resize(CompressedSize);
+                              else
+                                  Compressed = {};
+                          });
+    }
+
+    // Blob offsets are assigned by WriteIndex in the same order the blobs were collected above
+    ArchiveIndex& Index  = Layout.Index;
+    Index.ContentVersion = m_ContentVersion;
+    Index.Resources.resize(SortedResources.size());
+    Layout.Locations.reserve(Blobs.size());
+    auto InitLocation = [&](BlobLocation& Location) {
+        const size_t i            = Layout.Locations.size();
+        const size_t DataSize     = Blobs[i]->Size();
+        const bool   IsCompressed = !CompressedBlobs[i].empty();
+
+        Location.Size             = StaticCast<Uint32>(IsCompressed ? CompressedBlobs[i].size() : DataSize);
+        Location.CodecId          = IsCompressed ? m_Compression.pCodec->GetId() : static_cast<Uint32>(CodecId::None);
+        Location.UncompressedSize = StaticCast<Uint32>(DataSize);
+        Layout.Locations.emplace_back(&Location);
+    };
+
+    for (size_t res = 0; res < SortedResources.size(); ++res)
+    {
+        ArchiveIndex::Resource& Res = Index.Resources[res];
+        Res.Type                    = SortedResources[res]->first.GetType();
+        Res.Name                    = SortedResources[res]->first.GetName();
+        for (BlobLocation& Location : Res.Blobs)
+            InitLocation(Location);
+    }
+    for (size_t dev = 0; dev < m_DeviceShaders.size(); ++dev)
+    {
+        Index.Shaders[dev].resize(m_DeviceShaders[dev].size());
+        for (BlobLocation& Location : Index.Shaders[dev])
+            InitLocation(Location);
+    }
+    VERIFY_EXPR(Layout.Locations.size() == Blobs.size());
+}
+
+size_t DeviceObjectArchive::WriteIndex(ArchiveIndex& Index, SerializationBuffer& Buffer)
+{
+    Serializer<SerializerMode::Write> Ser{Buffer};
+    const ArchiveSerializer<SerializerMode::Write> ArchiveSer{Ser};
+
+    // The index is written in a single pass: blob offsets are not known until the
+    // index size is known, so they are patched after the whole index is written.
+    std::vector<std::pair<BlobLocation*, size_t>> Locations;
+    auto WriteLocation = [&](BlobLocation& Location) {
+        if (Location.Size == 0)
+            Location = {};
+        Locations.emplace_back(&Location, Ser.GetSize());
+        return ArchiveSer.SerializeBlobLocation(Location);
+    };
 
-            res = Ser(ResType, Name);
-            VERIFY(res, "Failed to serialize resource type and name");
+    // The index size is patched once the whole index is written
+    ArchiveHeader Header;
+    Header.ContentVersion = Index.ContentVersion;
+    if (!ArchiveSer.SerializeHeader(Header))
+        return 0;
+
+    Uint32 NumResources = StaticCast<Uint32>(Index.Resources.size());
+    if (!Ser(NumResources))
+        return 0;
+
+    for (ArchiveIndex::Resource& Res : Index.Resources)
+    {
+        if (!Ser(Res.Type, Res.Name))
+            return 0;
 
-            res = ArchiveSer.SerializeResourceData(res_it.second);
-            VERIFY(res, "Failed to serialize resource data");
+        for (BlobLocation& Location : Res.Blobs)
+        {
+            if (!WriteLocation(Location))
+                return 0;
         }
+    }
 
-        for (const std::vector<SerializedData>& Shaders : m_DeviceShaders)
+    for (std::vector<BlobLocation>& Shaders : Index.Shaders)
+    {
+        Uint32 NumShaders = StaticCast<Uint32>(Shaders.size());
+        if (!Ser(NumShaders))
+            return 0;
+
+        for (BlobLocation& Location : Shaders)
         {
-            res = ArchiveSer.SerializeShaders(Shaders);
-            VERIFY(res, "Failed to serialize shaders");
+            if (!WriteLocation(Location))
+                return 0;
         }
-    };
+    }
+
+    if (!ArchiveSer.PatchIndexSize(StaticCast<Uint32>(Ser.GetSize())))
+        return 0;
+
+    size_t ArchiveSize = Ser.GetSize();
+    for (const auto& it : Locations)
+    {
+        BlobLocation& Location = *it.first;
+        if (Location.Size == 0)
+            continue;
+
+        ArchiveSize     = AlignUp(ArchiveSize, BlobAlignment);
+        Location.Offset = ArchiveSize;
+        ArchiveSize += Location.Size;
+
+        if (!ArchiveSer.PatchBlobLocation(it.second, Location))
+            return 0;
+    }
+    Index.Version = ArchiveVersion;
+
+    return ArchiveSize;
+}
+
+void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
+{
+    if (ppDataBlob == nullptr)
+    {
+        DEV_ERROR("Pointer to the data blob object must not be null");
+        return;
+    }
+    DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
+
+    SerializationLayout Layout;
+    PrepareSerialization(Layout);
+
+    SerializationBuffer IndexBuffer{GetRawAllocator()};
+    Layout.ArchiveSize = WriteIndex(Layout.Index, IndexBuffer);
+    if (Layout.ArchiveSize == 0)
+    {
+        UNEXPECTED("Failed to write the archive index");
+        return;
+    }
 
-    Serializer<SerializerMode::Measure> Measurer;
-    SerializeThis(Measurer);
+    RefCntAutoPtr<DataBlobImpl> pDataBlob = DataBlobImpl::Create(Layout.ArchiveSize);
 
-    RefCntAutoPtr<DataBlobImpl> pDataBlob = DataBlobImpl::Create(Measurer.GetSize());
+    Uint8* const pArchiveData = pDataBlob->GetDataPtr<Uint8>();
+    // Zero out alignment gaps
+    std::memset(pArchiveData, 0, Layout.ArchiveSize);
 
-    Serializer<SerializerMode::Write> Writer{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
-    SerializeThis(Writer);
-    VERIFY_EXPR(Writer.IsEnded());
+    IndexBuffer.CopyTo(pArchiveData);
+    for (size_t i = 0; i < Layout.Blobs.size(); ++i)
+    {
+        const BlobLocation& Location = *Layout.Locations[i];
+        if (Location.Size != 0)
+            std::memcpy(pArchiveData + Location.Offset, Layout.GetBlobData(i), Location.Size);
+    }
 
     *ppDataBlob = pDataBlob.Detach();
 }
 
+namespace
+{
+
+constexpr Uint8 BlobPadding[DeviceObjectArchive::BlobAlignment] = {};
+
+// Writes zeros to the stream to align the blob at the given offset
+bool WriteBlobPadding(IFileStream* pStream, size_t& Offset, const BlobLocation& Location)
+{
+    VERIFY_EXPR(Location.Offset >= Offset && Location.Offset - Offset < DeviceObjectArchive::BlobAlignment);
+    if (Location.Offset > Offset && !pStream->Write(BlobPadding, static_cast<size_t>(Location.Offset - Offset)))
+        return false;
+
+    Offset = static_cast<size_t>(Location.Offset + Location.Size);
+    return true;
+}
+
+} // namespace
+
+bool DeviceObjectArchive::Serialize(IFileStream* pStream) const
+{
+    if (pStream == nullptr)
+    {
+        DEV_ERROR("File stream must not be null");
+        return false;
+    }
+
+    SerializationLayout Layout;
+    PrepareSerialization(Layout);
+
+    // Write the data directly to the stream without assembling the archive in memory
+    {
+        SerializationBuffer IndexBuffer{pStream, GetRawAllocator()};
+        Layout.ArchiveSize = WriteIndex(Layout.Index, IndexBuffer);
+        if (Layout.ArchiveSize == 0 || !IndexBuffer.Flush())
+            return false;
+        Layout.IndexSize = IndexBuffer.GetSize();
+    }
+
+    size_t Offset = Layout.IndexSize;
+    for (size_t i = 0; i < Layout.Blobs.size(); ++i)
+    {
+        const BlobLocation& Location = *Layout.Locations[i];
+        if (Location.Size == 0)
+            continue;
+
+        if (!WriteBlobPadding(pStream, Offset, Location) ||
+            !pStream->Write(Layout.GetBlobData(i), Location.Size))
+            return false;
+    }
+    VERIFY_EXPR(Offset == Layout.ArchiveSize);
+
+    return true;
+}
 
 namespace
 {
@@ -315,9 +794,11 @@ const char* ArchiveDeviceTypeToString(Uint32 dev)
     }
 }
 
-const char* ResourceTypeToString(DeviceObjectArchive::ResourceType Type)
+} // namespace
+
+
+const char* DeviceObjectArchive::ResourceTypeToString(ResourceType Type)
 {
-    using ResourceType = DeviceObjectArchive::ResourceType;
     static_assert(static_cast<size_t>(ResourceType::Count) == 8, "Please handle the new chunk type below");
     switch (Type)
     {
@@ -337,9 +818,6 @@ const char* ResourceTypeToString(DeviceObjectArchive::ResourceType Type)
     }
 }
 
-} // namespace
-
-
 DeviceObjectArchive::DeviceObjectArchive(const CreateInfo& CI) noexcept(false)
 {
     if (!Deserialize(CI))
@@ -360,24 +838,105 @@ const SerializedData& DeviceObjectArchive::GetDeviceSpecificData(ResourceType Ty
         return NullData;
     }
     VERIFY_EXPR(SafeStrEqual(Name, it->first.GetName()));
-    return it->second.DeviceSpecific[static_cast<size_t>(DevType)];
+    return GetUncompressedData(it->second.DeviceSpecific[static_cast<size_t>(DevType)]);
 }
 
-std::string DeviceObjectArchive::ToString() const
+const SerializedData& DeviceObjectArchive::DecompressBlob(const SerializedData& Data) const noexcept
 {
-    std::stringstream Output;
-    Output << "Archive contents:\n";
+    auto it = m_CompressedBlobs.find(Data.Ptr());
+    if (it == m_CompressedBlobs.end() || it->second->Size != Data.Size())
+        return Data;
+
+    CompressedBlob& Blob = *it->second;
+    std::call_once(Blob.DecompressFlag,
+                   [&Blob]() {
+                       SerializedData Uncompressed{Blob.UncompressedSize, GetRawAllocator()};
+                       if (Blob.pCodec->Decompress(Blob.pData, Blob.Size, Uncompressed.Ptr(), Uncompressed.Size()))
+                           Blob.Uncompressed = std::move(Uncompressed);
+                       else
+                           LOG_ERROR_MESSAGE("Failed to decompress archive data. The archive may be corrupted.");
+                   });
+
+    return Blob.Uncompressed;
+}
 
-    constexpr char SeparatorLine[] = "------------------\n";
-    constexpr char Ident1[]        = "  ";
-    constexpr char Ident2[]        = "    ";
+size_t DeviceObjectArchive::GetUncompressedSize(const SerializedData& Data) const noexcept
+{
+    auto it = m_CompressedBlobs.find(Data.Ptr());
+    if (it == m_CompressedBlobs.end() || it->second->Size != Data.Size())
+        return Data.Size();
 
-    // Print header
-    {
-        Output << "Header\n"
-               << Ident1 << "Archive version: " << ArchiveVersion << '\n'
-               << Ident1 << "Content version: " << m_ContentVersion << '\n';
-    }
+    return it->second->UncompressedSize;
+}
+
+void DeviceObjectArchive::Decompress(IThreadPool* pThreadPool) const noexcept
+{
+    if (m_CompressedBlobs.empty())
+        return;
+
+    std::vector<SerializedData> Blobs;
+    Blobs.reserve(m_CompressedBlobs.size());
+    for (const auto& it : m_CompressedBlobs)
+    {
+        // Blobs are looked up by their location, so a view of the compressed data is sufficient
+        Blobs.emplace_back(const_cast<void*>(it.first), it.second->Size);
+    }
+
+    ProcessInParallel(pThreadPool, Blobs.size(),
+                      [&](size_t i) {
+                          DecompressBlob(Blobs[i]);
+                      });
+}
+
+void DeviceObjectArchive::ResolveCompressedBlobsImpl() noexcept
+{
+    Decompress();
+
+    // The first slot that references the blob takes the decompressed data, other slots get copies
+    std::unordered_map<const void*, const SerializedData*> ResolvedSlots;
+
+    auto ResolveSlot = [&](SerializedData& Data) {
+        auto it = m_CompressedBlobs.find(Data.Ptr());
+        if (it == m_CompressedBlobs.end() || it->second->Size != Data.Size())
+            return;
+
+        auto slot_it = ResolvedSlots.emplace(it->first, &Data);
+        if (slot_it.second)
+            Data = std::move(it->second->Uncompressed);
+        else
+            Data = slot_it.first->second->MakeCopy(GetRawAllocator());
+    };
+
+    for (auto& it : m_NamedResources)
+    {
+        ResolveSlot(it.second.Common);
+        for (SerializedData& DevData : it.second.DeviceSpecific)
+            ResolveSlot(DevData);
+    }
+    for (auto& Shaders : m_DeviceShaders)
+    {
+        for (SerializedData& Shader : Shaders)
+            ResolveSlot(Shader);
+    }
+
+    m_CompressedBlobs.clear();
+}
+
+std::string DeviceObjectArchive::ToString() const
+{
+    std::stringstream Output;
+    Output << "Archive contents:\n";
+
+    constexpr char SeparatorLine[] = "------------------\n";
+    constexpr char Ident1[]        = "  ";
+    constexpr char Ident2[]        = "    ";
+
+    // Print header
+    {
+        Output << "Header\n"
+               << Ident1 << "Archive version: " << ArchiveVersion << '\n'
+               << Ident1 << "Content version: " << m_ContentVersion << '\n';
+    }
 
     constexpr char CommonDataName[] = "Common";
 
@@ -425,11 +984,13 @@ std::string DeviceObjectArchive::ToString() const
 
                 const ResourceData& Res = it.second;
 
-                size_t MaxSize       = Res.Common.Size();
+                const size_t CommonDataSize = GetUncompressedData(Res.Common).Size();
+
+                size_t MaxSize       = CommonDataSize;
                 size_t MaxDevNameLen = strlen(CommonDataName);
                 for (Uint32 i = 0; i < Res.DeviceSpecific.size(); ++i)
                 {
-                    const size_t DevDataSize = Res.DeviceSpecific[i].Size();
+                    const size_t DevDataSize = GetUncompressedData(Res.DeviceSpecific[i]).Size();
 
                     MaxSize = std::max(MaxSize, DevDataSize);
                     if (DevDataSize != 0)
@@ -438,12 +999,12 @@ std::string DeviceObjectArchive::ToString() const
                 const size_t SizeFieldW = GetNumFieldWidth(MaxSize);
 
                 Output << Ident2 << std::setw(static_cast<int>(MaxDevNameLen)) << std::left << CommonDataName << ' '
-                       << std::setw(static_cast<int>(SizeFieldW)) << std::right << Res.Common.Size() << " bytes\n";
+                       << std::setw(static_cast<int>(SizeFieldW)) << std::right << CommonDataSize << " bytes\n";
                 // ....Common     1015 bytes
 
                 for (Uint32 i = 0; i < Res.DeviceSpecific.size(); ++i)
                 {
-                    const size_t DevDataSize = Res.DeviceSpecific[i].Size();
+                    const size_t DevDataSize = GetUncompressedData(Res.DeviceSpecific[i]).Size();
                     if (DevDataSize > 0)
                     {
                         Output << Ident2 << std::setw(static_cast<int>(MaxDevNameLen)) << std::left << ArchiveDeviceTypeToString(i) << ' '
@@ -493,8 +1054,10 @@ std::string DeviceObjectArchive::ToString() const
 
                 size_t MaxSize    = 0;
                 size_t MaxNameLen = 0;
-                for (const SerializedData& ShaderData : Shaders)
+                for (const SerializedData& CompressedData : Shaders)
                 {
+                    const SerializedData& ShaderData = GetUncompressedData(CompressedData);
+
                     MaxSize = std::max(MaxSize, ShaderData.Size());
 
                     ShaderCreateInfo                 ShaderCI;
@@ -512,7 +1075,7 @@ std::string DeviceObjectArchive::ToString() const
                 {
                     Output << Ident2 << '[' << std::setw(static_cast<int>(IdxFieldW)) << std::right << idx << "] "
                            << std::setw(static_cast<int>(MaxNameLen)) << std::left << ShaderNames[idx] << ' '
-                           << std::setw(static_cast<int>(SizeFieldW)) << std::right << Shaders[idx].Size() << " bytes\n";
+                           << std::setw(static_cast<int>(SizeFieldW)) << std::right << GetUncompressedData(Shaders[idx]).Size() << " bytes\n";
                     // ....[0] 'Test VS' 4020 bytes
                 }
             }
@@ -525,6 +1088,8 @@ std::string DeviceObjectArchive::ToString() const
 
 void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 {
+    ResolveCompressedBlobs();
+
     for (auto& res_it : m_NamedResources)
         res_it.second.DeviceSpecific[static_cast<size_t>(Dev)] = {};
 
@@ -533,6 +1098,8 @@ void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 
 void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false)
 {
+    ResolveCompressedBlobs();
+
     IMemoryAllocator& Allocator = GetRawAllocator();
     for (auto& dst_res_it : m_NamedResources)
     {
@@ -544,7 +1111,7 @@ void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, Devic
         if (src_res_it == Src.m_NamedResources.end())
             continue;
 
-        const SerializedData& SrcData{src_res_it->second.DeviceSpecific[static_cast<size_t>(Dev)]};
+        const SerializedData& SrcData{Src.GetUncompressedData(src_res_it->second.DeviceSpecific[static_cast<size_t>(Dev)])};
         // Always copy src data even if it is empty
         DstData = SrcData.MakeCopy(Allocator);
     }
@@ -554,10 +1121,102 @@ void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, Devic
     auto&       DstShaders = m_DeviceShaders[static_cast<size_t>(Dev)];
     DstShaders.clear();
     for (const SerializedData& SrcShader : SrcShaders)
-        DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+        DstShaders.emplace_back(Src.GetUncompressedData(SrcShader).MakeCopy(Allocator));
 }
 
-void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
+namespace
+{
+
+bool HasShaderIndices(DeviceObjectArchive::ResourceType Type)
+{
+    using ResourceType = DeviceObjectArchive::ResourceType;
+    return (Type == ResourceType::StandaloneShader ||
+            Type == ResourceType::GraphicsPipeline ||
+            Type == ResourceType::ComputePipeline ||
+            Type == ResourceType::RayTracingPipeline ||
+            Type == ResourceType::TilePipeline);
+}
+
+// Reads shader indices from the device-specific data of a standalone shader or a pipeline
+bool ReadShaderIndices(DeviceObjectArchive::ResourceType Type,
+                       const SerializedData&             DeviceData,
+                       DynamicLinearAllocator&           Allocator,
+                       std::vector<Uint32>&              Indices)
+{
+    Serializer<SerializerMode::Read> Ser{DeviceData};
+    if (Type == DeviceObjectArchive::ResourceType::StandaloneShader)
+    {
+        // For shaders, device-specific data is the serialized shader bytecode index
+        Uint32 ShaderIndex = 0;
+        if (!Ser(ShaderIndex))
+        {
+            LOG_ERROR_MESSAGE("Failed to deserialize standalone shader index. Archive file may be corrupted or invalid.");
+            return false;
+        }
+        VERIFY(Ser.IsEnded(), "No other data besides the shader index is expected");
+        Indices.assign(1, ShaderIndex);
+    }
+    else
+    {
+        // For pipelines, device-specific data is the shader index array
+        DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator))
+        {
+            LOG_ERROR_MESSAGE("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
+            return false;
+        }
+        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
+        Indices.assign(ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count);
+    }
+    return true;
+}
+
+// Overwrites shader indices in the device-specific data.
+// The number of indices must not change, so that the data size remains the same.
+void WriteShaderIndices(DeviceObjectArchive::ResourceType Type,
+                        const SerializedData&             DeviceData,
+                        const std::vector<Uint32>&        Indices)
+{
+    Serializer<SerializerMode::Write> Ser{DeviceData};
+    if (Type == DeviceObjectArchive::ResourceType::StandaloneShader)
+    {
+        VERIFY_EXPR(Indices.size() == 1);
+        Ser(Indices[0]);
+    }
+    else
+    {
+        const DeviceObjectArchive::ShaderIndexArray ShaderIndices{Indices.data(), static_cast<Uint32>(Indices.size())};
+        PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, ShaderIndices, nullptr);
+    }
+    VERIFY_EXPR(Ser.IsEnded());
+}
+
+} // namespace
+
+void DeviceObjectArchive::Merge(const DeviceObjectArchive* const* ppSrcArchives, size_t NumSrcArchives) noexcept(false)
+{
+    VERIFY_EXPR(ppSrcArchives != nullptr || NumSrcArchives == 0);
+
+    ResolveCompressedBlobs();
+
+    // The map is built once and is updated as new shaders are added, so that
+    // merging N archives does not rehash the shaders of this archive N times.
+    ShaderIndexMapsType DstShaderToIdx;
+    for (size_t i = 0; i < m_DeviceShaders.size(); ++i)
+    {
+        const std::vector<SerializedData>& DstShaders = m_DeviceShaders[i];
+        for (size_t j = 0; j < DstShaders.size(); ++j)
+            DstShaderToIdx[i].emplace(SerializedData{DstShaders[j].Ptr(), DstShaders[j].Size()}, static_cast<Uint32>(j));
+    }
+
+    for (size_t i = 0; i < NumSrcArchives; ++i)
+    {
+        VERIFY_EXPR(ppSrcArchives[i] != nullptr);
+        MergeArchive(*ppSrcArchives[i], DstShaderToIdx);
+    }
+}
+
+void DeviceObjectArchive::MergeArchive(const DeviceObjectArchive& Src, ShaderIndexMapsType& DstShaderToIdx) noexcept(false)
 {
     if (m_ContentVersion != Src.m_ContentVersion)
         LOG_WARNING_MESSAGE("Merging archives with different content versions (", m_ContentVersion, " and ", Src.m_ContentVersion, ").");
@@ -567,110 +1226,718 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
     IMemoryAllocator&      Allocator = GetRawAllocator();
     DynamicLinearAllocator DynAllocator{Allocator, 512};
 
-    // Copy shaders
-    std::array<Uint32, static_cast<size_t>(DeviceType::Count)> ShaderBaseIndices{};
+    // Copy shaders. Byte code that is already present in this archive is not duplicated.
+    // For every device type, maps the source shader index to the index in this archive.
+    std::array<std::vector<Uint32>, static_cast<size_t>(DeviceType::Count)> ShaderIndexRemap;
     for (size_t i = 0; i < m_DeviceShaders.size(); ++i)
     {
         const auto& SrcShaders = Src.m_DeviceShaders[i];
         auto&       DstShaders = m_DeviceShaders[i];
-        ShaderBaseIndices[i]   = static_cast<Uint32>(DstShaders.size());
         if (SrcShaders.empty())
             continue;
-        DstShaders.reserve(DstShaders.size() + SrcShaders.size());
-        for (const SerializedData& SrcShader : SrcShaders)
-            DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+
+        // NB: keys reference the data owned by DstShaders, which does not move when the vector grows
+        auto& DstShaderToIdxMap = DstShaderToIdx[i];
+
+        std::vector<Uint32>& Remap = ShaderIndexRemap[i];
+        Remap.resize(SrcShaders.size());
+        for (size_t j = 0; j < SrcShaders.size(); ++j)
+        {
+            const SerializedData& SrcShader = Src.GetUncompressedData(SrcShaders[j]);
+
+            auto it = DstShaderToIdxMap.find(SrcShader);
+            if (it == DstShaderToIdxMap.end())
+            {
+                const Uint32 NewIdx = static_cast<Uint32>(DstShaders.size());
+                DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+                it = DstShaderToIdxMap.emplace(SerializedData{DstShaders.back().Ptr(), DstShaders.back().Size()}, NewIdx).first;
+            }
+            Remap[j] = it->second;
+        }
     }
 
+    auto RemapShaderIndex = [&ShaderIndexRemap](size_t DevType, Uint32 SrcIdx) {
+        const std::vector<Uint32>& Remap = ShaderIndexRemap[DevType];
+        if (SrcIdx >= Remap.size())
+            LOG_ERROR_AND_THROW("Shader index ", SrcIdx, " is out of range. Archive file may be corrupted or invalid.");
+        return Remap[SrcIdx];
+    };
+
     // Copy named resources
+    std::vector<Uint32> ShaderIndices;
     for (auto& src_res_it : Src.m_NamedResources)
     {
         const ResourceType ResType = src_res_it.first.GetType();
         const char*        ResName = src_res_it.first.GetName();
 
-        auto it_inserted = m_NamedResources.emplace(NamedResourceKey{ResType, ResName, /*CopyName = */ true}, src_res_it.second.MakeCopy(Allocator));
-        if (!it_inserted.second)
+        auto dst_res_it = m_NamedResources.find(NamedResourceKey{ResType, ResName});
+        if (dst_res_it != m_NamedResources.end())
         {
-            // Silently skip duplicate resources
-            if (it_inserted.first->second != src_res_it.second)
+            // Silently skip duplicate resources.
+            // Device-specific data is not compared as shader indices are different in the archives.
+            if (dst_res_it->second.Common != Src.GetUncompressedData(src_res_it.second.Common))
                 LOG_WARNING_MESSAGE("Failed to copy resource '", ResName, "': resource with the same name already exists.");
 
             continue;
         }
 
-        const auto IsStandaloneShader = (ResType == ResourceType::StandaloneShader);
-        const bool IsPipeline =
-            (ResType == ResourceType::GraphicsPipeline ||
-             ResType == ResourceType::ComputePipeline ||
-             ResType == ResourceType::RayTracingPipeline ||
-             ResType == ResourceType::TilePipeline);
+        ResourceData SrcResData;
+        SrcResData.Common = Src.GetUncompressedData(src_res_it.second.Common).MakeCopy(Allocator);
+        for (size_t i = 0; i < SrcResData.DeviceSpecific.size(); ++i)
+            SrcResData.DeviceSpecific[i] = Src.GetUncompressedData(src_res_it.second.DeviceSpecific[i]).MakeCopy(Allocator);
+
+        auto it_inserted = m_NamedResources.emplace(NamedResourceKey{ResType, ResName, /*CopyName = */ true}, std::move(SrcResData));
+        VERIFY_EXPR(it_inserted.second);
 
         // Update shader indices
-        if (IsStandaloneShader || IsPipeline)
+        if (HasShaderIndices(ResType))
         {
             for (size_t i = 0; i < static_cast<size_t>(DeviceType::Count); ++i)
             {
-                const Uint32 BaseIdx = ShaderBaseIndices[i];
-
                 SerializedData& DeviceData = it_inserted.first->second.DeviceSpecific[i];
                 if (!DeviceData)
                     continue;
 
-                if (IsStandaloneShader)
+                if (!ReadShaderIndices(ResType, DeviceData, DynAllocator, ShaderIndices))
+                    LOG_ERROR_AND_THROW("Failed to read shader indices of resource '", ResName, "'.");
+
+                for (Uint32& Idx : ShaderIndices)
+                    Idx = RemapShaderIndex(i, Idx);
+
+                WriteShaderIndices(ResType, DeviceData, ShaderIndices);
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Parses the archive index that has been read from the stream. The index data may be
+// corrupted, so the size of every value is checked before it is read.
+bool ParseArchiveIndex(DeviceObjectArchive::ArchiveIndex& Index, size_t ArchiveSize)
+{
+    using ArchiveIndex = DeviceObjectArchive::ArchiveIndex;
+
+    Serializer<SerializerMode::Read> Reader{SerializedData{Index.Data.data(), Index.Data.size()}};
+
+    auto CanRead = [&Reader](Uint64 Size) {
+        if (Reader.GetRemainingSize() >= Size)
+            return true;
+        LOG_ERROR_MESSAGE("Unexpected end of the device object archive index data.");
+        return false;
+    };
+    auto CanReadString = [&Reader, &CanRead]() {
+        Uint32 LenWithNull = 0;
+        if (!CanRead(sizeof(LenWithNull)))
+            return false;
+        std::memcpy(&LenWithNull, Reader.GetCurrentPtr(), sizeof(LenWithNull));
+        return CanRead(Uint64{sizeof(LenWithNull)} + LenWithNull);
+    };
+
+    // The magic number, the version and the index size have been validated by ReadIndex.
+    // NB: this must match header serialization in ArchiveSerializer::SerializeHeader
+    DeviceObjectArchive::ArchiveHeader Header;
+    if (!CanRead(sizeof(Header.MagicNumber) + sizeof(Header.Version) + sizeof(Header.IndexSize) + sizeof(Header.APIVersion) + sizeof(Header.ContentVersion)))
+        return false;
+    Reader(Header.MagicNumber, Header.Version, Header.IndexSize, Header.APIVersion, Header.ContentVersion);
+
+    if (!CanReadString())
+        return false;
+    Reader(Header.GitHash);
+
+    constexpr size_t LocationSize = sizeof(Uint64) + sizeof(Uint32) * 3;
+
+    Uint32 NumResources = 0;
+    if (!CanRead(sizeof(NumResources)))
+        return false;
+    Reader(NumResources);
+
+    for (Uint32 res = 0; res < NumResources; ++res)
+    {
+        ArchiveIndex::Resource Res;
+        if (!CanRead(sizeof(Res.Type)))
+            return false;
+        Reader(Res.Type);
+
+        if (!CanReadString() || !Reader(Res.Name) || !CanRead(Uint64{LocationSize} * Res.Blobs.size()))
+            return false;
+
+        for (BlobLocation& Location : Res.Blobs)
+            ArchiveSerializer<SerializerMode::Read>{Reader}.SerializeBlobLocation(Location);
+        Index.Resources.emplace_back(Res);
+    }
+
+    for (std::vector<BlobLocation>& Shaders : Index.Shaders)
+    {
+        Uint32 NumShaders = 0;
+        if (!CanRead(sizeof(NumShaders)))
+            return false;
+        Reader(NumShaders);
+
+        if (!CanRead(Uint64{LocationSize} * NumShaders))
+            return false;
+
+        Shaders.resize(NumShaders);
+        for (BlobLocation& Location : Shaders)
+            ArchiveSerializer<SerializerMode::Read>{Reader}.SerializeBlobLocation(Location);
+    }
+
+    if (!Reader.IsEnded())
+    {
+        LOG_ERROR_MESSAGE("Device object archive index size recorded in the header (", Index.Data.size(), ") does not match the actual size (", Reader.GetSize(), ").");
+        return false;
+    }
+
+    auto IsValidLocation = [ArchiveSize](const BlobLocation& Location) {
+        if (Location.Size == 0 || (Location.Offset <= ArchiveSize && Location.Size <= ArchiveSize - Location.Offset))
+            return true;
+
+        LOG_ERROR_MESSAGE("Data blob [", Location.Offset, ", ", Location.Offset + Location.Size, ") is out of the archive bounds (", ArchiveSize, " bytes).");
+        return false;
+    };
+    for (const ArchiveIndex::Resource& Res : Index.Resources)
+    {
+        for (const BlobLocation& Location : Res.Blobs)
+        {
+            if (!IsValidLocation(Location))
+                return false;
+        }
+    }
+    for (const std::vector<BlobLocation>& Shaders : Index.Shaders)
+    {
+        for (const BlobLocation& Location : Shaders)
+        {
+            if (!IsValidLocation(Location))
+                return false;
+        }
+    }
+
+    Index.Version        = Header.Version;
+    Index.ContentVersion = Header.ContentVersion;
+
+    return true;
+}
+
+// Reads data blobs of archives from streams
+class ArchiveStreamReader
+{
+public:
+    ArchiveStreamReader(const DeviceObjectArchive::Codec* const* ppCodecs, Uint32 NumCodecs) noexcept :
+        m_ppCodecs{ppCodecs},
+        m_NumCodecs{NumCodecs}
+    {}
+
+    // Reads the data as it is stored in the archive
+    bool ReadRaw(IFileStream* pStream, Uint64 Offset, size_t Size, std::vector<Uint8>& Data) const
+    {
+        Data.resize(Size);
+        if (Size == 0)
+            return true;
+
+        return (pStream->SetPos(StaticCast<size_t>(Offset), static_cast<int>(FilePosOrigin::Start)) &&
+                pStream->Read(Data.data(), Size));
+    }
+
+    // Reads the data and decompresses it if necessary
+    bool ReadUncompressed(IFileStream* pStream, const BlobLocation& Location, std::vector<Uint8>& Data)
+    {
+        if (Location.CodecId == static_cast<Uint32>(DeviceObjectArchive::CodecId::None))
+            return ReadRaw(pStream, Location.Offset, Location.Size, Data);
+
+        const DeviceObjectArchive::Codec* pCodec = GetBlobCodec(Location, m_ppCodecs, m_NumCodecs);
+        if (pCodec == nullptr)
+            return false;
+
+        if (!ReadRaw(pStream, Location.Offset, Location.Size, m_Buffer))
+            return false;
+
+        Data.resize(Location.UncompressedSize);
+        return pCodec->Decompress(m_Buffer.data(), m_Buffer.size(), Data.data(), Data.size());
+    }
+
+    // Copies the data to another stream without loading all of it into memory
+    bool Copy(IFileStream* pSrcStream, Uint64 Offset, size_t Size, IFileStream* pDstStream)
+    {
+        constexpr size_t MaxChunkSize = size_t{64} << 10;
+
+        if (!pSrcStream->SetPos(StaticCast<size_t>(Offset), static_cast<int>(FilePosOrigin::Start)))
+            return false;
+
+        m_Buffer.resize(std::min(Size, MaxChunkSize));
+        while (Size > 0)
+        {
+            const size_t ChunkSize = std::min(Size, m_Buffer.size());
+            if (!pSrcStream->Read(m_Buffer.data(), ChunkSize) || !pDstStream->Write(m_Buffer.data(), ChunkSize))
+                return false;
+            Size -= ChunkSize;
+        }
+        return true;
+    }
+
+private:
+    const DeviceObjectArchive::Codec* const* const m_ppCodecs;
+    const Uint32                                   m_NumCodecs;
+
+    std::vector<Uint8> m_Buffer;
+};
+
+} // namespace
+
+bool DeviceObjectArchive::ReadIndex(IFileStream* pStream, ArchiveIndex& Index) noexcept
+{
+    Index = ArchiveIndex{};
+    if (pStream == nullptr)
+    {
+        DEV_ERROR("File stream must not be null");
+        return false;
+    }
+
+    const size_t ArchiveSize = pStream->GetSize();
+    if (!pStream->SetPos(0, static_cast<int>(FilePosOrigin::Start)))
+    {
+        LOG_ERROR_MESSAGE("Failed to set the stream position.");
+        return false;
+    }
+
+    // Read the beginning of the header that contains the index size, then the rest of the index.
+    // NB: this must match header serialization in ArchiveSerializer::SerializeHeader
+    ArchiveHeader    Header;
+    constexpr size_t HeaderPrefixSize = sizeof(Header.MagicNumber) + sizeof(Header.Version) + sizeof(Header.IndexSize);
+    if (ArchiveSize < HeaderPrefixSize)
+    {
+        LOG_ERROR_MESSAGE("The stream is too small to contain a device object archive.");
+        return false;
+    }
+
+    Index.Data.resize(HeaderPrefixSize);
+    if (!pStream->Read(Index.Data.data(), HeaderPrefixSize))
+    {
+        LOG_ERROR_MESSAGE("Failed to read the device object archive header from the stream.");
+        return false;
+    }
+    std::memcpy(&Header.MagicNumber, &Index.Data[0], sizeof(Header.MagicNumber));
+    std::memcpy(&Header.Version, &Index.Data[sizeof(Header.MagicNumber)], sizeof(Header.Version));
+
+    if (Header.MagicNumber != HeaderMagicNumber)
+    {
+        LOG_ERROR_MESSAGE("Invalid device object archive header.");
+        return false;
+    }
+    // Only archives with the index can be read from a stream
+    if (Header.Version != ArchiveVersion)
+    {
+        LOG_ERROR_MESSAGE("Device object archive version ", Header.Version, " can't be read from a stream. Expected version: ", Uint32{ArchiveVersion},
+                          ". Older archives must be loaded and serialized again.");
+        return false;
+    }
+
+    std::memcpy(&Header.IndexSize, &Index.Data[sizeof(Header.MagicNumber) + sizeof(Header.Version)], sizeof(Header.IndexSize));
+    if (Header.IndexSize < HeaderPrefixSize || Header.IndexSize > ArchiveSize)
+    {
+        LOG_ERROR_MESSAGE("Invalid device object archive index size (", Header.IndexSize, "). Archive size: ", ArchiveSize, '.');
+        return false;
+    }
+
+    Index.Data.resize(Header.IndexSize);
+    if (!pStream->Read(Index.Data.data() + HeaderPrefixSize, Header.IndexSize - HeaderPrefixSize))
+    {
+        LOG_ERROR_MESSAGE("Failed to read the device object archive index from the stream.");
+        return false;
+    }
+
+    return ParseArchiveIndex(Index, ArchiveSize);
+}
+
+bool DeviceObjectArchive::MergeStreams(IFileStream* const* ppSrcStreams,
+                                       Uint32              NumSrcStreams,
+                                       IFileStream*        pDstStream,
+                                       const Codec* const* ppCodecs,
+                                       Uint32              NumCodecs) noexcept
+{
+    if (NumSrcStreams == 0 || ppSrcStreams == nullptr)
+    {
+        DEV_ERROR("At least one source stream must be provided");
+        return false;
+    }
+    if (pDstStream == nullptr)
+    {
+        DEV_ERROR("Destination stream must not be null");
+        return false;
+    }
+
+    std::vector<ArchiveIndex> SrcIndices(NumSrcStreams);
+    for (Uint32 src = 0; src < NumSrcStreams; ++src)
+    {
+        if (ppSrcStreams[src] == nullptr || !ReadIndex(ppSrcStreams[src], SrcIndices[src]))
+        {
+            LOG_ERROR_MESSAGE("Failed to read the index of source archive ", src, '.');
+            return false;
+        }
+
+        if (SrcIndices[src].ContentVersion != SrcIndices[0].ContentVersion)
+            LOG_WARNING_MESSAGE("Merging archives with different content versions (", SrcIndices[0].ContentVersion, " and ", SrcIndices[src].ContentVersion, ").");
+    }
+
+    try
+    {
+        ArchiveStreamReader    Reader{ppCodecs, NumCodecs};
+        DynamicLinearAllocator Allocator{GetRawAllocator(), 512};
+
+        std::vector<Uint8> Data;
+        std::vector<Uint8> OtherData;
+
+        // Source of the data blob written to the merged archive
+        struct BlobSource
+        {
+            IFileStream* pStream = nullptr;
+            Uint64       Offset  = 0;
+
+            // If not null, the data that was modified in memory
+            const std::vector<Uint8>* pData = nullptr;
+        };
+
+        ArchiveIndex DstIndex;
+        DstIndex.ContentVersion = SrcIndices[0].ContentVersion;
+
+        // Copy shaders. Shaders whose stored data is identical are only written once.
+        // For every source archive and device type, maps the source shader index to the index in the merged archive.
+        std::vector<std::array<std::vector<Uint32>, static_cast<size_t>(DeviceType::Count)>> ShaderIndexRemap(NumSrcStreams);
+        std::array<std::vector<BlobSource>, static_cast<size_t>(DeviceType::Count)>           ShaderSources;
+        for (size_t dev = 0; dev < DstIndex.Shaders.size(); ++dev)
+        {
+            std::vector<BlobLocation>& DstShaders = DstIndex.Shaders[dev];
+
+            std::unordered_multimap<size_t, Uint32> HashToIdx;
+            for (Uint32 src = 0; src < NumSrcStreams; ++src)
+            {
+                const std::vector<BlobLocation>& SrcShaders = SrcIndices[src].Shaders[dev];
+
+                std::vector<Uint32>& Remap = ShaderIndexRemap[src][dev];
+                Remap.resize(SrcShaders.size());
+                for (size_t i = 0; i < SrcShaders.size(); ++i)
                 {
-                    // For shaders, device-specific data is the serialized shader bytecode index
-                    Uint32 ShaderIndex = 0;
+                    const BlobLocation& Location = SrcShaders[i];
+                    if (!Reader.ReadRaw(ppSrcStreams[src], Location.Offset, Location.Size, Data))
+                        LOG_ERROR_AND_THROW("Failed to read shader data from source archive ", src, '.');
+
+                    const size_t Hash = ComputeHash(Location.CodecId, Location.UncompressedSize, ComputeHashRaw(Data.data(), Data.size()));
+
+                    Uint32 DstIdx   = ~0u;
+                    auto   it_range = HashToIdx.equal_range(Hash);
+                    for (auto it = it_range.first; it != it_range.second && DstIdx == ~0u; ++it)
                     {
-                        Serializer<SerializerMode::Read> Ser{DeviceData};
-                        if (!Ser(ShaderIndex))
-                            LOG_ERROR_AND_THROW("Failed to deserialize standalone shader index. Archive file may be corrupted or invalid.");
-                        VERIFY(Ser.IsEnded(), "No other data besides the shader index is expected");
+                        const BlobLocation& DstLocation = DstShaders[it->second];
+                        if (DstLocation.Size != Location.Size || DstLocation.CodecId != Location.CodecId)
+                            continue;
+
+                        // Hashes may collide, so compare the data
+                        const BlobSource& DstSource = ShaderSources[dev][it->second];
+                        if (!Reader.ReadRaw(DstSource.pStream, DstSource.Offset, DstLocation.Size, OtherData))
+                            LOG_ERROR_AND_THROW("Failed to read shader data.");
+                        if (Data == OtherData)
+                            DstIdx = it->second;
                     }
 
-                    ShaderIndex += BaseIdx;
-
+                    if (DstIdx == ~0u)
                     {
-                        Serializer<SerializerMode::Write> Ser{DeviceData};
-                        Ser(ShaderIndex);
-                        VERIFY_EXPR(Ser.IsEnded());
+                        DstIdx = static_cast<Uint32>(DstShaders.size());
+                        DstShaders.emplace_back(Location);
+                        ShaderSources[dev].emplace_back(BlobSource{ppSrcStreams[src], Location.Offset, nullptr});
+                        HashToIdx.emplace(Hash, DstIdx);
                     }
+                    Remap[i] = DstIdx;
                 }
-                else if (IsPipeline)
+            }
+        }
+
+        struct MergedResource
+        {
+            const ArchiveIndex::Resource* pRes = nullptr;
+            Uint32                        Src  = 0;
+
+            // Device-specific data with remapped shader indices
+            std::array<std::vector<Uint8>, static_cast<size_t>(DeviceType::Count)> PatchedData;
+        };
+        std::vector<MergedResource> Resources;
+
+        // Copy named resources
+        std::unordered_map<NamedResourceKey, size_t, NamedResourceKey::Hasher> ResourceIndices;
+        std::vector<Uint32>                                                    ShaderIndices;
+        for (Uint32 src = 0; src < NumSrcStreams; ++src)
+        {
+            for (const ArchiveIndex::Resource& Res : SrcIndices[src].Resources)
+            {
+                auto it_inserted = ResourceIndices.emplace(NamedResourceKey{Res.Type, Res.Name}, Resources.size());
+                if (!it_inserted.second)
                 {
-                    // For pipelines, device-specific data is the shader index array
-                    ShaderIndexArray ShaderIndices;
+                    // Silently skip duplicate resources
+                    // Device-specific data is not compared as shader indices are different in the archives.
+                    const MergedResource& DstRes      = Resources[it_inserted.first->second];
+                    const BlobLocation&   DstLocation = DstRes.pRes->Blobs[0];
+                    const BlobLocation&   SrcLocation = Res.Blobs[0];
+
+                    bool IsDataRead = false;
+                    if (DstLocation.CodecId == SrcLocation.CodecId)
+                    {
+                        IsDataRead = (Reader.ReadRaw(ppSrcStreams[DstRes.Src], DstLocation.Offset, DstLocation.Size, Data) &&
+                                      Reader.ReadRaw(ppSrcStreams[src], SrcLocation.Offset, SrcLocation.Size, OtherData));
+                    }
+                    else
                     {
-                        Serializer<SerializerMode::Read> Ser{DeviceData};
-                        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &DynAllocator))
-                            LOG_ERROR_AND_THROW("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
-                        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
+                        IsDataRead = (Reader.ReadUncompressed(ppSrcStreams[DstRes.Src], DstLocation, Data) &&
+                                      Reader.ReadUncompressed(ppSrcStreams[src], SrcLocation, OtherData));
                     }
+                    if (!IsDataRead)
+                        LOG_ERROR_AND_THROW("Failed to read data of resource '", Res.Name, "'.");
 
-                    std::vector<Uint32> NewIndices{ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count};
-                    for (Uint32& Idx : NewIndices)
-                        Idx += BaseIdx;
+                    if (Data != OtherData)
+                        LOG_WARNING_MESSAGE("Failed to copy resource '", Res.Name, "': resource with the same name already exists.");
 
+                    continue;
+                }
+
+                MergedResource DstRes;
+                DstRes.pRes = &Res;
+                DstRes.Src  = src;
+
+                // Update shader indices. This data is small and is written uncompressed.
+                if (HasShaderIndices(Res.Type))
+                {
+                    for (size_t dev = 0; dev < DstRes.PatchedData.size(); ++dev)
                     {
-                        Serializer<SerializerMode::Write> Ser{DeviceData};
-                        PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, ShaderIndexArray{NewIndices.data(), ShaderIndices.Count}, nullptr);
-                        VERIFY_EXPR(Ser.IsEnded());
+                        const BlobLocation& Location = Res.Blobs[1 + dev];
+                        if (Location.Size == 0)
+                            continue;
+
+                        std::vector<Uint8>& DevData = DstRes.PatchedData[dev];
+                        if (!Reader.ReadUncompressed(ppSrcStreams[src], Location, DevData))
+                            LOG_ERROR_AND_THROW("Failed to read device-specific data of resource '", Res.Name, "'.");
+
+                        const SerializedData DeviceData{DevData.data(), DevData.size()};
+                        if (!ReadShaderIndices(Res.Type, DeviceData, Allocator, ShaderIndices))
+                            LOG_ERROR_AND_THROW("Failed to read shader indices of resource '", Res.Name, "'.");
+
+                        const std::vector<Uint32>& Remap = ShaderIndexRemap[src][dev];
+                        for (Uint32& Idx : ShaderIndices)
+                        {
+                            if (Idx >= Remap.size())
+                                LOG_ERROR_AND_THROW("Shader index ", Idx, " is out of range. Archive file may be corrupted or invalid.");
+                            Idx = Remap[Idx];
+                        }
+
+                        WriteShaderIndices(Res.Type, DeviceData, ShaderIndices);
                     }
+                    Allocator.Discard();
                 }
-                else
+
+                Resources.emplace_back(std::move(DstRes));
+            }
+        }
+
+        // Sort resources by type and name so that the index is deterministic
+        std::sort(Resources.begin(), Resources.end(),
+                  [](const MergedResource& Lhs, const MergedResource& Rhs) {
+                      if (Lhs.pRes->Type != Rhs.pRes->Type)
+                          return Lhs.pRes->Type < Rhs.pRes->Type;
+                      return strcmp(Lhs.pRes->Name, Rhs.pRes->Name) < 0;
+                  });
+
+        // Blob sources and locations in the order the blobs are written to the archive
+        std::vector<BlobSource>          BlobSources;
+        std::vector<const BlobLocation*> BlobLocations;
+
+        DstIndex.Resources.resize(Resources.size());
+        for (size_t res = 0; res < Resources.size(); ++res)
+        {
+            const MergedResource&   SrcRes = Resources[res];
+            ArchiveIndex::Resource& DstRes = DstIndex.Resources[res];
+
+            DstRes = *SrcRes.pRes;
+            for (size_t i = 0; i < DstRes.Blobs.size(); ++i)
+            {
+                BlobLocation& Location = DstRes.Blobs[i];
+                BlobSource    Source{ppSrcStreams[SrcRes.Src], Location.Offset, nullptr};
+                if (i > 0 && !SrcRes.PatchedData[i - 1].empty())
                 {
-                    UNEXPECTED("Unexpected resource type");
+                    Source.pData              = &SrcRes.PatchedData[i - 1];
+                    Location.Size             = StaticCast<Uint32>(Source.pData->size());
+                    Location.CodecId          = static_cast<Uint32>(CodecId::None);
+                    Location.UncompressedSize = Location.Size;
                 }
+                BlobSources.emplace_back(Source);
+                BlobLocations.emplace_back(&Location);
+            }
+        }
+        for (size_t dev = 0; dev < DstIndex.Shaders.size(); ++dev)
+        {
+            for (size_t i = 0; i < DstIndex.Shaders[dev].size(); ++i)
+            {
+                BlobSources.emplace_back(ShaderSources[dev][i]);
+                BlobLocations.emplace_back(&DstIndex.Shaders[dev][i]);
             }
         }
+
+        size_t IndexSize   = 0;
+        size_t ArchiveSize = 0;
+        {
+            SerializationBuffer IndexBuffer{pDstStream, GetRawAllocator()};
+            ArchiveSize = WriteIndex(DstIndex, IndexBuffer);
+            if (ArchiveSize == 0 || !IndexBuffer.Flush())
+                LOG_ERROR_AND_THROW("Failed to write the merged archive index.");
+            IndexSize = IndexBuffer.GetSize();
+        }
+
+        size_t Offset = IndexSize;
+        for (size_t i = 0; i < BlobSources.size(); ++i)
+        {
+            const BlobLocation& Location = *BlobLocations[i];
+            if (Location.Size == 0)
+                continue;
+
+            const BlobSource& Source = BlobSources[i];
+            if (!WriteBlobPadding(pDstStream, Offset, Location) ||
+                !(Source.pData != nullptr ?
+                      pDstStream->Write(Source.pData->data(), Location.Size) :
+                      Reader.Copy(Source.pStream, Source.Offset, Location.Size, pDstStream)))
+                LOG_ERROR_AND_THROW("Failed to write the merged archive data.");
+        }
+        VERIFY_EXPR(Offset == ArchiveSize);
     }
+    catch (...)
+    {
+        return false;
+    }
+
+    return true;
 }
 
-void DeviceObjectArchive::Serialize(IFileStream* pStream) const
+bool DeviceObjectArchive::DiffStreams(IFileStream*               pStream0,
+                                      IFileStream*               pStream1,
+                                      std::vector<ResourceDiff>& Diffs,
+                                      const Codec* const*        ppCodecs,
+                                      Uint32                     NumCodecs) noexcept
 {
-    DEV_CHECK_ERR(pStream != nullptr, "File stream must not be null");
-    RefCntAutoPtr<IDataBlob> pDataBlob;
-    Serialize(&pDataBlob);
-    VERIFY_EXPR(pDataBlob);
-    pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
+    Diffs.clear();
+    if (pStream0 == nullptr || pStream1 == nullptr)
+    {
+        DEV_ERROR("File streams must not be null");
+        return false;
+    }
+
+    const std::array<IFileStream*, 2> Streams = {pStream0, pStream1};
+
+    std::array<ArchiveIndex, 2> Indices;
+    for (size_t i = 0; i < Indices.size(); ++i)
+    {
+        if (!ReadIndex(Streams[i], Indices[i]))
+        {
+            LOG_ERROR_MESSAGE("Failed to read the index of archive ", i, '.');
+            return false;
+        }
+    }
+
+    try
+    {
+        ArchiveStreamReader Reader{ppCodecs, NumCodecs};
+
+        std::array<std::vector<Uint8>, 2> Data;
+        auto                              ReadData = [&](size_t i, const BlobLocation& Location) {
+            if (!Reader.ReadUncompressed(Streams[i], Location, Data[i]))
+                LOG_ERROR_AND_THROW("Failed to read data from archive ", i, '.');
+            return SerializedData{Data[i].data(), Data[i].size()};
+        };
+
+        // The same shader may have different indices in the archives, so shaders are compared by content hash
+        std::array<std::array<std::vector<size_t>, static_cast<size_t>(DeviceType::Count)>, 2> ShaderHashes;
+        for (size_t i = 0; i < Indices.size(); ++i)
+        {
+            for (size_t dev = 0; dev < Indices[i].Shaders.size(); ++dev)
+            {
+                for (const BlobLocation& Location : Indices[i].Shaders[dev])
+                    ShaderHashes[i][dev].emplace_back(ReadData(i, Location).GetHash());
+            }
+        }
+
+        DynamicLinearAllocator             Allocator{GetRawAllocator(), 512};
+        std::array<std::vector<Uint32>, 2> ShaderIndices;
+
+        auto IsModified = [&](const ArchiveIndex::Resource& Res0, const ArchiveIndex::Resource& Res1) {
+            for (size_t blob = 0; blob < Res0.Blobs.size(); ++blob)
+            {
+                if (Res0.Blobs[blob].UncompressedSize != Res1.Blobs[blob].UncompressedSize)
+                    return true;
+                if (Res0.Blobs[blob].Size == 0)
+                    continue;
+
+                const SerializedData BlobData0 = ReadData(0, Res0.Blobs[blob]);
+                const SerializedData BlobData1 = ReadData(1, Res1.Blobs[blob]);
+                if (blob == 0 || !HasShaderIndices(Res0.Type))
+                {
+                    if (BlobData0 != BlobData1)
+                        return true;
+                    continue;
+                }
+
+                // Compare the shaders referenced by the resource rather than their indices
+                const size_t dev = blob - 1;
+                if (!ReadShaderIndices(Res0.Type, BlobData0, Allocator, ShaderIndices[0]) ||
+                    !ReadShaderIndices(Res1.Type, BlobData1, Allocator, ShaderIndices[1]))
+                    LOG_ERROR_AND_THROW("Failed to read shader indices of resource '", Res0.Name, "'.");
+                Allocator.Discard();
+
+                if (ShaderIndices[0].size() != ShaderIndices[1].size())
+                    return true;
+
+                for (size_t s = 0; s < ShaderIndices[0].size(); ++s)
+                {
+                    const Uint32 Idx0 = ShaderIndices[0][s];
+                    const Uint32 Idx1 = ShaderIndices[1][s];
+                    if (Idx0 >= ShaderHashes[0][dev].size() || Idx1 >= ShaderHashes[1][dev].size())
+                        LOG_ERROR_AND_THROW("Shader index of resource '", Res0.Name, "' is out of range. Archive file may be corrupted or invalid.");
+
+                    if (ShaderHashes[0][dev][Idx0] != ShaderHashes[1][dev][Idx1])
+                        return true;
+                }
+            }
+            return false;
+        };
+
+        std::unordered_map<NamedResourceKey, const ArchiveIndex::Resource*, NamedResourceKey::Hasher> Resources1;
+        for (const ArchiveIndex::Resource& Res : Indices[1].Resources)
+            Resources1.emplace(NamedResourceKey{Res.Type, Res.Name}, &Res);
+
+        for (const ArchiveIndex::Resource& Res0 : Indices[0].Resources)
+        {
+            auto it = Resources1.find(NamedResourceKey{Res0.Type, Res0.Name});
+            if (it == Resources1.end())
+            {
+                Diffs.emplace_back(ResourceDiff{DiffType::Removed, Res0.Type, Res0.Name});
+                continue;
+            }
+
+            if (IsModified(Res0, *it->second))
+                Diffs.emplace_back(ResourceDiff{DiffType::Modified, Res0.Type, Res0.Name});
+            Resources1.erase(it);
+        }
+
+        for (const auto& it : Resources1)
+            Diffs.emplace_back(ResourceDiff{DiffType::Added, it.second->Type, it.second->Name});
+
+        std::sort(Diffs.begin(), Diffs.end(),
+                  [](const ResourceDiff& Lhs, const ResourceDiff& Rhs) {
+                      if (Lhs.ResType != Rhs.ResType)
+                          return Lhs.ResType < Rhs.ResType;
+                      return Lhs.Name < Rhs.Name;
+                  });
+    }
+    catch (...)
+    {
+        Diffs.clear();
+        return false;
+    }
+
+    return true;
 }
 
 } // namespace Diligent
@@ -0,0 +1,215 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "PipelineUsageTrace.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "DataBlobImpl.hpp"
+#include "EngineMemory.h"
+#include "Serializer.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+template <SerializerMode Mode>
+bool SerializeEntry(Serializer<Mode>& Ser, typename Serializer<Mode>::template ConstQual<PipelineUsageTrace::Entry>& Entry)
+{
+    return Ser(Entry.PipelineType, Entry.HashLow, Entry.HashHigh, Entry.FirstUseTime, Entry.NumRequests);
+}
+
+// The size of the entry data that follows the name
+constexpr size_t EntryDataSize = sizeof(PIPELINE_TYPE) + sizeof(Uint64) * 3 + sizeof(Uint32);
+
+} // namespace
+
+bool PipelineUsageTrace::Entry::operator==(const Entry& RHS) const
+{
+    // clang-format off
+    return PipelineType == RHS.PipelineType &&
+           Name         == RHS.Name         &&
+           HashLow      == RHS.HashLow      &&
+           HashHigh     == RHS.HashHigh     &&
+           FirstUseTime == RHS.FirstUseTime &&
+           NumRequests  == RHS.NumRequests;
+    // clang-format on
+}
+
+PipelineUsageTrace::PipelineUsageTrace()
+{
+}
+
+void PipelineUsageTrace::Record(PIPELINE_TYPE PipelineType, const char* Name, Uint64 HashLow, Uint64 HashHigh)
+{
+    if (Name == nullptr)
+        Name = "";
+
+    std::lock_guard<std::mutex> Guard{m_Mtx};
+
+    // Read the time under the lock so that when several threads record the same pipeline,
+    // the thread that creates the entry always has the earliest timestamp.
+    const Uint64 Time = static_cast<Uint64>(m_Timer.GetElapsedTime() * 1e+6);
+
+    auto it = m_EntryIdx.find(EntryKey{PipelineType, HashLow, HashHigh, Name});
+    if (it != m_EntryIdx.end())
+    {
+        ++m_Entries[it->second].NumRequests;
+        return;
+    }
+
+    m_Entries.emplace_back();
+    Entry& NewEntry       = m_Entries.back();
+    NewEntry.PipelineType = PipelineType;
+    NewEntry.Name         = Name;
+    NewEntry.HashLow      = HashLow;
+    NewEntry.HashHigh     = HashHigh;
+    NewEntry.FirstUseTime = Time;
+    NewEntry.NumRequests  = 1;
+
+    constexpr bool MakeCopy = true;
+    m_EntryIdx.emplace(EntryKey{PipelineType, HashLow, HashHigh, HashMapStringKey{Name, MakeCopy}}, m_Entries.size() - 1);
+}
+
+std::vector<PipelineUsageTrace::Entry> PipelineUsageTrace::GetEntries() const
+{
+    std::lock_guard<std::mutex> Guard{m_Mtx};
+    return m_Entries;
+}
+
+size_t PipelineUsageTrace::GetNumEntries() const
+{
+    std::lock_guard<std::mutex> Guard{m_Mtx};
+    return m_Entries.size();
+}
+
+void PipelineUsageTrace::Clear()
+{
+    std::lock_guard<std::mutex> Guard{m_Mtx};
+    m_Entries.clear();
+    m_EntryIdx.clear();
+    m_Timer.Restart();
+}
+
+void PipelineUsageTrace::Serialize(IDataBlob** ppBlob) const
+{
+    DEV_CHECK_ERR(ppBlob != nullptr && *ppBlob == nullptr, "ppBlob must not be null and must point to null");
+
+    SerializationBuffer Buffer{GetRawAllocator()};
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+
+        Serializer<SerializerMode::Write> Ser{Buffer};
+
+        const Uint32 NumEntries = static_cast<Uint32>(m_Entries.size());
+        Ser(MagicNumber, TraceVersion, NumEntries);
+        for (const Entry& TraceEntry : m_Entries)
+        {
+            const char* Name = TraceEntry.Name.c_str();
+            Ser(Name);
+            SerializeEntry(Ser, TraceEntry);
+        }
+    }
+
+    RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(Buffer.GetSize());
+    Buffer.CopyTo(pBlob->GetDataPtr());
+    *ppBlob = pBlob.Detach();
+}
+
+bool PipelineUsageTrace::Serialize(IFileStream* pStream) const
+{
+    DEV_CHECK_ERR(pStream != nullptr, "pStream must not be null");
+    if (pStream == nullptr)
+        return false;
+
+    RefCntAutoPtr<IDataBlob> pBlob;
+    Serialize(&pBlob);
+    return pStream->Write(pBlob->GetConstDataPtr(), pBlob->GetSize());
+}
+
+bool PipelineUsageTrace::Deserialize(const void* pData, size_t Size, std::vector<Entry>& Entries)
+{
+    Entries.clear();
+    if (pData == nullptr)
+    {
+        DEV_ERROR("pData must not be null");
+        return false;
+    }
+
+    Serializer<SerializerMode::Read> Ser{SerializedData{const_cast<void*>(pData), Size}};
+
+    // Check the remaining size before reading, so that the truncated trace is reported as an error
+    // rather than triggering the serializer assertions.
+    auto CanRead = [&Ser](size_t Size) {
+        return Ser.GetRemainingSize() >= Size;
+    };
+
+    Uint32 Magic      = 0;
+    Uint32 Version    = 0;
+    Uint32 NumEntries = 0;
+    if (!CanRead(sizeof(Uint32) * 3) || !Ser(Magic, Version, NumEntries) || Magic != MagicNumber)
+    {
+        LOG_ERROR_MESSAGE("Invalid pipeline usage trace header");
+        return false;
+    }
+
+    if (Version != TraceVersion)
+    {
+        LOG_ERROR_MESSAGE("Unsupported pipeline usage trace version: ", Version, ". Expected version: ", TraceVersion);
+        return false;
+    }
+
+    // Do not trust the number of entries when reserving the memory as the data may be corrupted
+    Entries.reserve(std::min(size_t{NumEntries}, Ser.GetRemainingSize() / (sizeof(Uint32) + EntryDataSize)));
+    for (Uint32 i = 0; i < NumEntries; ++i)
+    {
+        Uint32 NameLen = 0;
+        if (CanRead(sizeof(NameLen)))
+            std::memcpy(&NameLen, Ser.GetCurrentPtr(), sizeof(NameLen));
+
+        const char* Name = nullptr;
+        Entry       TraceEntry;
+        if (!CanRead(sizeof(NameLen) + size_t{NameLen} + EntryDataSize) || !Ser(Name) || !SerializeEntry(Ser, TraceEntry))
+        {
+            LOG_ERROR_MESSAGE("Failed to read pipeline usage trace entry ", i, ". The trace may be corrupted.");
+            Entries.clear();
+            return false;
+        }
+        TraceEntry.Name = Name;
+        Entries.emplace_back(std::move(TraceEntry));
+    }
+
+    if (!Ser.IsEnded())
+        LOG_WARNING_MESSAGE("Pipeline usage trace contains ", Ser.GetRemainingSize(), " bytes of unexpected data at the end");
+
+    return true;
+}
+
+} // namespace Diligent
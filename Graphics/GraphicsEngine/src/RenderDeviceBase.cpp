@@ -134,8 +134,9 @@ DeviceFeaturesVk EnableDeviceFeaturesVk(const DeviceFeaturesVk& SupportedFeature
 
     ENABLE_FEATURE(DynamicRendering, "VK_KHR_dynamic_rendering is");
     ENABLE_FEATURE(HostImageCopy, "VK_EXT_host_image_copy is");
+    ENABLE_FEATURE(DescriptorUpdateTemplate, "Descriptor update templates are");
 
-    ASSERT_SIZEOF(DeviceFeaturesVk, 2, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeaturesVk, 3, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
 
     return EnabledFeatures;
 }
@@ -210,6 +210,9 @@ void ValidateTextureDesc(const TextureDesc& Desc, const IRenderDevice* pDevice)
             LOG_TEXTURE_ERROR_AND_THROW("MISC_TEXTURE_FLAG_SUBSAMPLED is not compatible with BIND_SHADING_RATE");
     }
 
+    if ((Desc.MiscFlags & MISC_TEXTURE_FLAG_HOST_UPLOAD) != 0 && Desc.Usage != USAGE_DEFAULT)
+        LOG_TEXTURE_ERROR_AND_THROW("MISC_TEXTURE_FLAG_HOST_UPLOAD is only allowed for USAGE_DEFAULT textures");
+
     if (Desc.BindFlags & BIND_SHADING_RATE)
     {
         if (!pDevice->GetDeviceInfo().Features.VariableRateShading)
@@ -157,6 +157,45 @@ size_t ShaderVariableManagerD3D11::GetRequiredMemorySize(const PipelineResourceS
     return MemSize;
 }
 
+void ShaderVariableManagerD3D11::GetVariableIndices(const PipelineResourceSignatureD3D11Impl& Signature,
+                                                    const SHADER_RESOURCE_VARIABLE_TYPE*      AllowedVarTypes,
+                                                    Uint32                                    NumAllowedTypes,
+                                                    SHADER_TYPE                               ShaderType,
+                                                    Uint32*                                   pVarIndices)
+{
+    // Variables are grouped by resource type in the same order as in GetVariable()
+    const D3DShaderResourceCounters ResCounters = CountResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType);
+
+    Uint32 cb     = 0;
+    Uint32 texSrv = cb + ResCounters.NumCBs;
+    Uint32 texUav = texSrv + ResCounters.NumTexSRVs;
+    Uint32 bufSrv = texUav + ResCounters.NumTexUAVs;
+    Uint32 bufUav = bufSrv + ResCounters.NumBufSRVs;
+    Uint32 sam    = bufUav + ResCounters.NumBufUAVs;
+
+    ProcessSignatureResources(
+        Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
+        [&](Uint32 Index) //
+        {
+            const PipelineResourceDesc& ResDesc = Signature.GetResourceDesc(Index);
+            static_assert(SHADER_RESOURCE_TYPE_LAST == 8, "Please update the switch below to handle the new shader resource range");
+            switch (ResDesc.ResourceType)
+            {
+                    // clang-format off
+                case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:  pVarIndices[Index] = cb++;     break;
+                case SHADER_RESOURCE_TYPE_TEXTURE_SRV:      pVarIndices[Index] = texSrv++; break;
+                case SHADER_RESOURCE_TYPE_BUFFER_SRV:       pVarIndices[Index] = bufSrv++; break;
+                case SHADER_RESOURCE_TYPE_TEXTURE_UAV:      pVarIndices[Index] = texUav++; break;
+                case SHADER_RESOURCE_TYPE_BUFFER_UAV:       pVarIndices[Index] = bufUav++; break;
+                case SHADER_RESOURCE_TYPE_SAMPLER:          pVarIndices[Index] = sam++;    break;
+                case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT: pVarIndices[Index] = texSrv++; break;
+                // clang-format on
+                default:
+                    UNEXPECTED("Unsupported resource type.");
+            }
+        });
+}
+
 
 void ShaderVariableManagerD3D11::Initialize(const PipelineResourceSignatureD3D11Impl& Signature,
                                             IMemoryAllocator&                         Allocator,
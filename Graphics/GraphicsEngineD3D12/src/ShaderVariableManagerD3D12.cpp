@@ -85,6 +85,21 @@ size_t ShaderVariableManagerD3D12::GetRequiredMemorySize(const PipelineResourceS
     return (*pNumVariables) * sizeof(ShaderVariableD3D12Impl);
 }
 
+void ShaderVariableManagerD3D12::GetVariableIndices(const PipelineResourceSignatureD3D12Impl& Signature,
+                                                    const SHADER_RESOURCE_VARIABLE_TYPE*      AllowedVarTypes,
+                                                    Uint32                                    NumAllowedTypes,
+                                                    SHADER_TYPE                               ShaderType,
+                                                    Uint32*                                   pVarIndices)
+{
+    // Variables are created in the order of resources, see Initialize()
+    Uint32 VarInd = 0;
+    ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
+                              [pVarIndices, &VarInd](Uint32 ResIndex) //
+                              {
+                                  pVarIndices[ResIndex] = VarInd++;
+                              });
+}
+
 // Creates shader variable for every resource from Signature whose type is one of AllowedVarTypes
 void ShaderVariableManagerD3D12::Initialize(const PipelineResourceSignatureD3D12Impl& Signature,
                                             IMemoryAllocator&                         Allocator,
@@ -108,6 +123,9 @@ void ShaderVariableManagerD3D12::Initialize(const PipelineResourceSignatureD3D12
                                   ++VarInd;
                               });
     VERIFY_EXPR(VarInd == m_NumVariables);
+#ifdef DILIGENT_DEBUG
+    DvpVerifyVariableOrder();
+#endif
 }
 
 void ShaderVariableManagerD3D12::Destroy(IMemoryAllocator& Allocator)
@@ -135,13 +153,7 @@ const ShaderVariableManagerD3D12::ResourceAttribs& ShaderVariableManagerD3D12::G
 
 ShaderVariableD3D12Impl* ShaderVariableManagerD3D12::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableD3D12Impl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return FindVariableByName(Name);
 }
 
 
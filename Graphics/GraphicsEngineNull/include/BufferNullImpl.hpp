@@ -0,0 +1,80 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::BufferNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "BufferBase.hpp"
+#include "BufferViewNullImpl.hpp" // Required by BufferBase
+
+namespace Diligent
+{
+
+/// Buffer implementation in Null backend.
+
+/// The buffer does not allocate any GPU memory. Dynamic and staging buffers keep
+/// CPU-side storage so that they can be mapped by the application.
+class BufferNullImpl final : public BufferBase<EngineNullImplTraits>
+{
+public:
+    using TBufferBase = BufferBase<EngineNullImplTraits>;
+
+    // {63ED4FBB-71AD-40A5-AC98-93B22A26A49E}
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x63ED4FBB, 0x71AD, 0x40A5, {0xAC, 0x98, 0x93, 0xB2, 0x2A, 0x26, 0xA4, 0x9E}};
+
+    BufferNullImpl(IReferenceCounters*        pRefCounters,
+                   FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                   RenderDeviceNullImpl*      pDevice,
+                   const BufferDesc&          Desc,
+                   const BufferData*          pInitData,
+                   bool                       bIsDeviceInternal);
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_InternalImpl, TBufferBase)
+
+    /// Implementation of IBuffer::GetNativeHandle() in Null backend.
+    Uint64 DILIGENT_CALL_TYPE GetNativeHandle() override final { return 0; }
+
+    /// Implementation of IBuffer::GetSparseProperties() in Null backend.
+    SparseBufferProperties DILIGENT_CALL_TYPE GetSparseProperties() const override final;
+
+    // Returns the pointer to the CPU-side storage, or null if the buffer has no storage.
+    Uint8* GetCPUAddress() { return !m_Data.empty() ? m_Data.data() : nullptr; }
+
+private:
+    void CreateViewInternal(const BufferViewDesc& ViewDesc, IBufferView** ppView, bool IsDefaultView) override;
+
+private:
+    std::vector<Uint8> m_Data;
+};
+
+} // namespace Diligent
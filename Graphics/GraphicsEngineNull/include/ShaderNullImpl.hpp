@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "ShaderBase.hpp"
+
+namespace Diligent
+{
+
+/// Shader implementation in Null backend.
+
+/// The shader is never compiled and does not provide resource reflection.
+/// If byte code is given at creation time, it is kept so that it can be
+/// retrieved with GetBytecode().
+class ShaderNullImpl final : public ShaderBase<EngineNullImplTraits>
+{
+public:
+    using TShaderBase = ShaderBase<EngineNullImplTraits>;
+
+    // {94798DF2-A9D7-4AC0-99D1-EB7B4660B12B}
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x94798DF2, 0xA9D7, 0x4AC0, {0x99, 0xD1, 0xEB, 0x7B, 0x46, 0x60, 0xB1, 0x2B}};
+
+    struct CreateInfo
+    {
+        const RenderDeviceInfo&    DeviceInfo;
+        const GraphicsAdapterInfo& AdapterInfo;
+    };
+
+    ShaderNullImpl(IReferenceCounters*     pRefCounters,
+                   RenderDeviceNullImpl*   pDevice,
+                   const ShaderCreateInfo& ShaderCI,
+                   const CreateInfo&       NullShaderCI,
+                   bool                    IsDeviceInternal = false);
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_InternalImpl, TShaderBase)
+
+    /// Implementation of IShader::GetResourceCount() in Null backend.
+    Uint32 DILIGENT_CALL_TYPE GetResourceCount() const override final { return 0; }
+
+    /// Implementation of IShader::GetResourceDesc() in Null backend.
+    void DILIGENT_CALL_TYPE GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const override final;
+
+    /// Implementation of IShader::GetConstantBufferDesc() in Null backend.
+    const ShaderCodeBufferDesc* DILIGENT_CALL_TYPE GetConstantBufferDesc(Uint32 Index) const override final;
+
+    /// Implementation of IShader::GetBytecode() in Null backend.
+    void DILIGENT_CALL_TYPE GetBytecode(const void** ppBytecode, Uint64& Size) const override final;
+
+private:
+    std::vector<Uint8> m_Bytecode;
+};
+
+} // namespace Diligent
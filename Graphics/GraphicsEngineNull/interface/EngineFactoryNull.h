@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of functions that initialize Null engine implementation
+
+#include "../../GraphicsEngine/interface/EngineFactory.h"
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+
+#if PLATFORM_ANDROID || PLATFORM_LINUX || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS || PLATFORM_WEB || (PLATFORM_WIN32 && !defined(_MSC_VER))
+// https://gcc.gnu.org/wiki/Visibility
+#    define API_QUALIFIER __attribute__((visibility("default")))
+#elif PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
+#    define API_QUALIFIER
+#else
+#    error Unsupported platform
+#endif
+
+#if ENGINE_DLL && PLATFORM_WIN32 && defined(_MSC_VER)
+#    include "../../GraphicsEngine/interface/LoadEngineDll.h"
+#    define EXPLICITLY_LOAD_ENGINE_NULL_DLL 1
+#endif
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {3F1C5BDD-E856-4AEB-997F-45C5BB92047C}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_EngineFactoryNull =
+    {0x3F1C5BDD, 0xE856, 0x4AEB, {0x99, 0x7F, 0x45, 0xC5, 0xBB, 0x92, 0x04, 0x7C}};
+
+#define DILIGENT_INTERFACE_NAME IEngineFactoryNull
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IEngineFactoryNullInclusiveMethods \
+    IEngineFactoryInclusiveMethods;        \
+    IEngineFactoryNullMethods EngineFactoryNull
+
+// clang-format off
+
+/// Engine factory for Null rendering backend.
+
+/// The Null backend does not use a GPU. It creates all device objects and validates
+/// and tracks the state of all commands, but does not execute any work. It is intended
+/// to measure the CPU overhead of the engine.
+DILIGENT_BEGIN_INTERFACE(IEngineFactoryNull, IEngineFactory)
+{
+    /// Creates a render device and device contexts for Null engine implementation.
+
+    /// \param [in] EngineCI    - Engine creation info.
+    /// \param [out] ppDevice   - Address of the memory location where pointer to
+    ///                           the created device will be written.
+    /// \param [out] ppContexts - Address of the memory location where pointers to
+    ///                           the contexts will be written. Immediate context goes at
+    ///                           position 0. Null backend does not support deferred contexts.
+    VIRTUAL void METHOD(CreateDeviceAndContextsNull)(THIS_
+                                                     const EngineNullCreateInfo REF EngineCI,
+                                                     IRenderDevice**                ppDevice,
+                                                     IDeviceContext**               ppContexts) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define IEngineFactoryNull_CreateDeviceAndContextsNull(This, ...) CALL_IFACE_METHOD(EngineFactoryNull, CreateDeviceAndContextsNull, This, __VA_ARGS__)
+
+// clang-format on
+
+#endif
+
+
+#if EXPLICITLY_LOAD_ENGINE_NULL_DLL
+
+typedef struct IEngineFactoryNull* (*GetEngineFactoryNullType)();
+
+inline GetEngineFactoryNullType DILIGENT_GLOBAL_FUNCTION(LoadGraphicsEngineNull)()
+{
+    return (GetEngineFactoryNullType)LoadEngineDll("GraphicsEngineNull", "GetEngineFactoryNull");
+}
+
+#else
+
+API_QUALIFIER
+struct IEngineFactoryNull* DILIGENT_GLOBAL_FUNCTION(GetEngineFactoryNull)();
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
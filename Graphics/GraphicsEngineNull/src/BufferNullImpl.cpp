@@ -0,0 +1,108 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "BufferNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+constexpr INTERFACE_ID BufferNullImpl::IID_InternalImpl;
+
+BufferNullImpl::BufferNullImpl(IReferenceCounters*        pRefCounters,
+                               FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                               RenderDeviceNullImpl*      pDevice,
+                               const BufferDesc&          Desc,
+                               const BufferData*          pInitData,
+                               bool                       bIsDeviceInternal) :
+    TBufferBase{
+        pRefCounters,
+        BuffViewObjMemAllocator,
+        pDevice,
+        Desc,
+        bIsDeviceInternal,
+    }
+{
+    ValidateBufferInitData(m_Desc, pInitData);
+
+    if (m_Desc.Usage == USAGE_SPARSE)
+        LOG_ERROR_AND_THROW("Sparse resources are not supported in Null backend");
+
+    if (m_Desc.Usage == USAGE_DYNAMIC || m_Desc.Usage == USAGE_STAGING || m_Desc.Usage == USAGE_UNIFIED)
+    {
+        m_Data.resize(StaticCast<size_t>(m_Desc.Size));
+        if (pInitData != nullptr && pInitData->pData != nullptr)
+            memcpy(m_Data.data(), pInitData->pData, StaticCast<size_t>(std::min(m_Desc.Size, pInitData->DataSize)));
+    }
+
+    SetState(RESOURCE_STATE_UNDEFINED);
+    m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
+}
+
+SparseBufferProperties BufferNullImpl::GetSparseProperties() const
+{
+    DEV_ERROR("IBuffer::GetSparseProperties() is not supported in Null backend");
+    return {};
+}
+
+void BufferNullImpl::CreateViewInternal(const BufferViewDesc& OrigViewDesc, IBufferView** ppView, bool IsDefaultView)
+{
+    VERIFY(ppView != nullptr, "Null pointer provided");
+    if (!ppView) return;
+    VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    *ppView = nullptr;
+
+    try
+    {
+        RenderDeviceNullImpl* const pDeviceNull = GetDevice();
+
+        BufferViewDesc ViewDesc = OrigViewDesc;
+        ValidateAndCorrectBufferViewDesc(m_Desc, ViewDesc, pDeviceNull->GetAdapterInfo().Buffer.StructuredBufferOffsetAlignment);
+
+        FixedBlockMemoryAllocator& BuffViewAllocator = pDeviceNull->GetBuffViewObjAllocator();
+        VERIFY(&BuffViewAllocator == &m_dbgBuffViewAllocator, "Buffer view allocator does not match allocator provided at buffer initialization");
+
+        if (ViewDesc.ViewType == BUFFER_VIEW_UNORDERED_ACCESS || ViewDesc.ViewType == BUFFER_VIEW_SHADER_RESOURCE)
+            *ppView = NEW_RC_OBJ(BuffViewAllocator, "BufferViewNullImpl instance", BufferViewNullImpl, IsDefaultView ? this : nullptr)(pDeviceNull, ViewDesc, this, IsDefaultView, m_bIsDeviceInternal);
+
+        if (!IsDefaultView && *ppView)
+            (*ppView)->AddRef();
+    }
+    catch (const std::runtime_error&)
+    {
+        const char* ViewTypeName = GetBufferViewTypeLiteralName(OrigViewDesc.ViewType);
+        LOG_ERROR("Failed to create view \"", OrigViewDesc.Name ? OrigViewDesc.Name : "", "\" (", ViewTypeName, ") for buffer \"", m_Desc.Name, "\"");
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,617 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <cstring>
+
+#include "DeviceContextNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "ShaderResourceCacheNull.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+DeviceContextNullImpl::DeviceContextNullImpl(IReferenceCounters*      pRefCounters,
+                                             RenderDeviceNullImpl*    pDevice,
+                                             const DeviceContextDesc& Desc) :
+    // clang-format off
+    TDeviceContextBase
+    {
+        pRefCounters,
+        pDevice,
+        Desc
+    }
+// clang-format on
+{
+}
+
+void DeviceContextNullImpl::Begin(Uint32 ImmediateContextId)
+{
+    DEV_CHECK_ERR(ImmediateContextId == 0, "Null backend supports only one immediate context");
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+}
+
+void DeviceContextNullImpl::SetPipelineState(IPipelineState* pPipelineState)
+{
+    if (!TDeviceContextBase::SetPipelineState(pPipelineState, PipelineStateNullImpl::IID_InternalImpl))
+        return;
+
+    Uint32 DvpCompatibleSRBCount = 0;
+    PrepareCommittedResources(m_BindInfo, DvpCompatibleSRBCount);
+    // Commit all SRBs when PSO changes
+    m_BindInfo.StaleSRBMask |= m_BindInfo.ActiveSRBMask;
+}
+
+void DeviceContextNullImpl::TransitionShaderResources(IShaderResourceBinding* pShaderResourceBinding)
+{
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "Shader resource binding must not be null");
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void DeviceContextNullImpl::DvpValidateCommittedShaderResources()
+{
+    if (m_BindInfo.ResourcesValidated)
+        return;
+
+    DvpVerifySRBCompatibility(m_BindInfo);
+
+    m_BindInfo.ResourcesValidated = true;
+}
+#endif
+
+void DeviceContextNullImpl::CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
+                                                  RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
+
+    ShaderResourceBindingNullImpl* const pResBindingNull = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+#ifdef DILIGENT_DEBUG
+    pResBindingNull->GetResourceCache().DbgVerifyDynamicBuffersCounter();
+#endif
+    m_BindInfo.Set(pResBindingNull->GetBindingIndex(), pResBindingNull);
+}
+
+void DeviceContextNullImpl::InvalidateState()
+{
+    TDeviceContextBase::InvalidateState();
+    m_BindInfo.Reset();
+}
+
+void DeviceContextNullImpl::SetStencilRef(Uint32 StencilRef)
+{
+    TDeviceContextBase::SetStencilRef(StencilRef, 0);
+}
+
+void DeviceContextNullImpl::SetBlendFactors(const float* pBlendFactors)
+{
+    TDeviceContextBase::SetBlendFactors(pBlendFactors, 0);
+}
+
+void DeviceContextNullImpl::SetVertexBuffers(Uint32                         StartSlot,
+                                             Uint32                         NumBuffersSet,
+                                             IBuffer* const*                ppBuffers,
+                                             const Uint64*                  pOffsets,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                             SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+}
+
+void DeviceContextNullImpl::SetIndexBuffer(IBuffer*                       pIndexBuffer,
+                                           Uint64                         ByteOffset,
+                                           RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+}
+
+void DeviceContextNullImpl::SetViewports(Uint32          NumViewports,
+                                         const Viewport* pViewports,
+                                         Uint32          RTWidth,
+                                         Uint32          RTHeight)
+{
+    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+}
+
+void DeviceContextNullImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+}
+
+void DeviceContextNullImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    if (m_pActiveRenderPass != nullptr)
+    {
+        LOG_ERROR_MESSAGE("Calling SetRenderTargets inside active render pass is invalid. End the render pass first");
+        return;
+    }
+#endif
+
+    if (TDeviceContextBase::SetRenderTargets(Attribs))
+        SetViewports(1, nullptr, 0, 0);
+}
+
+void DeviceContextNullImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    TDeviceContextBase::BeginRenderPass(Attribs);
+}
+
+void DeviceContextNullImpl::NextSubpass()
+{
+    TDeviceContextBase::NextSubpass();
+}
+
+void DeviceContextNullImpl::EndRenderPass()
+{
+    TDeviceContextBase::EndRenderPass();
+}
+
+void DeviceContextNullImpl::PrepareForDraw(DRAW_FLAGS Flags)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    DvpVerifyRenderTargets();
+#endif
+    DEV_CHECK_ERR(m_pPipelineState != nullptr, "No PSO is bound in the context");
+
+#ifdef DILIGENT_DEVELOPMENT
+    if (m_NumVertexStreams < m_pPipelineState->GetNumBufferSlotsUsed())
+        LOG_ERROR("Currently bound pipeline state '", m_pPipelineState->GetDesc().Name, "' expects ", m_pPipelineState->GetNumBufferSlotsUsed(), " input buffer slots, but only ", m_NumVertexStreams, " is bound");
+#endif
+
+    // Resolve the SRBs that would need to be committed by a native backend and mark them as committed.
+    if (CommittedShaderResources::SRBMaskType CommitSRBMask = m_BindInfo.GetCommitMask(Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT))
+        m_BindInfo.StaleSRBMask &= ~CommitSRBMask;
+}
+
+void DeviceContextNullImpl::PrepareForDispatchCompute()
+{
+    DEV_CHECK_ERR(m_pPipelineState != nullptr, "No PSO is bound in the context");
+
+    if (CommittedShaderResources::SRBMaskType CommitSRBMask = m_BindInfo.GetCommitMask())
+        m_BindInfo.StaleSRBMask &= ~CommitSRBMask;
+}
+
+void DeviceContextNullImpl::Draw(const DrawAttribs& Attribs)
+{
+    TDeviceContextBase::Draw(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.NumVertices == 0 || Attribs.NumInstances == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDraw(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.NumInstances == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexed(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.NumIndices == 0 || Attribs.NumInstances == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.NumInstances == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndirect(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    UNSUPPORTED("DrawMesh is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("DrawMeshIndirect is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchCompute(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    if (Attribs.ThreadGroupCountX == 0 || Attribs.ThreadGroupCountY == 0 || Attribs.ThreadGroupCountZ == 0)
+        return;
+
+    PrepareForDispatchCompute();
+}
+
+void DeviceContextNullImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    PrepareForDispatchCompute();
+}
+
+void DeviceContextNullImpl::ClearDepthStencil(ITextureView*                  pView,
+                                              CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                              float                          fDepth,
+                                              Uint8                          Stencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearDepthStencil(pView);
+}
+
+void DeviceContextNullImpl::ClearRenderTarget(ITextureView*                  pView,
+                                              const void*                    RGBA,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearRenderTarget(pView);
+}
+
+void DeviceContextNullImpl::UpdateBuffer(IBuffer*                       pBuffer,
+                                         Uint64                         Offset,
+                                         Uint64                         Size,
+                                         const void*                    pData,
+                                         RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::UpdateBuffer(pBuffer, Offset, Size, pData, StateTransitionMode);
+
+    // Only buffers that are accessible by the CPU keep their contents in Null backend
+    BufferNullImpl* const pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    if (Uint8* pCPUAddress = pBufferNull->GetCPUAddress())
+        memcpy(pCPUAddress + Offset, pData, StaticCast<size_t>(Size));
+}
+
+void DeviceContextNullImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
+                                       Uint64                         SrcOffset,
+                                       RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                       IBuffer*                       pDstBuffer,
+                                       Uint64                         DstOffset,
+                                       Uint64                         Size,
+                                       RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
+
+    BufferNullImpl* const pSrcBufferNull = ClassPtrCast<BufferNullImpl>(pSrcBuffer);
+    BufferNullImpl* const pDstBufferNull = ClassPtrCast<BufferNullImpl>(pDstBuffer);
+
+    const Uint8* pSrcAddress = pSrcBufferNull->GetCPUAddress();
+    Uint8*       pDstAddress = pDstBufferNull->GetCPUAddress();
+    if (pSrcAddress != nullptr && pDstAddress != nullptr)
+        memmove(pDstAddress + DstOffset, pSrcAddress + SrcOffset, StaticCast<size_t>(Size));
+}
+
+void DeviceContextNullImpl::MapBuffer(IBuffer*  pBuffer,
+                                      MAP_TYPE  MapType,
+                                      MAP_FLAGS MapFlags,
+                                      PVoid&    pMappedData)
+{
+    TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
+
+    BufferNullImpl* const pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+
+    pMappedData = pBufferNull->GetCPUAddress();
+    DEV_CHECK_ERR(pMappedData != nullptr, "Buffer '", pBufferNull->GetDesc().Name, "' does not have CPU-accessible memory and can't be mapped");
+}
+
+void DeviceContextNullImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
+{
+    TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
+}
+
+void DeviceContextNullImpl::UpdateTexture(ITexture*                      pTexture,
+                                          Uint32                         MipLevel,
+                                          Uint32                         Slice,
+                                          const Box&                     DstBox,
+                                          const TextureSubResData&       SubresData,
+                                          RESOURCE_STATE_TRANSITION_MODE SrcBufferStateTransitionMode,
+                                          RESOURCE_STATE_TRANSITION_MODE TextureStateTransitionMode)
+{
+    TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferStateTransitionMode, TextureStateTransitionMode);
+}
+
+void DeviceContextNullImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    TDeviceContextBase::CopyTexture(CopyAttribs);
+}
+
+void DeviceContextNullImpl::MapTextureSubresource(ITexture*                 pTexture,
+                                                  Uint32                    MipLevel,
+                                                  Uint32                    ArraySlice,
+                                                  MAP_TYPE                  MapType,
+                                                  MAP_FLAGS                 MapFlags,
+                                                  const Box*                pMapRegion,
+                                                  MappedTextureSubresource& MappedData)
+{
+    TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
+
+    const TextureDesc&          TexDesc    = pTexture->GetDesc();
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(TexDesc.Format);
+    const MipLevelProperties    MipProps   = GetMipLevelProperties(TexDesc, MipLevel);
+
+    const MappedTextureKey MappedTexKey{pTexture->GetUniqueID(), MipLevel, ArraySlice};
+
+    auto it = m_MappedTextures.emplace(MappedTexKey, std::vector<Uint8>{}).first;
+    if (!it->second.empty())
+    {
+        LOG_ERROR_MESSAGE("Mip level ", MipLevel, ", slice ", ArraySlice, " of texture '", TexDesc.Name, "' has already been mapped");
+        MappedData = MappedTextureSubresource{};
+        return;
+    }
+    it->second.resize(StaticCast<size_t>(MipProps.MipSize));
+
+    Uint64 Offset = 0;
+    if (pMapRegion != nullptr)
+    {
+        Offset = pMapRegion->MinZ * MipProps.DepthSliceSize +
+            (pMapRegion->MinY / FmtAttribs.BlockHeight) * MipProps.RowSize +
+            (pMapRegion->MinX / FmtAttribs.BlockWidth) * FmtAttribs.GetElementSize();
+    }
+
+    MappedData.pData       = it->second.data() + Offset;
+    MappedData.Stride      = MipProps.RowSize;
+    MappedData.DepthStride = MipProps.DepthSliceSize;
+}
+
+void DeviceContextNullImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
+{
+    TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
+
+    const MappedTextureKey MappedTexKey{pTexture->GetUniqueID(), MipLevel, ArraySlice};
+
+    auto it = m_MappedTextures.find(MappedTexKey);
+    if (it == m_MappedTextures.end())
+    {
+        LOG_ERROR_MESSAGE("Failed to unmap mip level ", MipLevel, ", slice ", ArraySlice, " of texture '", pTexture->GetDesc().Name, "': the subresource is not mapped");
+        return;
+    }
+    m_MappedTextures.erase(it);
+}
+
+void DeviceContextNullImpl::FinishCommandList(ICommandList** ppCommandList)
+{
+    LOG_ERROR("Deferred contexts are not supported in Null backend");
+}
+
+void DeviceContextNullImpl::ExecuteCommandLists(Uint32 NumCommandLists, ICommandList* const* ppCommandLists)
+{
+    LOG_ERROR("Deferred contexts are not supported in Null backend");
+}
+
+void DeviceContextNullImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
+    ClassPtrCast<FenceNullImpl>(pFence)->EnqueueSignal(Value);
+}
+
+void DeviceContextNullImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::DeviceWaitForFence(pFence, Value, 0);
+    ClassPtrCast<FenceNullImpl>(pFence)->DvpDeviceWait(Value);
+}
+
+void DeviceContextNullImpl::WaitForIdle()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can be idled");
+}
+
+void DeviceContextNullImpl::BeginQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::BeginQuery(pQuery, 0);
+}
+
+void DeviceContextNullImpl::EndQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::EndQuery(pQuery, 0);
+}
+
+void DeviceContextNullImpl::Flush()
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
+}
+
+void DeviceContextNullImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyBLAS(const CopyBLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyTLAS(const CopyTLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteBLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteTLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::TraceRays(const TraceRaysAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRays is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRaysIndirect is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::UpdateSBT(IShaderBindingTable*                 pSBT,
+                                      const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs)
+{
+    UNSUPPORTED("UpdateSBT is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::SetShadingRate(SHADING_RATE          BaseRate,
+                                           SHADING_RATE_COMBINER PrimitiveCombiner,
+                                           SHADING_RATE_COMBINER TextureCombiner)
+{
+    UNSUPPORTED("SetShadingRate is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
+{
+    UNSUPPORTED("BindSparseResourceMemory is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BeginDebugGroup(const Char* Name, const float* pColor)
+{
+    TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
+}
+
+void DeviceContextNullImpl::EndDebugGroup()
+{
+    TDeviceContextBase::EndDebugGroup(0);
+}
+
+void DeviceContextNullImpl::InsertDebugLabel(const Char* Label, const float* pColor)
+{
+    TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
+}
+
+void DeviceContextNullImpl::GenerateMips(ITextureView* pTexView)
+{
+    TDeviceContextBase::GenerateMips(pTexView);
+}
+
+void DeviceContextNullImpl::FinishFrame()
+{
+    if (m_pActiveRenderPass != nullptr)
+        LOG_ERROR_MESSAGE("Finishing frame inside an active render pass.");
+
+    if (!m_MappedTextures.empty())
+        LOG_ERROR_MESSAGE("There are mapped textures in the device context when finishing the frame. All dynamic resources must be used in the same frame in which they are mapped.");
+
+    TDeviceContextBase::EndFrame();
+}
+
+void DeviceContextNullImpl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+
+    for (Uint32 i = 0; i < BarrierCount; ++i)
+    {
+        const StateTransitionDesc& Barrier = pResourceBarriers[i];
+#ifdef DILIGENT_DEVELOPMENT
+        DvpVerifyStateTransitionDesc(Barrier);
+#endif
+        if ((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0)
+            continue;
+
+        if (RefCntAutoPtr<ITexture> pTexture{Barrier.pResource, IID_Texture})
+        {
+            pTexture->SetState(Barrier.NewState);
+        }
+        else if (RefCntAutoPtr<IBuffer> pBuffer{Barrier.pResource, IID_Buffer})
+        {
+            pBuffer->SetState(Barrier.NewState);
+        }
+        else
+        {
+            UNEXPECTED("unsupported resource type");
+        }
+    }
+}
+
+void DeviceContextNullImpl::ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                      ITexture*                               pDstTexture,
+                                                      const ResolveTextureSubresourceAttribs& ResolveAttribs)
+{
+    TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+}
+
+} // namespace Diligent
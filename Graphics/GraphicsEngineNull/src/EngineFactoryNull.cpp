@@ -0,0 +1,336 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+/// \file
+/// Routines that initialize Null engine implementation
+
+#include "pch.h"
+
+#include <cstring>
+
+#include "EngineFactoryBase.hpp"
+#include "EngineFactoryNull.h"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "EngineMemory.h"
+
+#if PLATFORM_ANDROID
+#    include "FileSystem.hpp"
+#endif
+
+namespace Diligent
+{
+
+/// Engine factory for Null implementation
+class EngineFactoryNullImpl final : public EngineFactoryBase<IEngineFactoryNull>
+{
+public:
+    static EngineFactoryNullImpl* GetInstance()
+    {
+        static EngineFactoryNullImpl TheFactory;
+        return &TheFactory;
+    }
+
+    using TBase = EngineFactoryBase;
+
+    EngineFactoryNullImpl() :
+        TBase{IID_EngineFactoryNull}
+    {}
+
+    void DILIGENT_CALL_TYPE EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const override final;
+
+    void DILIGENT_CALL_TYPE CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
+                                             IDearchiver**               ppDearchiver) const override final;
+
+    void DILIGENT_CALL_TYPE CreateDeviceAndContextsNull(const EngineNullCreateInfo& EngineCI,
+                                                        IRenderDevice**             ppDevice,
+                                                        IDeviceContext**            ppContexts) override final;
+
+#if PLATFORM_ANDROID
+    void DILIGENT_CALL_TYPE InitAndroidFileSystem(struct AAssetManager* AssetManager,
+                                                  const char*           ExternalFilesDir,
+                                                  const char*           OutputFilesDir) const override final;
+#endif
+};
+
+namespace
+{
+
+DeviceFeatures GetSupportedFeatures()
+{
+    DeviceFeatures Features{DEVICE_FEATURE_STATE_ENABLED};
+
+    // Shaders are not compiled, so there is no reflection information
+    Features.ShaderResourceQueries = DEVICE_FEATURE_STATE_DISABLED;
+
+    // Features that require dedicated command or resource types not implemented by the Null backend
+    Features.MeshShaders                   = DEVICE_FEATURE_STATE_DISABLED;
+    Features.RayTracing                    = DEVICE_FEATURE_STATE_DISABLED;
+    Features.TileShaders                   = DEVICE_FEATURE_STATE_DISABLED;
+    Features.VariableRateShading           = DEVICE_FEATURE_STATE_DISABLED;
+    Features.SparseResources               = DEVICE_FEATURE_STATE_DISABLED;
+    Features.NativeFence                   = DEVICE_FEATURE_STATE_DISABLED;
+    Features.TransferQueueTimestampQueries = DEVICE_FEATURE_STATE_DISABLED;
+
+    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+
+    return Features;
+}
+
+GraphicsAdapterInfo GetGraphicsAdapterInfo()
+{
+    GraphicsAdapterInfo AdapterInfo{};
+
+    // Set graphics adapter properties
+    {
+        static constexpr char Description[] = "Diligent Null Device";
+        static_assert(sizeof(Description) <= sizeof(AdapterInfo.Description), "Description is too long");
+        memcpy(AdapterInfo.Description, Description, sizeof(Description));
+
+        AdapterInfo.Type       = ADAPTER_TYPE_SOFTWARE;
+        AdapterInfo.Vendor     = ADAPTER_VENDOR_UNKNOWN;
+        AdapterInfo.VendorId   = 0;
+        AdapterInfo.DeviceId   = 0;
+        AdapterInfo.NumOutputs = 0;
+    }
+
+    AdapterInfo.Features = GetSupportedFeatures();
+
+    // Set adapter memory info
+    {
+        AdapterMemoryInfo& MemoryInfo{AdapterInfo.Memory};
+        MemoryInfo.UnifiedMemory          = Uint64{1} << 32u;
+        MemoryInfo.MaxMemoryAllocation    = Uint64{1} << 32u;
+        MemoryInfo.UnifiedMemoryCPUAccess = CPU_ACCESS_READ | CPU_ACCESS_WRITE;
+    }
+
+    // Draw command properties
+    {
+        DrawCommandProperties& DrawCommandInfo{AdapterInfo.DrawCommand};
+        DrawCommandInfo.MaxIndexValue        = ~0u;
+        DrawCommandInfo.MaxDrawIndirectCount = ~0u;
+        DrawCommandInfo.CapFlags =
+            DRAW_COMMAND_CAP_FLAG_BASE_VERTEX |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_FIRST_INSTANCE |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER;
+    }
+
+    // Set queue info
+    {
+        AdapterInfo.NumQueues                           = 1;
+        AdapterInfo.Queues[0].QueueType                 = COMMAND_QUEUE_TYPE_GRAPHICS;
+        AdapterInfo.Queues[0].MaxDeviceContexts         = 1;
+        AdapterInfo.Queues[0].TextureCopyGranularity[0] = 1;
+        AdapterInfo.Queues[0].TextureCopyGranularity[1] = 1;
+        AdapterInfo.Queues[0].TextureCopyGranularity[2] = 1;
+    }
+
+    // Set compute shader info
+    {
+        ComputeShaderProperties& ComputeShaderInfo{AdapterInfo.ComputeShader};
+
+        ComputeShaderInfo.MaxThreadGroupSizeX = 1024;
+        ComputeShaderInfo.MaxThreadGroupSizeY = 1024;
+        ComputeShaderInfo.MaxThreadGroupSizeZ = 64;
+
+        ComputeShaderInfo.MaxThreadGroupCountX = 65535;
+        ComputeShaderInfo.MaxThreadGroupCountY = 65535;
+        ComputeShaderInfo.MaxThreadGroupCountZ = 65535;
+
+        ComputeShaderInfo.SharedMemorySize          = 32768;
+        ComputeShaderInfo.MaxThreadGroupInvocations = 1024;
+    }
+
+    // Set texture info
+    {
+        TextureProperties& TextureInfo{AdapterInfo.Texture};
+
+        TextureInfo.MaxTexture1DDimension   = 16384;
+        TextureInfo.MaxTexture1DArraySlices = 2048;
+        TextureInfo.MaxTexture2DDimension   = 16384;
+        TextureInfo.MaxTexture2DArraySlices = 2048;
+        TextureInfo.MaxTexture3DDimension   = 2048;
+        TextureInfo.MaxTextureCubeDimension = 16384;
+
+        TextureInfo.Texture2DMSSupported       = True;
+        TextureInfo.Texture2DMSArraySupported  = True;
+        TextureInfo.TextureViewSupported       = True;
+        TextureInfo.CubemapArraysSupported     = True;
+        TextureInfo.TextureView2DOn3DSupported = True;
+    }
+
+    // Set buffer info
+    {
+        BufferProperties& BufferInfo{AdapterInfo.Buffer};
+        BufferInfo.ConstantBufferOffsetAlignment   = 256;
+        BufferInfo.StructuredBufferOffsetAlignment = 16;
+    }
+
+    // Set sampler info
+    {
+        SamplerProperties& SamplerInfo{AdapterInfo.Sampler};
+        SamplerInfo.BorderSamplingModeSupported = True;
+        SamplerInfo.MaxAnisotropy               = 16;
+        SamplerInfo.LODBiasSupported            = True;
+    }
+
+    return AdapterInfo;
+}
+
+} // namespace
+
+void EngineFactoryNullImpl::EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const
+{
+    if (Adapters == nullptr)
+        NumAdapters = 1;
+    else
+    {
+        NumAdapters = (std::min)(NumAdapters, 1u);
+        if (NumAdapters > 0)
+            Adapters[0] = GetGraphicsAdapterInfo();
+    }
+}
+
+void EngineFactoryNullImpl::CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
+                                             IDearchiver**               ppDearchiver) const
+{
+    DEV_CHECK_ERR(ppDearchiver != nullptr, "ppDearchiver must not be null");
+    if (ppDearchiver == nullptr)
+        return;
+
+    LOG_ERROR_MESSAGE("Dearchiver is not supported in Null backend");
+    *ppDearchiver = nullptr;
+}
+
+void EngineFactoryNullImpl::CreateDeviceAndContextsNull(const EngineNullCreateInfo& EngineCI,
+                                                        IRenderDevice**             ppDevice,
+                                                        IDeviceContext**            ppImmediateContext)
+{
+    if (EngineCI.EngineAPIVersion != DILIGENT_API_VERSION)
+    {
+        LOG_ERROR_MESSAGE("Diligent Engine runtime (", DILIGENT_API_VERSION, ") is not compatible with the client API version (", EngineCI.EngineAPIVersion, ")");
+        return;
+    }
+
+    DEV_CHECK_ERR(ppDevice && ppImmediateContext, "Null pointer provided");
+    if (!ppDevice || !ppImmediateContext)
+        return;
+
+    if (EngineCI.NumImmediateContexts > 1)
+    {
+        LOG_ERROR_MESSAGE("Null backend doesn't support multiple immediate contexts");
+        return;
+    }
+
+    if (EngineCI.NumDeferredContexts > 0)
+    {
+        LOG_ERROR_MESSAGE("Null backend doesn't support deferred contexts");
+        return;
+    }
+
+    *ppDevice           = nullptr;
+    *ppImmediateContext = nullptr;
+
+    try
+    {
+        const GraphicsAdapterInfo AdapterInfo = GetGraphicsAdapterInfo();
+        VerifyEngineCreateInfo(EngineCI, AdapterInfo);
+
+        SetRawAllocator(EngineCI.pRawMemAllocator);
+        IMemoryAllocator& RawMemAllocator = GetRawAllocator();
+
+        RenderDeviceNullImpl* pRenderDeviceNull{
+            NEW_RC_OBJ(RawMemAllocator, "RenderDeviceNullImpl instance", RenderDeviceNullImpl)(
+                RenderDeviceNullImpl::CreateInfo{
+                    RawMemAllocator,
+                    this,
+                    EngineCI,
+                    AdapterInfo,
+                    AdapterInfo.Features,
+                })};
+        pRenderDeviceNull->QueryInterface(IID_RenderDevice, reinterpret_cast<IObject**>(ppDevice));
+
+        DeviceContextNullImpl* pDeviceContextNull{
+            NEW_RC_OBJ(RawMemAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                pRenderDeviceNull,
+                DeviceContextDesc{
+                    EngineCI.pImmediateContextInfo ? EngineCI.pImmediateContextInfo[0].Name : nullptr,
+                    pRenderDeviceNull->GetAdapterInfo().Queues[0].QueueType,
+                    False, // IsDeferred
+                    0,     // Context id
+                    0      // Queue id
+                })};
+        pDeviceContextNull->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppImmediateContext));
+        pRenderDeviceNull->SetImmediateContext(0, pDeviceContextNull);
+    }
+    catch (const std::runtime_error&)
+    {
+        if (*ppDevice)
+        {
+            (*ppDevice)->Release();
+            *ppDevice = nullptr;
+        }
+
+        if (*ppImmediateContext != nullptr)
+        {
+            (*ppImmediateContext)->Release();
+            *ppImmediateContext = nullptr;
+        }
+
+        LOG_ERROR("Failed to create Null render device and context");
+    }
+}
+
+#if PLATFORM_ANDROID
+void EngineFactoryNullImpl::InitAndroidFileSystem(struct AAssetManager* AssetManager,
+                                                  const char*           ExternalFilesDir,
+                                                  const char*           OutputFilesDir) const
+{
+    AndroidFileSystem::Init(AssetManager, ExternalFilesDir, OutputFilesDir);
+}
+#endif
+
+API_QUALIFIER IEngineFactoryNull* GetEngineFactoryNull()
+{
+    return EngineFactoryNullImpl::GetInstance();
+}
+
+} // namespace Diligent
+
+extern "C"
+{
+    API_QUALIFIER Diligent::IEngineFactoryNull* Diligent_GetEngineFactoryNull()
+    {
+        return Diligent::GetEngineFactoryNull();
+    }
+}
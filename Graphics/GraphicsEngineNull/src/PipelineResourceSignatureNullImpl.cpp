@@ -0,0 +1,239 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+PipelineResourceSignatureNullImpl::PipelineResourceSignatureNullImpl(IReferenceCounters*                  pRefCounters,
+                                                                     RenderDeviceNullImpl*                pDevice,
+                                                                     const PipelineResourceSignatureDesc& Desc,
+                                                                     SHADER_TYPE                          ShaderStages,
+                                                                     bool                                 bIsDeviceInternal) :
+    TPipelineResourceSignatureBase{pRefCounters, pDevice, Desc, ShaderStages, bIsDeviceInternal}
+{
+    try
+    {
+        Initialize(
+            GetRawAllocator(), Desc, /*CreateImmutableSamplers = */ true,
+            [this]() //
+            {
+                InitResourceLayout();
+            },
+            [this]() //
+            {
+                return ShaderResourceCacheNull::GetRequiredMemorySize(m_SRBCacheSize);
+            });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+void PipelineResourceSignatureNullImpl::InitResourceLayout()
+{
+    // Every resource occupies ArraySize consecutive slots in the cache. Resources in m_Desc.Resources are
+    // sorted by variable type, so static resources have the same offsets in the SRB and the static caches.
+    //
+    //      SRB cache:    |  Static   |  Mutable  |  Dynamic  |
+    //      Static cache: |  Static   |
+
+    // The total number of static resources in all stages accounting for array sizes,
+    // excluding separate samplers that are assigned immutable samplers.
+    Uint32 StaticResourceCount = 0;
+
+    // Index of the immutable sampler for every sampler in m_Desc.Resources, or InvalidImmutableSamplerIndex.
+    std::vector<Uint32> ResourceToImmutableSamplerInd(m_Desc.NumResources, InvalidImmutableSamplerIndex);
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER)
+        {
+            // Note that FindImmutableSampler() below will work properly both when combined texture samplers are used and when not.
+            ResourceToImmutableSamplerInd[i] = FindImmutableSampler(ResDesc.ShaderStages, ResDesc.Name);
+        }
+
+        if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC && ResourceToImmutableSamplerInd[i] == InvalidImmutableSamplerIndex)
+            StaticResourceCount += ResDesc.ArraySize;
+    }
+
+    // Initialize static resource cache
+    if (StaticResourceCount != 0)
+    {
+        VERIFY_EXPR(m_pStaticResCache != nullptr);
+        m_pStaticResCache->Initialize(GetRawAllocator(), StaticResourceCount);
+    }
+
+    Uint32 SRBCacheOffset    = 0;
+    Uint32 StaticCacheOffset = 0;
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        VERIFY(i == 0 || ResDesc.VarType >= m_Desc.Resources[i - 1].VarType, "Resources must be sorted by variable type");
+
+        Uint32 AssignedSamplerInd     = ResourceAttribs::InvalidSamplerInd;
+        Uint32 SrcImmutableSamplerInd = ResourceToImmutableSamplerInd[i];
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV)
+        {
+            VERIFY_EXPR(SrcImmutableSamplerInd == InvalidImmutableSamplerIndex);
+            AssignedSamplerInd = FindAssignedSampler(ResDesc, ResourceAttribs::InvalidSamplerInd);
+            if (AssignedSamplerInd != ResourceAttribs::InvalidSamplerInd)
+            {
+                SrcImmutableSamplerInd = ResourceToImmutableSamplerInd[AssignedSamplerInd];
+            }
+        }
+
+        const bool IsImmutableSampler = (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && SrcImmutableSamplerInd != InvalidImmutableSamplerIndex);
+        const bool IsStaticResource   = (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC && !IsImmutableSampler);
+
+        new (m_pResourceAttribs + i) ResourceAttribs{
+            AssignedSamplerInd,
+            ResDesc.ArraySize,
+            SrcImmutableSamplerInd != InvalidImmutableSamplerIndex,
+            SRBCacheOffset,
+            IsStaticResource ? StaticCacheOffset : ~0u,
+        };
+
+        if (IsStaticResource)
+        {
+            m_pStaticResCache->InitializeResources(StaticCacheOffset, ResDesc.ArraySize, ResDesc.ResourceType, m_pResourceAttribs[i].IsImmutableSamplerAssigned());
+            StaticCacheOffset += ResDesc.ArraySize;
+        }
+
+        SRBCacheOffset += ResDesc.ArraySize;
+    }
+    VERIFY_EXPR(StaticCacheOffset == StaticResourceCount);
+
+    m_SRBCacheSize = SRBCacheOffset;
+
+#ifdef DILIGENT_DEBUG
+    if (m_pStaticResCache != nullptr)
+        m_pStaticResCache->DbgVerifyResourceInitialization();
+#endif
+}
+
+PipelineResourceSignatureNullImpl::~PipelineResourceSignatureNullImpl()
+{
+    Destruct();
+}
+
+void PipelineResourceSignatureNullImpl::InitSRBResourceCache(ShaderResourceCacheNull& ResourceCache)
+{
+    IMemoryAllocator& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
+    ResourceCache.Initialize(CacheMemAllocator, m_SRBCacheSize);
+
+    const Uint32                   TotalResources = GetTotalResourceCount();
+    const ResourceCacheContentType CacheType      = ResourceCache.GetContentType();
+    for (Uint32 r = 0; r < TotalResources; ++r)
+    {
+        const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
+        const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+        ResourceCache.InitializeResources(Attr.CacheOffset(CacheType), ResDesc.ArraySize, ResDesc.ResourceType, Attr.IsImmutableSamplerAssigned());
+
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+        {
+            // Initialize immutable samplers
+            const Uint32 ImtblSamplerInd = FindImmutableSampler(ResDesc.ShaderStages, ResDesc.Name);
+            VERIFY_EXPR(ImtblSamplerInd != InvalidImmutableSamplerIndex);
+            if (const RefCntAutoPtr<SamplerNullImpl>& pSampler = m_pImmutableSamplers[ImtblSamplerInd])
+            {
+                for (Uint32 elem = 0; elem < ResDesc.ArraySize; ++elem)
+                    ResourceCache.SetResource(Attr.CacheOffset(CacheType) + elem, pSampler);
+            }
+        }
+    }
+
+#ifdef DILIGENT_DEBUG
+    ResourceCache.DbgVerifyResourceInitialization();
+#endif
+}
+
+void PipelineResourceSignatureNullImpl::CopyStaticResources(ShaderResourceCacheNull& DstResourceCache) const
+{
+    if (m_pStaticResCache == nullptr)
+        return;
+
+    // SrcResourceCache contains only static resources.
+    // In case of SRB, DstResourceCache contains static, mutable and dynamic resources.
+    // In case of Signature, DstResourceCache contains only static resources.
+    const ShaderResourceCacheNull&  SrcResourceCache = *m_pStaticResCache;
+    const std::pair<Uint32, Uint32> ResIdxRange      = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    const ResourceCacheContentType  SrcCacheType     = SrcResourceCache.GetContentType();
+    const ResourceCacheContentType  DstCacheType     = DstResourceCache.GetContentType();
+
+    for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
+    {
+        const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
+        const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+        VERIFY_EXPR(ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+        {
+            // Skip immutable samplers as they are initialized in InitSRBResourceCache()
+            continue;
+        }
+
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        {
+            const Uint32                             SrcCacheOffset = Attr.CacheOffset(SrcCacheType) + ArrInd;
+            const ShaderResourceCacheNull::Resource& SrcCachedRes   = SrcResourceCache.GetResource(SrcCacheOffset);
+            IDeviceObject*                           pObject        = SrcCachedRes.pObject;
+            if (pObject == nullptr)
+            {
+                if (DstCacheType == ResourceCacheContentType::SRB)
+                    LOG_ERROR_MESSAGE("No resource is assigned to static shader variable '", GetShaderResourcePrintName(ResDesc, ArrInd), "' in pipeline resource signature '", m_Desc.Name, "'.");
+                continue;
+            }
+
+            const Uint32                             DstCacheOffset = Attr.CacheOffset(DstCacheType) + ArrInd;
+            const ShaderResourceCacheNull::Resource& DstCachedRes   = const_cast<const ShaderResourceCacheNull&>(DstResourceCache).GetResource(DstCacheOffset);
+            VERIFY_EXPR(SrcCachedRes.Type == DstCachedRes.Type);
+
+            const IDeviceObject* pCachedResource = DstCachedRes.pObject;
+            if (pCachedResource != pObject)
+            {
+                DEV_CHECK_ERR(pCachedResource == nullptr, "Static resource has already been initialized, and the new resource does not match previously assigned resource");
+                DstResourceCache.SetResource(DstCacheOffset,
+                                             SrcCachedRes.pObject,
+                                             SrcCachedRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER ? SrcCachedRes.BufferBaseOffset : 0,
+                                             SrcCachedRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER ? SrcCachedRes.BufferRangeSize : 0);
+            }
+        }
+    }
+
+#ifdef DILIGENT_DEBUG
+    DstResourceCache.DbgVerifyDynamicBuffersCounter();
+#endif
+}
+
+} // namespace Diligent
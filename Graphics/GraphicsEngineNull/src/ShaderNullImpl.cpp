@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+constexpr INTERFACE_ID ShaderNullImpl::IID_InternalImpl;
+
+ShaderNullImpl::ShaderNullImpl(IReferenceCounters*     pRefCounters,
+                               RenderDeviceNullImpl*   pDevice,
+                               const ShaderCreateInfo& ShaderCI,
+                               const CreateInfo&       NullShaderCI,
+                               bool                    IsDeviceInternal) :
+    // clang-format off
+    TShaderBase
+    {
+        pRefCounters,
+        pDevice,
+        ShaderCI.Desc,
+        NullShaderCI.DeviceInfo,
+        NullShaderCI.AdapterInfo,
+        IsDeviceInternal
+    }
+// clang-format on
+{
+    if (ShaderCI.ByteCode != nullptr && ShaderCI.ByteCodeSize != 0)
+    {
+        const Uint8* pBytes = static_cast<const Uint8*>(ShaderCI.ByteCode);
+        m_Bytecode.assign(pBytes, pBytes + ShaderCI.ByteCodeSize);
+    }
+
+    m_Status.store(SHADER_STATUS_READY);
+}
+
+void ShaderNullImpl::GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const
+{
+    DEV_ERROR("Resource index (", Index, ") is out of range: shaders in Null backend have no resources");
+}
+
+const ShaderCodeBufferDesc* ShaderNullImpl::GetConstantBufferDesc(Uint32 Index) const
+{
+    UNEXPECTED("Resource index (", Index, ") is out of range: shaders in Null backend have no resources");
+    return nullptr;
+}
+
+void ShaderNullImpl::GetBytecode(const void** ppBytecode, Uint64& Size) const
+{
+    *ppBytecode = !m_Bytecode.empty() ? m_Bytecode.data() : nullptr;
+    Size        = m_Bytecode.size();
+}
+
+} // namespace Diligent
@@ -0,0 +1,217 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderResourceCacheNull.hpp"
+#include "EngineMemory.h"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+
+namespace Diligent
+{
+
+size_t ShaderResourceCacheNull::GetRequiredMemorySize(Uint32 NumResources)
+{
+    return NumResources * sizeof(Resource);
+}
+
+ShaderResourceCacheNull::ShaderResourceCacheNull(ResourceCacheContentType ContentType) noexcept :
+    m_TotalResources{0},
+    m_ContentType{static_cast<Uint32>(ContentType)}
+{
+}
+
+ShaderResourceCacheNull::~ShaderResourceCacheNull()
+{
+    if (m_pMemory)
+    {
+        Resource* pResources = GetFirstResourcePtr();
+        for (Uint32 res = 0; res < m_TotalResources; ++res)
+            pResources[res].~Resource();
+    }
+}
+
+void ShaderResourceCacheNull::Initialize(IMemoryAllocator& MemAllocator, Uint32 NumResources)
+{
+    VERIFY(!m_pMemory, "Memory has already been allocated");
+
+    m_TotalResources = NumResources;
+    VERIFY(m_TotalResources == NumResources, "NumResources (", NumResources, ") exceeds maximum representable value");
+
+#ifdef DILIGENT_DEBUG
+    m_DbgInitializedResources.resize(NumResources);
+#endif
+
+    const size_t MemorySize = GetRequiredMemorySize(NumResources);
+    if (MemorySize > 0)
+    {
+        m_pMemory = decltype(m_pMemory){
+            ALLOCATE_RAW(MemAllocator, "Memory for shader resource cache data", MemorySize),
+            STDDeleter<void, IMemoryAllocator>(MemAllocator),
+        };
+    }
+}
+
+void ShaderResourceCacheNull::InitializeResources(Uint32 Offset, Uint32 ArraySize, SHADER_RESOURCE_TYPE Type, bool HasImmutableSampler)
+{
+    VERIFY(Offset + ArraySize <= m_TotalResources, "Resource range is out of bounds");
+    Resource* pResources = GetFirstResourcePtr();
+    for (Uint32 res = 0; res < ArraySize; ++res)
+    {
+        new (pResources + Offset + res) Resource{Type, HasImmutableSampler};
+#ifdef DILIGENT_DEBUG
+        m_DbgInitializedResources[size_t{Offset} + res] = true;
+#endif
+    }
+}
+
+static const BufferNullImpl* GetCachedBuffer(const ShaderResourceCacheNull::Resource& Res)
+{
+    if (!Res.pObject)
+        return nullptr;
+
+    switch (Res.Type)
+    {
+        case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+            return Res.pObject.ConstPtr<BufferNullImpl>();
+
+        case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+        case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+            return Res.pObject.ConstPtr<BufferViewNullImpl>()->GetBuffer<const BufferNullImpl>();
+
+        default:
+            return nullptr;
+    }
+}
+
+static bool IsDynamicBuffer(const ShaderResourceCacheNull::Resource& Res)
+{
+    const BufferNullImpl* pBuffer = GetCachedBuffer(Res);
+    if (pBuffer == nullptr)
+        return false;
+
+    const BufferDesc& BuffDesc = pBuffer->GetDesc();
+
+    bool IsDynamic = (BuffDesc.Usage == USAGE_DYNAMIC);
+    if (!IsDynamic && Res.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER)
+    {
+        // Constant buffers that are not bound as a whole are also counted as dynamic as their offset may change
+        IsDynamic = (Res.BufferRangeSize != 0 && Res.BufferRangeSize < BuffDesc.Size);
+    }
+
+    return IsDynamic;
+}
+
+const ShaderResourceCacheNull::Resource& ShaderResourceCacheNull::SetResource(
+    Uint32                       CacheOffset,
+    RefCntAutoPtr<IDeviceObject> pObject,
+    Uint64                       BufferBaseOffset,
+    Uint64                       BufferRangeSize)
+{
+    VERIFY(CacheOffset < m_TotalResources, "Offset ", CacheOffset, " is out of range");
+    Resource& DstRes = GetFirstResourcePtr()[CacheOffset];
+
+    if (IsDynamicBuffer(DstRes))
+    {
+        VERIFY(m_NumDynamicBuffers > 0, "Dynamic buffers counter must be greater than zero when there is at least one dynamic buffer bound in the resource cache");
+        --m_NumDynamicBuffers;
+    }
+
+    DstRes.pObject             = std::move(pObject);
+    DstRes.BufferDynamicOffset = 0; // It is essential to reset dynamic offset
+    DstRes.BufferBaseOffset    = 0;
+    DstRes.BufferRangeSize     = 0;
+
+    if (DstRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER)
+    {
+        if (const BufferNullImpl* pBuffer = DstRes.pObject.ConstPtr<BufferNullImpl>())
+        {
+            VERIFY(BufferBaseOffset + BufferRangeSize <= pBuffer->GetDesc().Size, "Specified range is out of buffer bounds");
+            DstRes.BufferBaseOffset = BufferBaseOffset;
+            DstRes.BufferRangeSize  = BufferRangeSize != 0 ? BufferRangeSize : pBuffer->GetDesc().Size - BufferBaseOffset;
+        }
+    }
+    else if (DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV || DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV)
+    {
+        VERIFY(BufferBaseOffset == 0 && BufferRangeSize == 0, "Buffer range can only be specified for constant buffers");
+        if (const BufferViewNullImpl* pBuffView = DstRes.pObject.ConstPtr<BufferViewNullImpl>())
+        {
+            DstRes.BufferBaseOffset = pBuffView->GetDesc().ByteOffset;
+            DstRes.BufferRangeSize  = pBuffView->GetDesc().ByteWidth;
+        }
+    }
+    else
+    {
+        VERIFY(BufferBaseOffset == 0 && BufferRangeSize == 0, "Buffer range can only be specified for constant buffers");
+    }
+
+    if (IsDynamicBuffer(DstRes))
+    {
+        ++m_NumDynamicBuffers;
+    }
+
+    UpdateRevision();
+
+    return DstRes;
+}
+
+void ShaderResourceCacheNull::SetDynamicBufferOffset(Uint32 CacheOffset,
+                                                     Uint32 DynamicBufferOffset)
+{
+    VERIFY(CacheOffset < m_TotalResources, "Offset ", CacheOffset, " is out of range");
+    Resource& DstRes = GetFirstResourcePtr()[CacheOffset];
+
+    DEV_CHECK_ERR(DstRes.pObject, "Setting dynamic offset when no object is bound");
+    const BufferNullImpl* pBuffer = GetCachedBuffer(DstRes);
+    DEV_CHECK_ERR(pBuffer != nullptr && DstRes.BufferBaseOffset + DstRes.BufferRangeSize + DynamicBufferOffset <= pBuffer->GetDesc().Size,
+                  "Specified offset is out of buffer bounds");
+
+    DstRes.BufferDynamicOffset = DynamicBufferOffset;
+}
+
+#ifdef DILIGENT_DEBUG
+void ShaderResourceCacheNull::DbgVerifyResourceInitialization() const
+{
+    for (bool ResInitialized : m_DbgInitializedResources)
+        VERIFY(ResInitialized, "Not all resources in the cache have been initialized. This is a bug.");
+}
+
+void ShaderResourceCacheNull::DbgVerifyDynamicBuffersCounter() const
+{
+    const Resource* pResources        = GetFirstResourcePtr();
+    Uint32          NumDynamicBuffers = 0;
+    for (Uint32 res = 0; res < m_TotalResources; ++res)
+    {
+        if (IsDynamicBuffer(pResources[res]))
+            ++NumDynamicBuffers;
+    }
+    VERIFY(NumDynamicBuffers == m_NumDynamicBuffers, "The number of dynamic buffers (", m_NumDynamicBuffers, ") does not match the actual number (", NumDynamicBuffers, ")");
+}
+#endif
+
+} // namespace Diligent
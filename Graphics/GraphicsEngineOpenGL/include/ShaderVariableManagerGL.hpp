@@ -94,6 +94,14 @@ public:
                                         Uint32                                 NumAllowedTypes,
                                         SHADER_TYPE                            ShaderType);
 
+    // Writes the index of the variable that Initialize() creates for every resource in the given
+    // shader stage to pVarIndices[ResIndex]. Elements for resources without variables are not modified.
+    static void GetVariableIndices(const PipelineResourceSignatureGLImpl& Signature,
+                                   const SHADER_RESOURCE_VARIABLE_TYPE*   AllowedVarTypes,
+                                   Uint32                                 NumAllowedTypes,
+                                   SHADER_TYPE                            ShaderType,
+                                   Uint32*                                pVarIndices);
+
     using ResourceAttribs = PipelineResourceAttribsGL;
 
     // These two methods can't be implemented in the header because they depend on PipelineResourceSignatureGLImpl
@@ -87,6 +87,42 @@ size_t ShaderVariableManagerGL::GetRequiredMemorySize(const PipelineResourceSign
     return RequiredSize;
 }
 
+void ShaderVariableManagerGL::GetVariableIndices(const PipelineResourceSignatureGLImpl& Signature,
+                                                 const SHADER_RESOURCE_VARIABLE_TYPE*   AllowedVarTypes,
+                                                 Uint32                                 NumAllowedTypes,
+                                                 SHADER_TYPE                            ShaderType,
+                                                 Uint32*                                pVarIndices)
+{
+    // Variables are grouped by binding range in the same order as in GetVariable()
+    const ResourceCounters Counters = CountResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType);
+
+    Uint32 UBInd      = 0;
+    Uint32 TextureInd = UBInd + Counters.NumUBs;
+    Uint32 ImageInd   = TextureInd + Counters.NumTextures;
+    Uint32 SSBOInd    = ImageInd + Counters.NumImages;
+
+    Signature.ProcessResources(
+        AllowedVarTypes, NumAllowedTypes, ShaderType,
+        [&](const PipelineResourceDesc& ResDesc, Uint32 Index) //
+        {
+            if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER)
+                return;
+
+            static_assert(BINDING_RANGE_COUNT == 4, "Please update the switch below to handle the new shader resource range");
+            switch (PipelineResourceToBindingRange(ResDesc))
+            {
+                // clang-format off
+                case BINDING_RANGE_UNIFORM_BUFFER: pVarIndices[Index] = UBInd++;      break;
+                case BINDING_RANGE_TEXTURE:        pVarIndices[Index] = TextureInd++; break;
+                case BINDING_RANGE_IMAGE:          pVarIndices[Index] = ImageInd++;   break;
+                case BINDING_RANGE_STORAGE_BUFFER: pVarIndices[Index] = SSBOInd++;    break;
+                // clang-format on
+                default:
+                    UNEXPECTED("Unsupported resource type.");
+            }
+        });
+}
+
 void ShaderVariableManagerGL::Initialize(const PipelineResourceSignatureGLImpl& Signature,
                                          IMemoryAllocator&                      Allocator,
                                          const SHADER_RESOURCE_VARIABLE_TYPE*   AllowedVarTypes,
@@ -30,6 +30,8 @@
 /// \file
 /// Declaration of Diligent::BufferVkImpl class
 
+#include <atomic>
+
 #include "EngineVkImplTraits.hpp"
 #include "BufferBase.hpp"
 #include "BufferViewVkImpl.hpp" // Required by BufferBase
@@ -101,7 +103,19 @@ public:
         return reinterpret_cast<Uint8*>(m_MemoryAllocation.Page->GetCPUMemory()) + m_BufferMemoryAlignedOffset;
     }
 
+    const VulkanUtilities::MemoryAllocation& GetMemoryAllocation() const { return m_MemoryAllocation; }
+
+    // Returns true if the buffer can be moved to another memory location by the defragmentation (see MemoryDefragmenter).
+    bool IsRelocatable() const;
+
+    // Returns true if the buffer is used by a deferred context that is recording commands or by
+    // a command list that has not been executed yet. Such command lists reference the Vulkan
+    // buffer handle, so the buffer must not be relocated (see DeferredBufferReferences).
+    bool IsReferencedByDeferredCommands() const { return m_DeferredCommandRefs.load() != 0; }
+
 private:
+    friend class DeferredBufferReferences;
+
     friend class DeviceContextVkImpl;
 
     virtual void CreateViewInternal(const struct BufferViewDesc& ViewDesc, IBufferView** ppView, bool bIsDefaultView) override;
@@ -113,6 +127,15 @@ private:
 
     VulkanUtilities::BufferWrapper    m_VulkanBuffer;
     VulkanUtilities::MemoryAllocation m_MemoryAllocation;
+
+    // The number of deferred contexts and command lists that reference the buffer
+    std::atomic<Uint32> m_DeferredCommandRefs{0};
+
+    // Usage flags the Vulkan buffer was created with
+    VkBufferUsageFlags m_VkUsage = 0;
+
+    // Device address of the buffer created with VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT, except for sparse buffers
+    VkDeviceAddress m_DeviceAddress = 0;
 };
 
 } // namespace Diligent
@@ -33,6 +33,7 @@
 #include "EngineVkImplTraits.hpp"
 #include "VulkanUtilities/VulkanHeaders.h"
 #include "CommandListBase.hpp"
+#include "MemoryDefragmenter.hpp"
 
 namespace Diligent
 {
@@ -43,14 +44,16 @@ class CommandListVkImpl final : public CommandListBase<EngineVkImplTraits>
 public:
     using TCommandListBase = CommandListBase<EngineVkImplTraits>;
 
-    CommandListVkImpl(IReferenceCounters*  pRefCounters,
-                      RenderDeviceVkImpl*  pDevice,
-                      DeviceContextVkImpl* pDeferredCtx,
-                      VkCommandBuffer      vkCmdBuff) :
+    CommandListVkImpl(IReferenceCounters*        pRefCounters,
+                      RenderDeviceVkImpl*        pDevice,
+                      DeviceContextVkImpl*       pDeferredCtx,
+                      VkCommandBuffer            vkCmdBuff,
+                      DeferredBufferReferences&& BufferRefs) :
         // clang-format off
         TCommandListBase {pRefCounters, pDevice, pDeferredCtx},
-        m_pDeferredCtx   {pDeferredCtx},
-        m_vkCmdBuff      {vkCmdBuff   }
+        m_pDeferredCtx   {pDeferredCtx         },
+        m_vkCmdBuff      {vkCmdBuff            },
+        m_BufferRefs     {std::move(BufferRefs)}
     // clang-format on
     {
     }
@@ -65,11 +68,15 @@ public:
         outVkCmdBuff   = m_vkCmdBuff;
         outDeferredCtx = std::move(m_pDeferredCtx);
         m_vkCmdBuff    = VK_NULL_HANDLE;
+        // The command buffer is submitted to the same queue that releases the memory of relocated
+        // buffers, so the buffers can be moved once the command list is executed.
+        m_BufferRefs.Clear();
     }
 
 private:
     RefCntAutoPtr<IDeviceContext> m_pDeferredCtx;
     VkCommandBuffer               m_vkCmdBuff;
+    DeferredBufferReferences      m_BufferRefs;
 };
 
 } // namespace Diligent
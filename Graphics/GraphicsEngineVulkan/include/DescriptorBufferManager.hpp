@@ -0,0 +1,289 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// Descriptor buffer management utilities (VK_EXT_descriptor_buffer).
+
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+#include "VulkanUtilities/ObjectWrappers.hpp"
+#include "VulkanUtilities/LogicalDevice.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+
+namespace Diligent
+{
+
+class DescriptorBufferManager;
+class RenderDeviceVkImpl;
+
+// Describes the placement of descriptors of one descriptor set layout in the descriptor buffer.
+// Descriptors are indexed by the offset in the resource cache (see ShaderResourceCacheVk):
+// bindings in every descriptor set are ordered the same way as the resources in the cache.
+struct DescriptorBufferSetLayout
+{
+    struct Descriptor
+    {
+        // Offset of the descriptor from the beginning of the set data
+        Uint32 Offset = 0;
+
+        // Size of the descriptor. For combined image samplers that are stored as two separate
+        // arrays (see combinedImageSamplerDescriptorSingleArray), this is the size of the image part.
+        Uint32 Size = 0;
+
+        // Offset of the sampler part of the combined image sampler, if it is stored in a separate array
+        Uint32 SamplerOffset = ~0u;
+
+        // Immutable sampler of the combined image sampler or separate sampler
+        VkSampler ImmutableSampler = VK_NULL_HANDLE;
+    };
+
+    // The total size of the set data in the descriptor buffer
+    VkDeviceSize Size = 0;
+
+    // The size of the data written by vkGetDescriptorEXT for a combined image sampler
+    Uint32 CombinedImageSamplerSize = 0;
+
+    // Whether the set data is kept in the persistent allocation owned by the resource cache (static/mutable set).
+    // Otherwise, the data is written to the dynamic descriptor buffer every time the set is bound (dynamic set).
+    bool Persistent = false;
+
+    // Descriptors indexed by the resource cache offset
+    std::vector<Descriptor> Descriptors;
+
+    // Immutable sampler descriptors that never change and must be written once when the set data is initialized.
+    // This includes immutable separate samplers as well as immutable samplers that are not associated with any resource.
+    std::vector<Descriptor> ImmutableSamplers;
+
+    // Writes immutable sampler descriptors to the set data
+    void WriteImmutableSamplers(const VulkanUtilities::LogicalDevice& LogicalDevice, Uint8* pSetData) const;
+};
+
+
+// Represents a range of the descriptor buffer that holds the data of a descriptor set.
+// The class destructor returns the range to the manager through the release queue.
+class DescriptorBufferAllocation
+{
+public:
+    // clang-format off
+    DescriptorBufferAllocation(VkDeviceSize             _Offset,
+                               VkDeviceSize             _UnalignedOffset,
+                               VkDeviceSize             _Size,
+                               Uint8*                   _pData,
+                               Uint64                   _CmdQueueMask,
+                               DescriptorBufferManager& _Manager) noexcept :
+        Offset         {_Offset         },
+        UnalignedOffset{_UnalignedOffset},
+        Size           {_Size           },
+        pData          {_pData          },
+        CmdQueueMask   {_CmdQueueMask   },
+        pManager       {&_Manager       }
+    {}
+    DescriptorBufferAllocation() noexcept {}
+
+    DescriptorBufferAllocation             (const DescriptorBufferAllocation&) = delete;
+    DescriptorBufferAllocation& operator = (const DescriptorBufferAllocation&) = delete;
+
+    DescriptorBufferAllocation(DescriptorBufferAllocation&& rhs) noexcept :
+        Offset         {rhs.Offset         },
+        UnalignedOffset{rhs.UnalignedOffset},
+        Size           {rhs.Size           },
+        pData          {rhs.pData          },
+        CmdQueueMask   {rhs.CmdQueueMask   },
+        pManager       {rhs.pManager       }
+    {
+        rhs.Reset();
+    }
+    // clang-format on
+
+    DescriptorBufferAllocation& operator=(DescriptorBufferAllocation&& rhs) noexcept
+    {
+        Release();
+
+        Offset          = rhs.Offset;
+        UnalignedOffset = rhs.UnalignedOffset;
+        Size            = rhs.Size;
+        pData           = rhs.pData;
+        CmdQueueMask    = rhs.CmdQueueMask;
+        pManager        = rhs.pManager;
+
+        rhs.Reset();
+
+        return *this;
+    }
+
+    explicit operator bool() const
+    {
+        return pManager != nullptr;
+    }
+
+    void Reset()
+    {
+        Offset          = 0;
+        UnalignedOffset = 0;
+        Size            = 0;
+        pData           = nullptr;
+        CmdQueueMask    = 0;
+        pManager        = nullptr;
+    }
+
+    void Release();
+
+    ~DescriptorBufferAllocation()
+    {
+        Release();
+    }
+
+    // Offset of the set data from the beginning of the descriptor buffer
+    VkDeviceSize GetOffset() const { return Offset; }
+
+    // CPU address of the set data
+    Uint8* GetCPUAddress() const { return pData; }
+
+    // The size of the allocation, which may be larger than the requested size due to alignment
+    VkDeviceSize GetSize() const { return Size - (Offset - UnalignedOffset); }
+
+    // Sets the mask of the command queues that may use the allocation when it is released
+    void SetCommandQueueMask(Uint64 QueueMask) { CmdQueueMask = QueueMask; }
+
+private:
+    VkDeviceSize             Offset          = 0;
+    VkDeviceSize             UnalignedOffset = 0;
+    VkDeviceSize             Size            = 0;
+    Uint8*                   pData           = nullptr;
+    Uint64                   CmdQueueMask    = 0;
+    DescriptorBufferManager* pManager        = nullptr;
+};
+
+
+// The class manages the global descriptor buffer. The buffer is allocated in host-visible coherent
+// memory and is persistently mapped, so that descriptors are written directly by the CPU.
+// All descriptor sets are suballocated from a single buffer, so that the buffer is bound to the
+// command buffer only once.
+//      ________________________________________________________
+//     |                                                        |
+//     |                  DescriptorBufferManager               |
+//     |                                                        |
+//     |  | Set data | Set data |  Page  |  ...  |  Set data |  |
+//     |________________________________________________________|
+//              |                   A
+//   Allocate() |                   | Free() (through the release queue)
+//              V                   |
+//
+class DescriptorBufferManager
+{
+public:
+    DescriptorBufferManager(RenderDeviceVkImpl& DeviceVkImpl, VkDeviceSize Size) noexcept(false);
+    ~DescriptorBufferManager();
+
+    // clang-format off
+    DescriptorBufferManager             (const DescriptorBufferManager&) = delete;
+    DescriptorBufferManager& operator = (const DescriptorBufferManager&) = delete;
+    DescriptorBufferManager             (DescriptorBufferManager&&)      = delete;
+    DescriptorBufferManager& operator = (DescriptorBufferManager&&)      = delete;
+    // clang-format on
+
+    // Allocates Size bytes from the descriptor buffer. The allocation is aligned by descriptorBufferOffsetAlignment.
+    DescriptorBufferAllocation Allocate(Uint64 CommandQueueMask, VkDeviceSize Size);
+
+    // Releases Vulkan objects. Must be called before the device is destroyed.
+    void Destroy();
+
+    VkDeviceAddress    GetDeviceAddress() const { return m_DeviceAddress; }
+    Uint8*             GetCPUAddress() const { return m_CPUAddress; }
+    VkBufferUsageFlags GetUsage() const { return m_Usage; }
+    VkDeviceSize       GetOffsetAlignment() const { return m_OffsetAlignment; }
+
+    RenderDeviceVkImpl& GetDeviceVkImpl() { return m_DeviceVkImpl; }
+
+#ifdef DILIGENT_DEVELOPMENT
+    Int32 GetAllocationCounter() const
+    {
+        return m_AllocationCounter.load();
+    }
+#endif
+
+private:
+    friend class DescriptorBufferAllocation;
+    void Free(VkDeviceSize Offset, VkDeviceSize Size, Uint64 CmdQueueMask);
+
+    RenderDeviceVkImpl& m_DeviceVkImpl;
+
+    VulkanUtilities::BufferWrapper       m_VkBuffer;
+    VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
+    Uint8*                               m_CPUAddress    = nullptr;
+    VkDeviceAddress                      m_DeviceAddress = 0;
+    const VkBufferUsageFlags             m_Usage;
+    const VkDeviceSize                   m_OffsetAlignment;
+
+    std::mutex                     m_Mutex;
+    VariableSizeAllocationsManager m_AllocationsMgr;
+    size_t                         m_PeakUsedSize = 0;
+
+#ifdef DILIGENT_DEVELOPMENT
+    std::atomic<Int32> m_AllocationCounter{0};
+#endif
+};
+
+
+// DynamicDescriptorBufferAllocator is used by the device context to write dynamic descriptor sets.
+// It requests pages from the global descriptor buffer manager and linearly suballocates set data from them.
+// The class is not thread-safe as device contexts must not be used in multiple threads simultaneously.
+// All allocated pages are recycled at the end of every frame.
+class DynamicDescriptorBufferAllocator
+{
+public:
+    DynamicDescriptorBufferAllocator(DescriptorBufferManager& Manager, std::string Name, VkDeviceSize PageSize) :
+        // clang-format off
+        m_GlobalMgr{Manager        },
+        m_Name     {std::move(Name)},
+        m_PageSize {PageSize       }
+    // clang-format on
+    {}
+    ~DynamicDescriptorBufferAllocator();
+
+    // Allocates Size bytes and returns the offset of the data from the beginning of the descriptor buffer.
+    // The CPU address of the data is written to pData.
+    VkDeviceSize Allocate(VkDeviceSize Size, Uint8*& pData);
+
+    // Releases all allocated pages that are later returned to the global manager.
+    void ReleasePages(Uint64 QueueMask);
+
+    size_t GetAllocatedPageCount() const { return m_AllocatedPages.size(); }
+
+private:
+    DescriptorBufferManager&                m_GlobalMgr;
+    const std::string                       m_Name;
+    const VkDeviceSize                      m_PageSize;
+    std::vector<DescriptorBufferAllocation> m_AllocatedPages;
+    VkDeviceSize                            m_CurrOffset    = 0;
+    size_t                                  m_PeakPageCount = 0;
+};
+
+} // namespace Diligent
@@ -57,8 +57,10 @@
 #include "VulkanDynamicHeap.hpp"
 #include "ResourceReleaseQueue.hpp"
 #include "DescriptorPoolManager.hpp"
+#include "DescriptorBufferManager.hpp"
 #include "HashUtils.hpp"
 #include "ManagedVulkanObject.hpp"
+#include "MemoryDefragmenter.hpp"
 
 namespace Diligent
 {
@@ -321,6 +323,13 @@ public:
     /// Implementation of IDeviceContextVk::GetVkCommandBuffer().
     virtual VkCommandBuffer DILIGENT_CALL_TYPE GetVkCommandBuffer() override final;
 
+    /// Implementation of IDeviceContextVk::DefragmentMemory().
+    virtual Bool DILIGENT_CALL_TYPE DefragmentMemory(const MemoryDefragmentationAttribsVk& Attribs) override final;
+
+    // Moves the buffer to the memory allocated in a fuller page and records the commands
+    // that copy its data. Returns false if there is no suitable memory (see MemoryDefragmenter).
+    bool RelocateBuffer(BufferVkImpl& BufferVk);
+
     // Transitions BLAS state from OldState to NewState, and optionally updates internal state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal BLAS state is used as old state.
     void TransitionBLASState(BottomLevelASVkImpl& BLAS,
@@ -408,6 +417,9 @@ public:
 
     __forceinline size_t GetDynamicBufferOffset(const BufferVkImpl* pBuffer, bool VerifyAllocation = true);
 
+    // Returns the device address of the buffer data, taking the current dynamic allocation into account
+    __forceinline VkDeviceAddress GetDynamicBufferDeviceAddress(const BufferVkImpl* pBuffer, bool VerifyAllocation = true);
+
 #ifdef DILIGENT_DEVELOPMENT
     void DvpVerifyDynamicAllocation(const BufferVkImpl* pBuffer) const;
 #endif
@@ -419,6 +431,7 @@ private:
     void               CommitVkVertexBuffers();
     void               CommitViewports();
     void               CommitScissorRects();
+    void               CommitDynamicGraphicsState(const PipelineStateVkImpl::DynamicGraphicsState& State);
 
     void Flush(Uint32               NumCommandLists,
                ICommandList* const* ppCommandLists);
@@ -447,6 +460,19 @@ private:
 
     void AliasingBarrier(IDeviceObject* pResourceBefore, IDeviceObject* pResourceAfter);
 
+    // Transitions the resource described by an immediate or split state transition barrier.
+    void TransitionResourceState(const StateTransitionDesc& Barrier);
+
+    // Records the first half of the split barrier (requires synchronization2).
+    void BeginSplitBarrier(const StateTransitionDesc& Barrier);
+
+    // Records the second half of the split barrier. Returns false if there is no matching
+    // begin-split barrier in the current command buffer.
+    bool EndSplitBarrier(const StateTransitionDesc& Barrier);
+
+    // Completes begin-split barriers that have not been ended in the current command buffer.
+    void ResolveSplitBarriers();
+
     __forceinline void EnsureVkCmdBuffer()
     {
         VERIFY_EXPR(m_CmdPool != nullptr);
@@ -514,11 +540,18 @@ private:
         /// Current graphics PSO uses no depth/render targets.
         bool NullRenderTargets = false;
 
+        /// Whether m_CommittedDynamicState holds the states set in the command buffer,
+        /// see EngineVkCreateInfo::UseExtendedDynamicState.
+        bool DynamicGraphicsStateValid = false;
+
         Uint32 NumCommands = 0;
 
         VkPipelineBindPoint vkPipelineBindPoint = VK_PIPELINE_BIND_POINT_MAX_ENUM;
     } m_State;
 
+    // Dynamic graphics states that were last set in the command buffer.
+    PipelineStateVkImpl::DynamicGraphicsState m_CommittedDynamicState;
+
     // Graphics/mesh, compute, ray tracing
     static constexpr Uint32 NUM_PIPELINE_BIND_POINTS = 3;
 
@@ -531,6 +564,11 @@ private:
             // Static/mutable and dynamic descriptor sets
             std::array<VkDescriptorSet, MAX_DESCR_SET_PER_SIGNATURE> vkSets = {};
 
+            // Signature whose dynamic resources are written into the push descriptor set by
+            // CommitDescriptorSets(), or null if the signature does not use push descriptors.
+            // The push descriptor set has no corresponding element in vkSets.
+            const PipelineResourceSignatureVkImpl* pPushSetSignature = nullptr;
+
             // Descriptor set base index given by Layout.GetFirstDescrSetIndex
             Uint32 BaseInd = 0;
 
@@ -538,6 +576,10 @@ private:
             // Note that this is not the actual number of dynamic buffers in the resource cache.
             Uint32 DynamicOffsetCount = 0;
 
+            // Offsets of the static/mutable and dynamic set data in the descriptor buffer.
+            // Only used when descriptor buffers are enabled, in which case vkSets are always null.
+            std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE> DescrBufferOffsets = {};
+
 #ifdef DILIGENT_DEVELOPMENT
             // The descriptor set base index that was used in the last BindDescriptorSets() call
             Uint32 LastBoundBaseInd = ~0u;
@@ -555,6 +597,7 @@ private:
     __forceinline ResourceBindInfo& GetBindInfo(PIPELINE_TYPE Type);
 
     __forceinline void CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    void               CommitDescriptorBufferSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo);
 #endif
@@ -565,9 +608,15 @@ private:
     /// Memory to store dynamic buffer offsets for descriptor sets.
     std::vector<Uint32> m_DynamicBufferOffsets;
 
+    /// Memory to store descriptor data for dynamic descriptor set update templates.
+    std::vector<Uint8> m_DescriptorTemplateData;
+
     /// Temporary array used by CommitDescriptorSets
     std::array<VkDescriptorSet, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)> m_DescriptorSets = {};
 
+    /// Temporary array of descriptor buffer offsets used by CommitDescriptorBufferSets
+    std::array<VkDeviceSize, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)> m_DescriptorBufferOffsets = {};
+
     /// Render pass that matches currently bound render targets.
     /// This render pass may or may not be currently set in the command buffer
     VkRenderPass m_vkRenderPass = VK_NULL_HANDLE;
@@ -581,6 +630,9 @@ private:
 
     FixedBlockMemoryAllocator m_CmdListAllocator;
 
+    /// Relocatable buffers used by the deferred context since the last FinishCommandList()
+    DeferredBufferReferences m_DeferredBufferRefs;
+
     // Semaphores are not owned by the command context
     std::vector<RefCntAutoPtr<ManagedSemaphore>>    m_WaitManagedSemaphores;
     std::vector<RefCntAutoPtr<ManagedSemaphore>>    m_SignalManagedSemaphores;
@@ -598,6 +650,26 @@ private:
     std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>> m_SignalFences;
     std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>> m_WaitFences;
 
+    struct PendingSplitBarrier
+    {
+        // Keeps the resource alive until the barrier is ended
+        RefCntAutoPtr<IDeviceObject> pResource;
+
+        StateTransitionDesc Desc;
+
+        VulkanUtilities::EventWrapper                Event;
+        VulkanUtilities::CommandBuffer::SplitBarrier Barrier;
+    };
+    // Begin-split barriers recorded in the current command buffer
+    std::vector<PendingSplitBarrier> m_PendingSplitBarriers;
+
+    // Split barriers that were completed by ResolveSplitBarriers() before the matching
+    // end-split barrier. They are kept until the end of the frame.
+    std::vector<std::pair<RefCntAutoPtr<IDeviceObject>, StateTransitionDesc>> m_ResolvedSplitBarriers;
+
+    // Events of ended or resolved split barriers that are returned to the pool at the end of the frame
+    std::vector<VulkanUtilities::EventWrapper> m_StaleSplitBarrierEvents;
+
     struct MappedTextureKey
     {
         TextureVkImpl* const Texture;
@@ -644,6 +716,13 @@ private:
     VulkanDynamicHeap             m_DynamicHeap;
     DynamicDescriptorSetAllocator m_DynamicDescrSetAllocator;
 
+    // Allocator for the descriptor set data that is written every time the set is bound.
+    // Null if descriptor buffers are not used.
+    std::unique_ptr<DynamicDescriptorBufferAllocator> m_pDynamicDescrBufferAllocator;
+
+    // Device address of the global dynamic buffer, see VulkanDynamicMemoryManager::GetVkDeviceAddress()
+    VkDeviceAddress m_DynamicBufferDeviceAddress = 0;
+
     // In Vulkan we can't bind null vertex buffer, so we have to create a dummy VB
     RefCntAutoPtr<BufferVkImpl> m_DummyVB;
 
@@ -677,4 +756,16 @@ __forceinline size_t DeviceContextVkImpl::GetDynamicBufferOffset(const BufferVkI
         0;
 }
 
+__forceinline VkDeviceAddress DeviceContextVkImpl::GetDynamicBufferDeviceAddress(const BufferVkImpl* pBuffer, bool VerifyAllocation)
+{
+    VERIFY_EXPR(pBuffer != nullptr);
+
+    if (pBuffer->m_VulkanBuffer != VK_NULL_HANDLE)
+        return pBuffer->GetVkDeviceAddress();
+
+    // Dynamic buffers without backing buffer are suballocated from the global dynamic buffer
+    VERIFY(m_DynamicBufferDeviceAddress != 0, "Dynamic buffer device address is only available when descriptor buffers are used");
+    return m_DynamicBufferDeviceAddress + GetDynamicBufferOffset(pBuffer, VerifyAllocation);
+}
+
 } // namespace Diligent
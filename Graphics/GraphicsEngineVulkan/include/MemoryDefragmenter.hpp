@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::MemoryDefragmenter class
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+
+#include "DeviceContextVk.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+class BufferVkImpl;
+class DeviceContextVkImpl;
+
+// The defragmenter keeps track of the buffers that can be moved to another memory location
+// by copying their data on the GPU (see IDeviceContextVk::DefragmentMemory).
+//
+//   Page A (10% used)       Page B (70% used)
+//  | VB |              |   | IB | VB | VB |    |
+//    |                                     A
+//    '-------------------------------------'
+//             vkCmdCopyBuffer
+//
+// Buffers are moved from the least occupied pages to the fuller pages of the same
+// memory type, so that the emptied pages can be released by the memory manager.
+// Only buffers that are bound by their Vulkan handle (vertex, index and indirect
+// argument buffers) can be moved, as there are no descriptors or views that reference them.
+// The registry holds weak references, so it does not keep buffers alive.
+// Buffers that are referenced by deferred contexts or command lists that have not been
+// executed are skipped (see DeferredBufferReferences).
+class MemoryDefragmenter
+{
+public:
+    MemoryDefragmenter() noexcept {}
+
+    // clang-format off
+    MemoryDefragmenter             (const MemoryDefragmenter&) = delete;
+    MemoryDefragmenter             (MemoryDefragmenter&&)      = delete;
+    MemoryDefragmenter& operator = (const MemoryDefragmenter&) = delete;
+    MemoryDefragmenter& operator = (MemoryDefragmenter&&)      = delete;
+    // clang-format on
+
+    // Registers the buffer if it can be moved by the defragmentation.
+    void RegisterBuffer(BufferVkImpl* pBuffer);
+
+    // Moves buffers used by the context's command queue until one of the limits is reached.
+    // Returns true if there are more buffers that can be moved.
+    bool Defragment(DeviceContextVkImpl& Ctx, const MemoryDefragmentationAttribsVk& Attribs);
+
+    Uint64 GetNumBytesMoved() const { return m_NumBytesMoved.load(); }
+    Uint32 GetNumAllocationsMoved() const { return m_NumAllocationsMoved.load(); }
+
+private:
+    std::mutex                               m_Mutex;
+    std::vector<RefCntWeakPtr<BufferVkImpl>> m_Buffers;
+
+    std::atomic<Uint64> m_NumBytesMoved{0};
+    std::atomic<Uint32> m_NumAllocationsMoved{0};
+};
+
+// Deferred contexts record Vulkan buffer handles into command lists that are executed later.
+// The set holds the relocatable buffers that are used by a deferred context while it records
+// commands, and is then moved to the command list. The buffers can't be relocated until the
+// set is cleared when the command list is executed or destroyed.
+class DeferredBufferReferences
+{
+public:
+    DeferredBufferReferences() noexcept {}
+    ~DeferredBufferReferences();
+
+    // clang-format off
+    DeferredBufferReferences             (const DeferredBufferReferences&) = delete;
+    DeferredBufferReferences& operator = (const DeferredBufferReferences&) = delete;
+    // clang-format on
+
+    DeferredBufferReferences(DeferredBufferReferences&& rhs) noexcept;
+    DeferredBufferReferences& operator=(DeferredBufferReferences&& rhs) noexcept;
+
+    // Adds the buffer to the set if it is relocatable.
+    void Add(BufferVkImpl& Buffer);
+
+    // Releases all references.
+    void Clear();
+
+private:
+    std::unordered_map<BufferVkImpl*, RefCntAutoPtr<BufferVkImpl>> m_Buffers;
+};
+
+} // namespace Diligent
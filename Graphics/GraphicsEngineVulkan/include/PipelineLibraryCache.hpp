@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineLibraryCache class
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <functional>
+
+#include "PipelineState.h"
+#include "RefCntAutoPtr.hpp"
+#include "VulkanUtilities/ObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+class PipelineResourceSignatureVkImpl;
+
+// Graphics pipeline sub-state that a pipeline library depends on.
+struct PipelineLibraryKey
+{
+    // Graphics pipeline states the library depends on. The states it does not depend on
+    // are left default-initialized. The input layout is kept in LayoutElements and Semantics.
+    GraphicsPipelineDesc  Desc;
+    VkPipelineCreateFlags Flags = 0;
+
+    std::vector<VkDynamicState> DynamicStates;
+
+    // Input layout elements with null semantic names, and the names
+    std::vector<LayoutElement> LayoutElements;
+    std::vector<std::string>   Semantics;
+
+    struct ShaderInfo
+    {
+        SHADER_TYPE           Type = SHADER_TYPE_UNKNOWN;
+        std::vector<uint32_t> SPIRV;
+        std::string           EntryPoint;
+
+        bool operator==(const ShaderInfo& rhs) const
+        {
+            return Type == rhs.Type && EntryPoint == rhs.EntryPoint && SPIRV == rhs.SPIRV;
+        }
+    };
+    std::vector<ShaderInfo> Shaders;
+
+    // Non-null resource signatures that define the pipeline layout.
+    // Keys that reference released signatures never match other keys.
+    std::vector<RefCntWeakPtr<PipelineResourceSignatureVkImpl>> Signatures;
+
+    size_t Hash = 0;
+
+    void SetInputLayout(const InputLayoutDesc& InputLayout);
+};
+
+// Caches graphics pipeline libraries (VK_EXT_graphics_pipeline_library).
+// A graphics pipeline is split into four parts that are compiled independently
+// and are shared by all pipelines with identical sub-states:
+//
+//   | Vertex input | Pre-rasterization shaders | Fragment shader | Fragment output |
+//
+// Every part is identified by the full sub-state it depends on, see PipelineLibraryKey.
+// Libraries are owned by the pipeline states that use them, and the cache holds
+// weak references, so a library is released when the last pipeline state that uses it is destroyed.
+class PipelineLibraryCache
+{
+public:
+    enum LIBRARY_PART : Uint32
+    {
+        LIBRARY_PART_VERTEX_INPUT = 0,
+        LIBRARY_PART_PRE_RASTERIZATION,
+        LIBRARY_PART_FRAGMENT_SHADER,
+        LIBRARY_PART_FRAGMENT_OUTPUT,
+        LIBRARY_PART_COUNT
+    };
+
+    using LibraryPtr = std::shared_ptr<const VulkanUtilities::PipelineWrapper>;
+
+    PipelineLibraryCache() noexcept {}
+
+    // clang-format off
+    PipelineLibraryCache             (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache             (PipelineLibraryCache&&)      = delete;
+    PipelineLibraryCache& operator = (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache& operator = (PipelineLibraryCache&&)      = delete;
+    // clang-format on
+
+    ~PipelineLibraryCache();
+
+    using CreateLibraryHandlerType = std::function<VulkanUtilities::PipelineWrapper()>;
+
+    // Returns the library for the given part and sub-state.
+    // If there is no such library in the cache, it is created by CreateLibrary.
+    // The library is created outside of the lock, so that other threads are not blocked
+    // while it is being compiled.
+    LibraryPtr GetLibrary(LIBRARY_PART Part, PipelineLibraryKey Key, const CreateLibraryHandlerType& CreateLibrary) noexcept(false);
+
+    // Releases all references. Must be called before the device is destroyed.
+    void Destroy();
+
+private:
+    static size_t ComputeKeyHash(const PipelineLibraryKey& Key);
+    static bool   KeysEqual(PipelineLibraryKey& Key0, PipelineLibraryKey& Key1);
+
+    LibraryPtr FindLibrary(LIBRARY_PART Part, PipelineLibraryKey& Key);
+    void       PurgeExpiredEntries();
+
+    struct LibraryEntry
+    {
+        PipelineLibraryKey                                    Key;
+        std::weak_ptr<const VulkanUtilities::PipelineWrapper> pLibrary;
+    };
+
+    std::mutex m_Mutex;
+
+    // Entries are indexed by the key hash
+    std::array<std::unordered_multimap<size_t, LibraryEntry>, LIBRARY_PART_COUNT> m_Libraries;
+
+    // Entries of released libraries are purged when the number of entries exceeds the threshold
+    size_t m_PurgeThreshold = 256;
+};
+
+} // namespace Diligent
@@ -199,5 +199,18 @@ inline VkDescriptorType DescriptorTypeToVkDescriptorType(DescriptorType Type)
     }
 }
 
+// Descriptor set layouts used with descriptor buffers must not contain descriptors with dynamic offsets.
+// Buffers with dynamic offsets use regular descriptors whose address includes the offset.
+inline VkDescriptorType DescriptorTypeToVkDescriptorBufferType(DescriptorType Type)
+{
+    const VkDescriptorType vkType = DescriptorTypeToVkDescriptorType(Type);
+    switch (vkType)
+    {
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC: return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        default: return vkType;
+    }
+}
+
 
 } // namespace Diligent
@@ -31,6 +31,7 @@
 /// Declaration of Diligent::PipelineResourceSignatureVkImpl class
 
 #include <array>
+#include <vector>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineResourceSignatureBase.hpp"
@@ -43,7 +44,9 @@
 
 #include "PipelineResourceAttribsVk.hpp"
 #include "VulkanUtilities/ObjectWrappers.hpp"
+#include "VulkanUtilities/CommandBuffer.hpp"
 #include "SRBMemoryAllocator.hpp"
+#include "DescriptorBufferManager.hpp"
 
 namespace Diligent
 {
@@ -123,6 +126,20 @@ public:
     bool   HasDescriptorSet(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId] != VK_NULL_HANDLE; }
     Uint32 GetDescriptorSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescriptorSetSizes[SetId]; }
 
+    // Returns true if the dynamic descriptor set is a push descriptor set, see EngineVkCreateInfo::UsePushDescriptors.
+    bool HasPushDescriptorSet() const { return m_UsePushDescriptorSet; }
+
+    // Returns true if the descriptor set layouts were created for descriptor buffers, see EngineVkCreateInfo::UseDescriptorBuffers.
+    bool UsesDescriptorBuffer() const { return m_UseDescriptorBuffer; }
+
+    // Returns the descriptor buffer layout of the set with index SetIndex in the resource cache
+    const DescriptorBufferSetLayout& GetDescriptorBufferLayout(Uint32 SetIndex) const
+    {
+        VERIFY(m_UseDescriptorBuffer, "This signature does not use descriptor buffers");
+        VERIFY_EXPR(SetIndex < GetNumDescriptorSets());
+        return m_DescriptorBufferLayouts[SetIndex];
+    }
+
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
     // Copies static resources from the static resource cache to the destination cache
@@ -130,9 +147,26 @@ public:
     // Make the base class method visible
     using TPipelineResourceSignatureBase::CopyStaticResources;
 
-    // Commits dynamic resources from ResourceCache to vkDynamicDescriptorSet
+    // Commits dynamic resources from ResourceCache to vkDynamicDescriptorSet.
+    // TemplateData is the scratch memory used to write the descriptor update template data.
     void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                VkDescriptorSet              vkDynamicDescriptorSet) const;
+                                VkDescriptorSet              vkDynamicDescriptorSet,
+                                std::vector<Uint8>&          TemplateData) const;
+
+    // Pushes dynamic resources from ResourceCache into the push descriptor set with index SetIndex
+    // in the pipeline layout vkPipelineLayout.
+    void PushDynamicResources(const ShaderResourceCacheVk&    ResourceCache,
+                              VulkanUtilities::CommandBuffer& CmdBuffer,
+                              VkPipelineBindPoint             vkBindPoint,
+                              VkPipelineLayout                vkPipelineLayout,
+                              Uint32                          SetIndex) const;
+
+    // Writes all descriptors of the set with index SetIndex in ResourceCache to the descriptor buffer set data.
+    // Descriptors with dynamic offsets use the current dynamic allocations of pCtx.
+    void WriteDescriptorBufferSet(const ShaderResourceCacheVk& ResourceCache,
+                                  Uint32                       SetIndex,
+                                  Uint8*                       pSetData,
+                                  DeviceContextVkImpl*         pCtx) const;
 
 #ifdef DILIGENT_DEVELOPMENT
     /// Verifies committed resource using the SPIRV resource attributes from the PSO.
@@ -178,21 +212,50 @@ private:
 
     void CreateSetLayouts(bool IsSerialized);
 
+    void CreateDynamicSetUpdateTemplate();
+
+    void InitDescriptorBufferLayouts();
+
+    // Writes descriptors of all dynamic resources to pData using the dynamic set update template layout.
+    // Returns false if any resource is null, in which case the template can't be used.
+    bool WriteDynamicSetTemplateData(const ShaderResourceCacheVk& ResourceCache, Uint8* pData) const;
+
+    // Prepares descriptor writes for all dynamic resources in ResourceCache and passes them to
+    // FlushWrites(Uint32 WriteCount, const VkWriteDescriptorSet* pWrites) in batches.
+    template <typename FlushWritesHandlerType>
+    void WriteDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                               VkDescriptorSet              vkDynamicDescriptorSet,
+                               FlushWritesHandlerType&&     FlushWrites) const;
+
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
 
 private:
     std::array<VulkanUtilities::DescriptorSetLayoutWrapper, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrSetLayouts;
 
+    // Descriptor update template that writes all dynamic resources (except for immutable samplers)
+    // from the tightly packed data array of m_DynamicSetTemplateDataSize bytes.
+    VulkanUtilities::DescrUpdateTemplateWrapper m_DynamicSetUpdateTemplate;
+    Uint32                                      m_DynamicSetTemplateDataSize = 0;
+
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
+    // Descriptor buffer set layouts indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
+    std::array<DescriptorBufferSetLayout, MAX_DESCRIPTOR_SETS> m_DescriptorBufferLayouts;
+
     // The total number of uniform buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicUniformBufferCount = 0;
     // The total number storage buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicStorageBufferCount = 0;
+
+    // Whether the dynamic descriptor set layout was created with VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR flag
+    bool m_UsePushDescriptorSet = false;
+
+    // Whether the descriptor set layouts were created with VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT flag
+    bool m_UseDescriptorBuffer = false;
 };
 
 template <> Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE>() const;
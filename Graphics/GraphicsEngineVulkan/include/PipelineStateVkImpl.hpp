@@ -32,6 +32,7 @@
 
 #include <array>
 #include <memory>
+#include <atomic>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineStateBase.hpp"
@@ -41,6 +42,7 @@
 #include "FixedBlockMemoryAllocator.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "PipelineLayoutVk.hpp"
+#include "PipelineLibraryCache.hpp"
 #include "VulkanUtilities/ObjectWrappers.hpp"
 #include "VulkanUtilities/CommandBuffer.hpp"
 
@@ -69,10 +71,55 @@ public:
     virtual IRenderPassVk* DILIGENT_CALL_TYPE GetRenderPass() const override final { return GetRenderPassPtr().RawPtr<IRenderPassVk>(); }
 
     /// Implementation of IPipelineStateVk::GetVkPipeline().
-    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final { return m_Pipeline; }
+    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final
+    {
+        // When the pipeline was quickly linked from pipeline libraries, the optimized
+        // pipeline replaces it as soon as it is built in the background.
+        if (m_pSharedPipelineOwner)
+            return m_pSharedPipelineOwner->GetVkPipeline();
+
+        return m_OptimizedPipelineReady.load() ? m_OptimizedPipeline : m_Pipeline;
+    }
 
     const PipelineLayoutVk& GetPipelineLayout() const { return m_PipelineLayout; }
 
+    // Graphics pipeline states that are set by the device context when the pipeline is bound,
+    // see EngineVkCreateInfo::UseExtendedDynamicState.
+    struct DynamicGraphicsState
+    {
+        // VK_EXT_extended_dynamic_state
+        VkCullModeFlags     CullMode          = VK_CULL_MODE_NONE;
+        VkFrontFace         FrontFace         = VK_FRONT_FACE_CLOCKWISE;
+        VkPrimitiveTopology Topology          = VK_PRIMITIVE_TOPOLOGY_MAX_ENUM; // MAX_ENUM for mesh pipelines
+        VkBool32            DepthTestEnable   = VK_FALSE;
+        VkBool32            DepthWriteEnable  = VK_FALSE;
+        VkCompareOp         DepthCompareOp    = VK_COMPARE_OP_NEVER;
+        VkBool32            StencilTestEnable = VK_FALSE;
+        VkStencilOpState    StencilFront      = {};
+        VkStencilOpState    StencilBack       = {};
+
+        // VK_EXT_extended_dynamic_state2
+        VkBool32 PrimitiveRestartEnable  = VK_FALSE;
+        uint32_t PatchControlPoints      = 0;
+        VkBool32 DepthBiasEnable         = VK_FALSE;
+        float    DepthBiasConstantFactor = 0;
+        float    DepthBiasClamp          = 0;
+        float    DepthBiasSlopeFactor    = 0;
+
+        // VK_EXT_extended_dynamic_state3
+        VkPolygonMode PolygonMode         = VK_POLYGON_MODE_FILL;
+        VkBool32      DepthClampEnable    = VK_FALSE;
+        Uint32        NumColorAttachments = 0;
+
+        std::array<VkBool32, MAX_RENDER_TARGETS>                ColorBlendEnable   = {};
+        std::array<VkColorBlendEquationEXT, MAX_RENDER_TARGETS> ColorBlendEquation = {};
+        std::array<VkColorComponentFlags, MAX_RENDER_TARGETS>   ColorWriteMask     = {};
+    };
+
+    // Returns the dynamic graphics state, or null if extended dynamic state is not used
+    // or this is not a graphics pipeline.
+    const DynamicGraphicsState* GetDynamicGraphicsState() const { return m_pDynamicState.get(); }
+
     struct ShaderStageInfo
     {
         ShaderStageInfo() {}
@@ -141,6 +188,23 @@ private:
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayoutVk                 m_PipelineLayout;
 
+    // Pipeline built from pipeline libraries with link-time optimization in the background,
+    // see EngineVkCreateInfo::UseGraphicsPipelineLibrary.
+    VulkanUtilities::PipelineWrapper  m_OptimizedPipeline;
+    std::atomic<bool>                 m_OptimizedPipelineReady{false};
+    std::unique_ptr<AsyncInitializer> m_LinkTimeOptimizer;
+
+    // Pipeline libraries the pipeline was linked from. The libraries are shared with other
+    // pipeline states and are released when the last pipeline state that uses them is destroyed.
+    std::array<PipelineLibraryCache::LibraryPtr, PipelineLibraryCache::LIBRARY_PART_COUNT> m_PipelineLibraries;
+
+    // Dynamic graphics states, see EngineVkCreateInfo::UseExtendedDynamicState.
+    std::unique_ptr<DynamicGraphicsState> m_pDynamicState;
+
+    // Pipeline state whose Vulkan pipeline is used by this pipeline state as they only differ by dynamic states.
+    // The owner also keeps alive the render pass the pipeline was created with.
+    RefCntAutoPtr<PipelineStateVkImpl> m_pSharedPipelineOwner;
+
 #ifdef DILIGENT_DEVELOPMENT
     // Shader resources for all shaders in all shader stages
     TShaderResources m_ShaderResources;
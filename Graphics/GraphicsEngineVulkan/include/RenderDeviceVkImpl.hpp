@@ -30,6 +30,7 @@
 /// \file
 /// Declaration of Diligent::RenderDeviceVkImpl class
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -47,6 +48,10 @@
 #include "VulkanUtilities/MemoryManager.hpp"
 
 #include "DescriptorPoolManager.hpp"
+#include "DescriptorBufferManager.hpp"
+#include "PipelineLibraryCache.hpp"
+#include "SharedPipelineCache.hpp"
+#include "MemoryDefragmenter.hpp"
 #include "VulkanDynamicHeap.hpp"
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
@@ -228,12 +233,43 @@ public:
     /// Implementation of IRenderDeviceVk::GetDeviceFeaturesVk().
     virtual void DILIGENT_CALL_TYPE GetDeviceFeaturesVk(DeviceFeaturesVk& FeaturesVk) const override final;
 
+    /// Implementation of IRenderDeviceVk::GetMemoryStatsVk().
+    virtual void DILIGENT_CALL_TYPE GetMemoryStatsVk(MemoryStatsVk& Stats) override final;
+
+    /// Implementation of IRenderDeviceVk::GetPipelineStatsVk().
+    virtual void DILIGENT_CALL_TYPE GetPipelineStatsVk(PipelineStatsVk& Stats) override final;
+
     DescriptorSetAllocation AllocateDescriptorSet(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "")
     {
         return m_DescriptorSetAllocator.Allocate(CommandQueueMask, SetLayout, DebugName);
     }
     DescriptorPoolManager& GetDynamicDescriptorPool() { return m_DynamicDescriptorPool; }
 
+    // Returns an unsignaled event for a split barrier.
+    VulkanUtilities::EventWrapper GetSplitBarrierEvent();
+
+    // Returns the events to the pool once all command buffers that use them in the queues
+    // from QueueMask are complete.
+    void DisposeSplitBarrierEvents(std::vector<VulkanUtilities::EventWrapper>&& Events, Uint64 QueueMask);
+
+    // Returns true if descriptors are written into the descriptor buffer instead of descriptor sets,
+    // see EngineVkCreateInfo::UseDescriptorBuffers.
+    bool UseDescriptorBuffers() const { return m_LogicalDevice->GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE; }
+
+    // Returns the descriptor buffer manager, or null if descriptor buffers are not used.
+    DescriptorBufferManager* GetDescriptorBufferManager() { return m_pDescriptorBufferMgr.get(); }
+
+    // Returns the graphics pipeline library cache, or null if pipeline libraries are not used,
+    // see EngineVkCreateInfo::UseGraphicsPipelineLibrary.
+    PipelineLibraryCache* GetPipelineLibraryCache() { return m_pPipelineLibraryCache.get(); }
+
+    // Returns the cache of graphics pipelines shared by pipeline states that only differ by dynamic states,
+    // or null if extended dynamic state is not used, see EngineVkCreateInfo::UseExtendedDynamicState.
+    SharedPipelineCache* GetSharedPipelineCache() { return m_pSharedPipelineCache.get(); }
+
+    // Returns the registry of buffers that can be moved by the memory defragmentation.
+    MemoryDefragmenter& GetMemoryDefragmenter() { return m_MemoryDefragmenter; }
+
     std::shared_ptr<const VulkanUtilities::Instance> GetInstance() const { return m_Instance; }
 
     const VulkanUtilities::PhysicalDevice& GetPhysicalDevice() const { return *m_PhysicalDevice; }
@@ -263,8 +299,9 @@ public:
 
     struct Properties
     {
-        Uint32 UploadHeapPageSize  = 0;
-        Uint32 DynamicHeapPageSize = 0;
+        Uint32 UploadHeapPageSize              = 0;
+        Uint32 DynamicHeapPageSize             = 0;
+        Uint32 DynamicDescriptorBufferPageSize = 0;
     };
 
     const Properties& GetProperties() const { return m_Properties; }
@@ -296,6 +333,8 @@ private:
                              std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pFences);
 
 private:
+    void RecycleSplitBarrierEvents(std::vector<VulkanUtilities::EventWrapper>&& Events);
+
     const Properties m_Properties;
 
     std::shared_ptr<VulkanUtilities::Instance>       m_Instance;
@@ -308,6 +347,10 @@ private:
     DescriptorSetAllocator m_DescriptorSetAllocator;
     DescriptorPoolManager  m_DynamicDescriptorPool;
 
+    // Events reused by split barriers
+    std::mutex                                 m_SplitBarrierEventsMtx;
+    std::vector<VulkanUtilities::EventWrapper> m_SplitBarrierEvents;
+
     // These one-time command pools are used by buffer and texture constructors to
     // issue copy commands. Vulkan requires that every command pool is used by one thread
     // at a time, so every constructor must allocate command buffer from its own pool.
@@ -320,6 +363,17 @@ private:
 
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
+    MemoryDefragmenter m_MemoryDefragmenter;
+
+    // Global descriptor buffer, only created when descriptor buffers are used
+    std::unique_ptr<DescriptorBufferManager> m_pDescriptorBufferMgr;
+
+    // Graphics pipeline libraries, only created when pipeline libraries are used
+    std::unique_ptr<PipelineLibraryCache> m_pPipelineLibraryCache;
+
+    // Graphics pipelines shared between pipeline states, only created when extended dynamic state is used
+    std::unique_ptr<SharedPipelineCache> m_pSharedPipelineCache;
+
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
 };
 
@@ -44,7 +44,7 @@ namespace Diligent
 class PipelineResourceSignatureVkImpl;
 
 /// Implementation of the Diligent::IShaderResourceBindingVk interface
-// sizeof(ShaderResourceBindingVkImpl) == 64 (x64, msvc, Release)
+// sizeof(ShaderResourceBindingVkImpl) == 72 (x64, msvc, Release)
 class ShaderResourceBindingVkImpl final : public ShaderResourceBindingBase<EngineVkImplTraits>
 {
 public:
@@ -55,6 +55,11 @@ public:
     ~ShaderResourceBindingVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ShaderResourceBindingVk, TBase)
+
+    /// Implementation of IShaderResourceBinding::SetResources() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetResources(const ShaderResourceVariableBinding* pBindings,
+                                                 Uint32                               NumBindings,
+                                                 SET_SHADER_RESOURCE_FLAGS            Flags) override final;
 };
 
 } // namespace Diligent
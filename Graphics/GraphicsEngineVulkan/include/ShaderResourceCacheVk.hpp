@@ -52,11 +52,16 @@
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
+//
+// When descriptor buffers are used (see EngineVkCreateInfo::UseDescriptorBuffers), persistent sets hold
+// a range of the descriptor buffer instead of the Vulkan descriptor set.
 
+#include <array>
 #include <vector>
 #include <memory>
 
 #include "DescriptorPoolManager.hpp"
+#include "DescriptorBufferManager.hpp"
 #include "SPIRVShaderResources.hpp"
 #include "BufferVkImpl.hpp"
 #include "ShaderResourceCacheCommon.hpp"
@@ -68,7 +73,7 @@ namespace Diligent
 
 class DeviceContextVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 32 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
@@ -129,6 +134,14 @@ public:
         VkWriteDescriptorSetAccelerationStructureKHR GetAccelerationStructureWriteInfo() const;
         // clang-format on
 
+        // Writes the descriptor of the resource to the descriptor buffer set data.
+        // If pCtx is not null, the current dynamic offsets of the buffer are applied to the descriptor address.
+        void WriteDescriptorBufferData(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                       const DescriptorBufferSetLayout&      Layout,
+                                       Uint32                                CacheOffset,
+                                       Uint8*                                pSetData,
+                                       DeviceContextVkImpl*                  pCtx) const;
+
         template <DescriptorType DescrType>
         auto GetDescriptorWriteInfo() const;
 
@@ -140,7 +153,7 @@ public:
         explicit operator bool() const { return !IsNull(); }
     };
 
-    // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
+    // sizeof(DescriptorSet) == 104 (x64, msvc, Release)
     class DescriptorSet
     {
     public:
@@ -169,12 +182,19 @@ public:
             return m_DescriptorSetAllocation.GetVkDescriptorSet();
         }
 
+        const DescriptorBufferAllocation& GetDescriptorBufferAllocation() const
+        {
+            return m_DescriptorBufferAllocation;
+        }
+
     private:
         // clang-format off
-/* 0 */ const Uint32            m_NumResources = 0;
-/* 8 */ Resource* const         m_pResources   = nullptr;
-/*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
-/*48 */ // End of structure
+/* 0 */ const Uint32                     m_NumResources = 0;
+/* 8 */ Resource* const                  m_pResources   = nullptr;
+/*16 */ DescriptorSetAllocation          m_DescriptorSetAllocation;
+/*48 */ DescriptorBufferAllocation       m_DescriptorBufferAllocation;
+/*96 */ const DescriptorBufferSetLayout* m_pDescriptorBufferLayout = nullptr;
+/*104*/ // End of structure
         // clang-format on
 
     private:
@@ -200,6 +220,18 @@ public:
         DescrSet.m_DescriptorSetAllocation = std::move(Allocation);
     }
 
+    // Assigns the descriptor buffer range that holds the data of a persistent descriptor set.
+    // Layout must outlive the cache.
+    void AssignDescriptorBufferAllocation(Uint32 SetIndex, DescriptorBufferAllocation&& Allocation, const DescriptorBufferSetLayout& Layout)
+    {
+        DescriptorSet& DescrSet = GetDescriptorSet(SetIndex);
+        VERIFY(DescrSet.GetSize() > 0, "Descriptor set is empty");
+        VERIFY(!DescrSet.m_DescriptorBufferAllocation, "Descriptor buffer allocation has already been initialized");
+        VERIFY(Layout.Persistent && Layout.Descriptors.size() == DescrSet.GetSize(), "Descriptor buffer set layout is not consistent with the descriptor set");
+        DescrSet.m_DescriptorBufferAllocation = std::move(Allocation);
+        DescrSet.m_pDescriptorBufferLayout    = &Layout;
+    }
+
     struct SetResourceInfo
     {
         const Uint32 BindingIndex = 0;
@@ -241,10 +273,72 @@ public:
         return SetResource(nullptr, SetIndex, Offset, {});
     }
 
+    // While the batch is alive, descriptor writes issued by SetResource() are accumulated
+    // instead of being submitted immediately. Writes to consecutive elements of the same
+    // binding are merged, and all writes are submitted with as few vkUpdateDescriptorSets
+    // calls as possible when the batch is full or destroyed.
+    class DescriptorWriteBatch
+    {
+    public:
+        explicit DescriptorWriteBatch(ShaderResourceCacheVk& Cache) noexcept;
+        ~DescriptorWriteBatch();
+
+        // clang-format off
+        DescriptorWriteBatch             (const DescriptorWriteBatch&) = delete;
+        DescriptorWriteBatch             (DescriptorWriteBatch&&)      = delete;
+        DescriptorWriteBatch& operator = (const DescriptorWriteBatch&) = delete;
+        DescriptorWriteBatch& operator = (DescriptorWriteBatch&&)      = delete;
+        // clang-format on
+
+        void AddWrite(const VulkanUtilities::LogicalDevice* pLogicalDevice,
+                      VkDescriptorSet                       vkSet,
+                      Uint32                                BindingIndex,
+                      Uint32                                ArrayIndex,
+                      const Resource&                       Res);
+
+        void Flush();
+
+    private:
+#ifdef DILIGENT_DEBUG
+        // Use small batches in debug build to exercise the flushing logic
+        static constexpr size_t ImgInfoBatchSize     = 2;
+        static constexpr size_t BuffInfoBatchSize    = 2;
+        static constexpr size_t TexelBuffBatchSize   = 2;
+        static constexpr size_t AccelStructBatchSize = 2;
+        static constexpr size_t WriteBatchSize       = 2;
+#else
+        static constexpr size_t ImgInfoBatchSize     = 64;
+        static constexpr size_t BuffInfoBatchSize    = 32;
+        static constexpr size_t TexelBuffBatchSize   = 16;
+        static constexpr size_t AccelStructBatchSize = 16;
+        static constexpr size_t WriteBatchSize       = 32;
+#endif
+
+        ShaderResourceCacheVk&                m_Cache;
+        const VulkanUtilities::LogicalDevice* m_pLogicalDevice = nullptr;
+
+        Uint32 m_NumImgInfos     = 0;
+        Uint32 m_NumBuffInfos    = 0;
+        Uint32 m_NumBuffViews    = 0;
+        Uint32 m_NumAccelStructs = 0;
+        Uint32 m_NumWrites       = 0;
+
+        // Do not zero-initialize arrays!
+        std::array<VkDescriptorImageInfo, ImgInfoBatchSize>                            m_ImgInfos;
+        std::array<VkDescriptorBufferInfo, BuffInfoBatchSize>                          m_BuffInfos;
+        std::array<VkBufferView, TexelBuffBatchSize>                                   m_BuffViews;
+        std::array<VkWriteDescriptorSetAccelerationStructureKHR, AccelStructBatchSize> m_AccelStructInfos;
+        std::array<VkWriteDescriptorSet, WriteBatchSize>                               m_Writes;
+    };
+
     void SetDynamicBufferOffset(Uint32 DescrSetIndex,
                                 Uint32 CacheOffset,
                                 Uint32 DynamicBufferOffset);
 
+    // Returns true if the set contains dynamic buffers or buffers with non-zero dynamic offsets.
+    // Such sets can't use the persistent descriptor buffer data and must be written every time they are bound.
+    bool HasDynamicBufferOffsets(Uint32 SetIndex) const;
+
 
     Uint32 GetNumDescriptorSets() const { return m_NumSets; }
     bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
@@ -282,6 +376,9 @@ private:
 
     std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
 
+    // Active descriptor write batch, see DescriptorWriteBatch
+    DescriptorWriteBatch* m_pWriteBatch = nullptr;
+
     Uint16 m_NumSets = 0;
 
     // Total actual number of dynamic buffers (that were created with USAGE_DYNAMIC) bound in the resource cache
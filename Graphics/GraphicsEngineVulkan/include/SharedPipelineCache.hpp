@@ -0,0 +1,158 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::SharedPipelineCache class
+
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+#include "PipelineState.h"
+#include "VulkanUtilities/LogicalDevice.hpp"
+#include "VulkanUtilities/PhysicalDevice.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+class PipelineStateVkImpl;
+
+// Graphics pipeline states that are set dynamically rather than baked into the pipeline,
+// see EngineVkCreateInfo::UseExtendedDynamicState.
+struct ExtendedDynamicStates
+{
+    // VK_EXT_extended_dynamic_state: cull mode, front face, primitive topology and the depth-stencil state
+    bool DepthStencilAndCulling = false;
+
+    // VK_EXT_extended_dynamic_state2: depth bias and primitive restart
+    bool DepthBiasAndRestart = false;
+
+    // VK_EXT_extended_dynamic_state2: patch control points
+    bool PatchControlPoints = false;
+
+    // Primitive topology may be changed to any topology, not only to the one of the same class
+    bool UnrestrictedTopology = false;
+
+    // VK_EXT_extended_dynamic_state3
+    bool PolygonMode      = false;
+    bool DepthClampEnable = false;
+    bool ColorBlend       = false; // Color blend enable, color blend equation and color write mask
+
+    ExtendedDynamicStates() noexcept {}
+    ExtendedDynamicStates(const VulkanUtilities::LogicalDevice&  LogicalDevice,
+                          const VulkanUtilities::PhysicalDevice& PhysicalDevice) noexcept;
+};
+
+// Description of a graphics pipeline with the states that are set dynamically excluded,
+// see ComputeSharedPipelineKey() in PipelineStateVkImpl.cpp.
+// Desc references the input layout and the render pass of the pipeline state the key was
+// created for, so the key may only be compared while this pipeline state is alive.
+struct SharedPipelineKey
+{
+    GraphicsPipelineDesc Desc;
+    PIPELINE_TYPE        PipelineType          = PIPELINE_TYPE_INVALID;
+    Uint64               ImmediateContextMask  = 0;
+    bool                 BakedPrimitiveRestart = false;
+
+    std::vector<size_t> SignatureHashes;
+    std::vector<size_t> ShaderHashes;
+
+    size_t Hash = 0;
+
+    bool operator==(const SharedPipelineKey& rhs) const noexcept;
+};
+
+// Graphics pipelines that only differ by the states that are set dynamically are identical.
+// The cache finds the pipeline state object whose Vulkan pipeline can be reused by a new
+// pipeline state with the same key (see PipelineStateVkImpl::InitializePipeline).
+//
+//     PSO A (cull back) ----.
+//                           |---> VkPipeline
+//     PSO B (cull none) ----'
+//
+// The cache holds weak references, so pipelines are released when the last PSO that uses them is destroyed.
+class SharedPipelineCache
+{
+public:
+    SharedPipelineCache(const VulkanUtilities::LogicalDevice&  LogicalDevice,
+                        const VulkanUtilities::PhysicalDevice& PhysicalDevice) noexcept;
+
+    // clang-format off
+    SharedPipelineCache             (const SharedPipelineCache&) = delete;
+    SharedPipelineCache             (SharedPipelineCache&&)      = delete;
+    SharedPipelineCache& operator = (const SharedPipelineCache&) = delete;
+    SharedPipelineCache& operator = (SharedPipelineCache&&)      = delete;
+    // clang-format on
+
+    ~SharedPipelineCache();
+
+    // Returns the pipeline state that owns the pipeline with the given key, or null if there is no such pipeline.
+    RefCntAutoPtr<PipelineStateVkImpl> Find(const SharedPipelineKey& Key);
+
+    // Registers the pipeline state that owns the pipeline with the given key.
+    // The key must have been created for this pipeline state.
+    void Add(SharedPipelineKey Key, PipelineStateVkImpl* pPSO);
+
+    // Releases all references and reports pipeline sharing statistics.
+    void Destroy();
+
+    const ExtendedDynamicStates& GetDynamicStates() const { return m_DynamicStates; }
+
+    // The number of graphics pipeline states created with the cache.
+    Uint32 GetNumPipelineStates() const { return m_NumPipelineStates.load(); }
+
+    // The number of graphics pipeline states that reused an existing Vulkan pipeline.
+    Uint32 GetNumSharedPipelines() const { return m_NumSharedPipelines.load(); }
+
+private:
+    void PurgeExpiredEntries();
+
+    const ExtendedDynamicStates m_DynamicStates;
+
+    struct PipelineEntry
+    {
+        SharedPipelineKey                  Key;
+        RefCntWeakPtr<PipelineStateVkImpl> pOwner;
+    };
+
+    std::mutex m_Mutex;
+
+    // Entries are indexed by the key hash, and the keys are compared while their owners are locked.
+    std::unordered_multimap<size_t, PipelineEntry> m_Pipelines;
+
+    // Entries of destroyed pipeline states are purged when the map size exceeds the threshold
+    size_t m_PurgeThreshold = 64;
+
+    std::atomic<Uint32> m_NumPipelineStates{0};
+    std::atomic<Uint32> m_NumSharedPipelines{0};
+};
+
+} // namespace Diligent
@@ -91,6 +91,19 @@ public:
 
     void InvalidateStagingRange(VkDeviceSize Offset, VkDeviceSize Size);
 
+    // Returns true if the texture was created with MISC_TEXTURE_FLAG_HOST_UPLOAD flag and supports host image copies.
+    bool IsHostUploadEnabled() const { return m_HostUploadLayout != VK_IMAGE_LAYOUT_UNDEFINED; }
+
+    // Writes the data to the texture region with vkCopyMemoryToImageEXT.
+    // Returns false if the region can't be updated on the host, in which case
+    // the update must be performed by the device.
+    bool UpdateRegionOnHost(const void* pSrcData,
+                            Uint64      SrcStride,
+                            Uint64      SrcDepthStride,
+                            Uint32      MipLevel,
+                            Uint32      Slice,
+                            const Box&  DstBox);
+
     // For non-compressed color format buffer, the offset must be a multiple of the format's texel block size.
     // For compressed format buffer, the offset must be a multiple of the compressed texel block size in bytes.
     // For depth-stencil format buffer, the offset must be a multiple of 4.
@@ -119,6 +132,10 @@ protected:
     VulkanUtilities::BufferWrapper    m_StagingBuffer;
     VulkanUtilities::MemoryAllocation m_MemoryAllocation;
     VkDeviceSize                      m_StagingDataAlignedOffset = 0;
+
+    // The layout that the texture is kept in when it is updated on the host,
+    // or VK_IMAGE_LAYOUT_UNDEFINED if host upload is not enabled.
+    VkImageLayout m_HostUploadLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 };
 
 } // namespace Diligent
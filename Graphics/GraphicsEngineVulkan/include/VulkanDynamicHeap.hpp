@@ -142,8 +142,9 @@ public:
     VulkanDynamicMemoryManager& operator= (const VulkanDynamicMemoryManager&)  = delete;
     VulkanDynamicMemoryManager& operator= (      VulkanDynamicMemoryManager&&) = delete;
 
-    VkBuffer GetVkBuffer()  const{return m_VkBuffer;}
-    Uint8*   GetCPUAddress()const{return m_CPUAddress;}
+    VkBuffer        GetVkBuffer()       const{return m_VkBuffer;}
+    Uint8*          GetCPUAddress()     const{return m_CPUAddress;}
+    VkDeviceAddress GetVkDeviceAddress()const{return m_DeviceAddress;}
     // clang-format on
 
     void Destroy();
@@ -156,6 +157,7 @@ private:
     VulkanUtilities::BufferWrapper       m_VkBuffer;
     VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
     Uint8*                               m_CPUAddress;
+    VkDeviceAddress                      m_DeviceAddress = 0; // Only valid in descriptor buffer mode
     const VkDeviceSize                   m_DefaultAlignment;
     const Uint64                         m_CommandQueueMask;
     OffsetType                           m_TotalPeakSize = 0;
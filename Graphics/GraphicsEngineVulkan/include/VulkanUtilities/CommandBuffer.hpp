@@ -399,6 +399,8 @@ public:
         m_State       = {};
         m_Barrier     = {};
         m_ImageBarriers.clear();
+        m_ImageBarriers2.clear();
+        m_BufferBarriers2.clear();
     }
 
     __forceinline void BindComputePipeline(VkPipeline ComputePipeline)
@@ -492,6 +494,34 @@ public:
                        VkPipelineStageFlags SrcStages,
                        VkPipelineStageFlags DestStages);
 
+    // Adds a barrier for the whole buffer. When synchronization2 is not used,
+    // the barrier is merged into the global memory barrier.
+    void BufferMemoryBarrier(VkBuffer             Buffer,
+                             VkAccessFlags        srcAccessMask,
+                             VkAccessFlags        dstAccessMask,
+                             VkPipelineStageFlags SrcStages,
+                             VkPipelineStageFlags DestStages);
+
+    // Barriers of a split barrier. The same barriers must be passed to
+    // vkCmdSetEvent2 and vkCmdWaitEvents2.
+    struct SplitBarrier
+    {
+        VkEvent                                Event            = VK_NULL_HANDLE;
+        VkMemoryBarrier2KHR                    MemoryBarrier    = {};
+        bool                                   HasMemoryBarrier = false;
+        std::vector<VkBufferMemoryBarrier2KHR> BufferBarriers;
+        std::vector<VkImageMemoryBarrier2KHR>  ImageBarriers;
+    };
+
+    // Moves all barriers accumulated since the last flush into the split barrier and
+    // records vkCmdSetEvent2 that signals the event when the source stages complete.
+    // Requires synchronization2.
+    void SetEvent(VkEvent Event, SplitBarrier& Barrier);
+
+    // Records vkCmdWaitEvents2 that waits for the event set by SetEvent() and
+    // executes the second half of the split barrier.
+    void WaitEvent(const SplitBarrier& Barrier);
+
     __forceinline void BindDescriptorSets(VkPipelineBindPoint    pipelineBindPoint,
                                           VkPipelineLayout       layout,
                                           uint32_t               firstSet,
@@ -504,6 +534,54 @@ public:
         vkCmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 
+    __forceinline void PushDescriptorSet(VkPipelineBindPoint         pipelineBindPoint,
+                                         VkPipelineLayout            layout,
+                                         uint32_t                    set,
+                                         uint32_t                    descriptorWriteCount,
+                                         const VkWriteDescriptorSet* pDescriptorWrites)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdPushDescriptorSetKHR(m_VkCmdBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+#else
+        UNSUPPORTED("Push descriptors are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void BindDescriptorBuffer(VkDeviceAddress Address, VkBufferUsageFlags Usage)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        if (m_State.DescriptorBufferAddress != Address)
+        {
+            VkDescriptorBufferBindingInfoEXT BindingInfo{};
+            BindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+            BindingInfo.address = Address;
+            BindingInfo.usage   = Usage;
+            vkCmdBindDescriptorBuffersEXT(m_VkCmdBuffer, 1, &BindingInfo);
+            m_State.DescriptorBufferAddress = Address;
+        }
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDescriptorBufferOffsets(VkPipelineBindPoint pipelineBindPoint,
+                                                  VkPipelineLayout    layout,
+                                                  uint32_t            firstSet,
+                                                  uint32_t            setCount,
+                                                  const uint32_t*     pBufferIndices,
+                                                  const VkDeviceSize* pOffsets)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.DescriptorBufferAddress != 0, "Descriptor buffer is not bound");
+        vkCmdSetDescriptorBufferOffsetsEXT(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void CopyBuffer(VkBuffer            srcBuffer,
                                   VkBuffer            dstBuffer,
                                   uint32_t            regionCount,
@@ -794,6 +872,184 @@ public:
 #endif
     }
 
+    __forceinline void SetCullMode(VkCullModeFlags CullMode)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetCullModeEXT(m_VkCmdBuffer, CullMode);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetFrontFace(VkFrontFace FrontFace)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetFrontFaceEXT(m_VkCmdBuffer, FrontFace);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPrimitiveTopology(VkPrimitiveTopology Topology)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPrimitiveTopologyEXT(m_VkCmdBuffer, Topology);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthTestEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthTestEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthWriteEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthWriteEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthCompareOp(VkCompareOp CompareOp)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthCompareOpEXT(m_VkCmdBuffer, CompareOp);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetStencilTestEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetStencilTestEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetStencilOp(VkStencilFaceFlags FaceMask, const VkStencilOpState& OpState)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetStencilOpEXT(m_VkCmdBuffer, FaceMask, OpState.failOp, OpState.passOp, OpState.depthFailOp, OpState.compareOp);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthBiasEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthBiasEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPrimitiveRestartEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPrimitiveRestartEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPatchControlPoints(uint32_t PatchControlPoints)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPatchControlPointsEXT(m_VkCmdBuffer, PatchControlPoints);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPolygonMode(VkPolygonMode PolygonMode)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPolygonModeEXT(m_VkCmdBuffer, PolygonMode);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthClampEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthClampEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetColorBlendEnable(uint32_t FirstAttachment, uint32_t AttachmentCount, const VkBool32* pEnables)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetColorBlendEnableEXT(m_VkCmdBuffer, FirstAttachment, AttachmentCount, pEnables);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetColorBlendEquation(uint32_t FirstAttachment, uint32_t AttachmentCount, const VkColorBlendEquationEXT* pEquations)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetColorBlendEquationEXT(m_VkCmdBuffer, FirstAttachment, AttachmentCount, pEquations);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetColorWriteMask(uint32_t FirstAttachment, uint32_t AttachmentCount, const VkColorComponentFlags* pMasks)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetColorWriteMaskEXT(m_VkCmdBuffer, FirstAttachment, AttachmentCount, pMasks);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetStencilCompareMask(VkStencilFaceFlags FaceMask, uint32_t CompareMask)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetStencilCompareMask(m_VkCmdBuffer, FaceMask, CompareMask);
+    }
+
+    __forceinline void SetStencilWriteMask(VkStencilFaceFlags FaceMask, uint32_t WriteMask)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetStencilWriteMask(m_VkCmdBuffer, FaceMask, WriteMask);
+    }
+
+    __forceinline void SetDepthBias(float ConstantFactor, float Clamp, float SlopeFactor)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthBias(m_VkCmdBuffer, ConstantFactor, Clamp, SlopeFactor);
+    }
+
     void FlushBarriers();
 
     __forceinline void SetVkCmdBuffer(VkCommandBuffer VkCmdBuffer, VkPipelineStageFlags StageMask, VkAccessFlags AccessMask)
@@ -807,6 +1063,17 @@ public:
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_Barrier.SupportedStagesMask; }
     VkAccessFlags        GetSupportedAccessMask() const { return m_Barrier.SupportedAccessMask; }
 
+    // Enables vkCmdPipelineBarrier2 that keeps stage and access masks of every resource barrier.
+    // The setting persists across Reset() calls.
+    void SetUseSynchronization2(bool UseSync2) { m_UseSync2 = UseSync2; }
+    bool IsSynchronization2Used() const { return m_UseSync2; }
+
+    bool HasPendingBarriers() const
+    {
+        return (m_Barrier.MemorySrcStages != 0 || m_Barrier.MemoryDstStages != 0 ||
+                !m_ImageBarriers.empty() || !m_ImageBarriers2.empty() || !m_BufferBarriers2.empty());
+    }
+
     struct StateCache
     {
         VkRenderPass  RenderPass           = VK_NULL_HANDLE;
@@ -822,6 +1089,8 @@ public:
         uint32_t      InsidePassQueries    = 0;
         uint32_t      OutsidePassQueries   = 0;
         size_t        DynamicRenderingHash = 0;
+
+        VkDeviceAddress DescriptorBufferAddress = 0;
     };
 
     __forceinline bool IsInRenderScope() const { return m_State.RenderPass != VK_NULL_HANDLE || m_State.DynamicRenderingHash != 0; }
@@ -829,6 +1098,19 @@ public:
     const StateCache& GetState() const { return m_State; }
 
 private:
+    void FlushBarriers2();
+
+    VkImageMemoryBarrier2KHR GetImageBarrier2(VkImage                        Image,
+                                              VkImageLayout                  OldLayout,
+                                              VkImageLayout                  NewLayout,
+                                              const VkImageSubresourceRange& SubresRange,
+                                              VkPipelineStageFlags           SrcStages,
+                                              VkPipelineStageFlags           DstStages) const;
+
+    // Moves the global memory barrier accumulated in m_Barrier into MemBarrier.
+    // Returns false if there is no memory barrier.
+    bool ExtractMemoryBarrier2(VkMemoryBarrier2KHR& MemBarrier);
+
     struct PipelineBarrier
     {
         VkPipelineStageFlags MemorySrcStages = 0;
@@ -848,6 +1130,13 @@ private:
     PipelineBarrier m_Barrier;
 
     std::vector<VkImageMemoryBarrier> m_ImageBarriers;
+
+    // Per-resource barriers used with synchronization2. Global memory barriers
+    // are still accumulated in m_Barrier.
+    std::vector<VkImageMemoryBarrier2KHR>  m_ImageBarriers2;
+    std::vector<VkBufferMemoryBarrier2KHR> m_BufferBarriers2;
+
+    bool m_UseSync2 = false;
 };
 
 } // namespace VulkanUtilities
@@ -45,6 +45,21 @@ namespace VulkanUtilities
 class MemoryPage;
 class MemoryManager;
 
+// Memory pages are pooled by the size of the allocations they serve
+enum class MemoryPageSizeClass : uint8_t
+{
+    // Small allocations are placed in small pages to reduce fragmentation of regular pages
+    Small,
+
+    // Regular allocations
+    Regular,
+
+    // Large or driver-preferred allocations get their own page that is never shared
+    Dedicated,
+
+    Count
+};
+
 struct MemoryAllocation
 {
     MemoryAllocation() noexcept {}
@@ -104,11 +119,13 @@ struct MemoryAllocation
 class MemoryPage
 {
 public:
-    MemoryPage(MemoryManager&        ParentMemoryMgr,
-               VkDeviceSize          PageSize,
-               uint32_t              MemoryTypeIndex,
-               bool                  IsHostVisible,
-               VkMemoryAllocateFlags AllocateFlags);
+    MemoryPage(MemoryManager&                       ParentMemoryMgr,
+               VkDeviceSize                         PageSize,
+               uint32_t                             MemoryTypeIndex,
+               bool                                 IsHostVisible,
+               VkMemoryAllocateFlags                AllocateFlags,
+               MemoryPageSizeClass                  SizeClass      = MemoryPageSizeClass::Regular,
+               const VkMemoryDedicatedAllocateInfo* pDedicatedInfo = nullptr);
     ~MemoryPage();
 
     // clang-format off
@@ -116,7 +133,10 @@ public:
         m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
         m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
         m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
+        m_CPUMemory       {rhs.m_CPUMemory               },
+        m_MemoryTypeIndex {rhs.m_MemoryTypeIndex         },
+        m_AllocateFlags   {rhs.m_AllocateFlags           },
+        m_SizeClass       {rhs.m_SizeClass               }
     {
         rhs.m_CPUMemory = nullptr;
     }
@@ -134,8 +154,11 @@ public:
 
     MemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment);
 
-    VkDeviceMemory GetVkMemory() const { return m_VkMemory; }
-    void*          GetCPUMemory() const { return m_CPUMemory; }
+    VkDeviceMemory        GetVkMemory() const { return m_VkMemory; }
+    void*                 GetCPUMemory() const { return m_CPUMemory; }
+    uint32_t              GetMemoryTypeIndex() const { return m_MemoryTypeIndex; }
+    VkMemoryAllocateFlags GetAllocateFlags() const { return m_AllocateFlags; }
+    MemoryPageSizeClass   GetSizeClass() const { return m_SizeClass; }
 
 private:
     using AllocationsMgrOffsetType = Diligent::VariableSizeAllocationsManager::OffsetType;
@@ -149,7 +172,10 @@ private:
     std::mutex                               m_Mutex;
     Diligent::VariableSizeAllocationsManager m_AllocationMgr;
     VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
-    void*                                    m_CPUMemory = nullptr;
+    void*                                    m_CPUMemory       = nullptr;
+    uint32_t                                 m_MemoryTypeIndex = 0;
+    VkMemoryAllocateFlags                    m_AllocateFlags   = 0;
+    MemoryPageSizeClass                      m_SizeClass       = MemoryPageSizeClass::Regular;
 };
 
 class MemoryManager
@@ -163,7 +189,8 @@ public:
                   VkDeviceSize                 DeviceLocalPageSize,
                   VkDeviceSize                 HostVisiblePageSize,
                   VkDeviceSize                 DeviceLocalReserveSize,
-                  VkDeviceSize                 HostVisibleReserveSize) :
+                  VkDeviceSize                 HostVisibleReserveSize,
+                  float                        BudgetThreshold = 0) :
         m_MgrName               {std::move(MgrName)    },
         m_LogicalDevice         {Device                },
         m_PhysicalDevice        {PhysDevice            },
@@ -171,7 +198,8 @@ public:
         m_DeviceLocalPageSize   {DeviceLocalPageSize   },
         m_HostVisiblePageSize   {HostVisiblePageSize   },
         m_DeviceLocalReserveSize{DeviceLocalReserveSize},
-        m_HostVisibleReserveSize{HostVisibleReserveSize}
+        m_HostVisibleReserveSize{HostVisibleReserveSize},
+        m_BudgetThreshold       {BudgetThreshold       }
     {}
 
 
@@ -189,11 +217,15 @@ public:
         m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
         m_DeviceLocalReserveSize {rhs.m_DeviceLocalReserveSize},
         m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
+        m_BudgetThreshold        {rhs.m_BudgetThreshold       },
+        m_OverBudgetHeapMask     {rhs.m_OverBudgetHeapMask    },
+        m_BudgetWarningHeapMask  {rhs.m_BudgetWarningHeapMask },
 
         //m_CurrUsedSize      {rhs.m_CurrUsedSize},
         m_PeakUsedSize      {rhs.m_PeakUsedSize     },
         m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
-        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
+        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize},
+        m_NumPages          {rhs.m_NumPages         }
     {
         // clang-format on
         for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
@@ -210,7 +242,40 @@ public:
 
     MemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags);
     MemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
-    void             ShrinkMemory();
+
+    // Allocates a dedicated memory page for the image or the buffer specified by pDedicatedInfo.
+    MemoryAllocation AllocateDedicated(const VkMemoryRequirements&          MemReqs,
+                                       VkMemoryPropertyFlags                MemoryProps,
+                                       const VkMemoryDedicatedAllocateInfo& DedicatedInfo);
+
+    // Allocates memory for the resource that is moved out of SrcPage by the defragmentation.
+    // The memory is only allocated in the existing pages of the same type that are fuller than SrcPage.
+    // New pages are never created. Returns an empty allocation if there is no suitable page.
+    MemoryAllocation AllocateForDefragmentation(VkDeviceSize Size, VkDeviceSize Alignment, const MemoryPage& SrcPage);
+
+    void ShrinkMemory();
+
+    struct Stats
+    {
+        // 0 == Device local, 1 == Host-visible
+        std::array<VkDeviceSize, 2> UsedSize      = {};
+        std::array<VkDeviceSize, 2> AllocatedSize = {};
+
+        std::array<uint32_t, static_cast<size_t>(MemoryPageSizeClass::Count)> NumPages = {};
+    };
+    Stats GetStats();
+
+    // Allocations that are not larger than this size are placed in small pages.
+    VkDeviceSize GetSmallAllocationThreshold(bool HostVisible) const
+    {
+        return (HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize) / SmallAllocationSizeRatio;
+    }
+
+    // Device-local allocations that are not smaller than this size are placed in dedicated pages.
+    VkDeviceSize GetDedicatedAllocationThreshold() const
+    {
+        return m_DeviceLocalPageSize / 2;
+    }
 
 protected:
     friend class MemoryPage;
@@ -218,6 +283,32 @@ protected:
     virtual void OnNewPageCreated(MemoryPage& NewPage) {}
     virtual void OnPageDestroy(MemoryPage& Page) {}
 
+    // Small pages are SmallPageSizeRatio times smaller than regular pages and serve
+    // allocations that are at least SmallAllocationSizeRatio times smaller than regular page.
+    static constexpr VkDeviceSize SmallPageSizeRatio       = 8;
+    static constexpr VkDeviceSize SmallAllocationSizeRatio = 64;
+
+    MemoryAllocation CreatePageAndAllocate(VkDeviceSize                         Size,
+                                           VkDeviceSize                         Alignment,
+                                           uint32_t                             MemoryTypeIndex,
+                                           bool                                 HostVisible,
+                                           VkMemoryAllocateFlags                AllocateFlags,
+                                           MemoryPageSizeClass                  SizeClass,
+                                           const VkMemoryDedicatedAllocateInfo* pDedicatedInfo);
+
+    void OnAllocation(const MemoryAllocation& Allocation, bool HostVisible);
+
+    // Checks if a new page of the given size fits into the budget of the heap the memory type belongs to.
+    // If it does not, releases empty pages of the heap. Must be called with m_PagesMtx locked.
+    void EnforceBudget(uint32_t MemoryTypeIndex, VkDeviceSize PageSize);
+
+    // Updates m_OverBudgetHeapMask. Returns false if the budget can't be queried.
+    bool UpdateBudget(VkDeviceSize ExtraSize = 0, uint32_t ExtraSizeHeapIndex = ~0u);
+
+    // Releases empty pages. If IgnoreReserve is false, pages are kept while the allocated size does not exceed the reserve.
+    // Pages of the heaps in m_OverBudgetHeapMask are always released. Must be called with m_PagesMtx locked.
+    void ReleaseEmptyPages(bool IgnoreReserve, uint32_t HeapMask = ~0u);
+
     std::string m_MgrName;
 
     const LogicalDevice&  m_LogicalDevice;
@@ -231,21 +322,25 @@ protected:
         const uint32_t              MemoryTypeIndex;
         const VkMemoryAllocateFlags AllocateFlags;
         const bool                  IsHostVisible;
+        const MemoryPageSizeClass   SizeClass;
 
         // clang-format off
         MemoryPageIndex(uint32_t              _MemoryTypeIndex,
                         bool                  _IsHostVisible,
-                        VkMemoryAllocateFlags _AllocateFlags) :
+                        VkMemoryAllocateFlags _AllocateFlags,
+                        MemoryPageSizeClass   _SizeClass) :
             MemoryTypeIndex{_MemoryTypeIndex},
             AllocateFlags  {_AllocateFlags},
-            IsHostVisible  {_IsHostVisible}
+            IsHostVisible  {_IsHostVisible},
+            SizeClass      {_SizeClass}
         {}
 
         bool operator == (const MemoryPageIndex& rhs)const
         {
             return MemoryTypeIndex == rhs.MemoryTypeIndex &&
                    AllocateFlags   == rhs.AllocateFlags   &&
-                   IsHostVisible   == rhs.IsHostVisible;
+                   IsHostVisible   == rhs.IsHostVisible   &&
+                   SizeClass       == rhs.SizeClass;
         }
         // clang-format on
 
@@ -253,7 +348,7 @@ protected:
         {
             size_t operator()(const MemoryPageIndex& PageIndex) const
             {
-                return Diligent::ComputeHash(PageIndex.MemoryTypeIndex, PageIndex.AllocateFlags, PageIndex.IsHostVisible);
+                return Diligent::ComputeHash(PageIndex.MemoryTypeIndex, PageIndex.AllocateFlags, PageIndex.IsHostVisible, static_cast<uint8_t>(PageIndex.SizeClass));
             }
         };
     };
@@ -264,6 +359,15 @@ protected:
     const VkDeviceSize m_DeviceLocalReserveSize;
     const VkDeviceSize m_HostVisibleReserveSize;
 
+    // The fraction of the heap budget that the manager tries not to exceed (see VK_EXT_memory_budget).
+    // Zero if the budget is not used.
+    const float m_BudgetThreshold;
+
+    // Heaps whose usage exceeds the budget threshold
+    uint32_t m_OverBudgetHeapMask = 0;
+    // Heaps for which the over-budget warning has been reported
+    uint32_t m_BudgetWarningHeapMask = 0;
+
     void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible);
 
     // 0 == Device local, 1 == Host-visible
@@ -272,6 +376,8 @@ protected:
     std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
     std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
 
+    std::array<uint32_t, static_cast<size_t>(MemoryPageSizeClass::Count)> m_NumPages = {};
+
     // If adding new member, do not forget to update move ctor
 };
 
@@ -48,54 +48,68 @@ public:
 
     struct ExtensionFeatures
     {
-        VkPhysicalDeviceMeshShaderFeaturesEXT             MeshShader             = {};
-        VkPhysicalDevice16BitStorageFeaturesKHR           Storage16Bit           = {};
-        VkPhysicalDevice8BitStorageFeaturesKHR            Storage8Bit            = {};
-        VkPhysicalDeviceShaderFloat16Int8FeaturesKHR      ShaderFloat16Int8      = {};
-        VkPhysicalDeviceAccelerationStructureFeaturesKHR  AccelStruct            = {};
-        VkPhysicalDeviceRayTracingPipelineFeaturesKHR     RayTracingPipeline     = {};
-        VkPhysicalDeviceRayQueryFeaturesKHR               RayQuery               = {};
-        VkPhysicalDeviceBufferDeviceAddressFeaturesKHR    BufferDeviceAddress    = {};
-        VkPhysicalDeviceDescriptorIndexingFeaturesEXT     DescriptorIndexing     = {};
-        VkPhysicalDevicePortabilitySubsetFeaturesKHR      PortabilitySubset      = {};
-        VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT VertexAttributeDivisor = {};
-        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR      TimelineSemaphore      = {};
-        VkPhysicalDeviceHostQueryResetFeatures            HostQueryReset         = {};
-        VkPhysicalDeviceFragmentShadingRateFeaturesKHR    ShadingRate            = {};
-        VkPhysicalDeviceFragmentDensityMapFeaturesEXT     FragmentDensityMap     = {}; // Only for desktop devices
-        VkPhysicalDeviceFragmentDensityMap2FeaturesEXT    FragmentDensityMap2    = {}; // Only for mobile devices
-        VkPhysicalDeviceMultiviewFeaturesKHR              Multiview              = {}; // Required for RenderPass2
-        VkPhysicalDeviceMultiDrawFeaturesEXT              MultiDraw              = {};
-        VkPhysicalDeviceShaderDrawParametersFeatures      ShaderDrawParameters   = {};
-        VkPhysicalDeviceDynamicRenderingFeaturesKHR       DynamicRendering       = {};
-        VkPhysicalDeviceHostImageCopyFeaturesEXT          HostImageCopy          = {};
-
-
-        bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
-        bool Spirv15              = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
-        bool SubgroupOps          = false; // Requires Vulkan 1.1
-        bool HasPortabilitySubset = false;
-        bool RenderPass2          = false;
-        bool DrawIndirectCount    = false;
+        VkPhysicalDeviceMeshShaderFeaturesEXT              MeshShader              = {};
+        VkPhysicalDevice16BitStorageFeaturesKHR            Storage16Bit            = {};
+        VkPhysicalDevice8BitStorageFeaturesKHR             Storage8Bit             = {};
+        VkPhysicalDeviceShaderFloat16Int8FeaturesKHR       ShaderFloat16Int8       = {};
+        VkPhysicalDeviceAccelerationStructureFeaturesKHR   AccelStruct             = {};
+        VkPhysicalDeviceRayTracingPipelineFeaturesKHR      RayTracingPipeline      = {};
+        VkPhysicalDeviceRayQueryFeaturesKHR                RayQuery                = {};
+        VkPhysicalDeviceBufferDeviceAddressFeaturesKHR     BufferDeviceAddress     = {};
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT      DescriptorIndexing      = {};
+        VkPhysicalDevicePortabilitySubsetFeaturesKHR       PortabilitySubset       = {};
+        VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT  VertexAttributeDivisor  = {};
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR       TimelineSemaphore       = {};
+        VkPhysicalDeviceHostQueryResetFeatures             HostQueryReset          = {};
+        VkPhysicalDeviceFragmentShadingRateFeaturesKHR     ShadingRate             = {};
+        VkPhysicalDeviceFragmentDensityMapFeaturesEXT      FragmentDensityMap      = {}; // Only for desktop devices
+        VkPhysicalDeviceFragmentDensityMap2FeaturesEXT     FragmentDensityMap2     = {}; // Only for mobile devices
+        VkPhysicalDeviceMultiviewFeaturesKHR               Multiview               = {}; // Required for RenderPass2
+        VkPhysicalDeviceMultiDrawFeaturesEXT               MultiDraw               = {};
+        VkPhysicalDeviceShaderDrawParametersFeatures       ShaderDrawParameters    = {};
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR        DynamicRendering        = {};
+        VkPhysicalDeviceHostImageCopyFeaturesEXT           HostImageCopy           = {};
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT        DescriptorBuffer        = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT GraphicsPipelineLibrary = {};
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT    ExtendedDynamicState    = {};
+        VkPhysicalDeviceExtendedDynamicState2FeaturesEXT   ExtendedDynamicState2   = {};
+        VkPhysicalDeviceExtendedDynamicState3FeaturesEXT   ExtendedDynamicState3   = {};
+        VkPhysicalDeviceSynchronization2FeaturesKHR        Synchronization2        = {};
+
+
+        bool Spirv14                  = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
+        bool Spirv15                  = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
+        bool SubgroupOps              = false; // Requires Vulkan 1.1
+        bool HasPortabilitySubset     = false;
+        bool RenderPass2              = false;
+        bool DrawIndirectCount        = false;
+        bool DescriptorUpdateTemplate = false; // Requires Vulkan 1.1
+        bool PushDescriptor           = false;
+        bool MemoryBudget             = false;
+        bool DedicatedAllocation      = false; // Requires Vulkan 1.1
     };
 
     struct ExtensionProperties
     {
-        VkPhysicalDeviceMeshShaderPropertiesEXT             MeshShader             = {};
-        VkPhysicalDeviceAccelerationStructurePropertiesKHR  AccelStruct            = {};
-        VkPhysicalDeviceRayTracingPipelinePropertiesKHR     RayTracingPipeline     = {};
-        VkPhysicalDeviceDescriptorIndexingPropertiesEXT     DescriptorIndexing     = {};
-        VkPhysicalDevicePortabilitySubsetPropertiesKHR      PortabilitySubset      = {};
-        VkPhysicalDeviceSubgroupProperties                  Subgroup               = {};
-        VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT VertexAttributeDivisor = {};
-        VkPhysicalDeviceTimelineSemaphorePropertiesKHR      TimelineSemaphore      = {};
-        VkPhysicalDeviceFragmentShadingRatePropertiesKHR    ShadingRate            = {};
-        VkPhysicalDeviceFragmentDensityMapPropertiesEXT     FragmentDensityMap     = {};
-        VkPhysicalDeviceMultiviewPropertiesKHR              Multiview              = {};
-        VkPhysicalDeviceMaintenance3Properties              Maintenance3           = {};
-        VkPhysicalDeviceFragmentDensityMap2PropertiesEXT    FragmentDensityMap2    = {};
-        VkPhysicalDeviceMultiDrawPropertiesEXT              MultiDraw              = {};
-        VkPhysicalDeviceHostImageCopyPropertiesEXT          HostImageCopy          = {};
+        VkPhysicalDeviceMeshShaderPropertiesEXT              MeshShader              = {};
+        VkPhysicalDeviceAccelerationStructurePropertiesKHR   AccelStruct             = {};
+        VkPhysicalDeviceRayTracingPipelinePropertiesKHR      RayTracingPipeline      = {};
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT      DescriptorIndexing      = {};
+        VkPhysicalDevicePortabilitySubsetPropertiesKHR       PortabilitySubset       = {};
+        VkPhysicalDeviceSubgroupProperties                   Subgroup                = {};
+        VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT  VertexAttributeDivisor  = {};
+        VkPhysicalDeviceTimelineSemaphorePropertiesKHR       TimelineSemaphore       = {};
+        VkPhysicalDeviceFragmentShadingRatePropertiesKHR     ShadingRate             = {};
+        VkPhysicalDeviceFragmentDensityMapPropertiesEXT      FragmentDensityMap      = {};
+        VkPhysicalDeviceMultiviewPropertiesKHR               Multiview               = {};
+        VkPhysicalDeviceMaintenance3Properties               Maintenance3            = {};
+        VkPhysicalDeviceFragmentDensityMap2PropertiesEXT     FragmentDensityMap2     = {};
+        VkPhysicalDeviceMultiDrawPropertiesEXT               MultiDraw               = {};
+        VkPhysicalDeviceHostImageCopyPropertiesEXT           HostImageCopy           = {};
+        VkPhysicalDevicePushDescriptorPropertiesKHR          PushDescriptor          = {};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT        DescriptorBuffer        = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT GraphicsPipelineLibrary = {};
+        VkPhysicalDeviceExtendedDynamicState3PropertiesEXT   ExtendedDynamicState3   = {};
 
         std::unique_ptr<VkImageLayout[]> HostImageCopyLayouts;
     };
@@ -119,6 +133,10 @@ public:
 
     uint32_t GetMemoryTypeIndex(uint32_t typeBits, VkMemoryPropertyFlags properties) const;
 
+    // Queries the current memory budget and usage of every memory heap (requires VK_EXT_memory_budget).
+    // Returns false if the budget can't be queried.
+    bool GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const;
+
     VkPhysicalDevice                            GetVkDeviceHandle() const { return m_vkDevice; }
     uint32_t                                    GetVkVersion() const { return m_vkVersion; }
     const VkPhysicalDeviceProperties&           GetProperties() const { return m_Properties; }
@@ -136,9 +154,9 @@ private:
 
     const VkPhysicalDevice               m_vkDevice;
     uint32_t                             m_vkVersion        = 0;
-    VkPhysicalDeviceProperties           m_Properties       = {};
-    VkPhysicalDeviceFeatures             m_Features         = {};
-    VkPhysicalDeviceMemoryProperties     m_MemoryProperties = {};
+    VkPhysicalDeviceProperties       m_Properties       = {};
+    VkPhysicalDeviceFeatures         m_Features         = {};
+    VkPhysicalDeviceMemoryProperties m_MemoryProperties = {};
     ExtensionFeatures                    m_ExtFeatures      = {};
     ExtensionProperties                  m_ExtProperties    = {};
     std::vector<VkQueueFamilyProperties> m_QueueFamilyProperties;
@@ -39,6 +39,17 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_DeviceContextVk =
     {0x72aeb1ba, 0xc6ad, 0x42ec, {0x88, 0x11, 0x7e, 0xd9, 0xc7, 0x21, 0x76, 0xbb}};
 
+/// Memory defragmentation attributes, see IDeviceContextVk::DefragmentMemory().
+struct MemoryDefragmentationAttribsVk
+{
+    /// The maximum number of bytes to move in one call.
+    Uint64 MaxBytesToMove       DEFAULT_INITIALIZER(16 << 20);
+
+    /// The maximum number of allocations to move in one call.
+    Uint32 MaxAllocationsToMove DEFAULT_INITIALIZER(64);
+};
+typedef struct MemoryDefragmentationAttribsVk MemoryDefragmentationAttribsVk;
+
 #define DILIGENT_INTERFACE_NAME IDeviceContextVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -84,6 +95,32 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
     /// calling IDeviceContext::InvalidateState() and then manually restore all required states via
     /// appropriate Diligent API calls.
     VIRTUAL VkCommandBuffer METHOD(GetVkCommandBuffer)(THIS) PURE;
+
+    /// Performs one step of the incremental device memory defragmentation
+
+    /// \param [in] Attribs - Defragmentation attributes, see Diligent::MemoryDefragmentationAttribsVk.
+    /// \return     true if there are more allocations that can be moved, and false otherwise.
+    ///
+    /// The method moves buffers from the least occupied memory pages to the fuller ones
+    /// so that empty pages can be released. Data is copied by the GPU in the context's
+    /// command buffer, and the old memory is released when the commands are complete.
+    /// The application is expected to call the method once per frame until it returns false.
+    ///
+    /// Only USAGE_DEFAULT and USAGE_IMMUTABLE buffers that are created for this context's
+    /// command queue with BIND_VERTEX_BUFFER, BIND_INDEX_BUFFER and BIND_INDIRECT_DRAW_ARGS
+    /// bind flags are moved, as they are never referenced by descriptors or views.
+    /// Buffers that are used by a deferred context since its last FinishCommandList() call, or
+    /// by a command list that has not been executed yet, are skipped.
+    ///
+    /// Textures are not moved: their Vulkan images are referenced by texture views, descriptor
+    /// sets and framebuffers, which would all have to be recreated. Dedicated allocations
+    /// used by large textures are released when the textures are destroyed.
+    ///
+    /// \remarks   The method can only be called by an immediate context outside of a render pass.
+    ///            It must not be called while other threads record commands that use the buffers.
+    ///            The Vulkan buffer handle of a moved buffer changes.
+    VIRTUAL Bool METHOD(DefragmentMemory)(THIS_
+                                          const MemoryDefragmentationAttribsVk REF Attribs) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -95,6 +132,7 @@ DILIGENT_END_INTERFACE
 
 #    define IDeviceContextVk_TransitionImageLayout(This, ...) CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout, This, __VA_ARGS__)
 #    define IDeviceContextVk_BufferMemoryBarrier(This, ...)   CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,   This, __VA_ARGS__)
+#    define IDeviceContextVk_DefragmentMemory(This, ...)      CALL_IFACE_METHOD(DeviceContextVk, DefragmentMemory,      This, __VA_ARGS__)
 
 // clang-format on
 
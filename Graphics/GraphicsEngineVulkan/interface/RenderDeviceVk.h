@@ -38,6 +38,59 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceVk =
     {0xab8cf3a6, 0xd959, 0x41c1, {0xae, 0x0, 0xa5, 0x8a, 0xe9, 0x82, 0xe, 0x6a}};
 
+/// Vulkan device memory statistics, see IRenderDeviceVk::GetMemoryStatsVk().
+struct MemoryStatsVk
+{
+    /// The total size of device-local memory used by resources, in bytes.
+    Uint64 DeviceLocalUsedSize      DEFAULT_INITIALIZER(0);
+
+    /// The total size of device-local memory pages allocated by the engine, in bytes.
+    Uint64 DeviceLocalAllocatedSize DEFAULT_INITIALIZER(0);
+
+    /// The total size of host-visible memory used by resources and upload heaps, in bytes.
+    Uint64 HostVisibleUsedSize      DEFAULT_INITIALIZER(0);
+
+    /// The total size of host-visible memory pages allocated by the engine, in bytes.
+    Uint64 HostVisibleAllocatedSize DEFAULT_INITIALIZER(0);
+
+    /// The number of pages that hold small allocations.
+    Uint32 NumSmallPages            DEFAULT_INITIALIZER(0);
+
+    /// The number of pages that hold regular allocations.
+    Uint32 NumRegularPages          DEFAULT_INITIALIZER(0);
+
+    /// The number of dedicated pages, each holding a single resource.
+    Uint32 NumDedicatedPages        DEFAULT_INITIALIZER(0);
+
+    /// The total budget of device-local heaps reported by VK_EXT_memory_budget extension, in bytes.
+    /// Zero if the extension is not enabled, see EngineVkCreateInfo::UseMemoryBudget.
+    Uint64 DeviceLocalBudget        DEFAULT_INITIALIZER(0);
+
+    /// The total usage of device-local heaps reported by VK_EXT_memory_budget extension
+    /// by all processes, in bytes. Zero if the extension is not enabled.
+    Uint64 DeviceLocalUsage         DEFAULT_INITIALIZER(0);
+
+    /// The total number of bytes moved by the memory defragmentation, see IDeviceContextVk::DefragmentMemory().
+    Uint64 NumBytesMoved            DEFAULT_INITIALIZER(0);
+
+    /// The total number of allocations moved by the memory defragmentation.
+    Uint32 NumAllocationsMoved      DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryStatsVk MemoryStatsVk;
+
+/// Vulkan pipeline statistics, see IRenderDeviceVk::GetPipelineStatsVk().
+struct PipelineStatsVk
+{
+    /// The number of graphics pipeline states created while extended dynamic state is in use,
+    /// see EngineVkCreateInfo::UseExtendedDynamicState.
+    Uint32 NumGraphicsPipelineStates  DEFAULT_INITIALIZER(0);
+
+    /// The number of graphics pipeline states that reused the Vulkan pipeline of another
+    /// pipeline state that only differs by the states that are set dynamically.
+    Uint32 NumSharedGraphicsPipelines DEFAULT_INITIALIZER(0);
+};
+typedef struct PipelineStatsVk PipelineStatsVk;
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -166,6 +219,14 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
     /// Returns Vulkan-specific device features, see Diligent::DeviceFeaturesVk.
     VIRTUAL void METHOD(GetDeviceFeaturesVk)(THIS_
                                              DeviceFeaturesVk REF FeaturesVk) CONST PURE;
+
+    /// Returns device memory statistics, see Diligent::MemoryStatsVk.
+    VIRTUAL void METHOD(GetMemoryStatsVk)(THIS_
+                                          MemoryStatsVk REF Stats) PURE;
+
+    /// Returns pipeline statistics, see Diligent::PipelineStatsVk.
+    VIRTUAL void METHOD(GetPipelineStatsVk)(THIS_
+                                            PipelineStatsVk REF Stats) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -184,6 +245,8 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
 #    define IRenderDeviceVk_GetDeviceFeaturesVk(This, ...)            CALL_IFACE_METHOD(RenderDeviceVk, GetDeviceFeaturesVk,            This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetMemoryStatsVk(This, ...)               CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryStatsVk,               This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetPipelineStatsVk(This, ...)             CALL_IFACE_METHOD(RenderDeviceVk, GetPipelineStatsVk,             This, __VA_ARGS__)
 
 // clang-format on
 
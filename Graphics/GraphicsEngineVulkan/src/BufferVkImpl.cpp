@@ -180,6 +180,19 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
         ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
 
+    // In descriptor buffer mode, descriptors of uniform, storage and texel buffers are written using buffer device
+    // addresses. Dynamic buffers without a backing buffer use the address of the dynamic heap buffer instead.
+    // Sparse buffers are bound to memory objects that are not allocated with VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT.
+    if (pRenderDeviceVk->UseDescriptorBuffers() &&
+        (m_Desc.BindFlags & (BIND_UNIFORM_BUFFER | BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS)) != 0 &&
+        m_Desc.Usage != USAGE_SPARSE &&
+        (m_Desc.Usage != USAGE_DYNAMIC || RequiresBackingBuffer))
+    {
+        VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
+    m_VkUsage = VkBuffCI.usage;
+
     if (m_Desc.Usage == USAGE_SPARSE)
     {
         VkBuffCI.flags =
@@ -319,6 +332,9 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
         VERIFY(!AlignToNonCoherentAtomSize || (m_BufferMemoryAlignedOffset + MemReqs.size) % DeviceLimits.nonCoherentAtomSize == 0, "End offset is not properly aligned");
 
+        if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+            m_DeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VulkanBuffer);
+
 #ifdef DILIGENT_DEBUG
         if ((m_Desc.BindFlags & BIND_RAY_TRACING) != 0)
         {
@@ -543,6 +559,22 @@ VkBuffer BufferVkImpl::GetVkBuffer() const
     }
 }
 
+bool BufferVkImpl::IsRelocatable() const
+{
+    // Vertex, index and indirect argument buffers are bound by their Vulkan handle when
+    // commands are recorded and are never referenced by views or descriptor sets.
+    constexpr BIND_FLAGS RelocatableBindFlags = BIND_VERTEX_BUFFER | BIND_INDEX_BUFFER | BIND_INDIRECT_DRAW_ARGS;
+
+    const VulkanUtilities::MemoryPage* pPage = m_MemoryAllocation.Page;
+    return (m_Desc.Usage == USAGE_DEFAULT || m_Desc.Usage == USAGE_IMMUTABLE) &&
+        (m_Desc.BindFlags & ~RelocatableBindFlags) == 0 &&
+        PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) == 1 &&
+        m_DeviceAddress == 0 &&
+        pPage != nullptr &&
+        pPage->GetCPUMemory() == nullptr &&
+        pPage->GetSizeClass() != VulkanUtilities::MemoryPageSizeClass::Dedicated;
+}
+
 void BufferVkImpl::SetAccessFlags(VkAccessFlags AccessFlags)
 {
     SetState(VkAccessFlagsToResourceStates(AccessFlags));
@@ -555,6 +587,10 @@ VkAccessFlags BufferVkImpl::GetAccessFlags() const
 
 VkDeviceAddress BufferVkImpl::GetVkDeviceAddress() const
 {
+    // The address of non-sparse buffers is queried once after the memory is bound
+    if (m_DeviceAddress != 0)
+        return m_DeviceAddress;
+
     constexpr BIND_FLAGS DeviceAddressFlags = BIND_RAY_TRACING;
 
     if (m_VulkanBuffer != VK_NULL_HANDLE && (m_Desc.BindFlags & DeviceAddressFlags) != 0)
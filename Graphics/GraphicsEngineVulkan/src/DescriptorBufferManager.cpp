@@ -0,0 +1,278 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "DescriptorBufferManager.hpp"
+#include "RenderDeviceVkImpl.hpp"
+
+namespace Diligent
+{
+
+void DescriptorBufferSetLayout::WriteImmutableSamplers(const VulkanUtilities::LogicalDevice& LogicalDevice, Uint8* pSetData) const
+{
+    for (const Descriptor& Sampler : ImmutableSamplers)
+    {
+        VERIFY_EXPR(Sampler.ImmutableSampler != VK_NULL_HANDLE);
+
+        VkDescriptorGetInfoEXT DescriptorInfo{};
+        DescriptorInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        DescriptorInfo.type          = VK_DESCRIPTOR_TYPE_SAMPLER;
+        DescriptorInfo.data.pSampler = &Sampler.ImmutableSampler;
+        LogicalDevice.GetDescriptor(DescriptorInfo, Sampler.Size, pSetData + Sampler.Offset);
+    }
+}
+
+
+void DescriptorBufferAllocation::Release()
+{
+    if (pManager != nullptr)
+    {
+        pManager->Free(UnalignedOffset, Size, CmdQueueMask);
+        Reset();
+    }
+}
+
+
+static VkDeviceSize GetDescriptorBufferSize(const VulkanUtilities::PhysicalDevice& PhysicalDevice, VkDeviceSize Size)
+{
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props = PhysicalDevice.GetExtProperties().DescriptorBuffer;
+
+    // All descriptors are accessed relative to the single bound buffer address
+    const VkDeviceSize MaxSize = std::min(Props.maxResourceDescriptorBufferRange, Props.maxSamplerDescriptorBufferRange);
+    if (Size > MaxSize)
+    {
+        LOG_WARNING_MESSAGE("Requested descriptor buffer size (", FormatMemorySize(Size, 2), ") exceeds the maximum descriptor buffer range (",
+                            FormatMemorySize(MaxSize, 2), ") supported by the device and will be clamped.");
+        Size = MaxSize;
+    }
+    return Size;
+}
+
+DescriptorBufferManager::DescriptorBufferManager(RenderDeviceVkImpl& DeviceVkImpl, VkDeviceSize Size) noexcept(false) :
+    // clang-format off
+    m_DeviceVkImpl   {DeviceVkImpl},
+    m_Usage
+    {
+        VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+        VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT  |
+        VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT
+    },
+    m_OffsetAlignment{DeviceVkImpl.GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment},
+    m_AllocationsMgr
+    {
+        StaticCast<size_t>(GetDescriptorBufferSize(DeviceVkImpl.GetPhysicalDevice(), Size)),
+        GetRawAllocator()
+    }
+// clang-format on
+{
+    VERIFY(IsPowerOfTwo(m_OffsetAlignment), "Descriptor buffer offset alignment (", m_OffsetAlignment, ") must be power of 2");
+
+    const VulkanUtilities::LogicalDevice&  LogicalDevice  = m_DeviceVkImpl.GetLogicalDevice();
+    const VulkanUtilities::PhysicalDevice& PhysicalDevice = m_DeviceVkImpl.GetPhysicalDevice();
+
+    VkBufferCreateInfo VkBuffCI{};
+    VkBuffCI.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    VkBuffCI.size        = m_AllocationsMgr.GetMaxSize();
+    VkBuffCI.usage       = m_Usage;
+    VkBuffCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    m_VkBuffer                   = LogicalDevice.CreateBuffer(VkBuffCI, "Descriptor buffer");
+    VkMemoryRequirements MemReqs = LogicalDevice.GetBufferMemoryRequirements(m_VkBuffer);
+
+    VkMemoryAllocateFlagsInfo FlagsInfo{};
+    FlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+    FlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
+    VkMemoryAllocateInfo MemAlloc{};
+    MemAlloc.sType          = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    MemAlloc.pNext          = &FlagsInfo;
+    MemAlloc.allocationSize = MemReqs.size;
+
+    // Prefer device-local host-visible memory that is read by the GPU directly
+    MemAlloc.memoryTypeIndex = PhysicalDevice.GetMemoryTypeIndex(MemReqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (MemAlloc.memoryTypeIndex == VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex)
+        MemAlloc.memoryTypeIndex = PhysicalDevice.GetMemoryTypeIndex(MemReqs.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (MemAlloc.memoryTypeIndex == VulkanUtilities::PhysicalDevice::InvalidMemoryTypeIndex)
+        LOG_ERROR_AND_THROW("Failed to find host-visible coherent memory type for the descriptor buffer");
+
+    m_BufferMemory = LogicalDevice.AllocateDeviceMemory(MemAlloc, "Host-visible memory for descriptor buffer");
+
+    void*    Data = nullptr;
+    VkResult err  = LogicalDevice.MapMemory(m_BufferMemory, 0, MemAlloc.allocationSize, 0, &Data);
+    CHECK_VK_ERROR_AND_THROW(err, "Failed to map descriptor buffer memory");
+    m_CPUAddress = static_cast<Uint8*>(Data);
+
+    err = LogicalDevice.BindBufferMemory(m_VkBuffer, m_BufferMemory, 0 /*offset*/);
+    CHECK_VK_ERROR_AND_THROW(err, "Failed to bind descriptor buffer memory");
+
+    m_DeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VkBuffer);
+    VERIFY(m_DeviceAddress % m_OffsetAlignment == 0, "Descriptor buffer address is not properly aligned");
+
+    LOG_INFO_MESSAGE("Descriptor buffer created. Total buffer size: ", FormatMemorySize(m_AllocationsMgr.GetMaxSize(), 2));
+}
+
+DescriptorBufferManager::~DescriptorBufferManager()
+{
+    VERIFY(m_BufferMemory == VK_NULL_HANDLE && m_VkBuffer == VK_NULL_HANDLE, "Vulkan resources must be explicitly released with Destroy()");
+    DEV_CHECK_ERR(m_AllocationCounter == 0, m_AllocationCounter, " descriptor buffer allocation(s) have not been returned to the manager");
+
+    const size_t Size = m_AllocationsMgr.GetMaxSize();
+    LOG_INFO_MESSAGE("Descriptor buffer usage stats:\n"
+                     "                       Total size: ",
+                     FormatMemorySize(Size, 2),
+                     ". Peak allocated size: ", FormatMemorySize(m_PeakUsedSize, 2, Size),
+                     ". Peak utilization: ",
+                     std::fixed, std::setprecision(1), static_cast<double>(m_PeakUsedSize) / static_cast<double>(std::max(Size, size_t{1})) * 100.0, '%');
+}
+
+void DescriptorBufferManager::Destroy()
+{
+    if (m_VkBuffer)
+    {
+        m_DeviceVkImpl.GetLogicalDevice().UnmapMemory(m_BufferMemory);
+        m_DeviceVkImpl.SafeReleaseDeviceObject(std::move(m_VkBuffer), ~Uint64{0});
+        m_DeviceVkImpl.SafeReleaseDeviceObject(std::move(m_BufferMemory), ~Uint64{0});
+    }
+    m_CPUAddress    = nullptr;
+    m_DeviceAddress = 0;
+}
+
+DescriptorBufferAllocation DescriptorBufferManager::Allocate(Uint64 CommandQueueMask, VkDeviceSize Size)
+{
+    VERIFY_EXPR(Size > 0);
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    VariableSizeAllocationsManager::Allocation Allocation = m_AllocationsMgr.Allocate(StaticCast<size_t>(Size), StaticCast<size_t>(m_OffsetAlignment));
+    if (!Allocation.IsValid())
+    {
+        LOG_ERROR_MESSAGE("Failed to allocate ", Size, " bytes from the descriptor buffer. Increase EngineVkCreateInfo::DescriptorBufferSize.");
+        return {};
+    }
+    m_PeakUsedSize = std::max(m_PeakUsedSize, m_AllocationsMgr.GetUsedSize());
+
+#ifdef DILIGENT_DEVELOPMENT
+    ++m_AllocationCounter;
+#endif
+
+    const VkDeviceSize Offset = AlignUp(VkDeviceSize{Allocation.UnalignedOffset}, m_OffsetAlignment);
+    return {Offset, Allocation.UnalignedOffset, Allocation.Size, m_CPUAddress + Offset, CommandQueueMask, *this};
+}
+
+void DescriptorBufferManager::Free(VkDeviceSize Offset, VkDeviceSize Size, Uint64 CmdQueueMask)
+{
+    class DescriptorBufferRangeDeleter
+    {
+    public:
+        // clang-format off
+        DescriptorBufferRangeDeleter(DescriptorBufferManager& _Mgr,
+                                     VkDeviceSize             _Offset,
+                                     VkDeviceSize             _Size) noexcept :
+            Mgr   {&_Mgr   },
+            Offset{_Offset },
+            Size  {_Size   }
+        {}
+
+        DescriptorBufferRangeDeleter             (const DescriptorBufferRangeDeleter&) = delete;
+        DescriptorBufferRangeDeleter& operator = (const DescriptorBufferRangeDeleter&) = delete;
+        DescriptorBufferRangeDeleter& operator = (      DescriptorBufferRangeDeleter&&)= delete;
+
+        DescriptorBufferRangeDeleter(DescriptorBufferRangeDeleter&& rhs) noexcept :
+            Mgr   {rhs.Mgr   },
+            Offset{rhs.Offset},
+            Size  {rhs.Size  }
+        {
+            rhs.Mgr = nullptr;
+        }
+        // clang-format on
+
+        ~DescriptorBufferRangeDeleter()
+        {
+            if (Mgr != nullptr)
+            {
+                std::lock_guard<std::mutex> Lock{Mgr->m_Mutex};
+                Mgr->m_AllocationsMgr.Free(StaticCast<size_t>(Offset), StaticCast<size_t>(Size));
+#ifdef DILIGENT_DEVELOPMENT
+                --Mgr->m_AllocationCounter;
+#endif
+            }
+        }
+
+    private:
+        DescriptorBufferManager* Mgr;
+        VkDeviceSize             Offset;
+        VkDeviceSize             Size;
+    };
+
+    // The range may still be used by the GPU, so it is returned to the manager through the release queue
+    m_DeviceVkImpl.SafeReleaseDeviceObject(DescriptorBufferRangeDeleter{*this, Offset, Size}, CmdQueueMask);
+}
+
+
+VkDeviceSize DynamicDescriptorBufferAllocator::Allocate(VkDeviceSize Size, Uint8*& pData)
+{
+    Size = AlignUp(Size, m_GlobalMgr.GetOffsetAlignment());
+
+    if (m_AllocatedPages.empty() || m_CurrOffset + Size > m_AllocatedPages.back().GetSize())
+    {
+        // The queue mask is not known until the pages are released
+        DescriptorBufferAllocation Page = m_GlobalMgr.Allocate(0, std::max(m_PageSize, Size));
+        if (!Page)
+        {
+            pData = nullptr;
+            return ~VkDeviceSize{0};
+        }
+        m_AllocatedPages.emplace_back(std::move(Page));
+        m_CurrOffset = 0;
+    }
+
+    const DescriptorBufferAllocation& Page = m_AllocatedPages.back();
+
+    const VkDeviceSize Offset = Page.GetOffset() + m_CurrOffset;
+    pData                     = Page.GetCPUAddress() + m_CurrOffset;
+    m_CurrOffset += Size;
+    return Offset;
+}
+
+void DynamicDescriptorBufferAllocator::ReleasePages(Uint64 QueueMask)
+{
+    // Pages are returned to the global manager through the release queue of the queue that used them
+    for (DescriptorBufferAllocation& Page : m_AllocatedPages)
+        Page.SetCommandQueueMask(QueueMask);
+
+    m_PeakPageCount = std::max(m_PeakPageCount, m_AllocatedPages.size());
+    m_AllocatedPages.clear();
+    m_CurrOffset = 0;
+}
+
+DynamicDescriptorBufferAllocator::~DynamicDescriptorBufferAllocator()
+{
+    DEV_CHECK_ERR(m_AllocatedPages.empty(), "All allocated pages must be returned to the descriptor buffer manager");
+    LOG_INFO_MESSAGE(m_Name, " peak descriptor buffer page count: ", m_PeakPageCount);
+}
+
+} // namespace Diligent
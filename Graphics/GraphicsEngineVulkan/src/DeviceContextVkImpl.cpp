@@ -31,6 +31,8 @@
 
 #include <sstream>
 #include <vector>
+#include <cstring>
+#include <algorithm>
 
 #include "RenderDeviceVkImpl.hpp"
 #include "PipelineStateVkImpl.hpp"
@@ -100,6 +102,8 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*      pRefCounters,
     }
 // clang-format on
 {
+    m_CommandBuffer.SetUseSynchronization2(pDeviceVkImpl->GetLogicalDevice().GetEnabledExtFeatures().Synchronization2.synchronization2 != VK_FALSE);
+
     if (!IsDeferred())
     {
         PrepareCommandPool(GetCommandQueueId());
@@ -122,6 +126,15 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*      pRefCounters,
     m_DynamicBufferOffsets.reserve(64);
     m_MappedBuffers.reserve(32);
 
+    if (DescriptorBufferManager* pDescrBufferMgr = pDeviceVkImpl->GetDescriptorBufferManager())
+    {
+        m_pDynamicDescrBufferAllocator = std::make_unique<DynamicDescriptorBufferAllocator>(
+            *pDescrBufferMgr,
+            GetContextObjectName("Dynamic descriptor buffer allocator", Desc.IsDeferred, Desc.ContextId),
+            pDeviceVkImpl->GetProperties().DynamicDescriptorBufferPageSize);
+        m_DynamicBufferDeviceAddress = pDeviceVkImpl->GetDynamicMemoryManager().GetVkDeviceAddress();
+    }
+
     CreateASCompactedSizeQueryPool();
 }
 
@@ -157,6 +170,7 @@ DeviceContextVkImpl::~DeviceContextVkImpl()
     DEV_CHECK_ERR(m_UploadHeap.GetStalePagesCount()                  == 0, "All allocated upload heap pages must have been released at this point");
     DEV_CHECK_ERR(m_DynamicHeap.GetAllocatedMasterBlockCount()       == 0, "All allocated dynamic heap master blocks must have been released");
     DEV_CHECK_ERR(m_DynamicDescrSetAllocator.GetAllocatedPoolCount() == 0, "All allocated dynamic descriptor set pools must have been released at this point");
+    DEV_CHECK_ERR(!m_pDynamicDescrBufferAllocator || m_pDynamicDescrBufferAllocator->GetAllocatedPageCount() == 0, "All allocated dynamic descriptor buffer pages must have been released at this point");
     // clang-format on
 
     // NB: If there are any command buffers in the release queue, they will always be returned to the pool
@@ -315,6 +329,11 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
             const GraphicsPipelineDesc& GraphicsPipeline = m_pPipelineState->GetGraphicsPipelineDesc();
             m_CommandBuffer.BindGraphicsPipeline(vkPipeline);
 
+            if (const PipelineStateVkImpl::DynamicGraphicsState* pDynamicState = m_pPipelineState->GetDynamicGraphicsState())
+            {
+                CommitDynamicGraphicsState(*pDynamicState);
+            }
+
             if (CommitStates)
             {
                 m_CommandBuffer.SetStencilReference(m_StencilRef);
@@ -364,6 +383,7 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
     {
         // Do not clear DescriptorSetBaseInd and DynamicOffsetCount!
         BindInfo.SetInfo[sign].vkSets.fill(VK_NULL_HANDLE);
+        BindInfo.SetInfo[sign].pPushSetSignature = nullptr;
     }
 #endif
 
@@ -419,22 +439,33 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
 {
     VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
 
+    if (m_pDynamicDescrBufferAllocator)
+    {
+        CommitDescriptorBufferSets(BindInfo, CommitSRBMask);
+        return;
+    }
+
     const Uint32 FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
     const Uint32 LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
     VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
 
-    // Bind all descriptor sets in a single BindDescriptorSets call
-    uint32_t     DynamicOffsetCount = 0;
-    uint32_t     TotalSetCount      = 0;
-    const Uint32 FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+
+    // Bind all descriptor sets in a single BindDescriptorSets call.
+    // The only exception is the push descriptor set, which splits the sets into two ranges.
+    uint32_t DynamicOffsetCount = 0;
+    uint32_t TotalSetCount      = 0;
+    Uint32   FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
     for (Uint32 sign = FirstSign; sign <= LastSign; ++sign)
     {
         ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[sign];
-        VERIFY(SetInfo.vkSets[0] != VK_NULL_HANDLE || (CommitSRBMask & (1u << sign)) == 0,
+
+        const bool HasDescriptorSets = SetInfo.vkSets[0] != VK_NULL_HANDLE || SetInfo.pPushSetSignature != nullptr;
+        VERIFY(HasDescriptorSets || (CommitSRBMask & (1u << sign)) == 0,
                "At least one descriptor set in the stale SRB must not be NULL. Empty SRBs should not be marked as stale by CommitShaderResources()");
 
-        VERIFY((BindInfo.ActiveSRBMask & (1u << sign)) != 0 || SetInfo.vkSets[0] == VK_NULL_HANDLE, "Descriptor sets must be null for inactive slots");
-        if (SetInfo.vkSets[0] == VK_NULL_HANDLE)
+        VERIFY((BindInfo.ActiveSRBMask & (1u << sign)) != 0 || !HasDescriptorSets, "Descriptor sets must be null for inactive slots");
+        if (!HasDescriptorSets)
         {
             VERIFY_EXPR(SetInfo.vkSets[1] == VK_NULL_HANDLE);
             continue;
@@ -447,7 +478,8 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
         const ShaderResourceCacheVk* pResourceCache = BindInfo.ResourceCaches[sign];
         DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null, but corresponding descriptor set is not");
 
-        m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[0];
+        if (SetInfo.vkSets[0] != VK_NULL_HANDLE)
+            m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[0];
         if (SetInfo.vkSets[1] != VK_NULL_HANDLE)
             m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[1];
 
@@ -461,6 +493,26 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
             DynamicOffsetCount += SetInfo.DynamicOffsetCount;
         }
 
+        if (SetInfo.pPushSetSignature != nullptr)
+        {
+            // The push descriptor set is always the last set of the signature and contains no
+            // dynamic offsets. Bind the sets accumulated so far, push the descriptors and
+            // start the new range right after the push descriptor set.
+            if (TotalSetCount > 0)
+            {
+                m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                                   m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+            }
+
+            const Uint32 PushSetInd = FirstSetToBind + TotalSetCount;
+            VERIFY_EXPR(PushSetInd == SetInfo.BaseInd + SetInfo.pPushSetSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
+            SetInfo.pPushSetSignature->PushDynamicResources(*pResourceCache, m_CommandBuffer, m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, PushSetInd);
+
+            FirstSetToBind     = PushSetInd + 1;
+            TotalSetCount      = 0;
+            DynamicOffsetCount = 0;
+        }
+
 #ifdef DILIGENT_DEVELOPMENT
         SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
 #endif
@@ -474,9 +526,99 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
     // (either compute or graphics, according to the pipelineBindPoint). Any bindings that were previously
     // applied via these sets are no longer valid.
     // https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBindDescriptorSets.html
+    if (TotalSetCount > 0)
+    {
+        m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                           m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+    }
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+}
+
+void DeviceContextVkImpl::CommitDescriptorBufferSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    VERIFY_EXPR(m_pDynamicDescrBufferAllocator);
+
+    const Uint32 FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
+    const Uint32 LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
+    VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
+
     VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
-    m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
-                                       m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+
+    // All descriptor sets are suballocated from the single descriptor buffer, so the buffer is
+    // bound only once per command buffer, and binding the sets only sets the offsets.
+    const DescriptorBufferManager& DescrBufferMgr = *m_pDevice->GetDescriptorBufferManager();
+    m_CommandBuffer.BindDescriptorBuffer(DescrBufferMgr.GetDeviceAddress(), DescrBufferMgr.GetUsage());
+
+    static constexpr std::array<uint32_t, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)> BufferIndices = {};
+
+    Uint32 FirstSetToBind = BindInfo.SetInfo[FirstSign].BaseInd;
+    Uint32 TotalSetCount  = 0;
+    for (Uint32 sign = FirstSign; sign <= LastSign; ++sign)
+    {
+        ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[sign];
+
+        const PipelineResourceSignatureVkImpl* pSignature     = m_pPipelineState->GetResourceSignature(sign);
+        const ShaderResourceCacheVk*           pResourceCache = BindInfo.ResourceCaches[sign];
+        const Uint32                           NumSets        = pSignature != nullptr ? pSignature->GetNumDescriptorSets() : 0;
+        if (NumSets == 0 || (BindInfo.ActiveSRBMask & (1u << sign)) == 0 || pResourceCache == nullptr)
+        {
+            VERIFY(NumSets == 0 || (CommitSRBMask & (1u << sign)) == 0, "Resource cache of the stale SRB must not be null");
+            continue;
+        }
+
+        if (CommitSRBMask & (1u << sign))
+        {
+            for (Uint32 s = 0; s < NumSets; ++s)
+            {
+                const DescriptorBufferSetLayout& Layout = pSignature->GetDescriptorBufferLayout(s);
+                if (Layout.Persistent && !pResourceCache->HasDynamicBufferOffsets(s))
+                {
+                    const DescriptorBufferAllocation& Allocation = pResourceCache->GetDescriptorSet(s).GetDescriptorBufferAllocation();
+                    VERIFY(Allocation, "Persistent descriptor set data must have been allocated by InitSRBResourceCache()");
+                    SetInfo.DescrBufferOffsets[s] = Allocation.GetOffset();
+                }
+                else
+                {
+                    // Sets with dynamic resources or buffers with dynamic offsets are written every time they are bound,
+                    // which takes the current dynamic buffer allocations into account.
+                    Uint8*             pSetData = nullptr;
+                    const VkDeviceSize Offset   = m_pDynamicDescrBufferAllocator->Allocate(Layout.Size, pSetData);
+                    if (Offset == ~VkDeviceSize{0})
+                        return;
+
+                    pSignature->WriteDescriptorBufferSet(*pResourceCache, s, pSetData, this);
+                    SetInfo.DescrBufferOffsets[s] = Offset;
+                }
+            }
+        }
+
+        if (FirstSetToBind + TotalSetCount != SetInfo.BaseInd)
+        {
+            // vkCmdSetDescriptorBufferOffsetsEXT sets a contiguous range of sets
+            VERIFY_EXPR(SetInfo.BaseInd > FirstSetToBind + TotalSetCount);
+            if (TotalSetCount > 0)
+            {
+                m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                                           BufferIndices.data(), m_DescriptorBufferOffsets.data());
+            }
+            FirstSetToBind = SetInfo.BaseInd;
+            TotalSetCount  = 0;
+        }
+
+        for (Uint32 s = 0; s < NumSets; ++s)
+            m_DescriptorBufferOffsets[TotalSetCount++] = SetInfo.DescrBufferOffsets[s];
+
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+    }
+
+    if (TotalSetCount > 0)
+    {
+        m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                                   BufferIndices.data(), m_DescriptorBufferOffsets.data());
+    }
 
     BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
 }
@@ -499,7 +641,12 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
         DEV_CHECK_ERR((BindInfo.StaleSRBMask & BindInfo.ActiveSRBMask) == 0, "CommitDescriptorSets() must be called before validation.");
 
         const ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[i];
-        const Uint32                               DSCount = pSign->GetNumDescriptorSets();
+        // Push descriptor set has no descriptor set handle, and no handles are used with descriptor buffers
+        const Uint32 DSCount = m_pDynamicDescrBufferAllocator ?
+            0 :
+            pSign->GetNumDescriptorSets() - (SetInfo.pPushSetSignature != nullptr ? 1 : 0);
+        DEV_CHECK_ERR((SetInfo.pPushSetSignature != nullptr) == pSign->HasPushDescriptorSet(),
+                      "push descriptor set usage of the SRB at binding index ", i, " is not consistent with resource signature '", pSign->GetDesc().Name, "'.");
         for (Uint32 s = 0; s < DSCount; ++s)
         {
             DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
@@ -565,7 +712,14 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     BindInfo.Set(SRBIndex, pResBindingVkImpl);
     // We must not clear entire ResInfo as DescriptorSetBaseInd and DynamicOffsetCount
     // are set by SetPipelineState().
-    SetInfo.vkSets = {};
+    SetInfo.vkSets            = {};
+    SetInfo.pPushSetSignature = nullptr;
+
+    if (m_pDynamicDescrBufferAllocator)
+    {
+        // Descriptor set data is written to the descriptor buffer by CommitDescriptorBufferSets()
+        return;
+    }
 
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
@@ -582,6 +736,16 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         VERIFY_EXPR(DSIndex == pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
         VERIFY_EXPR(const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(DSIndex).GetVkDescriptorSet() == VK_NULL_HANDLE);
 
+        if (pSignature->HasPushDescriptorSet())
+        {
+            // Dynamic resources will be pushed directly into the command buffer by CommitDescriptorSets()
+            // when the pipeline layout is known.
+            SetInfo.pPushSetSignature = pSignature;
+            ++DSIndex;
+            VERIFY_EXPR(DSIndex == ResourceCache.GetNumDescriptorSets());
+            return;
+        }
+
         const VkDescriptorSetLayout vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
 
         VkDescriptorSet vkDynamicDescrSet   = VK_NULL_HANDLE;
@@ -597,7 +761,7 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
 
         // Write all dynamic resource descriptors
-        pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
+        pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet, m_DescriptorTemplateData);
 
         SetInfo.vkSets[DSIndex] = vkDynamicDescrSet;
         ++DSIndex;
@@ -1424,6 +1588,15 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    // Dynamic descriptor buffer pages are returned to the global descriptor buffer manager the same way.
+    if (m_pDynamicDescrBufferAllocator)
+        m_pDynamicDescrBufferAllocator->ReleasePages(QueueMask);
+
+    // Events of split barriers are returned to the pool once all command buffers that use them are complete.
+    m_pDevice->DisposeSplitBarrierEvents(std::move(m_StaleSplitBarrierEvents), QueueMask);
+    m_StaleSplitBarrierEvents.clear();
+    m_ResolvedSplitBarriers.clear();
+
     EndFrame();
 }
 
@@ -1470,6 +1643,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
             m_DvpDebugGroupCount = 0;
 #endif
 
+            ResolveSplitBarriers();
             m_CommandBuffer.FlushBarriers();
             m_CommandBuffer.EndCommandBuffer();
 
@@ -1611,6 +1785,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), std::move(vkCmdBuffs[buff_idx]), SubmittedFenceValue);
     }
     VERIFY_EXPR(buff_idx == vkCmdBuffs.size());
+    VERIFY(m_PendingSplitBarriers.empty(), "All begin-split barriers must have been resolved before the command buffer is submitted");
 
     m_State    = {};
     m_BindInfo = {};
@@ -1653,6 +1828,7 @@ void DeviceContextVkImpl::InvalidateState()
     m_DynamicRenderingInfo.reset();
 
     VERIFY(!m_CommandBuffer.IsInRenderScope(), "Invalidating context with unfinished render pass");
+    ResolveSplitBarriers();
     m_CommandBuffer.Reset();
 }
 
@@ -1765,6 +1941,104 @@ void DeviceContextVkImpl::CommitScissorRects()
     m_CommandBuffer.SetScissorRects(0, m_NumScissorRects, VkScissorRects);
 }
 
+void DeviceContextVkImpl::CommitDynamicGraphicsState(const PipelineStateVkImpl::DynamicGraphicsState& State)
+{
+    const SharedPipelineCache* pSharedCache = m_pDevice->GetSharedPipelineCache();
+    VERIFY_EXPR(pSharedCache != nullptr);
+    const ExtendedDynamicStates& EDS = pSharedCache->GetDynamicStates();
+
+    PipelineStateVkImpl::DynamicGraphicsState& Committed = m_CommittedDynamicState;
+
+    // Only the states that differ from the ones set in the command buffer are committed
+    const bool CommitAll = !m_State.DynamicGraphicsStateValid;
+
+    if (CommitAll || Committed.CullMode != State.CullMode)
+        m_CommandBuffer.SetCullMode(State.CullMode);
+    if (CommitAll || Committed.FrontFace != State.FrontFace)
+        m_CommandBuffer.SetFrontFace(State.FrontFace);
+
+    // Mesh pipelines do not use input assembly states, so they are invalidated when a mesh pipeline is bound
+    const bool InputAssemblyValid = !CommitAll && Committed.Topology != VK_PRIMITIVE_TOPOLOGY_MAX_ENUM;
+    if (State.Topology != VK_PRIMITIVE_TOPOLOGY_MAX_ENUM)
+    {
+        if (!InputAssemblyValid || Committed.Topology != State.Topology)
+            m_CommandBuffer.SetPrimitiveTopology(State.Topology);
+        if (EDS.DepthBiasAndRestart && (!InputAssemblyValid || Committed.PrimitiveRestartEnable != State.PrimitiveRestartEnable))
+            m_CommandBuffer.SetPrimitiveRestartEnable(State.PrimitiveRestartEnable);
+        // Patch control points are only dynamic in pipelines that use patch list topology
+        if (EDS.PatchControlPoints && State.PatchControlPoints != 0 && (!InputAssemblyValid || Committed.PatchControlPoints != State.PatchControlPoints))
+            m_CommandBuffer.SetPatchControlPoints(State.PatchControlPoints);
+    }
+
+    if (CommitAll || Committed.DepthTestEnable != State.DepthTestEnable)
+        m_CommandBuffer.SetDepthTestEnable(State.DepthTestEnable);
+    if (CommitAll || Committed.DepthWriteEnable != State.DepthWriteEnable)
+        m_CommandBuffer.SetDepthWriteEnable(State.DepthWriteEnable);
+    if (CommitAll || Committed.DepthCompareOp != State.DepthCompareOp)
+        m_CommandBuffer.SetDepthCompareOp(State.DepthCompareOp);
+    if (CommitAll || Committed.StencilTestEnable != State.StencilTestEnable)
+        m_CommandBuffer.SetStencilTestEnable(State.StencilTestEnable);
+
+    // VkStencilOpState has no padding, so it can be compared with memcmp
+    const bool FrontStencilChanged = CommitAll || memcmp(&Committed.StencilFront, &State.StencilFront, sizeof(VkStencilOpState)) != 0;
+    const bool BackStencilChanged  = CommitAll || memcmp(&Committed.StencilBack, &State.StencilBack, sizeof(VkStencilOpState)) != 0;
+    if (FrontStencilChanged || BackStencilChanged)
+    {
+        auto SetStencilFace = [this](VkStencilFaceFlags FaceMask, const VkStencilOpState& OpState) {
+            m_CommandBuffer.SetStencilOp(FaceMask, OpState);
+            m_CommandBuffer.SetStencilCompareMask(FaceMask, OpState.compareMask);
+            m_CommandBuffer.SetStencilWriteMask(FaceMask, OpState.writeMask);
+        };
+        if (memcmp(&State.StencilFront, &State.StencilBack, sizeof(VkStencilOpState)) == 0)
+        {
+            SetStencilFace(VK_STENCIL_FACE_FRONT_AND_BACK, State.StencilFront);
+        }
+        else
+        {
+            if (FrontStencilChanged)
+                SetStencilFace(VK_STENCIL_FACE_FRONT_BIT, State.StencilFront);
+            if (BackStencilChanged)
+                SetStencilFace(VK_STENCIL_FACE_BACK_BIT, State.StencilBack);
+        }
+    }
+
+    if (EDS.DepthBiasAndRestart)
+    {
+        if (CommitAll || Committed.DepthBiasEnable != State.DepthBiasEnable)
+            m_CommandBuffer.SetDepthBiasEnable(State.DepthBiasEnable);
+
+        if (CommitAll ||
+            Committed.DepthBiasConstantFactor != State.DepthBiasConstantFactor ||
+            Committed.DepthBiasClamp != State.DepthBiasClamp ||
+            Committed.DepthBiasSlopeFactor != State.DepthBiasSlopeFactor)
+        {
+            m_CommandBuffer.SetDepthBias(State.DepthBiasConstantFactor, State.DepthBiasClamp, State.DepthBiasSlopeFactor);
+        }
+    }
+
+    if (EDS.PolygonMode && (CommitAll || Committed.PolygonMode != State.PolygonMode))
+        m_CommandBuffer.SetPolygonMode(State.PolygonMode);
+
+    if (EDS.DepthClampEnable && (CommitAll || Committed.DepthClampEnable != State.DepthClampEnable))
+        m_CommandBuffer.SetDepthClampEnable(State.DepthClampEnable);
+
+    if (EDS.ColorBlend && State.NumColorAttachments > 0)
+    {
+        const Uint32 NumAttachments   = State.NumColorAttachments;
+        const bool   AttachmentsValid = !CommitAll && Committed.NumColorAttachments >= NumAttachments;
+        if (!AttachmentsValid || memcmp(Committed.ColorBlendEnable.data(), State.ColorBlendEnable.data(), sizeof(VkBool32) * NumAttachments) != 0)
+            m_CommandBuffer.SetColorBlendEnable(0, NumAttachments, State.ColorBlendEnable.data());
+        if (!AttachmentsValid || memcmp(Committed.ColorBlendEquation.data(), State.ColorBlendEquation.data(), sizeof(VkColorBlendEquationEXT) * NumAttachments) != 0)
+            m_CommandBuffer.SetColorBlendEquation(0, NumAttachments, State.ColorBlendEquation.data());
+        if (!AttachmentsValid || memcmp(Committed.ColorWriteMask.data(), State.ColorWriteMask.data(), sizeof(VkColorComponentFlags) * NumAttachments) != 0)
+            m_CommandBuffer.SetColorWriteMask(0, NumAttachments, State.ColorWriteMask.data());
+    }
+
+    Committed = State;
+
+    m_State.DynamicGraphicsStateValid = true;
+}
+
 
 void DeviceContextVkImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
 {
@@ -2334,6 +2608,11 @@ void DeviceContextVkImpl::UpdateTexture(ITexture*                      pTexture,
     {
         UNSUPPORTED("Copying buffer to texture is not implemented");
     }
+    else if (pTexVk->IsHostUploadEnabled() &&
+             pTexVk->UpdateRegionOnHost(SubresData.pData, SubresData.Stride, SubresData.DepthStride, MipLevel, Slice, DstBox))
+    {
+        // The data has been written to the texture by the host, no commands are needed
+    }
     else
     {
         UpdateTextureRegion(SubresData.pData, SubresData.Stride, SubresData.DepthStride, *pTexVk,
@@ -2828,13 +3107,14 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
 
     EndRenderScope();
+    ResolveSplitBarriers();
 
     VkCommandBuffer vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
     VkResult        err       = vkEndCommandBuffer(vkCmdBuff);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to end command buffer");
     (void)err;
 
-    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff)};
+    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff, std::move(m_DeferredBufferRefs))};
     pCmdListVk->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
     m_CommandBuffer.Reset();
@@ -3137,9 +3417,91 @@ VkCommandBuffer DeviceContextVkImpl::GetVkCommandBuffer()
     return m_CommandBuffer.GetVkCmdBuffer();
 }
 
+Bool DeviceContextVkImpl::DefragmentMemory(const MemoryDefragmentationAttribsVk& Attribs)
+{
+    if (IsDeferred())
+    {
+        LOG_ERROR_MESSAGE("Memory can only be defragmented by immediate contexts");
+        return False;
+    }
+    if (m_pActiveRenderPass != nullptr)
+    {
+        LOG_ERROR_MESSAGE("Memory can't be defragmented inside a render pass");
+        return False;
+    }
+
+    return m_pDevice->GetMemoryDefragmenter().Defragment(*this, Attribs) ? True : False;
+}
+
+bool DeviceContextVkImpl::RelocateBuffer(BufferVkImpl& BufferVk)
+{
+    VERIFY_EXPR(BufferVk.IsRelocatable() && BufferVk.IsInKnownState());
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = m_pDevice->GetLogicalDevice();
+    VulkanUtilities::MemoryManager&       MemoryMgr     = m_pDevice->GetGlobalMemoryManager();
+
+    const VkMemoryRequirements        MemReqs       = LogicalDevice.GetBufferMemoryRequirements(BufferVk.m_VulkanBuffer);
+    VulkanUtilities::MemoryAllocation NewAllocation = MemoryMgr.AllocateForDefragmentation(MemReqs.size, MemReqs.alignment, *BufferVk.m_MemoryAllocation.Page);
+    if (!NewAllocation)
+        return false;
+
+    // The new buffer has the same parameters as the original one, so its memory requirements are identical
+    VkBufferCreateInfo BuffCI{};
+    BuffCI.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    BuffCI.size        = BufferVk.GetDesc().Size;
+    BuffCI.usage       = BufferVk.m_VkUsage;
+    BuffCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    VulkanUtilities::BufferWrapper NewBuffer     = LogicalDevice.CreateBuffer(BuffCI, BufferVk.GetDesc().Name);
+    const VkDeviceSize             AlignedOffset = AlignUp(NewAllocation.UnalignedOffset, MemReqs.alignment);
+    VERIFY_EXPR(NewAllocation.Size >= MemReqs.size + (AlignedOffset - NewAllocation.UnalignedOffset));
+    if (LogicalDevice.BindBufferMemory(NewBuffer, NewAllocation.Page->GetVkMemory(), AlignedOffset) != VK_SUCCESS)
+    {
+        LOG_ERROR_MESSAGE("Failed to bind memory of the relocated buffer '", BufferVk.GetDesc().Name, "'");
+        return false;
+    }
+
+    // Undefined buffer content does not need to be copied
+    const RESOURCE_STATE State = BufferVk.GetState();
+    if (State != RESOURCE_STATE_UNDEFINED)
+    {
+        EnsureVkCmdBuffer();
+
+        // Transition the original buffer without updating the state as it is released after the copy
+        TransitionBufferState(BufferVk, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, false);
+
+        VkBufferCopy CopyRegion{};
+        CopyRegion.size = BufferVk.GetDesc().Size;
+        m_CommandBuffer.CopyBuffer(BufferVk.m_VulkanBuffer, NewBuffer, 1, &CopyRegion);
+
+        // Make the data available to the commands that use the buffer in its current state
+        m_CommandBuffer.BufferMemoryBarrier(NewBuffer, VK_ACCESS_TRANSFER_WRITE_BIT, ResourceStateFlagsToVkAccessFlags(State),
+                                            VK_PIPELINE_STAGE_TRANSFER_BIT, ResourceStateFlagsToVkPipelineStageFlags(State));
+        ++m_State.NumCommands;
+    }
+
+    // The original buffer and its memory are released when the copy command is complete
+    const Uint64 QueueMask = BufferVk.GetDesc().ImmediateContextMask;
+    m_pDevice->SafeReleaseDeviceObject(std::move(BufferVk.m_VulkanBuffer), QueueMask);
+    m_pDevice->SafeReleaseDeviceObject(std::move(BufferVk.m_MemoryAllocation), QueueMask);
+
+    BufferVk.m_VulkanBuffer              = std::move(NewBuffer);
+    BufferVk.m_MemoryAllocation          = std::move(NewAllocation);
+    BufferVk.m_BufferMemoryAlignedOffset = AlignedOffset;
+
+    // Vertex and index buffers must be rebound with the new handle
+    m_State.CommittedVBsUpToDate = false;
+    m_State.CommittedIBUpToDate  = false;
+
+    return true;
+}
+
 void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateBufferState)
 {
     VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+    if (IsDeferred())
+        m_DeferredBufferRefs.Add(BufferVk);
+
     if (OldState == RESOURCE_STATE_UNKNOWN)
     {
         if (BufferVk.IsInKnownState())
@@ -3175,7 +3537,7 @@ void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE
         VkPipelineStageFlags NewAccessFlags = ResourceStateFlagsToVkAccessFlags(NewState);
         VkPipelineStageFlags OldStages      = ResourceStateFlagsToVkPipelineStageFlags(OldState);
         VkPipelineStageFlags NewStages      = ResourceStateFlagsToVkPipelineStageFlags(NewState);
-        m_CommandBuffer.MemoryBarrier(OldAccessFlags, NewAccessFlags, OldStages, NewStages);
+        m_CommandBuffer.BufferMemoryBarrier(BufferVk.m_VulkanBuffer, OldAccessFlags, NewAccessFlags, OldStages, NewStages);
         if (UpdateBufferState)
         {
             BufferVk.SetState(NewState);
@@ -3189,6 +3551,9 @@ void DeviceContextVkImpl::TransitionOrVerifyBufferState(BufferVkImpl&
                                                         VkAccessFlagBits               ExpectedAccessFlags,
                                                         const char*                    OperationName)
 {
+    if (IsDeferred())
+        m_DeferredBufferRefs.Add(Buffer);
+
     if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
         VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
@@ -3374,8 +3739,11 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
 #endif
         if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN)
         {
-            // Skip begin-split barriers
             VERIFY((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0, "Resource state can't be updated in begin-split barrier");
+            // Without synchronization2, begin-split barriers are skipped and
+            // end-split barriers are executed as immediate ones.
+            if (m_CommandBuffer.IsSynchronization2Used() && (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING) == 0)
+                BeginSplitBarrier(Barrier);
             continue;
         }
         if (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING)
@@ -3385,35 +3753,169 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
         else
         {
             VERIFY(Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE || Barrier.TransitionType == STATE_TRANSITION_TYPE_END, "Unexpected barrier type");
+            if (Barrier.TransitionType == STATE_TRANSITION_TYPE_END && EndSplitBarrier(Barrier))
+                continue;
 
-            if (RefCntAutoPtr<TextureVkImpl> pTexture{Barrier.pResource, IID_TextureVk})
-            {
-                VkImageSubresourceRange SubResRange;
-                SubResRange.aspectMask     = 0;
-                SubResRange.baseMipLevel   = Barrier.FirstMipLevel;
-                SubResRange.levelCount     = (Barrier.MipLevelsCount == REMAINING_MIP_LEVELS) ? VK_REMAINING_MIP_LEVELS : Barrier.MipLevelsCount;
-                SubResRange.baseArrayLayer = Barrier.FirstArraySlice;
-                SubResRange.layerCount     = (Barrier.ArraySliceCount == REMAINING_ARRAY_SLICES) ? VK_REMAINING_ARRAY_LAYERS : Barrier.ArraySliceCount;
-                TransitionTextureState(*pTexture, Barrier.OldState, Barrier.NewState, Barrier.Flags, &SubResRange);
-            }
-            else if (RefCntAutoPtr<BufferVkImpl> pBuffer{Barrier.pResource, IID_BufferVk})
-            {
-                TransitionBufferState(*pBuffer, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
-            }
-            else if (RefCntAutoPtr<BottomLevelASVkImpl> pBottomLevelAS{Barrier.pResource, IID_BottomLevelAS})
-            {
-                TransitionBLASState(*pBottomLevelAS, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
-            }
-            else if (RefCntAutoPtr<TopLevelASVkImpl> pTopLevelAS{Barrier.pResource, IID_TopLevelAS})
-            {
-                TransitionTLASState(*pTopLevelAS, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
-            }
-            else
-            {
-                UNEXPECTED("unsupported resource type");
-            }
+            TransitionResourceState(Barrier);
+        }
+    }
+}
+
+void DeviceContextVkImpl::TransitionResourceState(const StateTransitionDesc& Barrier)
+{
+    if (RefCntAutoPtr<TextureVkImpl> pTexture{Barrier.pResource, IID_TextureVk})
+    {
+        VkImageSubresourceRange SubResRange;
+        SubResRange.aspectMask     = 0;
+        SubResRange.baseMipLevel   = Barrier.FirstMipLevel;
+        SubResRange.levelCount     = (Barrier.MipLevelsCount == REMAINING_MIP_LEVELS) ? VK_REMAINING_MIP_LEVELS : Barrier.MipLevelsCount;
+        SubResRange.baseArrayLayer = Barrier.FirstArraySlice;
+        SubResRange.layerCount     = (Barrier.ArraySliceCount == REMAINING_ARRAY_SLICES) ? VK_REMAINING_ARRAY_LAYERS : Barrier.ArraySliceCount;
+        TransitionTextureState(*pTexture, Barrier.OldState, Barrier.NewState, Barrier.Flags, &SubResRange);
+    }
+    else if (RefCntAutoPtr<BufferVkImpl> pBuffer{Barrier.pResource, IID_BufferVk})
+    {
+        TransitionBufferState(*pBuffer, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
+    }
+    else if (RefCntAutoPtr<BottomLevelASVkImpl> pBottomLevelAS{Barrier.pResource, IID_BottomLevelAS})
+    {
+        TransitionBLASState(*pBottomLevelAS, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
+    }
+    else if (RefCntAutoPtr<TopLevelASVkImpl> pTopLevelAS{Barrier.pResource, IID_TopLevelAS})
+    {
+        TransitionTLASState(*pTopLevelAS, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
+    }
+    else
+    {
+        UNEXPECTED("unsupported resource type");
+    }
+}
+
+void DeviceContextVkImpl::BeginSplitBarrier(const StateTransitionDesc& Barrier)
+{
+    VERIFY_EXPR(m_CommandBuffer.IsSynchronization2Used());
+
+    for (const PendingSplitBarrier& Pending : m_PendingSplitBarriers)
+    {
+        if (Pending.pResource.RawPtr() == Barrier.pResource)
+        {
+            // Transitions of the same resource that has not been ended can't be tracked.
+            // The end-split barrier will be executed as an immediate one.
+            LOG_WARNING_MESSAGE("Resource '", Barrier.pResource->GetDesc().Name, "' already has a pending begin-split barrier. The barrier will be ignored.");
+            return;
         }
     }
+
+    // The end-split barrier of the previous resolved transition will never come
+    m_ResolvedSplitBarriers.erase(std::remove_if(m_ResolvedSplitBarriers.begin(), m_ResolvedSplitBarriers.end(),
+                                                 [&Barrier](const std::pair<RefCntAutoPtr<IDeviceObject>, StateTransitionDesc>& Resolved) {
+                                                     return Resolved.first.RawPtr() == Barrier.pResource;
+                                                 }),
+                                  m_ResolvedSplitBarriers.end());
+
+    // Barriers accumulated so far must not be signaled by the event
+    m_CommandBuffer.FlushBarriers();
+
+    // The resource state is not updated by begin-split barriers
+    TransitionResourceState(Barrier);
+    if (!m_CommandBuffer.HasPendingBarriers())
+    {
+        // No barrier is required, so the end-split barrier will be a no-op too.
+        return;
+    }
+
+    PendingSplitBarrier Pending;
+    Pending.pResource = Barrier.pResource;
+    Pending.Desc      = Barrier;
+    Pending.Event     = m_pDevice->GetSplitBarrierEvent();
+    m_CommandBuffer.SetEvent(Pending.Event, Pending.Barrier);
+    m_PendingSplitBarriers.emplace_back(std::move(Pending));
+}
+
+static bool IsMatchingSplitBarrier(const StateTransitionDesc& BeginBarrier, const StateTransitionDesc& EndBarrier)
+{
+    return (BeginBarrier.pResource == EndBarrier.pResource &&
+            BeginBarrier.NewState == EndBarrier.NewState &&
+            BeginBarrier.FirstMipLevel == EndBarrier.FirstMipLevel &&
+            BeginBarrier.MipLevelsCount == EndBarrier.MipLevelsCount &&
+            BeginBarrier.FirstArraySlice == EndBarrier.FirstArraySlice &&
+            BeginBarrier.ArraySliceCount == EndBarrier.ArraySliceCount);
+}
+
+// Sets the internal state of the resource. If KnownStateOnly is true, the state is only
+// updated if the resource is in a known state, i.e. its state is tracked by the engine.
+static void SetResourceState(IDeviceObject* pResource, RESOURCE_STATE State, bool KnownStateOnly = false)
+{
+    auto UpdateState = [State, KnownStateOnly](auto& Resource) {
+        if (!KnownStateOnly || Resource.IsInKnownState())
+            Resource.SetState(State);
+    };
+
+    if (RefCntAutoPtr<TextureVkImpl> pTexture{pResource, IID_TextureVk})
+        UpdateState(*pTexture);
+    else if (RefCntAutoPtr<BufferVkImpl> pBuffer{pResource, IID_BufferVk})
+        UpdateState(*pBuffer);
+    else if (RefCntAutoPtr<BottomLevelASVkImpl> pBottomLevelAS{pResource, IID_BottomLevelAS})
+        UpdateState(*pBottomLevelAS);
+    else if (RefCntAutoPtr<TopLevelASVkImpl> pTopLevelAS{pResource, IID_TopLevelAS})
+        UpdateState(*pTopLevelAS);
+    else
+        UNEXPECTED("unsupported resource type");
+}
+
+bool DeviceContextVkImpl::EndSplitBarrier(const StateTransitionDesc& Barrier)
+{
+    auto it = std::find_if(m_PendingSplitBarriers.begin(), m_PendingSplitBarriers.end(),
+                           [&Barrier](const PendingSplitBarrier& Pending) {
+                               return IsMatchingSplitBarrier(Pending.Desc, Barrier);
+                           });
+    if (it == m_PendingSplitBarriers.end())
+    {
+        // The transition may have been completed when the command buffer was submitted
+        auto resolved_it = std::find_if(m_ResolvedSplitBarriers.begin(), m_ResolvedSplitBarriers.end(),
+                                        [&Barrier](const std::pair<RefCntAutoPtr<IDeviceObject>, StateTransitionDesc>& Resolved) {
+                                            return IsMatchingSplitBarrier(Resolved.second, Barrier);
+                                        });
+        if (resolved_it == m_ResolvedSplitBarriers.end())
+            return false;
+
+        if ((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0)
+            SetResourceState(Barrier.pResource, Barrier.NewState);
+        m_ResolvedSplitBarriers.erase(resolved_it);
+        return true;
+    }
+
+    EnsureVkCmdBuffer();
+    m_CommandBuffer.WaitEvent(it->Barrier);
+
+    if ((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0)
+        SetResourceState(Barrier.pResource, Barrier.NewState);
+
+    m_StaleSplitBarrierEvents.emplace_back(std::move(it->Event));
+    m_PendingSplitBarriers.erase(it);
+    return true;
+}
+
+void DeviceContextVkImpl::ResolveSplitBarriers()
+{
+    if (m_PendingSplitBarriers.empty())
+        return;
+
+    // The event may be set by the GPU, in which case the resource may have already been
+    // transitioned to the new state, so the begin-split barriers can't be discarded.
+    // Wait for the events in the same command buffer to complete the transitions. The internal
+    // state of tracked resources is updated, and matching end-split barriers become no-ops.
+    VERIFY(m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE, "Begin-split barriers are pending, but there is no command buffer");
+    for (PendingSplitBarrier& Pending : m_PendingSplitBarriers)
+    {
+        m_CommandBuffer.WaitEvent(Pending.Barrier);
+
+        SetResourceState(Pending.pResource, Pending.Desc.NewState, /*KnownStateOnly = */ true);
+
+        m_StaleSplitBarrierEvents.emplace_back(std::move(Pending.Event));
+        m_ResolvedSplitBarriers.emplace_back(std::move(Pending.pResource), Pending.Desc);
+    }
+    m_PendingSplitBarriers.clear();
 }
 
 void DeviceContextVkImpl::AliasingBarrier(IDeviceObject* pResourceBefore, IDeviceObject* pResourceAfter)
@@ -1272,6 +1272,197 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.HostImageCopy.pNext;
             }
 
+            if (EnabledFeaturesVk.DescriptorUpdateTemplate)
+            {
+                // Descriptor update templates are core in Vulkan 1.1 and do not require an extension
+                VERIFY_EXPR(PhysicalDevice->GetVkVersion() >= VK_API_VERSION_1_1);
+                EnabledExtFeats.DescriptorUpdateTemplate = DeviceExtFeatures.DescriptorUpdateTemplate;
+            }
+
+            // Dedicated allocations are core in Vulkan 1.1 and do not require an extension
+            EnabledExtFeats.DedicatedAllocation = DeviceExtFeatures.DedicatedAllocation;
+
+            if (EngineCI.UseDescriptorBuffers)
+            {
+#if DILIGENT_USE_VOLK
+                if (DeviceExtFeatures.DescriptorBuffer.descriptorBuffer == VK_TRUE &&
+                    DeviceExtFeatures.BufferDeviceAddress.bufferDeviceAddress == VK_TRUE)
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+                    EnabledExtFeats.DescriptorBuffer = DeviceExtFeatures.DescriptorBuffer;
+
+                    // disable unused features
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferCaptureReplay      = VK_FALSE;
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferImageLayoutIgnored = VK_FALSE;
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferPushDescriptors    = VK_FALSE;
+
+                    *NextExt = &EnabledExtFeats.DescriptorBuffer;
+                    NextExt  = &EnabledExtFeats.DescriptorBuffer.pNext;
+
+                    // Descriptors of buffers are written using device addresses
+                    if (EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddress != VK_TRUE)
+                    {
+                        VERIFY(PhysicalDevice->IsExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME), "VK_KHR_buffer_device_address extension must be supported");
+                        DeviceExtensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+                        EnabledExtFeats.BufferDeviceAddress = DeviceExtFeatures.BufferDeviceAddress;
+
+                        *NextExt = &EnabledExtFeats.BufferDeviceAddress;
+                        NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
+                    }
+                    EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddressCaptureReplay = VK_FALSE;
+                    EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddressMultiDevice   = VK_FALSE;
+                }
+                else
+                {
+                    LOG_INFO_MESSAGE(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME, " or buffer device address is not supported by the device: descriptor pools will be used.");
+                }
+#else
+                LOG_INFO_MESSAGE("Descriptor buffers are not supported when vulkan library is linked statically.");
+#endif
+            }
+
+            // Push descriptor sets are not used in descriptor buffer mode
+            if (EngineCI.UsePushDescriptors && EnabledExtFeats.DescriptorBuffer.descriptorBuffer != VK_TRUE)
+            {
+#if DILIGENT_USE_VOLK
+                if (DeviceExtFeatures.PushDescriptor)
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+                    EnabledExtFeats.PushDescriptor = true;
+                }
+                else
+                {
+                    LOG_INFO_MESSAGE(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, " is not supported by the device: push descriptors will not be used.");
+                }
+#else
+                LOG_INFO_MESSAGE("Push descriptors are not supported when vulkan library is linked statically.");
+#endif
+            }
+
+            if (EngineCI.UseGraphicsPipelineLibrary)
+            {
+                if (DeviceExtFeatures.GraphicsPipelineLibrary.graphicsPipelineLibrary == VK_TRUE)
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME));
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+                    DeviceExtensions.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+                    EnabledExtFeats.GraphicsPipelineLibrary = DeviceExtFeatures.GraphicsPipelineLibrary;
+
+                    *NextExt = &EnabledExtFeats.GraphicsPipelineLibrary;
+                    NextExt  = &EnabledExtFeats.GraphicsPipelineLibrary.pNext;
+                }
+                else
+                {
+                    LOG_INFO_MESSAGE(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, " is not supported by the device: graphics pipelines will be created monolithically.");
+                }
+            }
+
+            if (EngineCI.UseExtendedDynamicState)
+            {
+#if DILIGENT_USE_VOLK
+                if (DeviceExtFeatures.ExtendedDynamicState.extendedDynamicState == VK_TRUE)
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+                    EnabledExtFeats.ExtendedDynamicState = DeviceExtFeatures.ExtendedDynamicState;
+
+                    *NextExt = &EnabledExtFeats.ExtendedDynamicState;
+                    NextExt  = &EnabledExtFeats.ExtendedDynamicState.pNext;
+
+                    if (DeviceExtFeatures.ExtendedDynamicState2.extendedDynamicState2 == VK_TRUE)
+                    {
+                        VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME));
+                        DeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME);
+                        EnabledExtFeats.ExtendedDynamicState2 = DeviceExtFeatures.ExtendedDynamicState2;
+
+                        // disable unused features
+                        EnabledExtFeats.ExtendedDynamicState2.extendedDynamicState2LogicOp = VK_FALSE;
+
+                        *NextExt = &EnabledExtFeats.ExtendedDynamicState2;
+                        NextExt  = &EnabledExtFeats.ExtendedDynamicState2.pNext;
+                    }
+
+                    const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& DeviceEDS3 = DeviceExtFeatures.ExtendedDynamicState3;
+                    if (DeviceEDS3.extendedDynamicState3PolygonMode == VK_TRUE ||
+                        DeviceEDS3.extendedDynamicState3DepthClampEnable == VK_TRUE ||
+                        (DeviceEDS3.extendedDynamicState3ColorBlendEnable == VK_TRUE &&
+                         DeviceEDS3.extendedDynamicState3ColorBlendEquation == VK_TRUE &&
+                         DeviceEDS3.extendedDynamicState3ColorWriteMask == VK_TRUE))
+                    {
+                        VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME));
+                        DeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
+
+                        // Only enable the features that are used by the engine
+                        VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& EnabledEDS3{EnabledExtFeats.ExtendedDynamicState3};
+                        EnabledEDS3                                  = {};
+                        EnabledEDS3.sType                            = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+                        EnabledEDS3.extendedDynamicState3PolygonMode = DeviceEDS3.extendedDynamicState3PolygonMode;
+
+                        EnabledEDS3.extendedDynamicState3DepthClampEnable = DeviceEDS3.extendedDynamicState3DepthClampEnable;
+                        if (DeviceEDS3.extendedDynamicState3ColorBlendEnable == VK_TRUE &&
+                            DeviceEDS3.extendedDynamicState3ColorBlendEquation == VK_TRUE &&
+                            DeviceEDS3.extendedDynamicState3ColorWriteMask == VK_TRUE)
+                        {
+                            EnabledEDS3.extendedDynamicState3ColorBlendEnable   = VK_TRUE;
+                            EnabledEDS3.extendedDynamicState3ColorBlendEquation = VK_TRUE;
+                            EnabledEDS3.extendedDynamicState3ColorWriteMask     = VK_TRUE;
+                        }
+
+                        *NextExt = &EnabledEDS3;
+                        NextExt  = &EnabledEDS3.pNext;
+                    }
+                }
+                else
+                {
+                    LOG_INFO_MESSAGE(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME, " is not supported by the device: all states will be baked into graphics pipelines.");
+                }
+#else
+                LOG_INFO_MESSAGE("Extended dynamic state is not supported when vulkan library is linked statically.");
+#endif
+            }
+
+            if (EngineCI.UseSynchronization2)
+            {
+#if DILIGENT_USE_VOLK
+                if (DeviceExtFeatures.Synchronization2.synchronization2 == VK_TRUE)
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+                    EnabledExtFeats.Synchronization2 = DeviceExtFeatures.Synchronization2;
+
+                    *NextExt = &EnabledExtFeats.Synchronization2;
+                    NextExt  = &EnabledExtFeats.Synchronization2.pNext;
+                }
+                else
+                {
+                    LOG_INFO_MESSAGE(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME, " is not supported by the device: legacy pipeline barriers will be used.");
+                }
+#else
+                LOG_INFO_MESSAGE("Synchronization2 is not supported when vulkan library is linked statically.");
+#endif
+            }
+
+            if (EngineCI.UseMemoryBudget)
+            {
+#if DILIGENT_USE_VOLK
+                if (DeviceExtFeatures.MemoryBudget)
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+                    EnabledExtFeats.MemoryBudget = true;
+                }
+                else
+                {
+                    LOG_INFO_MESSAGE(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, " is not supported by the device: memory allocations will only be limited by the reserve sizes.");
+                }
+#else
+                LOG_INFO_MESSAGE("Memory budget is not supported when vulkan library is linked statically.");
+#endif
+            }
+
             // Append user-defined features
             *NextExt = EngineCI.pDeviceExtensionFeatures;
         }
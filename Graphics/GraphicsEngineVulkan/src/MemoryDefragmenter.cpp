@@ -0,0 +1,166 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "MemoryDefragmenter.hpp"
+
+#include <algorithm>
+
+#include "BufferVkImpl.hpp"
+#include "DeviceContextVkImpl.hpp"
+
+namespace Diligent
+{
+
+void MemoryDefragmenter::RegisterBuffer(BufferVkImpl* pBuffer)
+{
+    VERIFY_EXPR(pBuffer != nullptr);
+    if (!pBuffer->IsRelocatable())
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    m_Buffers.emplace_back(pBuffer);
+}
+
+bool MemoryDefragmenter::Defragment(DeviceContextVkImpl& Ctx, const MemoryDefragmentationAttribsVk& Attribs)
+{
+    const Uint64 QueueMask = Uint64{1} << Uint64{Ctx.GetCommandQueueId()};
+
+    struct Candidate
+    {
+        RefCntAutoPtr<BufferVkImpl> pBuffer;
+        float                       PageOccupancy;
+    };
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    std::vector<Candidate> Candidates;
+    for (size_t i = 0; i < m_Buffers.size();)
+    {
+        RefCntAutoPtr<BufferVkImpl> pBuffer = m_Buffers[i].Lock();
+        if (!pBuffer)
+        {
+            // The buffer has been destroyed
+            m_Buffers[i] = std::move(m_Buffers.back());
+            m_Buffers.pop_back();
+            continue;
+        }
+        ++i;
+
+        // Buffers whose state is unknown can't be synchronized with the copy
+        if ((pBuffer->GetDesc().ImmediateContextMask & QueueMask) == 0 || !pBuffer->IsInKnownState())
+            continue;
+
+        // Command lists that are recorded or pending execution reference the old Vulkan buffer
+        if (pBuffer->IsReferencedByDeferredCommands())
+            continue;
+
+        const VulkanUtilities::MemoryPage* pPage = pBuffer->GetMemoryAllocation().Page;
+        VERIFY_EXPR(pPage != nullptr);
+        const float PageOccupancy = static_cast<float>(pPage->GetUsedSize()) / static_cast<float>(pPage->GetPageSize());
+        Candidates.push_back({std::move(pBuffer), PageOccupancy});
+    }
+
+    // Empty the least occupied pages first
+    std::sort(Candidates.begin(), Candidates.end(),
+              [](const Candidate& lhs, const Candidate& rhs) {
+                  return lhs.PageOccupancy < rhs.PageOccupancy;
+              });
+
+    Uint64 BytesMoved       = 0;
+    Uint32 AllocationsMoved = 0;
+    bool   MoreWork         = false;
+    for (const Candidate& Cand : Candidates)
+    {
+        const Uint64 Size = Cand.pBuffer->GetDesc().Size;
+        if (Size > Attribs.MaxBytesToMove)
+            continue;
+
+        if (AllocationsMoved >= Attribs.MaxAllocationsToMove || BytesMoved + Size > Attribs.MaxBytesToMove)
+        {
+            MoreWork = true;
+            break;
+        }
+
+        if (Ctx.RelocateBuffer(*Cand.pBuffer))
+        {
+            BytesMoved += Size;
+            ++AllocationsMoved;
+        }
+    }
+
+    m_NumBytesMoved.fetch_add(BytesMoved);
+    m_NumAllocationsMoved.fetch_add(AllocationsMoved);
+
+    return MoreWork;
+}
+
+
+DeferredBufferReferences::~DeferredBufferReferences()
+{
+    Clear();
+}
+
+DeferredBufferReferences::DeferredBufferReferences(DeferredBufferReferences&& rhs) noexcept :
+    m_Buffers{std::move(rhs.m_Buffers)}
+{
+    rhs.m_Buffers.clear();
+}
+
+DeferredBufferReferences& DeferredBufferReferences::operator=(DeferredBufferReferences&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        Clear();
+        m_Buffers = std::move(rhs.m_Buffers);
+        rhs.m_Buffers.clear();
+    }
+    return *this;
+}
+
+void DeferredBufferReferences::Add(BufferVkImpl& Buffer)
+{
+    if (!Buffer.IsRelocatable())
+        return;
+
+    auto it_inserted = m_Buffers.emplace(&Buffer, RefCntAutoPtr<BufferVkImpl>{&Buffer});
+    if (it_inserted.second)
+        Buffer.m_DeferredCommandRefs.fetch_add(1);
+}
+
+void DeferredBufferReferences::Clear()
+{
+    for (auto& it : m_Buffers)
+    {
+        VERIFY_EXPR(it.second->m_DeferredCommandRefs.load() > 0);
+        it.second->m_DeferredCommandRefs.fetch_sub(1);
+    }
+    m_Buffers.clear();
+}
+
+} // namespace Diligent
@@ -0,0 +1,191 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineLibraryCache.hpp"
+
+#include <algorithm>
+
+#include "PipelineResourceSignatureVkImpl.hpp"
+#include "HashUtils.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+void PipelineLibraryKey::SetInputLayout(const InputLayoutDesc& InputLayout)
+{
+    LayoutElements.assign(InputLayout.LayoutElements, InputLayout.LayoutElements + InputLayout.NumElements);
+    Semantics.resize(LayoutElements.size());
+    for (size_t i = 0; i < LayoutElements.size(); ++i)
+    {
+        Semantics[i] = LayoutElements[i].HLSLSemantic != nullptr ? LayoutElements[i].HLSLSemantic : "";
+
+        LayoutElements[i].HLSLSemantic = nullptr;
+    }
+}
+
+PipelineLibraryCache::~PipelineLibraryCache()
+{
+#ifdef DILIGENT_DEBUG
+    for (const auto& Libraries : m_Libraries)
+        VERIFY(Libraries.empty(), "Pipeline library cache is not empty. Did you call Destroy?");
+#endif
+}
+
+size_t PipelineLibraryCache::ComputeKeyHash(const PipelineLibraryKey& Key)
+{
+    VERIFY(Key.Desc.InputLayout.NumElements == 0 && Key.Desc.pRenderPass == nullptr,
+           "Input layout must be set with SetInputLayout() and explicit render passes are not supported");
+
+    size_t Hash = ComputeHash(Key.Desc, Key.Flags);
+    for (VkDynamicState State : Key.DynamicStates)
+        HashCombine(Hash, static_cast<Uint32>(State));
+
+    for (size_t i = 0; i < Key.LayoutElements.size(); ++i)
+        HashCombine(Hash, Key.LayoutElements[i], Key.Semantics[i]);
+
+    for (const PipelineLibraryKey::ShaderInfo& Shader : Key.Shaders)
+    {
+        HashCombine(Hash, Shader.Type, Shader.EntryPoint,
+                    ComputeHashRaw(Shader.SPIRV.data(), Shader.SPIRV.size() * sizeof(uint32_t)));
+    }
+
+    return Hash;
+}
+
+bool PipelineLibraryCache::KeysEqual(PipelineLibraryKey& Key0, PipelineLibraryKey& Key1)
+{
+    // clang-format off
+    if (Key0.Hash           != Key1.Hash           ||
+        Key0.Flags          != Key1.Flags          ||
+        Key0.DynamicStates  != Key1.DynamicStates  ||
+        Key0.LayoutElements != Key1.LayoutElements ||
+        Key0.Semantics      != Key1.Semantics      ||
+        Key0.Shaders        != Key1.Shaders        ||
+        Key0.Signatures.size() != Key1.Signatures.size() ||
+        !(Key0.Desc == Key1.Desc))
+        return false;
+    // clang-format on
+
+    for (size_t i = 0; i < Key0.Signatures.size(); ++i)
+    {
+        RefCntAutoPtr<PipelineResourceSignatureVkImpl> pSign0 = Key0.Signatures[i].Lock();
+        RefCntAutoPtr<PipelineResourceSignatureVkImpl> pSign1 = Key1.Signatures[i].Lock();
+        // The pipeline layout of a library whose signature has been released can't be verified
+        if (!pSign0 || !pSign1 || !pSign0->IsCompatibleWith(pSign1.RawPtr()))
+            return false;
+    }
+
+    return true;
+}
+
+PipelineLibraryCache::LibraryPtr PipelineLibraryCache::FindLibrary(LIBRARY_PART Part, PipelineLibraryKey& Key)
+{
+    auto range = m_Libraries[Part].equal_range(Key.Hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (LibraryPtr pLibrary = it->second.pLibrary.lock())
+        {
+            if (KeysEqual(it->second.Key, Key))
+                return pLibrary;
+        }
+    }
+    return {};
+}
+
+PipelineLibraryCache::LibraryPtr PipelineLibraryCache::GetLibrary(LIBRARY_PART Part, PipelineLibraryKey Key, const CreateLibraryHandlerType& CreateLibrary) noexcept(false)
+{
+    VERIFY_EXPR(Part < LIBRARY_PART_COUNT);
+
+    // Signatures of the pipeline state that requests the library are alive
+    Key.Hash = ComputeKeyHash(Key);
+    for (RefCntWeakPtr<PipelineResourceSignatureVkImpl>& pWeakSign : Key.Signatures)
+    {
+        RefCntAutoPtr<PipelineResourceSignatureVkImpl> pSign = pWeakSign.Lock();
+        VERIFY_EXPR(pSign);
+        HashCombine(Key.Hash, pSign ? pSign->GetHash() : size_t{0});
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        if (LibraryPtr pLibrary = FindLibrary(Part, Key))
+            return pLibrary;
+    }
+
+    LibraryPtr pNewLibrary = std::make_shared<const VulkanUtilities::PipelineWrapper>(CreateLibrary());
+    VERIFY_EXPR(*pNewLibrary);
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    // If another thread has created the same library in the meantime, the existing one is returned
+    // and the new library is destroyed. This is safe as the new library has not been used yet.
+    if (LibraryPtr pLibrary = FindLibrary(Part, Key))
+        return pLibrary;
+
+    const size_t Hash = Key.Hash;
+    m_Libraries[Part].emplace(Hash, LibraryEntry{std::move(Key), pNewLibrary});
+
+    size_t NumEntries = 0;
+    for (const auto& Libraries : m_Libraries)
+        NumEntries += Libraries.size();
+    if (NumEntries >= m_PurgeThreshold)
+        PurgeExpiredEntries();
+
+    return pNewLibrary;
+}
+
+void PipelineLibraryCache::PurgeExpiredEntries()
+{
+    size_t NumEntries = 0;
+    for (auto& Libraries : m_Libraries)
+    {
+        for (auto it = Libraries.begin(); it != Libraries.end();)
+        {
+            if (it->second.pLibrary.expired())
+                it = Libraries.erase(it);
+            else
+                ++it;
+        }
+        NumEntries += Libraries.size();
+    }
+    m_PurgeThreshold = std::max(m_PurgeThreshold, NumEntries * 2);
+}
+
+void PipelineLibraryCache::Destroy()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    // Libraries are owned by the pipeline states that use them and are released
+    // along with them. Libraries are never referenced by command buffers, and pipelines
+    // linked from them do not depend on them, so they can be destroyed immediately.
+    for (auto& Libraries : m_Libraries)
+        Libraries.clear();
+}
+
+} // namespace Diligent
@@ -168,6 +168,10 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
 
 void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 {
+    // Descriptor buffers are only used by signatures created by the device. Serialized signatures
+    // that are not backed by a device are not affected as descriptor types are not serialized.
+    m_UseDescriptorBuffer = HasDevice() && GetDevice()->UseDescriptorBuffers();
+
     // Initialize static resource cache first
     if (Uint32 NumStaticResStages = GetNumStaticResStages())
     {
@@ -330,7 +334,9 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBinding.descriptorCount    = ResDesc.ArraySize;
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(ResDesc.ShaderStages);
         vkSetLayoutBinding.pImmutableSamplers = pVkImmutableSamplers;
-        vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
+        vkSetLayoutBinding.descriptorType     = m_UseDescriptorBuffer ?
+                DescriptorTypeToVkDescriptorBufferType(pAttribs->GetDescriptorType()) :
+                DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
 
         if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
@@ -462,25 +468,262 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
     {
         const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
 
+        // Only the signature with binding index 0 may use a push descriptor set, which guarantees that
+        // a pipeline layout never contains more than one push descriptor set.
+        // Push descriptor sets must not contain descriptors with dynamic offsets.
+        const std::vector<VkDescriptorSetLayoutBinding>& vkDynamicSetBindings = vkSetLayoutBindings[DESCRIPTOR_SET_ID_DYNAMIC];
+        if (LogicalDevice.GetEnabledExtFeatures().PushDescriptor &&
+            !m_UseDescriptorBuffer &&
+            m_Desc.BindingIndex == 0 &&
+            !vkDynamicSetBindings.empty() &&
+            BindingCount[CACHE_GROUP_DYN_UB_DYN_VAR] == 0 &&
+            BindingCount[CACHE_GROUP_DYN_SB_DYN_VAR] == 0)
+        {
+            Uint32 NumDynamicDescriptors = 0;
+            for (const VkDescriptorSetLayoutBinding& Binding : vkDynamicSetBindings)
+                NumDynamicDescriptors += Binding.descriptorCount;
+
+            m_UsePushDescriptorSet = NumDynamicDescriptors <= GetDevice()->GetPhysicalDevice().GetExtProperties().PushDescriptor.maxPushDescriptors;
+        }
+
         for (size_t i = 0; i < vkSetLayoutBindings.size(); ++i)
         {
             auto& vkSetLayoutBinding = vkSetLayoutBindings[i];
             if (vkSetLayoutBinding.empty())
                 continue;
 
+            SetLayoutCI.flags = (i == DESCRIPTOR_SET_ID_DYNAMIC && m_UsePushDescriptorSet) ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+            if (m_UseDescriptorBuffer)
+                SetLayoutCI.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
             SetLayoutCI.bindingCount = StaticCast<uint32_t>(vkSetLayoutBinding.size());
             SetLayoutCI.pBindings    = vkSetLayoutBinding.data();
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        // Push descriptor sets are written directly into the command buffer and are never updated with templates.
+        // Descriptor buffers are written directly by the CPU.
+        if (LogicalDevice.GetEnabledExtFeatures().DescriptorUpdateTemplate && HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC) && !m_UsePushDescriptorSet && !m_UseDescriptorBuffer)
+            CreateDynamicSetUpdateTemplate();
+
+        if (m_UseDescriptorBuffer)
+            InitDescriptorBufferLayouts();
+    }
+}
+
+namespace
+{
+
+// Returns the size of the descriptor data element in the descriptor update template data
+// (see VkDescriptorUpdateTemplateEntry)
+size_t GetDescriptorTemplateDataStride(DescriptorType DescrType)
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (DescrType)
+    {
+        case DescriptorType::Sampler:
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            return sizeof(VkDescriptorImageInfo);
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            return sizeof(VkBufferView);
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            return sizeof(VkDescriptorBufferInfo);
+
+        case DescriptorType::AccelerationStructure:
+            return sizeof(VkAccelerationStructureKHR);
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+            return 0;
     }
 }
 
+} // namespace
+
+void PipelineResourceSignatureVkImpl::CreateDynamicSetUpdateTemplate()
+{
+    VERIFY_EXPR(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC));
+
+    // Template entries follow the order of dynamic resources in m_Desc.Resources, so that
+    // WriteDynamicSetTemplateData() can write the data in a single pass over the resource cache.
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries;
+
+    size_t                          DataSize       = 0;
+    const std::pair<Uint32, Uint32> DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const PipelineResourceAttribsType& Attr      = GetResourceAttribs(ResIdx);
+        const DescriptorType               DescrType = Attr.GetDescriptorType();
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue; // Immutable samplers are permanently bound into the set layout
+
+        const size_t Stride = GetDescriptorTemplateDataStride(DescrType);
+
+        VkDescriptorUpdateTemplateEntry Entry{};
+        Entry.dstBinding      = Attr.BindingIndex;
+        Entry.dstArrayElement = 0;
+        Entry.descriptorCount = Attr.ArraySize;
+        Entry.descriptorType  = DescriptorTypeToVkDescriptorType(DescrType);
+        Entry.offset          = DataSize;
+        Entry.stride          = Stride;
+        Entries.push_back(Entry);
+
+        DataSize += Stride * Attr.ArraySize;
+    }
+
+    if (Entries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(Entries.size());
+    TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    m_DynamicSetUpdateTemplate   = GetDevice()->GetLogicalDevice().CreateDescriptorUpdateTemplate(TemplateCI, m_Desc.Name);
+    m_DynamicSetTemplateDataSize = StaticCast<Uint32>(DataSize);
+}
+
 PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 {
     Destruct();
 }
 
+namespace
+{
+
+Uint32 GetDescriptorBufferDescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props, VkDescriptorType Type, bool RobustBufferAccess)
+{
+    switch (Type)
+    {
+        // clang-format off
+        case VK_DESCRIPTOR_TYPE_SAMPLER:                    return static_cast<Uint32>(Props.samplerDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     return static_cast<Uint32>(Props.combinedImageSamplerDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              return static_cast<Uint32>(Props.sampledImageDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:              return static_cast<Uint32>(Props.storageImageDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       return static_cast<Uint32>(RobustBufferAccess ? Props.robustUniformTexelBufferDescriptorSize : Props.uniformTexelBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       return static_cast<Uint32>(RobustBufferAccess ? Props.robustStorageTexelBufferDescriptorSize : Props.storageTexelBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             return static_cast<Uint32>(RobustBufferAccess ? Props.robustUniformBufferDescriptorSize : Props.uniformBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:             return static_cast<Uint32>(RobustBufferAccess ? Props.robustStorageBufferDescriptorSize : Props.storageBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           return static_cast<Uint32>(Props.inputAttachmentDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: return static_cast<Uint32>(Props.accelerationStructureDescriptorSize);
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+            return 0;
+    }
+}
+
+} // namespace
+
+void PipelineResourceSignatureVkImpl::InitDescriptorBufferLayouts()
+{
+    VERIFY_EXPR(m_UseDescriptorBuffer);
+
+    const VulkanUtilities::LogicalDevice&                LogicalDevice      = GetDevice()->GetLogicalDevice();
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props              = GetDevice()->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+    const bool                                           RobustBufferAccess = LogicalDevice.GetEnabledFeatures().robustBufferAccess != VK_FALSE;
+
+    // Set layouts indexed by the set index rather than DESCRIPTOR_SET_ID
+    std::array<VkDescriptorSetLayout, MAX_DESCRIPTOR_SETS> vkSetLayouts = {};
+    if (HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+        vkSetLayouts[GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>()] = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_STATIC_MUTABLE];
+    if (HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC))
+        vkSetLayouts[GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>()] = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    const Uint32 NumSets = GetNumDescriptorSets();
+    for (Uint32 s = 0; s < NumSets; ++s)
+    {
+        DescriptorBufferSetLayout& Layout = m_DescriptorBufferLayouts[s];
+
+        Layout.Size                     = LogicalDevice.GetDescriptorSetLayoutSize(vkSetLayouts[s]);
+        Layout.CombinedImageSamplerSize = static_cast<Uint32>(Props.combinedImageSamplerDescriptorSize);
+        Layout.Persistent               = HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) && s == GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>();
+        Layout.Descriptors.resize(m_DescriptorSetSizes[s]);
+        Layout.ImmutableSamplers.clear();
+    }
+
+    for (Uint32 r = 0; r < m_Desc.NumResources; ++r)
+    {
+        const PipelineResourceDesc& ResDesc   = m_Desc.Resources[r];
+        const ResourceAttribs&      Attr      = m_pResourceAttribs[r];
+        const DescriptorType        DescrType = Attr.GetDescriptorType();
+        const VkDescriptorType      vkType    = DescriptorTypeToVkDescriptorBufferType(DescrType);
+
+        DescriptorBufferSetLayout& Layout        = m_DescriptorBufferLayouts[Attr.DescrSet];
+        const Uint32               BindingOffset = static_cast<Uint32>(LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkSetLayouts[Attr.DescrSet], Attr.BindingIndex));
+        const Uint32               DescrSize     = GetDescriptorBufferDescriptorSize(Props, vkType, RobustBufferAccess);
+
+        // Immutable samplers are not written to the descriptor buffer by the implementation
+        VkSampler vkImmutableSampler = VK_NULL_HANDLE;
+        if (Attr.IsImmutableSamplerAssigned())
+        {
+            const Uint32 SrcImmutableSamplerInd = FindImmutableSamplerVk(ResDesc, DescrType, m_Desc, GetCombinedSamplerSuffix());
+            VERIFY_EXPR(SrcImmutableSamplerInd != InvalidImmutableSamplerIndex);
+            if (const RefCntAutoPtr<SamplerVkImpl>& pSamplerVk = m_pImmutableSamplers[SrcImmutableSamplerInd])
+                vkImmutableSampler = pSamplerVk->GetVkSampler();
+        }
+
+        // If combinedImageSamplerDescriptorSingleArray is false, the binding is stored as the array of
+        // image descriptors followed by the array of sampler descriptors.
+        const bool SplitCombinedSampler = (vkType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER && !Props.combinedImageSamplerDescriptorSingleArray);
+        for (Uint32 elem = 0; elem < ResDesc.ArraySize; ++elem)
+        {
+            DescriptorBufferSetLayout::Descriptor Descr;
+            Descr.ImmutableSampler = vkImmutableSampler;
+            if (SplitCombinedSampler)
+            {
+                const Uint32 ImageSize   = static_cast<Uint32>(Props.sampledImageDescriptorSize);
+                const Uint32 SamplerSize = static_cast<Uint32>(Props.samplerDescriptorSize);
+
+                Descr.Offset        = BindingOffset + elem * ImageSize;
+                Descr.Size          = ImageSize;
+                Descr.SamplerOffset = BindingOffset + ResDesc.ArraySize * ImageSize + elem * SamplerSize;
+            }
+            else
+            {
+                Descr.Offset = BindingOffset + elem * DescrSize;
+                Descr.Size   = DescrSize;
+            }
+
+            // Separate immutable samplers are never set through the resource cache
+            if (DescrType == DescriptorType::Sampler && vkImmutableSampler != VK_NULL_HANDLE)
+                Layout.ImmutableSamplers.push_back(Descr);
+
+            Layout.Descriptors[Attr.CacheOffset(ResourceCacheContentType::SRB) + elem] = Descr;
+        }
+    }
+
+    // Immutable samplers that are not assigned to any resource
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        const ImmutableSamplerAttribsVk&    ImtblSampAttribs = m_pImmutableSamplerAttribs[i];
+        const RefCntAutoPtr<SamplerVkImpl>& pSamplerVk       = m_pImmutableSamplers[i];
+        if (ImtblSampAttribs.DescrSet == ~0u || !pSamplerVk)
+            continue;
+
+        DescriptorBufferSetLayout::Descriptor Descr;
+        Descr.Offset           = static_cast<Uint32>(LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkSetLayouts[ImtblSampAttribs.DescrSet], ImtblSampAttribs.BindingIndex));
+        Descr.Size             = static_cast<Uint32>(Props.samplerDescriptorSize);
+        Descr.ImmutableSampler = pSamplerVk->GetVkSampler();
+        m_DescriptorBufferLayouts[ImtblSampAttribs.DescrSet].ImmutableSamplers.push_back(Descr);
+    }
+}
+
 void PipelineResourceSignatureVkImpl::Destruct()
 {
     for (VulkanUtilities::DescriptorSetLayoutWrapper& Layout : m_VkDescrSetLayouts)
@@ -489,6 +732,9 @@ void PipelineResourceSignatureVkImpl::Destruct()
             GetDevice()->SafeReleaseDeviceObject(std::move(Layout), ~0ull);
     }
 
+    if (m_DynamicSetUpdateTemplate)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_DynamicSetUpdateTemplate), ~0ull);
+
     TPipelineResourceSignatureBase::Destruct();
 }
 
@@ -517,7 +763,24 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     ResourceCache.DbgVerifyResourceInitialization();
 #endif
 
-    if (VkDescriptorSetLayout vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+    if (m_UseDescriptorBuffer)
+    {
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+        {
+            // Static/mutable resources are written directly to the persistent set data by ShaderResourceCacheVk::SetResource()
+            const Uint32                     SetIdx = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>();
+            const DescriptorBufferSetLayout& Layout = m_DescriptorBufferLayouts[SetIdx];
+
+            DescriptorBufferAllocation Allocation = GetDevice()->GetDescriptorBufferManager()->Allocate(~Uint64{0}, Layout.Size);
+            if (!Allocation)
+                LOG_ERROR_AND_THROW("Failed to allocate descriptor buffer space for the static/mutable set of signature '", m_Desc.Name, "'");
+
+            memset(Allocation.GetCPUAddress(), 0, StaticCast<size_t>(Layout.Size));
+            Layout.WriteImmutableSamplers(GetDevice()->GetLogicalDevice(), Allocation.GetCPUAddress());
+            ResourceCache.AssignDescriptorBufferAllocation(SetIdx, std::move(Allocation), Layout);
+        }
+    }
+    else if (VkDescriptorSetLayout vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
 #ifdef DILIGENT_DEVELOPMENT
@@ -608,13 +871,85 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
-void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+bool PipelineResourceSignatureVkImpl::WriteDynamicSetTemplateData(const ShaderResourceCacheVk& ResourceCache, Uint8* pData) const
 {
-    VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
-    VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
-    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+    const ShaderResourceCacheVk::DescriptorSet& SetResources   = ResourceCache.GetDescriptorSet(GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>());
+    const std::pair<Uint32, Uint32>             DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
+
+    // Must be consistent with CreateDynamicSetUpdateTemplate()
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const PipelineResourceAttribsType& Attr        = GetResourceAttribs(ResIdx);
+        const Uint32                       CacheOffset = Attr.CacheOffset(CacheType);
+        const DescriptorType               DescrType   = Attr.GetDescriptorType();
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        for (Uint32 ArrElem = 0; ArrElem < Attr.ArraySize; ++ArrElem)
+        {
+            const ShaderResourceCacheVk::Resource& CachedRes = SetResources.GetResource(CacheOffset + ArrElem);
+            // Template entries write the entire array, so all elements must be bound
+            if (!CachedRes)
+                return false;
 
+            static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+            switch (DescrType)
+            {
+                case DescriptorType::UniformBuffer:
+                case DescriptorType::UniformBufferDynamic:
+                    *reinterpret_cast<VkDescriptorBufferInfo*>(pData) = CachedRes.GetUniformBufferDescriptorWriteInfo();
+                    break;
+
+                case DescriptorType::StorageBuffer:
+                case DescriptorType::StorageBufferDynamic:
+                case DescriptorType::StorageBuffer_ReadOnly:
+                case DescriptorType::StorageBufferDynamic_ReadOnly:
+                    *reinterpret_cast<VkDescriptorBufferInfo*>(pData) = CachedRes.GetStorageBufferDescriptorWriteInfo();
+                    break;
+
+                case DescriptorType::UniformTexelBuffer:
+                case DescriptorType::StorageTexelBuffer:
+                case DescriptorType::StorageTexelBuffer_ReadOnly:
+                    *reinterpret_cast<VkBufferView*>(pData) = CachedRes.GetBufferViewWriteInfo();
+                    break;
+
+                case DescriptorType::CombinedImageSampler:
+                case DescriptorType::SeparateImage:
+                case DescriptorType::StorageImage:
+                    *reinterpret_cast<VkDescriptorImageInfo*>(pData) = CachedRes.GetImageDescriptorWriteInfo();
+                    break;
+
+                case DescriptorType::InputAttachment:
+                case DescriptorType::InputAttachment_General:
+                    *reinterpret_cast<VkDescriptorImageInfo*>(pData) = CachedRes.GetInputAttachmentDescriptorWriteInfo();
+                    break;
+
+                case DescriptorType::Sampler:
+                    *reinterpret_cast<VkDescriptorImageInfo*>(pData) = CachedRes.GetSamplerDescriptorWriteInfo();
+                    break;
+
+                case DescriptorType::AccelerationStructure:
+                    // Template data for acceleration structures is the VkAccelerationStructureKHR handle
+                    *reinterpret_cast<VkAccelerationStructureKHR*>(pData) = *CachedRes.GetAccelerationStructureWriteInfo().pAccelerationStructures;
+                    break;
+
+                default:
+                    UNEXPECTED("Unexpected resource type");
+            }
+            pData += GetDescriptorTemplateDataStride(DescrType);
+        }
+    }
+
+    return true;
+}
+
+template <typename FlushWritesHandlerType>
+void PipelineResourceSignatureVkImpl::WriteDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                                            VkDescriptorSet              vkDynamicDescriptorSet,
+                                                            FlushWritesHandlerType&&     FlushWrites) const
+{
 #ifdef DILIGENT_DEBUG
     static constexpr size_t ImgUpdateBatchSize          = 4;
     static constexpr size_t BuffUpdateBatchSize         = 2;
@@ -644,7 +979,6 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     const Uint32                                DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
     const ShaderResourceCacheVk::DescriptorSet& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
-    const VulkanUtilities::LogicalDevice&       LogicalDevice  = GetDevice()->GetLogicalDevice();
     const std::pair<Uint32, Uint32>             DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
 
     constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
@@ -668,7 +1002,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         WriteDescrSetIt->pNext = nullptr;
         VERIFY(SetResources.GetVkDescriptorSet() == VK_NULL_HANDLE, "Dynamic descriptor set must not be assigned to the resource cache");
         WriteDescrSetIt->dstSet = vkDynamicDescriptorSet;
-        VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE, "Vulkan descriptor set must not be null");
+        VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE || m_UsePushDescriptorSet, "Vulkan descriptor set must not be null");
         WriteDescrSetIt->dstBinding      = Attr.BindingIndex;
         WriteDescrSetIt->dstArrayElement = ArrElem;
         // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
@@ -784,7 +1118,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         {
             Uint32 DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
             if (DescrWriteCount > 0)
-                LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+                FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
 
             DescrImgIt      = DescrImgInfoArr.begin();
             DescrBuffIt     = DescrBuffInfoArr.begin();
@@ -796,7 +1130,78 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     Uint32 DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
     if (DescrWriteCount > 0)
-        LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+        FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
+}
+
+void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                                             VkDescriptorSet              vkDynamicDescriptorSet,
+                                                             std::vector<Uint8>&          TemplateData) const
+{
+    VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
+    VERIFY(!m_UsePushDescriptorSet, "Dynamic resources of this signature must be written with PushDynamicResources()");
+    VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+
+    if (m_DynamicSetUpdateTemplate)
+    {
+        // Write all descriptors with a single call when all dynamic resources are bound.
+        // Otherwise, fall back to vkUpdateDescriptorSets that skips null resources.
+        if (TemplateData.size() < m_DynamicSetTemplateDataSize)
+            TemplateData.resize(m_DynamicSetTemplateDataSize);
+        if (WriteDynamicSetTemplateData(ResourceCache, TemplateData.data()))
+        {
+            GetDevice()->GetLogicalDevice().UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, m_DynamicSetUpdateTemplate, TemplateData.data());
+            return;
+        }
+    }
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+    WriteDynamicResources(ResourceCache, vkDynamicDescriptorSet,
+                          [&LogicalDevice](Uint32 WriteCount, const VkWriteDescriptorSet* pWrites) {
+                              LogicalDevice.UpdateDescriptorSets(WriteCount, pWrites, 0, nullptr);
+                          });
+}
+
+void PipelineResourceSignatureVkImpl::PushDynamicResources(const ShaderResourceCacheVk&    ResourceCache,
+                                                           VulkanUtilities::CommandBuffer& CmdBuffer,
+                                                           VkPipelineBindPoint             vkBindPoint,
+                                                           VkPipelineLayout                vkPipelineLayout,
+                                                           Uint32                          SetIndex) const
+{
+    VERIFY(m_UsePushDescriptorSet, "This signature does not use push descriptor set");
+    VERIFY_EXPR(vkPipelineLayout != VK_NULL_HANDLE);
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+
+    // dstSet is ignored by vkCmdPushDescriptorSetKHR
+    WriteDynamicResources(ResourceCache, VK_NULL_HANDLE,
+                          [&](Uint32 WriteCount, const VkWriteDescriptorSet* pWrites) {
+                              CmdBuffer.PushDescriptorSet(vkBindPoint, vkPipelineLayout, SetIndex, WriteCount, pWrites);
+                          });
+}
+
+
+void PipelineResourceSignatureVkImpl::WriteDescriptorBufferSet(const ShaderResourceCacheVk& ResourceCache,
+                                                               Uint32                       SetIndex,
+                                                               Uint8*                       pSetData,
+                                                               DeviceContextVkImpl*         pCtx) const
+{
+    VERIFY_EXPR(m_UseDescriptorBuffer);
+    VERIFY_EXPR(pSetData != nullptr);
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+
+    const VulkanUtilities::LogicalDevice&       LogicalDevice = GetDevice()->GetLogicalDevice();
+    const DescriptorBufferSetLayout&            Layout        = GetDescriptorBufferLayout(SetIndex);
+    const ShaderResourceCacheVk::DescriptorSet& DescrSet      = ResourceCache.GetDescriptorSet(SetIndex);
+    VERIFY_EXPR(Layout.Descriptors.size() == DescrSet.GetSize());
+
+    Layout.WriteImmutableSamplers(LogicalDevice, pSetData);
+    for (Uint32 CacheOffset = 0; CacheOffset < DescrSet.GetSize(); ++CacheOffset)
+    {
+        // Null resources are skipped the same way as by WriteDynamicResources()
+        const ShaderResourceCacheVk::Resource& Res = DescrSet.GetResource(CacheOffset);
+        if (Res)
+            Res.WriteDescriptorBufferData(LogicalDevice, Layout, CacheOffset, pSetData, pCtx);
+    }
 }
 
 
@@ -31,6 +31,8 @@
 
 #include <array>
 #include <unordered_map>
+#include <string>
+#include <cstring>
 
 #include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
@@ -116,6 +118,8 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
@@ -126,6 +130,488 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 }
 
 
+using GraphicsPipelineLibraries = std::array<PipelineLibraryCache::LibraryPtr, PipelineLibraryCache::LIBRARY_PART_COUNT>;
+
+// Graphics pipeline library (VK_EXT_graphics_pipeline_library) parameters
+struct GraphicsPipelineLibraryInfo
+{
+    // Shader stages that are compiled into the shader libraries
+    const PipelineStateVkImpl::TShaderStages* pShaderStages = nullptr;
+
+    // Resource signatures that define the pipeline layout
+    const RefCntAutoPtr<PipelineResourceSignatureVkImpl>* pSignatures    = nullptr;
+    Uint32                                                SignatureCount = 0;
+
+    // Whether to link the libraries with link-time optimization
+    bool LinkTimeOptimization = true;
+
+    // Output: the libraries the pipeline was linked from
+    GraphicsPipelineLibraries Libraries = {};
+
+    // Output: pipeline creation flags
+    VkPipelineCreateFlags Flags = 0;
+};
+
+VulkanUtilities::PipelineWrapper LinkGraphicsPipelineLibraries(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                                               const GraphicsPipelineLibraries&      Libraries,
+                                                               VkPipelineCreateFlags                 Flags,
+                                                               VkPipelineLayout                      vkLayout,
+                                                               bool                                  LinkTimeOptimization,
+                                                               VkPipelineCache                       vkPSOCache,
+                                                               const char*                           Name)
+{
+    std::array<VkPipeline, PipelineLibraryCache::LIBRARY_PART_COUNT> vkLibraries = {};
+    for (size_t i = 0; i < Libraries.size(); ++i)
+    {
+        VERIFY_EXPR(Libraries[i]);
+        vkLibraries[i] = *Libraries[i];
+    }
+
+    VkPipelineLibraryCreateInfoKHR LibraryCI{};
+    LibraryCI.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    LibraryCI.pNext        = nullptr;
+    LibraryCI.libraryCount = static_cast<uint32_t>(vkLibraries.size());
+    LibraryCI.pLibraries   = vkLibraries.data();
+
+    VkGraphicsPipelineCreateInfo PipelineCI{};
+    PipelineCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    PipelineCI.pNext = &LibraryCI;
+    PipelineCI.flags = Flags;
+    if (LinkTimeOptimization)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+    // All other states are provided by the libraries
+    PipelineCI.layout             = vkLayout;
+    PipelineCI.basePipelineHandle = VK_NULL_HANDLE;
+    PipelineCI.basePipelineIndex  = -1;
+
+    return LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, Name);
+}
+
+// Computes the hash of the i-th shader in the stage from its type, SPIR-V byte code and entry point.
+size_t ComputeShaderHash(const PipelineStateVkImpl::ShaderStageInfo& Stage, size_t i)
+{
+    const std::vector<uint32_t>& SPIRV      = Stage.SPIRVs[i];
+    const char*                  EntryPoint = Stage.Shaders[i]->GetEntryPoint();
+    return ComputeHash(Stage.Type,
+                       ComputeHashRaw(SPIRV.data(), SPIRV.size() * sizeof(uint32_t)),
+                       ComputeHashRaw(EntryPoint, strlen(EntryPoint)));
+}
+
+// Finds the four pipeline library parts in the device cache and creates the ones that are missing.
+// PipelineCI must be fully initialized as for the monolithic pipeline.
+void GetGraphicsPipelineLibraries(RenderDeviceVkImpl*                 pDeviceVk,
+                                  const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                  const PipelineStateDesc&            PSODesc,
+                                  const GraphicsPipelineDesc&         GraphicsPipeline,
+                                  VkPipelineCache                     vkPSOCache,
+                                  GraphicsPipelineLibraryInfo&        LibraryInfo)
+{
+    const VulkanUtilities::LogicalDevice& LogicalDevice = pDeviceVk->GetLogicalDevice();
+    PipelineLibraryCache&                 LibraryCache  = *pDeviceVk->GetPipelineLibraryCache();
+    VERIFY_EXPR(LibraryInfo.pShaderStages != nullptr);
+
+    // Render targets and sample count define the implicit render pass or the dynamic rendering info.
+    // Explicit render passes are not supported by the cache as their handles may be reused.
+    VERIFY_EXPR(GraphicsPipeline.pRenderPass == nullptr);
+
+    // Initializes the key with the states that all libraries depend on
+    auto InitLibraryKey = [&](bool UsesRenderTargets, bool UsesLayout) {
+        PipelineLibraryKey Key;
+        Key.Flags = PipelineCI.flags;
+        if (PipelineCI.pDynamicState != nullptr)
+        {
+            Key.DynamicStates.assign(PipelineCI.pDynamicState->pDynamicStates,
+                                     PipelineCI.pDynamicState->pDynamicStates + PipelineCI.pDynamicState->dynamicStateCount);
+        }
+
+        if (UsesRenderTargets)
+        {
+            Key.Desc.NumRenderTargets = GraphicsPipeline.NumRenderTargets;
+            for (Uint32 rt = 0; rt < GraphicsPipeline.NumRenderTargets; ++rt)
+                Key.Desc.RTVFormats[rt] = GraphicsPipeline.RTVFormats[rt];
+            Key.Desc.DSVFormat        = GraphicsPipeline.DSVFormat;
+            Key.Desc.ReadOnlyDSV      = GraphicsPipeline.ReadOnlyDSV;
+            Key.Desc.SmplDesc         = GraphicsPipeline.SmplDesc;
+            Key.Desc.ShadingRateFlags = GraphicsPipeline.ShadingRateFlags;
+            Key.Desc.SubpassIndex     = GraphicsPipeline.SubpassIndex;
+        }
+
+        if (UsesLayout)
+        {
+            for (Uint32 i = 0; i < LibraryInfo.SignatureCount; ++i)
+            {
+                if (PipelineResourceSignatureVkImpl* pSignature = LibraryInfo.pSignatures[i])
+                    Key.Signatures.emplace_back(pSignature);
+            }
+        }
+        return Key;
+    };
+
+    PipelineLibraryKey PreRasterizationKey = InitLibraryKey(/*UsesRenderTargets = */ true, /*UsesLayout = */ true);
+    PipelineLibraryKey FragmentShaderKey   = InitLibraryKey(/*UsesRenderTargets = */ true, /*UsesLayout = */ true);
+
+    // Split shader stages between the pre-rasterization and fragment shader libraries
+    std::vector<VkPipelineShaderStageCreateInfo> PreRasterizationStages;
+    std::vector<VkPipelineShaderStageCreateInfo> FragmentStages;
+
+    uint32_t StageIdx = 0;
+    for (const PipelineStateVkImpl::ShaderStageInfo& Stage : *LibraryInfo.pShaderStages)
+    {
+        for (size_t i = 0; i < Stage.Shaders.size(); ++i, ++StageIdx)
+        {
+            VERIFY_EXPR(StageIdx < PipelineCI.stageCount);
+
+            PipelineLibraryKey::ShaderInfo Shader;
+            Shader.Type       = Stage.Type;
+            Shader.SPIRV      = Stage.SPIRVs[i];
+            Shader.EntryPoint = Stage.Shaders[i]->GetEntryPoint();
+            if (Stage.Type == SHADER_TYPE_PIXEL)
+            {
+                FragmentStages.push_back(PipelineCI.pStages[StageIdx]);
+                FragmentShaderKey.Shaders.emplace_back(std::move(Shader));
+            }
+            else
+            {
+                PreRasterizationStages.push_back(PipelineCI.pStages[StageIdx]);
+                PreRasterizationKey.Shaders.emplace_back(std::move(Shader));
+            }
+        }
+    }
+    VERIFY_EXPR(StageIdx == PipelineCI.stageCount);
+
+    auto CreateLibrary = [&](VkGraphicsPipelineLibraryFlagsEXT LibraryFlags,
+                             const VkGraphicsPipelineCreateInfo& LibraryCI,
+                             const char*                         PartName) {
+        VkGraphicsPipelineLibraryCreateInfoEXT LibraryInfoCI{};
+        LibraryInfoCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+        LibraryInfoCI.pNext = LibraryCI.pNext;
+        LibraryInfoCI.flags = LibraryFlags;
+
+        VkGraphicsPipelineCreateInfo PartCI = LibraryCI;
+        PartCI.pNext                        = &LibraryInfoCI;
+        // Link-time optimization info is retained so that the libraries can be linked into the optimized pipeline
+        PartCI.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+        const std::string Name = std::string{PartName} + " library of PSO '" + (PSODesc.Name != nullptr ? PSODesc.Name : "") + '\'';
+        return LogicalDevice.CreateGraphicsPipeline(PartCI, vkPSOCache, Name.c_str());
+    };
+
+    // Initializes the states that are common for all libraries
+    auto GetLibraryCI = [&PipelineCI](bool UsesRenderPass, bool UsesLayout) {
+        VkGraphicsPipelineCreateInfo LibraryCI{};
+        LibraryCI.sType             = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        LibraryCI.flags             = PipelineCI.flags;
+        LibraryCI.pDynamicState     = PipelineCI.pDynamicState;
+        LibraryCI.basePipelineIndex = -1;
+        if (UsesRenderPass)
+        {
+            LibraryCI.pNext      = PipelineCI.pNext; // VkPipelineRenderingCreateInfoKHR
+            LibraryCI.renderPass = PipelineCI.renderPass;
+            LibraryCI.subpass    = PipelineCI.subpass;
+        }
+        if (UsesLayout)
+            LibraryCI.layout = PipelineCI.layout;
+        return LibraryCI;
+    };
+
+    PipelineLibraryKey VertexInputKey = InitLibraryKey(/*UsesRenderTargets = */ false, /*UsesLayout = */ false);
+    VertexInputKey.SetInputLayout(GraphicsPipeline.InputLayout);
+    VertexInputKey.Desc.PrimitiveTopology = GraphicsPipeline.PrimitiveTopology;
+
+    LibraryInfo.Libraries[PipelineLibraryCache::LIBRARY_PART_VERTEX_INPUT] = LibraryCache.GetLibrary(
+        PipelineLibraryCache::LIBRARY_PART_VERTEX_INPUT, std::move(VertexInputKey),
+        [&]() {
+            VkGraphicsPipelineCreateInfo LibraryCI = GetLibraryCI(/*UsesRenderPass = */ false, /*UsesLayout = */ false);
+            LibraryCI.pVertexInputState            = PipelineCI.pVertexInputState;
+            LibraryCI.pInputAssemblyState          = PipelineCI.pInputAssemblyState;
+            return CreateLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, LibraryCI, "Vertex input");
+        });
+
+    PreRasterizationKey.Desc.RasterizerDesc    = GraphicsPipeline.RasterizerDesc;
+    PreRasterizationKey.Desc.PrimitiveTopology = GraphicsPipeline.PrimitiveTopology;
+    PreRasterizationKey.Desc.NumViewports      = GraphicsPipeline.NumViewports;
+
+    LibraryInfo.Libraries[PipelineLibraryCache::LIBRARY_PART_PRE_RASTERIZATION] = LibraryCache.GetLibrary(
+        PipelineLibraryCache::LIBRARY_PART_PRE_RASTERIZATION, std::move(PreRasterizationKey),
+        [&]() {
+            VkGraphicsPipelineCreateInfo LibraryCI = GetLibraryCI(/*UsesRenderPass = */ true, /*UsesLayout = */ true);
+            LibraryCI.stageCount                   = static_cast<uint32_t>(PreRasterizationStages.size());
+            LibraryCI.pStages                      = PreRasterizationStages.data();
+            LibraryCI.pViewportState               = PipelineCI.pViewportState;
+            LibraryCI.pRasterizationState          = PipelineCI.pRasterizationState;
+            LibraryCI.pTessellationState           = PipelineCI.pTessellationState;
+            return CreateLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, LibraryCI, "Pre-rasterization");
+        });
+
+    FragmentShaderKey.Desc.DepthStencilDesc = GraphicsPipeline.DepthStencilDesc;
+    FragmentShaderKey.Desc.SampleMask       = GraphicsPipeline.SampleMask;
+
+    LibraryInfo.Libraries[PipelineLibraryCache::LIBRARY_PART_FRAGMENT_SHADER] = LibraryCache.GetLibrary(
+        PipelineLibraryCache::LIBRARY_PART_FRAGMENT_SHADER, std::move(FragmentShaderKey),
+        [&]() {
+            VkGraphicsPipelineCreateInfo LibraryCI = GetLibraryCI(/*UsesRenderPass = */ true, /*UsesLayout = */ true);
+            LibraryCI.stageCount                   = static_cast<uint32_t>(FragmentStages.size());
+            LibraryCI.pStages                      = !FragmentStages.empty() ? FragmentStages.data() : nullptr;
+            LibraryCI.pDepthStencilState           = PipelineCI.pDepthStencilState;
+            LibraryCI.pMultisampleState            = PipelineCI.pMultisampleState;
+            return CreateLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, LibraryCI, "Fragment shader");
+        });
+
+    PipelineLibraryKey FragmentOutputKey = InitLibraryKey(/*UsesRenderTargets = */ true, /*UsesLayout = */ false);
+    FragmentOutputKey.Desc.BlendDesc     = GraphicsPipeline.BlendDesc;
+    FragmentOutputKey.Desc.SampleMask    = GraphicsPipeline.SampleMask;
+
+    LibraryInfo.Libraries[PipelineLibraryCache::LIBRARY_PART_FRAGMENT_OUTPUT] = LibraryCache.GetLibrary(
+        PipelineLibraryCache::LIBRARY_PART_FRAGMENT_OUTPUT, std::move(FragmentOutputKey),
+        [&]() {
+            VkGraphicsPipelineCreateInfo LibraryCI = GetLibraryCI(/*UsesRenderPass = */ true, /*UsesLayout = */ false);
+            LibraryCI.pColorBlendState             = PipelineCI.pColorBlendState;
+            LibraryCI.pMultisampleState            = PipelineCI.pMultisampleState;
+            return CreateLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, LibraryCI, "Fragment output");
+        });
+
+    LibraryInfo.Flags = PipelineCI.flags;
+}
+
+
+bool IsPrimitiveRestartEnabled(PRIMITIVE_TOPOLOGY Topology)
+{
+    return (Topology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP ||
+            Topology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ ||
+            Topology == PRIMITIVE_TOPOLOGY_LINE_STRIP ||
+            Topology == PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ);
+}
+
+bool IsPatchListTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    return Topology >= PRIMITIVE_TOPOLOGY_1_CONTROL_POINT_PATCHLIST && Topology <= PRIMITIVE_TOPOLOGY_32_CONTROL_POINT_PATCHLIST;
+}
+
+// When primitive topology is dynamic, it must be of the same topology class as the one
+// the pipeline was created with, unless dynamicPrimitiveTopologyUnrestricted is supported.
+PRIMITIVE_TOPOLOGY GetPrimitiveTopologyClass(PRIMITIVE_TOPOLOGY Topology)
+{
+    switch (Topology)
+    {
+        case PRIMITIVE_TOPOLOGY_POINT_LIST:
+            return PRIMITIVE_TOPOLOGY_POINT_LIST;
+
+        case PRIMITIVE_TOPOLOGY_LINE_LIST:
+        case PRIMITIVE_TOPOLOGY_LINE_STRIP:
+        case PRIMITIVE_TOPOLOGY_LINE_LIST_ADJ:
+        case PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ:
+            return PRIMITIVE_TOPOLOGY_LINE_LIST;
+
+        case PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+        case PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+        case PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_ADJ:
+        case PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ:
+            return PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+        default:
+            VERIFY(IsPatchListTopology(Topology), "Unexpected primitive topology");
+            return PRIMITIVE_TOPOLOGY_1_CONTROL_POINT_PATCHLIST;
+    }
+}
+
+// Appends the states that are set by the device context when extended dynamic state is used,
+// see DeviceContextVkImpl::CommitDynamicGraphicsState().
+void GetExtendedDynamicStates(const ExtendedDynamicStates& EDS,
+                              const PipelineStateDesc&     PSODesc,
+                              const GraphicsPipelineDesc&  GraphicsPipeline,
+                              std::vector<VkDynamicState>& DynamicStates)
+{
+    if (!EDS.DepthStencilAndCulling)
+        return;
+
+    const bool HasInputAssembly = PSODesc.PipelineType == PIPELINE_TYPE_GRAPHICS;
+
+    DynamicStates.insert(DynamicStates.end(),
+                         {
+                             VK_DYNAMIC_STATE_CULL_MODE_EXT,
+                             VK_DYNAMIC_STATE_FRONT_FACE_EXT,
+                             VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT,
+                             VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT,
+                             VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT,
+                             VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT,
+                             VK_DYNAMIC_STATE_STENCIL_OP_EXT,
+                             VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK,
+                             VK_DYNAMIC_STATE_STENCIL_WRITE_MASK,
+                         });
+    if (HasInputAssembly)
+        DynamicStates.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+
+    if (EDS.DepthBiasAndRestart)
+    {
+        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS);
+        if (HasInputAssembly)
+            DynamicStates.push_back(VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT);
+    }
+
+    if (EDS.PatchControlPoints && HasInputAssembly && IsPatchListTopology(GraphicsPipeline.PrimitiveTopology))
+        DynamicStates.push_back(VK_DYNAMIC_STATE_PATCH_CONTROL_POINTS_EXT);
+
+    if (EDS.PolygonMode)
+        DynamicStates.push_back(VK_DYNAMIC_STATE_POLYGON_MODE_EXT);
+
+    if (EDS.DepthClampEnable)
+        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT);
+
+    if (EDS.ColorBlend)
+    {
+        DynamicStates.push_back(VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT);
+    }
+}
+
+// Computes the key that identifies the Vulkan pipeline in the shared pipeline cache.
+// States that are set dynamically are excluded from the key.
+SharedPipelineKey ComputeSharedPipelineKey(const ExtendedDynamicStates&                         EDS,
+                                           const PipelineStateDesc&                             PSODesc,
+                                           const GraphicsPipelineDesc&                          GraphicsPipeline,
+                                           const PipelineStateVkImpl::TShaderStages&            ShaderStages,
+                                           const RefCntAutoPtr<PipelineResourceSignatureVkImpl> Signatures[],
+                                           Uint32                                               SignatureCount)
+{
+    VERIFY_EXPR(EDS.DepthStencilAndCulling);
+
+    GraphicsPipelineDesc KeyDesc = GraphicsPipeline;
+
+    KeyDesc.RasterizerDesc.CullMode              = CULL_MODE_UNDEFINED;
+    KeyDesc.RasterizerDesc.FrontCounterClockwise = False;
+    KeyDesc.DepthStencilDesc                     = DepthStencilStateDesc{};
+
+    bool BakedPrimitiveRestart = false;
+    if (PSODesc.PipelineType == PIPELINE_TYPE_GRAPHICS)
+    {
+        if (!EDS.DepthBiasAndRestart)
+            BakedPrimitiveRestart = IsPrimitiveRestartEnabled(GraphicsPipeline.PrimitiveTopology);
+
+        // Patch control point count is baked into the pipeline unless it is dynamic
+        if (!IsPatchListTopology(GraphicsPipeline.PrimitiveTopology) || EDS.PatchControlPoints)
+        {
+            KeyDesc.PrimitiveTopology = EDS.UnrestrictedTopology ?
+                PRIMITIVE_TOPOLOGY_UNDEFINED :
+                GetPrimitiveTopologyClass(GraphicsPipeline.PrimitiveTopology);
+        }
+    }
+
+    if (EDS.DepthBiasAndRestart)
+    {
+        KeyDesc.RasterizerDesc.DepthBias            = 0;
+        KeyDesc.RasterizerDesc.DepthBiasClamp       = 0;
+        KeyDesc.RasterizerDesc.SlopeScaledDepthBias = 0;
+    }
+
+    if (EDS.PolygonMode)
+        KeyDesc.RasterizerDesc.FillMode = FILL_MODE_UNDEFINED;
+
+    if (EDS.DepthClampEnable)
+        KeyDesc.RasterizerDesc.DepthClipEnable = True;
+
+    if (EDS.ColorBlend)
+    {
+        // Logic operation is not dynamic
+        for (RenderTargetBlendDesc& RT : KeyDesc.BlendDesc.RenderTargets)
+        {
+            const Bool            LogicOperationEnable = RT.LogicOperationEnable;
+            const LOGIC_OPERATION LogicOp              = RT.LogicOp;
+
+            RT                      = RenderTargetBlendDesc{};
+            RT.LogicOperationEnable = LogicOperationEnable;
+            RT.LogicOp              = LogicOp;
+        }
+    }
+
+    SharedPipelineKey Key;
+    Key.Desc         = KeyDesc;
+    Key.PipelineType = PSODesc.PipelineType;
+    // The pipeline is released by its owner, so it may only be shared by pipeline states used in the same contexts
+    Key.ImmediateContextMask  = PSODesc.ImmediateContextMask;
+    Key.BakedPrimitiveRestart = BakedPrimitiveRestart;
+
+    Key.Hash = ComputeHash(KeyDesc, PSODesc.PipelineType, PSODesc.ImmediateContextMask, BakedPrimitiveRestart);
+
+    Key.SignatureHashes.resize(SignatureCount);
+    for (Uint32 i = 0; i < SignatureCount; ++i)
+    {
+        Key.SignatureHashes[i] = Signatures[i] ? Signatures[i]->GetHash() : size_t{0};
+        HashCombine(Key.Hash, Key.SignatureHashes[i]);
+    }
+
+    for (const PipelineStateVkImpl::ShaderStageInfo& Stage : ShaderStages)
+    {
+        for (size_t i = 0; i < Stage.Shaders.size(); ++i)
+        {
+            Key.ShaderHashes.push_back(ComputeShaderHash(Stage, i));
+            HashCombine(Key.Hash, Key.ShaderHashes.back());
+        }
+    }
+
+    return Key;
+}
+
+// Initializes the states that are set by the device context from the pipeline description.
+void InitDynamicGraphicsState(const PipelineStateDesc&                   PSODesc,
+                              const GraphicsPipelineDesc&                GraphicsPipeline,
+                              Uint32                                     NumColorAttachments,
+                              PipelineStateVkImpl::DynamicGraphicsState& State)
+{
+    const VkPipelineRasterizationStateCreateInfo RasterizerStateCI = RasterizerStateDesc_To_VkRasterizationStateCI(GraphicsPipeline.RasterizerDesc);
+
+    State.CullMode                = RasterizerStateCI.cullMode;
+    State.FrontFace               = RasterizerStateCI.frontFace;
+    State.PolygonMode             = RasterizerStateCI.polygonMode;
+    State.DepthClampEnable        = RasterizerStateCI.depthClampEnable;
+    State.DepthBiasEnable         = RasterizerStateCI.depthBiasEnable;
+    State.DepthBiasConstantFactor = RasterizerStateCI.depthBiasConstantFactor;
+    State.DepthBiasClamp          = RasterizerStateCI.depthBiasClamp;
+    State.DepthBiasSlopeFactor    = RasterizerStateCI.depthBiasSlopeFactor;
+
+    const VkPipelineDepthStencilStateCreateInfo DepthStencilStateCI = DepthStencilStateDesc_To_VkDepthStencilStateCI(GraphicsPipeline.DepthStencilDesc);
+
+    State.DepthTestEnable   = DepthStencilStateCI.depthTestEnable;
+    State.DepthWriteEnable  = DepthStencilStateCI.depthWriteEnable;
+    State.DepthCompareOp    = DepthStencilStateCI.depthCompareOp;
+    State.StencilTestEnable = DepthStencilStateCI.stencilTestEnable;
+    State.StencilFront      = DepthStencilStateCI.front;
+    State.StencilBack       = DepthStencilStateCI.back;
+
+    if (PSODesc.PipelineType == PIPELINE_TYPE_GRAPHICS)
+    {
+        PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(GraphicsPipeline.PrimitiveTopology, State.Topology, State.PatchControlPoints);
+        State.PrimitiveRestartEnable = IsPrimitiveRestartEnabled(GraphicsPipeline.PrimitiveTopology) ? VK_TRUE : VK_FALSE;
+    }
+
+    VERIFY_EXPR(NumColorAttachments <= MAX_RENDER_TARGETS);
+    std::vector<VkPipelineColorBlendAttachmentState> ColorBlendAttachmentStates(NumColorAttachments);
+
+    VkPipelineColorBlendStateCreateInfo BlendStateCI{};
+    BlendStateCI.pAttachments    = !ColorBlendAttachmentStates.empty() ? ColorBlendAttachmentStates.data() : nullptr;
+    BlendStateCI.attachmentCount = NumColorAttachments;
+    BlendStateDesc_To_VkBlendStateCI(GraphicsPipeline.BlendDesc, BlendStateCI, ColorBlendAttachmentStates);
+
+    State.NumColorAttachments = NumColorAttachments;
+    for (Uint32 rt = 0; rt < NumColorAttachments; ++rt)
+    {
+        const VkPipelineColorBlendAttachmentState& Attachment = ColorBlendAttachmentStates[rt];
+
+        State.ColorBlendEnable[rt] = Attachment.blendEnable;
+        State.ColorWriteMask[rt]   = Attachment.colorWriteMask;
+
+        VkColorBlendEquationEXT& Equation = State.ColorBlendEquation[rt];
+        Equation.srcColorBlendFactor      = Attachment.srcColorBlendFactor;
+        Equation.dstColorBlendFactor      = Attachment.dstColorBlendFactor;
+        Equation.colorBlendOp             = Attachment.colorBlendOp;
+        Equation.srcAlphaBlendFactor      = Attachment.srcAlphaBlendFactor;
+        Equation.dstAlphaBlendFactor      = Attachment.dstAlphaBlendFactor;
+        Equation.alphaBlendOp             = Attachment.alphaBlendOp;
+    }
+}
+
+
 void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDeviceVk,
                             std::vector<VkPipelineShaderStageCreateInfo>& Stages,
                             const PipelineLayoutVk&                       Layout,
@@ -133,7 +619,8 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
                             const GraphicsPipelineDesc&                   GraphicsPipeline,
                             VulkanUtilities::PipelineWrapper&             Pipeline,
                             RefCntAutoPtr<IRenderPass>&                   pRenderPass,
-                            VkPipelineCache                               vkPSOCache)
+                            VkPipelineCache                               vkPSOCache,
+                            GraphicsPipelineLibraryInfo*                  pLibraryInfo)
 {
     const VulkanUtilities::LogicalDevice&  LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const VulkanUtilities::PhysicalDevice& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
@@ -144,6 +631,8 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     VkPipelineRenderingCreateInfoKHR PipelineRenderingCI{};
     std::vector<VkFormat>            ColorAttachmentFormats;
@@ -198,13 +687,7 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
     InputAssemblyCI.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
     InputAssemblyCI.pNext = nullptr;
     InputAssemblyCI.flags = 0; // reserved for future use
-    InputAssemblyCI.primitiveRestartEnable =
-        (GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP ||
-         GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ ||
-         GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_LINE_STRIP ||
-         GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ) ?
-        VK_TRUE :
-        VK_FALSE;
+    InputAssemblyCI.primitiveRestartEnable = IsPrimitiveRestartEnabled(GraphicsPipeline.PrimitiveTopology) ? VK_TRUE : VK_FALSE;
     PipelineCI.pInputAssemblyState = &InputAssemblyCI;
 
 
@@ -340,6 +823,11 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
         DynamicStates.push_back(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
     }
 
+    if (const SharedPipelineCache* pSharedCache = pDeviceVk->GetSharedPipelineCache())
+    {
+        GetExtendedDynamicStates(pSharedCache->GetDynamicStates(), PSODesc, GraphicsPipeline, DynamicStates);
+    }
+
     DynamicStateCI.dynamicStateCount = static_cast<uint32_t>(DynamicStates.size());
     DynamicStateCI.pDynamicStates    = DynamicStates.data();
     PipelineCI.pDynamicState         = &DynamicStateCI;
@@ -357,7 +845,16 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    if (pLibraryInfo != nullptr)
+    {
+        GetGraphicsPipelineLibraries(pDeviceVk, PipelineCI, PSODesc, GraphicsPipeline, vkPSOCache, *pLibraryInfo);
+        Pipeline = LinkGraphicsPipelineLibraries(LogicalDevice, pLibraryInfo->Libraries, pLibraryInfo->Flags, PipelineCI.layout,
+                                                 pLibraryInfo->LinkTimeOptimization, vkPSOCache, PSODesc.Name);
+    }
+    else
+    {
+        Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    }
 }
 
 
@@ -378,6 +875,8 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount                   = static_cast<Uint32>(vkStages.size());
     PipelineCI.pStages                      = vkStages.data();
@@ -858,10 +1357,86 @@ void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateIn
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    const TShaderStages ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
 
     const VkPipelineCache vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+
+    // With extended dynamic state, pipeline states that only differ by dynamic states share the same Vulkan pipeline
+    SharedPipelineCache* pSharedCache = m_pDevice->GetSharedPipelineCache();
+    SharedPipelineKey    SharedKey;
+    if (pSharedCache != nullptr)
+    {
+        const GraphicsPipelineDesc& GraphicsPipeline = m_pGraphicsPipelineData->Desc;
+
+        const Uint32 NumColorAttachments = GraphicsPipeline.pRenderPass != nullptr ?
+            GraphicsPipeline.pRenderPass->GetDesc().pSubpasses[GraphicsPipeline.SubpassIndex].RenderTargetAttachmentCount :
+            GraphicsPipeline.NumRenderTargets;
+
+        m_pDynamicState = std::make_unique<DynamicGraphicsState>();
+        InitDynamicGraphicsState(m_Desc, GraphicsPipeline, NumColorAttachments, *m_pDynamicState);
+
+        SharedKey              = ComputeSharedPipelineKey(pSharedCache->GetDynamicStates(), m_Desc, GraphicsPipeline, ShaderStages, m_Signatures, m_SignatureCount);
+        m_pSharedPipelineOwner = pSharedCache->Find(SharedKey);
+        if (m_pSharedPipelineOwner)
+        {
+            // The implicit render pass is the same for both pipeline states
+            if (!GetRenderPassPtr())
+                GetRenderPassPtr() = m_pSharedPipelineOwner->GetRenderPassPtr();
+            return;
+        }
+    }
+
+    // Mesh pipelines and pipelines with explicit render passes are always created monolithically
+    if (m_pDevice->GetPipelineLibraryCache() == nullptr ||
+        m_Desc.PipelineType != PIPELINE_TYPE_GRAPHICS ||
+        m_pGraphicsPipelineData->Desc.pRenderPass != nullptr)
+    {
+        CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache, nullptr);
+        if (pSharedCache != nullptr)
+            pSharedCache->Add(std::move(SharedKey), this);
+        return;
+    }
+
+    // Asynchronous pipelines are quickly linked without link-time optimization, and
+    // the optimized pipeline is built in the background. Other pipelines are optimized right away.
+    IThreadPool* pThreadPool          = m_pDevice->GetShaderCompilationThreadPool();
+    const bool   OptimizeInBackground = (CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0 && pThreadPool != nullptr;
+
+    GraphicsPipelineLibraryInfo LibraryInfo;
+    LibraryInfo.pShaderStages        = &ShaderStages;
+    LibraryInfo.LinkTimeOptimization = !OptimizeInBackground;
+    LibraryInfo.pSignatures          = m_Signatures;
+    LibraryInfo.SignatureCount       = m_SignatureCount;
+
+    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache, &LibraryInfo);
+    if (pSharedCache != nullptr)
+        pSharedCache->Add(std::move(SharedKey), this);
+
+    // Keep the libraries alive so that they can be reused by other pipeline states
+    m_PipelineLibraries = LibraryInfo.Libraries;
+
+    if (OptimizeInBackground)
+    {
+        m_LinkTimeOptimizer = AsyncInitializer::Start(
+            pThreadPool,
+            [this,
+             Libraries = LibraryInfo.Libraries,
+             Flags     = LibraryInfo.Flags,
+             pPSOCache = RefCntAutoPtr<IPipelineStateCache>{CreateInfo.pPSOCache}](Uint32 ThreadId) //
+            {
+                const VkPipelineCache vkPSOCache = pPSOCache ? ClassPtrCast<PipelineStateCacheVkImpl>(pPSOCache.RawPtr())->GetVkPipelineCache() : VK_NULL_HANDLE;
+                try
+                {
+                    m_OptimizedPipeline = LinkGraphicsPipelineLibraries(m_pDevice->GetLogicalDevice(), Libraries, Flags, m_PipelineLayout.GetVkPipelineLayout(),
+                                                                        /*LinkTimeOptimization = */ true, vkPSOCache, m_Desc.Name);
+                    m_OptimizedPipelineReady.store(true);
+                }
+                catch (...)
+                {
+                    LOG_WARNING_MESSAGE("Failed to create optimized pipeline for PSO '", m_Desc.Name, "'. The pipeline linked without link-time optimization will be used.");
+                }
+            });
+    }
 }
 
 void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
@@ -925,6 +1500,8 @@ PipelineStateVkImpl::~PipelineStateVkImpl()
     // Make sure that asynchrous task is complete as it references the pipeline object.
     // This needs to be done in the final class before the destruction begins.
     GetStatus(/*WaitForCompletion =*/true);
+    // The optimized pipeline may still be being built in the background
+    AsyncInitializer::Update(m_LinkTimeOptimizer, /*WaitForCompletion =*/true);
 
     Destruct();
 }
@@ -932,6 +1509,8 @@ PipelineStateVkImpl::~PipelineStateVkImpl()
 void PipelineStateVkImpl::Destruct()
 {
     m_pDevice->SafeReleaseDeviceObject(std::move(m_Pipeline), m_Desc.ImmediateContextMask);
+    if (m_OptimizedPipeline)
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_OptimizedPipeline), m_Desc.ImmediateContextMask);
     m_PipelineLayout.Release(m_pDevice, m_Desc.ImmediateContextMask);
 
     TPipelineStateBase::Destruct();
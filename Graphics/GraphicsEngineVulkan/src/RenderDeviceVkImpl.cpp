@@ -80,7 +80,8 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     m_Properties
     {
         EngineCI.UploadHeapPageSize,
-        EngineCI.DynamicHeapPageSize
+        EngineCI.DynamicHeapPageSize,
+        EngineCI.DynamicDescriptorBufferPageSize
     },
     m_Instance         {Instance                 },
     m_PhysicalDevice         {std::move(PhysicalDevice)},
@@ -138,7 +139,8 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DeviceLocalMemoryPageSize,
         EngineCI.HostVisibleMemoryPageSize,
         EngineCI.DeviceLocalMemoryReserveSize,
-        EngineCI.HostVisibleMemoryReserveSize
+        EngineCI.HostVisibleMemoryReserveSize,
+        EngineCI.UseMemoryBudget ? EngineCI.MemoryBudgetThreshold : 0.f
     },
     m_DynamicMemoryManager
     {
@@ -156,6 +158,21 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         m_ImplicitRenderPassCache = std::make_unique<RenderPassCache>(*this);
     }
 
+    if (UseDescriptorBuffers())
+    {
+        m_pDescriptorBufferMgr = std::make_unique<DescriptorBufferManager>(*this, EngineCI.DescriptorBufferSize);
+    }
+
+    if (m_LogicalDevice->GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary)
+    {
+        m_pPipelineLibraryCache = std::make_unique<PipelineLibraryCache>();
+    }
+
+    if (m_LogicalDevice->GetEnabledExtFeatures().ExtendedDynamicState.extendedDynamicState)
+    {
+        m_pSharedPipelineCache = std::make_unique<SharedPipelineCache>(*m_LogicalDevice, *m_PhysicalDevice);
+    }
+
     static_assert(sizeof(VulkanDescriptorPoolSize) == sizeof(Uint32) * 11, "Please add new descriptors to m_DescriptorSetAllocator and m_DynamicDescriptorPool constructors");
 
     const uint32_t vkVersion = m_PhysicalDevice->GetVkVersion();
@@ -213,6 +230,23 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
     // the heap into release queues
     m_DynamicMemoryManager.Destroy();
 
+    // Descriptor buffer ranges that are still referenced by the release queues will be
+    // returned to the manager by ReleaseStaleResources() below.
+    if (m_pDescriptorBufferMgr)
+    {
+        m_pDescriptorBufferMgr->Destroy();
+    }
+
+    if (m_pPipelineLibraryCache)
+    {
+        m_pPipelineLibraryCache->Destroy();
+    }
+
+    if (m_pSharedPipelineCache)
+    {
+        m_pSharedPipelineCache->Destroy();
+    }
+
     // Explicitly destroy render pass cache
     if (m_ImplicitRenderPassCache)
     {
@@ -600,6 +634,8 @@ void RenderDeviceVkImpl::CreateBufferFromVulkanResource(VkBuffer vkBuffer, const
 void RenderDeviceVkImpl::CreateBuffer(const BufferDesc& BuffDesc, const BufferData* pBuffData, IBuffer** ppBuffer)
 {
     CreateBufferImpl(ppBuffer, BuffDesc, pBuffData);
+    if (ppBuffer != nullptr && *ppBuffer != nullptr)
+        m_MemoryDefragmenter.RegisterBuffer(ClassPtrCast<BufferVkImpl>(*ppBuffer));
 }
 
 
@@ -837,4 +873,129 @@ void RenderDeviceVkImpl::GetDeviceFeaturesVk(DeviceFeaturesVk& FeaturesVk) const
     FeaturesVk = PhysicalDeviceFeaturesToDeviceFeaturesVk(m_LogicalDevice->GetEnabledExtFeatures());
 }
 
+void RenderDeviceVkImpl::GetMemoryStatsVk(MemoryStatsVk& Stats)
+{
+    Stats = {};
+
+    const VulkanUtilities::MemoryManager::Stats MemStats = m_MemoryMgr.GetStats();
+
+    Stats.DeviceLocalUsedSize      = MemStats.UsedSize[0];
+    Stats.DeviceLocalAllocatedSize = MemStats.AllocatedSize[0];
+    Stats.HostVisibleUsedSize      = MemStats.UsedSize[1];
+    Stats.HostVisibleAllocatedSize = MemStats.AllocatedSize[1];
+    Stats.NumSmallPages            = MemStats.NumPages[static_cast<size_t>(VulkanUtilities::MemoryPageSizeClass::Small)];
+    Stats.NumRegularPages          = MemStats.NumPages[static_cast<size_t>(VulkanUtilities::MemoryPageSizeClass::Regular)];
+    Stats.NumDedicatedPages        = MemStats.NumPages[static_cast<size_t>(VulkanUtilities::MemoryPageSizeClass::Dedicated)];
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT Budget{};
+    if (m_LogicalDevice->GetEnabledExtFeatures().MemoryBudget && m_PhysicalDevice->GetMemoryBudget(Budget))
+    {
+        const VkPhysicalDeviceMemoryProperties& MemoryProps = m_PhysicalDevice->GetMemoryProperties();
+        for (uint32_t HeapIdx = 0; HeapIdx < MemoryProps.memoryHeapCount; ++HeapIdx)
+        {
+            if ((MemoryProps.memoryHeaps[HeapIdx].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0)
+            {
+                Stats.DeviceLocalBudget += Budget.heapBudget[HeapIdx];
+                Stats.DeviceLocalUsage += Budget.heapUsage[HeapIdx];
+            }
+        }
+    }
+
+    Stats.NumBytesMoved       = m_MemoryDefragmenter.GetNumBytesMoved();
+    Stats.NumAllocationsMoved = m_MemoryDefragmenter.GetNumAllocationsMoved();
+}
+
+void RenderDeviceVkImpl::GetPipelineStatsVk(PipelineStatsVk& Stats)
+{
+    Stats = {};
+
+    if (m_pSharedPipelineCache)
+    {
+        Stats.NumGraphicsPipelineStates  = m_pSharedPipelineCache->GetNumPipelineStates();
+        Stats.NumSharedGraphicsPipelines = m_pSharedPipelineCache->GetNumSharedPipelines();
+    }
+}
+
+VulkanUtilities::EventWrapper RenderDeviceVkImpl::GetSplitBarrierEvent()
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_SplitBarrierEventsMtx};
+        if (!m_SplitBarrierEvents.empty())
+        {
+            VulkanUtilities::EventWrapper Event = std::move(m_SplitBarrierEvents.back());
+            m_SplitBarrierEvents.pop_back();
+            return Event;
+        }
+    }
+
+    VkEventCreateInfo EventCI{};
+    EventCI.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+    EventCI.pNext = nullptr;
+    // Events are reset on the host when they are returned to the pool,
+    // so VK_EVENT_CREATE_DEVICE_ONLY_BIT can't be used.
+    EventCI.flags = 0;
+    return m_LogicalDevice->CreateEvent(EventCI, "Split barrier event");
+}
+
+void RenderDeviceVkImpl::DisposeSplitBarrierEvents(std::vector<VulkanUtilities::EventWrapper>&& Events, Uint64 QueueMask)
+{
+    if (Events.empty())
+        return;
+
+    if (QueueMask == 0)
+    {
+        // The command buffers that use the events have never been submitted
+        RecycleSplitBarrierEvents(std::move(Events));
+        return;
+    }
+
+    class EventRecycler
+    {
+    public:
+        // clang-format off
+        EventRecycler(RenderDeviceVkImpl&                          _Device,
+                      std::vector<VulkanUtilities::EventWrapper>&& _Events) noexcept :
+            Device {&_Device          },
+            Events {std::move(_Events)}
+        {}
+
+        EventRecycler            (const EventRecycler&) = delete;
+        EventRecycler& operator= (const EventRecycler&) = delete;
+        EventRecycler& operator= (      EventRecycler&&)= delete;
+
+        EventRecycler(EventRecycler&& rhs) noexcept :
+            Device {rhs.Device            },
+            Events {std::move(rhs.Events)}
+        {
+            rhs.Device = nullptr;
+        }
+        // clang-format on
+
+        ~EventRecycler()
+        {
+            if (Device != nullptr)
+            {
+                Device->RecycleSplitBarrierEvents(std::move(Events));
+            }
+        }
+
+    private:
+        RenderDeviceVkImpl*                        Device;
+        std::vector<VulkanUtilities::EventWrapper> Events;
+    };
+
+    SafeReleaseDeviceObject(EventRecycler{*this, std::move(Events)}, QueueMask);
+}
+
+void RenderDeviceVkImpl::RecycleSplitBarrierEvents(std::vector<VulkanUtilities::EventWrapper>&& Events)
+{
+    for (const VulkanUtilities::EventWrapper& Event : Events)
+        m_LogicalDevice->ResetEvent(Event);
+
+    std::lock_guard<std::mutex> Lock{m_SplitBarrierEventsMtx};
+    for (VulkanUtilities::EventWrapper& Event : Events)
+        m_SplitBarrierEvents.emplace_back(std::move(Event));
+    Events.clear();
+}
+
 } // namespace Diligent
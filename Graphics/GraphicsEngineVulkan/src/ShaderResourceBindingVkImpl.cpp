@@ -43,4 +43,13 @@ ShaderResourceBindingVkImpl::~ShaderResourceBindingVkImpl()
 {
 }
 
+void ShaderResourceBindingVkImpl::SetResources(const ShaderResourceVariableBinding* pBindings,
+                                               Uint32                               NumBindings,
+                                               SET_SHADER_RESOURCE_FLAGS            Flags)
+{
+    // Coalesce descriptor set updates of all records into as few vkUpdateDescriptorSets calls as possible
+    ShaderResourceCacheVk::DescriptorWriteBatch WriteBatch{m_ShaderResourceCache};
+    TBase::SetResources(pBindings, NumBindings, Flags);
+}
+
 } // namespace Diligent
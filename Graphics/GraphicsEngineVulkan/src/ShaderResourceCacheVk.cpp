@@ -288,6 +288,92 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
 #endif
 }
 
+namespace
+{
+
+void InitDescriptorWrite(VkWriteDescriptorSet& WriteDescrSet,
+                         VkDescriptorSet       vkSet,
+                         Uint32                BindingIndex,
+                         Uint32                ArrayIndex,
+                         DescriptorType        Type)
+{
+    WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    WriteDescrSet.pNext           = nullptr;
+    WriteDescrSet.dstSet          = vkSet;
+    WriteDescrSet.dstBinding      = BindingIndex;
+    WriteDescrSet.dstArrayElement = ArrayIndex;
+    WriteDescrSet.descriptorCount = 1;
+    // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
+    // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
+    WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(Type);
+    WriteDescrSet.pImageInfo       = nullptr;
+    WriteDescrSet.pBufferInfo      = nullptr;
+    WriteDescrSet.pTexelBufferView = nullptr;
+}
+
+// Writes the descriptor info of the resource to one of the provided structures
+// and sets the corresponding pointer in WriteDescrSet.
+void WriteDescriptorInfo(const ShaderResourceCacheVk::Resource&        Res,
+                         VkWriteDescriptorSet&                         WriteDescrSet,
+                         VkDescriptorImageInfo&                        vkDescrImageInfo,
+                         VkDescriptorBufferInfo&                       vkDescrBufferInfo,
+                         VkBufferView&                                 vkDescrBufferView,
+                         VkWriteDescriptorSetAccelerationStructureKHR& vkDescrAccelStructInfo)
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::Sampler:
+            vkDescrImageInfo         = Res.GetSamplerDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo = &vkDescrImageInfo;
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            vkDescrImageInfo         = Res.GetImageDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo = &vkDescrImageInfo;
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            vkDescrBufferView              = Res.GetBufferViewWriteInfo();
+            WriteDescrSet.pTexelBufferView = &vkDescrBufferView;
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            vkDescrBufferInfo         = Res.GetUniformBufferDescriptorWriteInfo();
+            WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            vkDescrBufferInfo         = Res.GetStorageBufferDescriptorWriteInfo();
+            WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            vkDescrImageInfo         = Res.GetInputAttachmentDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo = &vkDescrImageInfo;
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            vkDescrAccelStructInfo = Res.GetAccelerationStructureWriteInfo();
+            WriteDescrSet.pNext    = &vkDescrAccelStructInfo;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+    }
+}
+
+} // namespace
+
 const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     const VulkanUtilities::LogicalDevice* pLogicalDevice,
     Uint32                                DescrSetIndex,
@@ -333,86 +419,135 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     {
         VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
 
-        VkWriteDescriptorSet WriteDescrSet;
-        WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteDescrSet.pNext           = nullptr;
-        WriteDescrSet.dstSet          = vkSet;
-        WriteDescrSet.dstBinding      = SrcRes.BindingIndex;
-        WriteDescrSet.dstArrayElement = SrcRes.ArrayIndex;
-        WriteDescrSet.descriptorCount = 1;
-        // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
-        // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
-        WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(DstRes.Type);
-        WriteDescrSet.pImageInfo       = nullptr;
-        WriteDescrSet.pBufferInfo      = nullptr;
-        WriteDescrSet.pTexelBufferView = nullptr;
-
-        // Do not zero-initialize!
-        union
+        if (m_pWriteBatch != nullptr)
         {
+            m_pWriteBatch->AddWrite(pLogicalDevice, vkSet, SrcRes.BindingIndex, SrcRes.ArrayIndex, DstRes);
+        }
+        else
+        {
+            VkWriteDescriptorSet WriteDescrSet;
+            InitDescriptorWrite(WriteDescrSet, vkSet, SrcRes.BindingIndex, SrcRes.ArrayIndex, DstRes.Type);
+
+            // Do not zero-initialize!
             VkDescriptorImageInfo                        vkDescrImageInfo;
             VkDescriptorBufferInfo                       vkDescrBufferInfo;
             VkBufferView                                 vkDescrBufferView;
             VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
-        };
+            WriteDescriptorInfo(DstRes, WriteDescrSet, vkDescrImageInfo, vkDescrBufferInfo, vkDescrBufferView, vkDescrAccelStructInfo);
 
-        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
-        switch (DstRes.Type)
-        {
-            case DescriptorType::Sampler:
-                vkDescrImageInfo         = DstRes.GetSamplerDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
+            pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+        }
+    }
+    else if (DescrSet.m_DescriptorBufferAllocation && DstRes.pObject && !IsDynamicBuffer(DstRes))
+    {
+        VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to the descriptor buffer");
+        // The address of dynamic buffers is only known when the set is bound, see HasDynamicBufferOffsets()
+        DstRes.WriteDescriptorBufferData(*pLogicalDevice, *DescrSet.m_pDescriptorBufferLayout, CacheOffset,
+                                         DescrSet.m_DescriptorBufferAllocation.GetCPUAddress(), nullptr);
+    }
 
-            case DescriptorType::CombinedImageSampler:
-            case DescriptorType::SeparateImage:
-            case DescriptorType::StorageImage:
-                vkDescrImageInfo         = DstRes.GetImageDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
+    UpdateRevision();
 
-            case DescriptorType::UniformTexelBuffer:
-            case DescriptorType::StorageTexelBuffer:
-            case DescriptorType::StorageTexelBuffer_ReadOnly:
-                vkDescrBufferView              = DstRes.GetBufferViewWriteInfo();
-                WriteDescrSet.pTexelBufferView = &vkDescrBufferView;
-                break;
+    return DstRes;
+}
 
-            case DescriptorType::UniformBuffer:
-            case DescriptorType::UniformBufferDynamic:
-                vkDescrBufferInfo         = DstRes.GetUniformBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
+ShaderResourceCacheVk::DescriptorWriteBatch::DescriptorWriteBatch(ShaderResourceCacheVk& Cache) noexcept :
+    m_Cache{Cache}
+{
+    VERIFY(m_Cache.m_pWriteBatch == nullptr, "Another descriptor write batch is already active for this cache");
+    m_Cache.m_pWriteBatch = this;
+}
 
-            case DescriptorType::StorageBuffer:
-            case DescriptorType::StorageBuffer_ReadOnly:
-            case DescriptorType::StorageBufferDynamic:
-            case DescriptorType::StorageBufferDynamic_ReadOnly:
-                vkDescrBufferInfo         = DstRes.GetStorageBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
+ShaderResourceCacheVk::DescriptorWriteBatch::~DescriptorWriteBatch()
+{
+    Flush();
+    VERIFY_EXPR(m_Cache.m_pWriteBatch == this);
+    m_Cache.m_pWriteBatch = nullptr;
+}
 
-            case DescriptorType::InputAttachment:
-            case DescriptorType::InputAttachment_General:
-                vkDescrImageInfo         = DstRes.GetInputAttachmentDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
+void ShaderResourceCacheVk::DescriptorWriteBatch::AddWrite(const VulkanUtilities::LogicalDevice* pLogicalDevice,
+                                                           VkDescriptorSet                       vkSet,
+                                                           Uint32                                BindingIndex,
+                                                           Uint32                                ArrayIndex,
+                                                           const Resource&                       Res)
+{
+    VERIFY(m_pLogicalDevice == nullptr || m_pLogicalDevice == pLogicalDevice, "All writes in the batch must use the same logical device");
+    m_pLogicalDevice = pLogicalDevice;
+
+    if (m_NumImgInfos == m_ImgInfos.size() ||
+        m_NumBuffInfos == m_BuffInfos.size() ||
+        m_NumBuffViews == m_BuffViews.size() ||
+        m_NumAccelStructs == m_AccelStructInfos.size() ||
+        m_NumWrites == m_Writes.size())
+    {
+        Flush();
+    }
 
-            case DescriptorType::AccelerationStructure:
-                vkDescrAccelStructInfo = DstRes.GetAccelerationStructureWriteInfo();
-                WriteDescrSet.pNext    = &vkDescrAccelStructInfo;
-                break;
+    VkWriteDescriptorSet& WriteDescrSet = m_Writes[m_NumWrites];
+    InitDescriptorWrite(WriteDescrSet, vkSet, BindingIndex, ArrayIndex, Res.Type);
+    WriteDescriptorInfo(Res, WriteDescrSet, m_ImgInfos[m_NumImgInfos], m_BuffInfos[m_NumBuffInfos], m_BuffViews[m_NumBuffViews], m_AccelStructInfos[m_NumAccelStructs]);
 
-            default:
-                UNEXPECTED("Unexpected descriptor type");
+    if (WriteDescrSet.pImageInfo != nullptr)
+        ++m_NumImgInfos;
+    else if (WriteDescrSet.pBufferInfo != nullptr)
+        ++m_NumBuffInfos;
+    else if (WriteDescrSet.pTexelBufferView != nullptr)
+        ++m_NumBuffViews;
+    else if (WriteDescrSet.pNext != nullptr)
+        ++m_NumAccelStructs;
+
+    if (m_NumWrites > 0)
+    {
+        // If the previous write targets the preceding elements of the same binding, extend it.
+        // The previous write is the last one that used the info array, so the new info immediately
+        // follows its infos. Acceleration structure writes are never merged as every TLAS
+        // descriptor is written through its own VkWriteDescriptorSetAccelerationStructureKHR.
+        VkWriteDescriptorSet& PrevWrite = m_Writes[m_NumWrites - 1];
+        if (PrevWrite.dstSet == WriteDescrSet.dstSet &&
+            PrevWrite.dstBinding == WriteDescrSet.dstBinding &&
+            PrevWrite.descriptorType == WriteDescrSet.descriptorType &&
+            PrevWrite.dstArrayElement + PrevWrite.descriptorCount == WriteDescrSet.dstArrayElement &&
+            PrevWrite.pNext == nullptr && WriteDescrSet.pNext == nullptr)
+        {
+            VERIFY_EXPR(PrevWrite.pImageInfo == nullptr || PrevWrite.pImageInfo + PrevWrite.descriptorCount == WriteDescrSet.pImageInfo);
+            VERIFY_EXPR(PrevWrite.pBufferInfo == nullptr || PrevWrite.pBufferInfo + PrevWrite.descriptorCount == WriteDescrSet.pBufferInfo);
+            VERIFY_EXPR(PrevWrite.pTexelBufferView == nullptr || PrevWrite.pTexelBufferView + PrevWrite.descriptorCount == WriteDescrSet.pTexelBufferView);
+            ++PrevWrite.descriptorCount;
+            return;
         }
+    }
 
-        pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+    ++m_NumWrites;
+}
+
+void ShaderResourceCacheVk::DescriptorWriteBatch::Flush()
+{
+    if (m_NumWrites > 0)
+    {
+        VERIFY_EXPR(m_pLogicalDevice != nullptr);
+        m_pLogicalDevice->UpdateDescriptorSets(m_NumWrites, m_Writes.data(), 0, nullptr);
     }
 
-    UpdateRevision();
+    m_NumImgInfos     = 0;
+    m_NumBuffInfos    = 0;
+    m_NumBuffViews    = 0;
+    m_NumAccelStructs = 0;
+    m_NumWrites       = 0;
+}
 
-    return DstRes;
+bool ShaderResourceCacheVk::HasDynamicBufferOffsets(Uint32 SetIndex) const
+{
+    // Uniform and storage buffers with dynamic offsets go first in every descriptor set, see GetDynamicBufferOffsets()
+    const DescriptorSet& DescrSet = GetDescriptorSet(SetIndex);
+    for (Uint32 res = 0; res < DescrSet.GetSize(); ++res)
+    {
+        const Resource& Res = DescrSet.GetResource(res);
+        if (!IsDynamicDescriptorType(Res.Type))
+            break;
+        if (Res.BufferDynamicOffset != 0 || IsDynamicBuffer(Res))
+            return true;
+    }
+    return false;
 }
 
 void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
@@ -871,6 +1006,133 @@ VkWriteDescriptorSetAccelerationStructureKHR ShaderResourceCacheVk::Resource::Ge
 }
 
 
+void ShaderResourceCacheVk::Resource::WriteDescriptorBufferData(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                                                const DescriptorBufferSetLayout&      Layout,
+                                                                Uint32                                CacheOffset,
+                                                                Uint8*                                pSetData,
+                                                                DeviceContextVkImpl*                  pCtx) const
+{
+    DEV_CHECK_ERR(pObject != nullptr, "Unable to write descriptor buffer data: cached object is null");
+    VERIFY_EXPR(CacheOffset < Layout.Descriptors.size());
+    VERIFY(pCtx != nullptr || !IsDynamicBuffer(*this), "Device context is required to write descriptors of dynamic buffers");
+
+    const DescriptorBufferSetLayout::Descriptor& Descr = Layout.Descriptors[CacheOffset];
+
+    VkDescriptorGetInfoEXT DescriptorInfo{};
+    DescriptorInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    DescriptorInfo.pNext = nullptr;
+    DescriptorInfo.type  = DescriptorTypeToVkDescriptorBufferType(Type);
+
+    // Do not zero-initialize!
+    VkDescriptorImageInfo      ImageInfo;
+    VkDescriptorAddressInfoEXT AddressInfo;
+    AddressInfo.sType  = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    AddressInfo.pNext  = nullptr;
+    AddressInfo.format = VK_FORMAT_UNDEFINED;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Type)
+    {
+        case DescriptorType::Sampler:
+            ImageInfo                    = GetSamplerDescriptorWriteInfo();
+            DescriptorInfo.data.pSampler = &ImageInfo.sampler;
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+            ImageInfo = GetImageDescriptorWriteInfo();
+            // Unlike descriptor sets, descriptor buffers do not pick up immutable samplers from the layout
+            if (HasImmutableSampler)
+                ImageInfo.sampler = Descr.ImmutableSampler;
+            DescriptorInfo.data.pCombinedImageSampler = &ImageInfo;
+            break;
+
+        case DescriptorType::SeparateImage:
+            ImageInfo                         = GetImageDescriptorWriteInfo();
+            DescriptorInfo.data.pSampledImage = &ImageInfo;
+            break;
+
+        case DescriptorType::StorageImage:
+            ImageInfo                         = GetImageDescriptorWriteInfo();
+            DescriptorInfo.data.pStorageImage = &ImageInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            ImageInfo                                 = GetInputAttachmentDescriptorWriteInfo();
+            DescriptorInfo.data.pInputAttachmentImage = &ImageInfo;
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+        {
+            const BufferViewVkImpl* pBuffViewVk = pObject.ConstPtr<BufferViewVkImpl>();
+            const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
+            const BufferVkImpl*     pBuffVk     = pBuffViewVk->GetBuffer<const BufferVkImpl>();
+
+            AddressInfo.address = pBuffVk->GetVkDeviceAddress() + ViewDesc.ByteOffset;
+            AddressInfo.range   = ViewDesc.ByteWidth;
+            AddressInfo.format  = TypeToVkFormat(ViewDesc.Format.ValueType, ViewDesc.Format.NumComponents, ViewDesc.Format.IsNormalized);
+            if (Type == DescriptorType::UniformTexelBuffer)
+                DescriptorInfo.data.pUniformTexelBuffer = &AddressInfo;
+            else
+                DescriptorInfo.data.pStorageTexelBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+        {
+            const bool          IsUniform = (Type == DescriptorType::UniformBuffer || Type == DescriptorType::UniformBufferDynamic);
+            const BufferVkImpl* pBuffVk   = IsUniform ?
+                pObject.ConstPtr<BufferVkImpl>() :
+                pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+
+            // Descriptor buffers have no dynamic offsets, so the offset is applied to the descriptor address.
+            // Do not verify dynamic allocation here for the same reason as in GetDynamicBufferOffsets().
+            AddressInfo.address = pCtx != nullptr ?
+                pCtx->GetDynamicBufferDeviceAddress(pBuffVk, /*VerifyAllocation = */ false) :
+                pBuffVk->GetVkDeviceAddress();
+            AddressInfo.address += BufferBaseOffset + BufferDynamicOffset;
+            AddressInfo.range = BufferRangeSize;
+            if (IsUniform)
+                DescriptorInfo.data.pUniformBuffer = &AddressInfo;
+            else
+                DescriptorInfo.data.pStorageBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::AccelerationStructure:
+            DescriptorInfo.data.accelerationStructure = pObject.ConstPtr<TopLevelASVkImpl>()->GetVkDeviceAddress();
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+            return;
+    }
+
+    if (Descr.SamplerOffset == ~0u)
+    {
+        LogicalDevice.GetDescriptor(DescriptorInfo, Descr.Size, pSetData + Descr.Offset);
+    }
+    else
+    {
+        // The image and sampler parts of the combined image sampler are stored in separate arrays:
+        // the descriptor returned by vkGetDescriptorEXT must be split by the application.
+        VERIFY_EXPR(Type == DescriptorType::CombinedImageSampler);
+        std::array<Uint8, 256> CombinedData;
+        VERIFY(Layout.CombinedImageSamplerSize <= CombinedData.size() && Descr.Size <= Layout.CombinedImageSamplerSize,
+               "Combined image sampler descriptor size (", Layout.CombinedImageSamplerSize, ") is unexpectedly large");
+        LogicalDevice.GetDescriptor(DescriptorInfo, Layout.CombinedImageSamplerSize, CombinedData.data());
+        memcpy(pSetData + Descr.Offset, CombinedData.data(), Descr.Size);
+        memcpy(pSetData + Descr.SamplerOffset, CombinedData.data() + Descr.Size, Layout.CombinedImageSamplerSize - Descr.Size);
+    }
+}
+
 
 Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContextVkImpl*   pCtx,
                                                       std::vector<uint32_t>& Offsets,
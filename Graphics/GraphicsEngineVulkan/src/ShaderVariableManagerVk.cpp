@@ -79,6 +79,21 @@ size_t ShaderVariableManagerVk::GetRequiredMemorySize(const PipelineResourceSign
     return (*pNumVariables) * sizeof(ShaderVariableVkImpl);
 }
 
+void ShaderVariableManagerVk::GetVariableIndices(const PipelineResourceSignatureVkImpl& Signature,
+                                                 const SHADER_RESOURCE_VARIABLE_TYPE*   AllowedVarTypes,
+                                                 Uint32                                 NumAllowedTypes,
+                                                 SHADER_TYPE                            ShaderType,
+                                                 Uint32*                                pVarIndices)
+{
+    // Variables are created in the order of resources, see Initialize()
+    Uint32 VarInd = 0;
+    ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
+                              [pVarIndices, &VarInd](Uint32 ResIndex) //
+                              {
+                                  pVarIndices[ResIndex] = VarInd++;
+                              });
+}
+
 // Creates shader variable for every resource from SrcLayout whose type is one AllowedVarTypes
 void ShaderVariableManagerVk::Initialize(const PipelineResourceSignatureVkImpl& Signature,
                                          IMemoryAllocator&                      Allocator,
@@ -102,6 +117,9 @@ void ShaderVariableManagerVk::Initialize(const PipelineResourceSignatureVkImpl&
                                   ++VarInd;
                               });
     VERIFY_EXPR(VarInd == m_NumVariables);
+#ifdef DILIGENT_DEBUG
+    DvpVerifyVariableOrder();
+#endif
 }
 
 void ShaderVariableManagerVk::Destroy(IMemoryAllocator& Allocator)
@@ -116,13 +134,7 @@ void ShaderVariableManagerVk::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableVkImpl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return FindVariableByName(Name);
 }
 
 
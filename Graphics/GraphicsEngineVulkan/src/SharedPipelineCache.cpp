@@ -0,0 +1,165 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "SharedPipelineCache.hpp"
+
+#include <algorithm>
+
+#include "PipelineStateVkImpl.hpp"
+
+namespace Diligent
+{
+
+ExtendedDynamicStates::ExtendedDynamicStates(const VulkanUtilities::LogicalDevice&  LogicalDevice,
+                                             const VulkanUtilities::PhysicalDevice& PhysicalDevice) noexcept
+{
+    const VulkanUtilities::PhysicalDevice::ExtensionFeatures& ExtFeatures = LogicalDevice.GetEnabledExtFeatures();
+
+    DepthStencilAndCulling = ExtFeatures.ExtendedDynamicState.extendedDynamicState != VK_FALSE;
+    if (!DepthStencilAndCulling)
+        return;
+
+    DepthBiasAndRestart  = ExtFeatures.ExtendedDynamicState2.extendedDynamicState2 != VK_FALSE;
+    PatchControlPoints   = ExtFeatures.ExtendedDynamicState2.extendedDynamicState2PatchControlPoints != VK_FALSE;
+    UnrestrictedTopology = PhysicalDevice.GetExtProperties().ExtendedDynamicState3.dynamicPrimitiveTopologyUnrestricted != VK_FALSE;
+
+    const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& EDS3 = ExtFeatures.ExtendedDynamicState3;
+
+    PolygonMode      = EDS3.extendedDynamicState3PolygonMode != VK_FALSE;
+    DepthClampEnable = EDS3.extendedDynamicState3DepthClampEnable != VK_FALSE;
+    ColorBlend       = (EDS3.extendedDynamicState3ColorBlendEnable != VK_FALSE &&
+                        EDS3.extendedDynamicState3ColorBlendEquation != VK_FALSE &&
+                        EDS3.extendedDynamicState3ColorWriteMask != VK_FALSE);
+}
+
+bool SharedPipelineKey::operator==(const SharedPipelineKey& rhs) const noexcept
+{
+    // clang-format off
+    return Hash                  == rhs.Hash                  &&
+           PipelineType          == rhs.PipelineType          &&
+           ImmediateContextMask  == rhs.ImmediateContextMask  &&
+           BakedPrimitiveRestart == rhs.BakedPrimitiveRestart &&
+           SignatureHashes       == rhs.SignatureHashes       &&
+           ShaderHashes          == rhs.ShaderHashes          &&
+           Desc                  == rhs.Desc;
+    // clang-format on
+}
+
+SharedPipelineCache::SharedPipelineCache(const VulkanUtilities::LogicalDevice&  LogicalDevice,
+                                         const VulkanUtilities::PhysicalDevice& PhysicalDevice) noexcept :
+    m_DynamicStates{LogicalDevice, PhysicalDevice}
+{
+}
+
+SharedPipelineCache::~SharedPipelineCache()
+{
+    Destroy();
+}
+
+RefCntAutoPtr<PipelineStateVkImpl> SharedPipelineCache::Find(const SharedPipelineKey& Key)
+{
+    m_NumPipelineStates.fetch_add(1);
+
+    RefCntAutoPtr<PipelineStateVkImpl> pOwner;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+
+        auto range = m_Pipelines.equal_range(Key.Hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            // The entry key references the owner data, so the owner must be locked first
+            RefCntAutoPtr<PipelineStateVkImpl> pEntryOwner = it->second.pOwner.Lock();
+            if (pEntryOwner && it->second.Key == Key)
+            {
+                pOwner = std::move(pEntryOwner);
+                break;
+            }
+        }
+    }
+
+    if (pOwner)
+        m_NumSharedPipelines.fetch_add(1);
+
+    return pOwner;
+}
+
+void SharedPipelineCache::Add(SharedPipelineKey Key, PipelineStateVkImpl* pPSO)
+{
+    VERIFY_EXPR(pPSO != nullptr);
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    // If another thread has registered a pipeline with the same key, the new pipeline state replaces it.
+    // Entries of destroyed pipeline states can't be compared and are removed.
+    auto range = m_Pipelines.equal_range(Key.Hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        RefCntAutoPtr<PipelineStateVkImpl> pEntryOwner = it->second.pOwner.Lock();
+        if (!pEntryOwner || it->second.Key == Key)
+            it = m_Pipelines.erase(it);
+        else
+            ++it;
+    }
+
+    const size_t Hash = Key.Hash;
+    m_Pipelines.emplace(Hash, PipelineEntry{std::move(Key), RefCntWeakPtr<PipelineStateVkImpl>{pPSO}});
+
+    if (m_Pipelines.size() >= m_PurgeThreshold)
+        PurgeExpiredEntries();
+}
+
+void SharedPipelineCache::PurgeExpiredEntries()
+{
+    for (auto it = m_Pipelines.begin(); it != m_Pipelines.end();)
+    {
+        if (!it->second.pOwner.IsValid())
+            it = m_Pipelines.erase(it);
+        else
+            ++it;
+    }
+    m_PurgeThreshold = std::max(m_PurgeThreshold, m_Pipelines.size() * 2);
+}
+
+void SharedPipelineCache::Destroy()
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        m_Pipelines.clear();
+    }
+
+    const Uint32 NumPipelineStates = m_NumPipelineStates.exchange(0);
+    const Uint32 NumShared         = m_NumSharedPipelines.exchange(0);
+    if (NumPipelineStates > 0)
+    {
+        LOG_INFO_MESSAGE("Extended dynamic state: ", NumPipelineStates, " graphics pipeline state(s) created, ", NumShared,
+                         " of them reused an existing Vulkan pipeline (", NumPipelineStates - NumShared, " unique pipeline(s)).");
+    }
+}
+
+} // namespace Diligent
@@ -244,10 +244,16 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
 
         VkImageCreateInfo ImageCI = TextureDescToVkImageCreateInfo(m_Desc, pRenderDeviceVk);
 
-        const bool InitContent           = pInitData != nullptr && pInitData->pSubResources != nullptr && pInitData->NumSubresources > 0;
-        const bool UseHostInitialization = InitContent && CheckHostImageInitialization(LogicalDevice, pRenderDeviceVk->GetPhysicalDevice(), ImageCI);
-        if (UseHostInitialization)
+        const bool InitContent  = pInitData != nullptr && pInitData->pSubResources != nullptr && pInitData->NumSubresources > 0;
+        const bool HostUpload   = m_Desc.Usage == USAGE_DEFAULT && (m_Desc.MiscFlags & MISC_TEXTURE_FLAG_HOST_UPLOAD) != 0;
+        const bool HostTransfer = (InitContent || HostUpload) && CheckHostImageInitialization(LogicalDevice, pRenderDeviceVk->GetPhysicalDevice(), ImageCI);
+        if (HostTransfer)
+        {
+            if (HostUpload)
+                m_HostUploadLayout = VkImageLayoutFromUsage(ImageCI.usage);
             ImageCI.usage |= VK_IMAGE_USAGE_HOST_TRANSFER_BIT;
+        }
+        const bool UseHostInitialization = InitContent && HostTransfer;
 
         const std::vector<uint32_t> QueueFamilyIndices = PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) > 1 ?
             GetDevice()->ConvertCmdQueueIdsToQueueFamilies(m_Desc.ImmediateContextMask) :
@@ -279,11 +285,25 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
         {
             m_VulkanImage = LogicalDevice.CreateImage(ImageCI, m_Desc.Name);
 
-            VkMemoryRequirements MemReqs = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage);
+            // Some drivers prefer dedicated allocations for render targets and large images
+            VkMemoryDedicatedRequirements DedicatedReqs{};
+            const VkMemoryRequirements    MemReqs = LogicalDevice.GetEnabledExtFeatures().DedicatedAllocation ?
+                LogicalDevice.GetImageMemoryRequirements(m_VulkanImage, DedicatedReqs) :
+                LogicalDevice.GetImageMemoryRequirements(m_VulkanImage);
 
             const VkMemoryPropertyFlags ImageMemoryFlags = IsMemoryless ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
             VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
-            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+            if (DedicatedReqs.prefersDedicatedAllocation != VK_FALSE || DedicatedReqs.requiresDedicatedAllocation != VK_FALSE)
+            {
+                VkMemoryDedicatedAllocateInfo DedicatedInfo{};
+                DedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+                DedicatedInfo.image = m_VulkanImage;
+                m_MemoryAllocation  = pRenderDeviceVk->GetGlobalMemoryManager().AllocateDedicated(MemReqs, ImageMemoryFlags, DedicatedInfo);
+            }
+            else
+            {
+                m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+            }
             if (!m_MemoryAllocation)
                 LOG_ERROR_AND_THROW("Failed to allocate memory for texture '", m_Desc.Name, "'.");
 
@@ -415,6 +435,90 @@ bool TextureVkImpl::InitializeContentOnHost(const TextureData&          InitData
     return true;
 }
 
+bool TextureVkImpl::UpdateRegionOnHost(const void* pSrcData,
+                                       Uint64      SrcStride,
+                                       Uint64      SrcDepthStride,
+                                       Uint32      MipLevel,
+                                       Uint32      Slice,
+                                       const Box&  DstBox)
+{
+    VERIFY_EXPR(IsHostUploadEnabled());
+
+    // The host can't be synchronized with the layout transitions recorded by device contexts
+    if (!IsInKnownState())
+        return false;
+
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(m_Desc.Format);
+    if (FmtAttribs.ComponentType == COMPONENT_TYPE_DEPTH || FmtAttribs.ComponentType == COMPONENT_TYPE_DEPTH_STENCIL)
+        return false;
+
+    const Uint32 PixelSize = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ?
+        Uint32{FmtAttribs.ComponentSize} :
+        Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+    if ((SrcStride % PixelSize) != 0 || (DstBox.Depth() > 1 && (SrcDepthStride % SrcStride) != 0))
+        return false;
+
+    // The texture state is the state recorded by device contexts, and the transitions may not have been
+    // executed yet. The host only writes to the texture in the upload layout, so that pending transitions
+    // to any other state make the update go through the device and be ordered after them
+    // (see MISC_TEXTURE_FLAG_HOST_UPLOAD).
+    if (GetState() != RESOURCE_STATE_UNDEFINED && GetLayout() != m_HostUploadLayout)
+        return false;
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    if (GetState() == RESOURCE_STATE_UNDEFINED)
+    {
+        // The texture content is undefined, so all subresources can be transitioned at once
+        VkHostImageLayoutTransitionInfoEXT vkLayoutTransitionInfo{};
+        vkLayoutTransitionInfo.sType     = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT;
+        vkLayoutTransitionInfo.image     = m_VulkanImage;
+        vkLayoutTransitionInfo.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        vkLayoutTransitionInfo.newLayout = m_HostUploadLayout;
+
+        vkLayoutTransitionInfo.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        vkLayoutTransitionInfo.subresourceRange.baseArrayLayer = 0;
+        vkLayoutTransitionInfo.subresourceRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
+        vkLayoutTransitionInfo.subresourceRange.baseMipLevel   = 0;
+        vkLayoutTransitionInfo.subresourceRange.levelCount     = VK_REMAINING_MIP_LEVELS;
+        if (LogicalDevice.HostTransitionImageLayout(vkLayoutTransitionInfo) != VK_SUCCESS)
+            return false;
+
+        SetState(VkImageLayoutToResourceState(m_HostUploadLayout));
+    }
+
+    VkMemoryToImageCopyEXT vkCopyRegion{};
+    vkCopyRegion.sType        = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT;
+    vkCopyRegion.pNext        = nullptr;
+    vkCopyRegion.pHostPointer = pSrcData;
+
+    vkCopyRegion.memoryRowLength = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ?
+        static_cast<uint32_t>(SrcStride * FmtAttribs.BlockWidth / FmtAttribs.ComponentSize) :
+        static_cast<uint32_t>(SrcStride / PixelSize);
+    vkCopyRegion.memoryImageHeight = DstBox.Depth() > 1 ?
+        static_cast<uint32_t>(SrcDepthStride * FmtAttribs.BlockHeight / SrcStride) :
+        0;
+
+    vkCopyRegion.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    vkCopyRegion.imageSubresource.mipLevel       = MipLevel;
+    vkCopyRegion.imageSubresource.baseArrayLayer = Slice;
+    vkCopyRegion.imageSubresource.layerCount     = 1;
+
+    vkCopyRegion.imageOffset = {static_cast<int32_t>(DstBox.MinX), static_cast<int32_t>(DstBox.MinY), static_cast<int32_t>(DstBox.MinZ)};
+    vkCopyRegion.imageExtent = {DstBox.Width(), DstBox.Height(), DstBox.Depth()};
+
+    VkCopyMemoryToImageInfoEXT vkCopyInfo{};
+    vkCopyInfo.sType          = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT;
+    vkCopyInfo.pNext          = nullptr;
+    vkCopyInfo.flags          = 0;
+    vkCopyInfo.dstImage       = m_VulkanImage;
+    vkCopyInfo.dstImageLayout = m_HostUploadLayout;
+    vkCopyInfo.regionCount    = 1;
+    vkCopyInfo.pRegions       = &vkCopyRegion;
+
+    return LogicalDevice.CopyMemoryToImage(vkCopyInfo) == VK_SUCCESS;
+}
+
 void TextureVkImpl::InitializeContentOnDevice(const TextureData&          InitData,
                                               const TextureFormatAttribs& FmtAttribs,
                                               const VkImageCreateInfo&    ImageCI) noexcept(false)
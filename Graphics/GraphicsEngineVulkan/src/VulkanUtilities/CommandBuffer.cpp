@@ -140,12 +140,63 @@ static VkAccessFlags AccessMaskFromImageLayout(VkImageLayout Layout,
     return AccessMask;
 }
 
+// Checks if the subresource range of the image overlaps with any of the existing barriers
+template <typename ImageBarrierType>
+bool HasOverlappingImageBarrier(const std::vector<ImageBarrierType>& Barriers,
+                                VkImage                              Image,
+                                const VkImageSubresourceRange&       SubresRange)
+{
+    for (const ImageBarrierType& ImgBarrier : Barriers)
+    {
+        if (ImgBarrier.image != Image)
+            continue;
+
+        const VkImageSubresourceRange& OtherRange = ImgBarrier.subresourceRange;
+
+        const uint32_t StartLayer0 = SubresRange.baseArrayLayer;
+        const uint32_t EndLayer0   = SubresRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (SubresRange.baseArrayLayer + SubresRange.layerCount) : ~0u;
+        const uint32_t StartLayer1 = OtherRange.baseArrayLayer;
+        const uint32_t EndLayer1   = OtherRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (OtherRange.baseArrayLayer + OtherRange.layerCount) : ~0u;
+
+        const uint32_t StartMip0 = SubresRange.baseMipLevel;
+        const uint32_t EndMip0   = SubresRange.levelCount != VK_REMAINING_MIP_LEVELS ? (SubresRange.baseMipLevel + SubresRange.levelCount) : ~0u;
+        const uint32_t StartMip1 = OtherRange.baseMipLevel;
+        const uint32_t EndMip1   = OtherRange.levelCount != VK_REMAINING_MIP_LEVELS ? (OtherRange.baseMipLevel + OtherRange.levelCount) : ~0u;
+
+        const bool SlicesOverlap = Diligent::CheckLineSectionOverlap<true>(StartLayer0, EndLayer0, StartLayer1, EndLayer1);
+        const bool MipsOverlap   = Diligent::CheckLineSectionOverlap<true>(StartMip0, EndMip0, StartMip1, EndMip1);
+        if (SlicesOverlap && MipsOverlap)
+            return true;
+    }
+
+    return false;
+}
+
+VkDependencyInfoKHR GetDependencyInfo(const VkMemoryBarrier2KHR*                    pMemBarrier,
+                                      const std::vector<VkBufferMemoryBarrier2KHR>& BufferBarriers,
+                                      const std::vector<VkImageMemoryBarrier2KHR>&  ImageBarriers)
+{
+    VkDependencyInfoKHR DependencyInfo{};
+    DependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+    DependencyInfo.pNext                    = nullptr;
+    DependencyInfo.dependencyFlags          = 0;
+    DependencyInfo.memoryBarrierCount       = pMemBarrier != nullptr ? 1 : 0;
+    DependencyInfo.pMemoryBarriers          = pMemBarrier;
+    DependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(BufferBarriers.size());
+    DependencyInfo.pBufferMemoryBarriers    = !BufferBarriers.empty() ? BufferBarriers.data() : nullptr;
+    DependencyInfo.imageMemoryBarrierCount  = static_cast<uint32_t>(ImageBarriers.size());
+    DependencyInfo.pImageMemoryBarriers     = !ImageBarriers.empty() ? ImageBarriers.data() : nullptr;
+    return DependencyInfo;
+}
+
 } // namespace
 
 
 CommandBuffer::CommandBuffer() noexcept
 {
     m_ImageBarriers.reserve(32);
+    m_ImageBarriers2.reserve(32);
+    m_BufferBarriers2.reserve(32);
 }
 
 void CommandBuffer::TransitionImageLayout(VkImage                        Image,
@@ -162,6 +213,19 @@ void CommandBuffer::TransitionImageLayout(VkImage                        Image,
     VERIFY_EXPR((SrcStages & m_Barrier.SupportedStagesMask) != 0);
     VERIFY_EXPR((DstStages & m_Barrier.SupportedStagesMask) != 0);
 
+    if (m_UseSync2)
+    {
+        // Barriers in the same batch are not ordered, so if the range overlaps
+        // with any of the existing barriers, we need to flush them.
+        if (HasOverlappingImageBarrier(m_ImageBarriers2, Image, SubresRange))
+            FlushBarriers();
+
+        // Image barriers with the same old and new layouts do not perform layout transitions,
+        // but unlike global memory barriers, they only synchronize accesses to this image.
+        m_ImageBarriers2.emplace_back(GetImageBarrier2(Image, OldLayout, NewLayout, SubresRange, SrcStages, DstStages));
+        return;
+    }
+
     if (OldLayout == NewLayout)
     {
         m_Barrier.MemorySrcStages |= SrcStages;
@@ -172,36 +236,10 @@ void CommandBuffer::TransitionImageLayout(VkImage                        Image,
         return;
     }
 
-    // Check overlapping subresources
-    for (size_t i = 0; i < m_ImageBarriers.size(); ++i)
-    {
-        const VkImageMemoryBarrier& ImgBarrier = m_ImageBarriers[i];
-        if (ImgBarrier.image != Image)
-            continue;
-
-        const VkImageSubresourceRange& OtherRange = ImgBarrier.subresourceRange;
-
-        const uint32_t StartLayer0 = SubresRange.baseArrayLayer;
-        const uint32_t EndLayer0   = SubresRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (SubresRange.baseArrayLayer + SubresRange.layerCount) : ~0u;
-        const uint32_t StartLayer1 = OtherRange.baseArrayLayer;
-        const uint32_t EndLayer1   = OtherRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (OtherRange.baseArrayLayer + OtherRange.layerCount) : ~0u;
-
-        const uint32_t StartMip0 = SubresRange.baseMipLevel;
-        const uint32_t EndMip0   = SubresRange.levelCount != VK_REMAINING_MIP_LEVELS ? (SubresRange.baseMipLevel + SubresRange.levelCount) : ~0u;
-        const uint32_t StartMip1 = OtherRange.baseMipLevel;
-        const uint32_t EndMip1   = OtherRange.levelCount != VK_REMAINING_MIP_LEVELS ? (OtherRange.baseMipLevel + OtherRange.levelCount) : ~0u;
-
-        const bool SlicesOverlap = Diligent::CheckLineSectionOverlap<true>(StartLayer0, EndLayer0, StartLayer1, EndLayer1);
-        const bool MipsOverlap   = Diligent::CheckLineSectionOverlap<true>(StartMip0, EndMip0, StartMip1, EndMip1);
-
-        // If the range overlaps with any of the existing barriers, we need to
-        // flush them.
-        if (SlicesOverlap && MipsOverlap)
-        {
-            FlushBarriers();
-            break;
-        }
-    }
+    // If the range overlaps with any of the existing barriers, we need to
+    // flush them.
+    if (HasOverlappingImageBarrier(m_ImageBarriers, Image, SubresRange))
+        FlushBarriers();
 
     m_Barrier.ImageSrcStages |= SrcStages;
     m_Barrier.ImageDstStages |= DstStages;
@@ -237,8 +275,169 @@ void CommandBuffer::MemoryBarrier(VkAccessFlags        srcAccessMask,
     m_Barrier.MemoryDstAccess |= dstAccessMask;
 }
 
+void CommandBuffer::BufferMemoryBarrier(VkBuffer             Buffer,
+                                        VkAccessFlags        srcAccessMask,
+                                        VkAccessFlags        dstAccessMask,
+                                        VkPipelineStageFlags SrcStages,
+                                        VkPipelineStageFlags DstStages)
+{
+    if (!m_UseSync2)
+    {
+        MemoryBarrier(srcAccessMask, dstAccessMask, SrcStages, DstStages);
+        return;
+    }
+
+    EndRenderScope();
+
+    VERIFY_EXPR((SrcStages & m_Barrier.SupportedStagesMask) != 0);
+    VERIFY_EXPR((DstStages & m_Barrier.SupportedStagesMask) != 0);
+
+    // Barriers in the same batch are not ordered, so the previous barrier of the same buffer must be flushed
+    for (const VkBufferMemoryBarrier2KHR& BuffBarrier : m_BufferBarriers2)
+    {
+        if (BuffBarrier.buffer == Buffer)
+        {
+            FlushBarriers();
+            break;
+        }
+    }
+
+    VkBufferMemoryBarrier2KHR BuffBarrier{};
+    BuffBarrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+    BuffBarrier.pNext               = nullptr;
+    BuffBarrier.srcStageMask        = SrcStages & m_Barrier.SupportedStagesMask;
+    BuffBarrier.srcAccessMask       = srcAccessMask & m_Barrier.SupportedAccessMask;
+    BuffBarrier.dstStageMask        = DstStages & m_Barrier.SupportedStagesMask;
+    BuffBarrier.dstAccessMask       = dstAccessMask & m_Barrier.SupportedAccessMask;
+    BuffBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    BuffBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    BuffBarrier.buffer              = Buffer;
+    BuffBarrier.offset              = 0;
+    BuffBarrier.size                = VK_WHOLE_SIZE;
+    m_BufferBarriers2.emplace_back(BuffBarrier);
+}
+
+VkImageMemoryBarrier2KHR CommandBuffer::GetImageBarrier2(VkImage                        Image,
+                                                         VkImageLayout                  OldLayout,
+                                                         VkImageLayout                  NewLayout,
+                                                         const VkImageSubresourceRange& SubresRange,
+                                                         VkPipelineStageFlags           SrcStages,
+                                                         VkPipelineStageFlags           DstStages) const
+{
+    // Legacy stage and access flag bits have the same values in the 64-bit synchronization2 masks
+    VkImageMemoryBarrier2KHR ImgBarrier{};
+    ImgBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+    ImgBarrier.pNext               = nullptr;
+    ImgBarrier.srcStageMask        = SrcStages & m_Barrier.SupportedStagesMask;
+    ImgBarrier.srcAccessMask       = AccessMaskFromImageLayout(OldLayout, false) & m_Barrier.SupportedAccessMask;
+    ImgBarrier.dstStageMask        = DstStages & m_Barrier.SupportedStagesMask;
+    ImgBarrier.dstAccessMask       = AccessMaskFromImageLayout(NewLayout, true) & m_Barrier.SupportedAccessMask;
+    ImgBarrier.oldLayout           = OldLayout;
+    ImgBarrier.newLayout           = NewLayout;
+    ImgBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    ImgBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    ImgBarrier.image               = Image;
+    ImgBarrier.subresourceRange    = SubresRange;
+    return ImgBarrier;
+}
+
+bool CommandBuffer::ExtractMemoryBarrier2(VkMemoryBarrier2KHR& MemBarrier)
+{
+    // Unlike legacy barriers, memory barriers without access flags are still
+    // needed as they define execution dependencies.
+    const bool HasMemoryBarrier = m_Barrier.MemorySrcStages != 0 || m_Barrier.MemoryDstStages != 0;
+    if (HasMemoryBarrier)
+    {
+        MemBarrier               = {};
+        MemBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+        MemBarrier.pNext         = nullptr;
+        MemBarrier.srcStageMask  = m_Barrier.MemorySrcStages & m_Barrier.SupportedStagesMask;
+        MemBarrier.srcAccessMask = m_Barrier.MemorySrcAccess & m_Barrier.SupportedAccessMask;
+        MemBarrier.dstStageMask  = m_Barrier.MemoryDstStages & m_Barrier.SupportedStagesMask;
+        MemBarrier.dstAccessMask = m_Barrier.MemoryDstAccess & m_Barrier.SupportedAccessMask;
+    }
+
+    m_Barrier.MemorySrcStages = 0;
+    m_Barrier.MemoryDstStages = 0;
+    m_Barrier.MemorySrcAccess = 0;
+    m_Barrier.MemoryDstAccess = 0;
+
+    return HasMemoryBarrier;
+}
+
+void CommandBuffer::FlushBarriers2()
+{
+    if (m_Barrier.MemorySrcStages == 0 && m_Barrier.MemoryDstStages == 0 && m_ImageBarriers2.empty() && m_BufferBarriers2.empty())
+        return;
+
+    EndRenderScope();
+
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+    VkMemoryBarrier2KHR       MemBarrier{};
+    const bool                HasMemoryBarrier = ExtractMemoryBarrier2(MemBarrier);
+    const VkDependencyInfoKHR DependencyInfo   = GetDependencyInfo(HasMemoryBarrier ? &MemBarrier : nullptr, m_BufferBarriers2, m_ImageBarriers2);
+#if DILIGENT_USE_VOLK
+    vkCmdPipelineBarrier2KHR(m_VkCmdBuffer, &DependencyInfo);
+#else
+    (void)DependencyInfo;
+    UNEXPECTED("Synchronization2 is not supported when vulkan library is linked statically");
+#endif
+
+    m_ImageBarriers2.clear();
+    m_BufferBarriers2.clear();
+}
+
+void CommandBuffer::SetEvent(VkEvent Event, SplitBarrier& Barrier)
+{
+    VERIFY(m_UseSync2, "Split barriers require synchronization2");
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE && Event != VK_NULL_HANDLE);
+
+    // vkCmdSetEvent2 must be recorded outside of a render pass instance
+    EndRenderScope();
+
+    Barrier.Event            = Event;
+    Barrier.HasMemoryBarrier = ExtractMemoryBarrier2(Barrier.MemoryBarrier);
+    Barrier.BufferBarriers.assign(m_BufferBarriers2.begin(), m_BufferBarriers2.end());
+    Barrier.ImageBarriers.assign(m_ImageBarriers2.begin(), m_ImageBarriers2.end());
+    m_BufferBarriers2.clear();
+    m_ImageBarriers2.clear();
+
+    const VkDependencyInfoKHR DependencyInfo = GetDependencyInfo(Barrier.HasMemoryBarrier ? &Barrier.MemoryBarrier : nullptr, Barrier.BufferBarriers, Barrier.ImageBarriers);
+#if DILIGENT_USE_VOLK
+    vkCmdSetEvent2KHR(m_VkCmdBuffer, Event, &DependencyInfo);
+#else
+    (void)DependencyInfo;
+    UNEXPECTED("Synchronization2 is not supported when vulkan library is linked statically");
+#endif
+}
+
+void CommandBuffer::WaitEvent(const SplitBarrier& Barrier)
+{
+    VERIFY(m_UseSync2, "Split barriers require synchronization2");
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE && Barrier.Event != VK_NULL_HANDLE);
+
+    // vkCmdWaitEvents2 must be recorded outside of a render pass instance
+    EndRenderScope();
+    FlushBarriers();
+
+    const VkDependencyInfoKHR DependencyInfo = GetDependencyInfo(Barrier.HasMemoryBarrier ? &Barrier.MemoryBarrier : nullptr, Barrier.BufferBarriers, Barrier.ImageBarriers);
+#if DILIGENT_USE_VOLK
+    vkCmdWaitEvents2KHR(m_VkCmdBuffer, 1, &Barrier.Event, &DependencyInfo);
+#else
+    (void)DependencyInfo;
+    UNEXPECTED("Synchronization2 is not supported when vulkan library is linked statically");
+#endif
+}
+
 void CommandBuffer::FlushBarriers()
 {
+    if (m_UseSync2)
+    {
+        FlushBarriers2();
+        return;
+    }
+
     if (m_Barrier.MemorySrcStages == 0 && m_Barrier.MemoryDstStages == 0 && m_ImageBarriers.empty())
         return;
 
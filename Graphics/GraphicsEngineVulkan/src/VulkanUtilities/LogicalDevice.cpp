@@ -382,6 +382,12 @@ QueryPoolWrapper LogicalDevice::CreateQueryPool(const VkQueryPoolCreateInfo& Que
     return CreateVulkanObject<VkQueryPool, VulkanHandleTypeId::QueryPool>(vkCreateQueryPool, QueryPoolCI, DebugName, "query pool");
 }
 
+EventWrapper LogicalDevice::CreateEvent(const VkEventCreateInfo& EventCI, const char* DebugName) const
+{
+    VERIFY_EXPR(EventCI.sType == VK_STRUCTURE_TYPE_EVENT_CREATE_INFO);
+    return CreateVulkanObject<VkEvent, VulkanHandleTypeId::Event>(vkCreateEvent, EventCI, DebugName, "event");
+}
+
 AccelStructWrapper LogicalDevice::CreateAccelStruct(const VkAccelerationStructureCreateInfoKHR& CI, const char* DebugName) const
 {
 #if DILIGENT_USE_VOLK
@@ -438,6 +444,13 @@ PipelineCacheWrapper LogicalDevice::CreatePipelineCache(const VkPipelineCacheCre
     return CreateVulkanObject<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(vkCreatePipelineCache, CI, DebugName, "pipeline cache");
 }
 
+DescrUpdateTemplateWrapper LogicalDevice::CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& CI, const char* DebugName) const
+{
+    VERIFY_EXPR(CI.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO);
+    VERIFY_EXPR(m_EnabledExtFeatures.DescriptorUpdateTemplate);
+    return CreateVulkanObject<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(vkCreateDescriptorUpdateTemplate, CI, DebugName, "descriptor update template");
+}
+
 void LogicalDevice::ReleaseVulkanObject(CommandPoolWrapper&& CmdPool) const
 {
     vkDestroyCommandPool(m_VkDevice, CmdPool.m_VkObject, m_VkAllocator);
@@ -540,6 +553,12 @@ void LogicalDevice::ReleaseVulkanObject(QueryPoolWrapper&& QueryPool) const
     QueryPool.m_VkObject = VK_NULL_HANDLE;
 }
 
+void LogicalDevice::ReleaseVulkanObject(EventWrapper&& Event) const
+{
+    vkDestroyEvent(m_VkDevice, Event.m_VkObject, m_VkAllocator);
+    Event.m_VkObject = VK_NULL_HANDLE;
+}
+
 void LogicalDevice::ReleaseVulkanObject(AccelStructWrapper&& AccelStruct) const
 {
 #if DILIGENT_USE_VOLK
@@ -556,6 +575,12 @@ void LogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipeCache) const
     PipeCache.m_VkObject = VK_NULL_HANDLE;
 }
 
+void LogicalDevice::ReleaseVulkanObject(DescrUpdateTemplateWrapper&& DescrUpdateTemplate) const
+{
+    vkDestroyDescriptorUpdateTemplate(m_VkDevice, DescrUpdateTemplate.m_VkObject, m_VkAllocator);
+    DescrUpdateTemplate.m_VkObject = VK_NULL_HANDLE;
+}
+
 void LogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
 {
     VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
@@ -584,6 +609,27 @@ VkMemoryRequirements LogicalDevice::GetImageMemoryRequirements(VkImage vkImage)
     return MemReqs;
 }
 
+VkMemoryRequirements LogicalDevice::GetImageMemoryRequirements(VkImage vkImage, VkMemoryDedicatedRequirements& DedicatedReqs) const
+{
+    VERIFY_EXPR(m_EnabledExtFeatures.DedicatedAllocation);
+
+    DedicatedReqs       = {};
+    DedicatedReqs.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+
+    VkImageMemoryRequirementsInfo2 ReqsInfo{};
+    ReqsInfo.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2;
+    ReqsInfo.image = vkImage;
+
+    VkMemoryRequirements2 MemReqs2{};
+    MemReqs2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+    MemReqs2.pNext = &DedicatedReqs;
+
+    vkGetImageMemoryRequirements2(m_VkDevice, &ReqsInfo, &MemReqs2);
+    DedicatedReqs.pNext = nullptr;
+
+    return MemReqs2.memoryRequirements;
+}
+
 VkResult LogicalDevice::BindBufferMemory(VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
 {
     return vkBindBufferMemory(m_VkDevice, buffer, memory, memoryOffset);
@@ -609,6 +655,21 @@ VkDeviceAddress LogicalDevice::GetAccelerationStructureDeviceAddress(VkAccelerat
 #endif
 }
 
+VkDeviceAddress LogicalDevice::GetBufferDeviceAddress(VkBuffer vkBuffer) const
+{
+#if DILIGENT_USE_VOLK
+    VkBufferDeviceAddressInfoKHR Info = {};
+
+    Info.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+    Info.buffer = vkBuffer;
+
+    return vkGetBufferDeviceAddressKHR(m_VkDevice, &Info);
+#else
+    UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
+    return 0;
+#endif
+}
+
 void LogicalDevice::GetAccelerationStructureBuildSizes(const VkAccelerationStructureBuildGeometryInfoKHR& BuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR& SizeInfo) const
 {
 #if DILIGENT_USE_VOLK
@@ -650,6 +711,13 @@ VkResult LogicalDevice::ResetFence(VkFence fence) const
     return err;
 }
 
+VkResult LogicalDevice::ResetEvent(VkEvent event) const
+{
+    VkResult err = vkResetEvent(m_VkDevice, event);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "vkResetEvent() failed");
+    return err;
+}
+
 VkResult LogicalDevice::WaitForFences(uint32_t       fenceCount,
                                       const VkFence* pFences,
                                       VkBool32       waitAll,
@@ -698,6 +766,14 @@ void LogicalDevice::UpdateDescriptorSets(uint32_t                    descriptorW
     vkUpdateDescriptorSets(m_VkDevice, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
+void LogicalDevice::UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                                    VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                    const void*                pData) const
+{
+    VERIFY_EXPR(descriptorSet != VK_NULL_HANDLE && descriptorUpdateTemplate != VK_NULL_HANDLE);
+    vkUpdateDescriptorSetWithTemplate(m_VkDevice, descriptorSet, descriptorUpdateTemplate, pData);
+}
+
 VkResult LogicalDevice::ResetCommandPool(VkCommandPool           vkCmdPool,
                                          VkCommandPoolResetFlags flags) const
 {
@@ -725,6 +801,39 @@ void LogicalDevice::ResetQueryPool(VkQueryPool queryPool,
 #endif
 }
 
+VkDeviceSize LogicalDevice::GetDescriptorSetLayoutSize(VkDescriptorSetLayout vkLayout) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Size = 0;
+    vkGetDescriptorSetLayoutSizeEXT(m_VkDevice, vkLayout, &Size);
+    return Size;
+#else
+    UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+    return 0;
+#endif
+}
+
+VkDeviceSize LogicalDevice::GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout vkLayout, uint32_t Binding) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Offset = 0;
+    vkGetDescriptorSetLayoutBindingOffsetEXT(m_VkDevice, vkLayout, Binding, &Offset);
+    return Offset;
+#else
+    UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+    return 0;
+#endif
+}
+
+void LogicalDevice::GetDescriptor(const VkDescriptorGetInfoEXT& DescriptorInfo, size_t DataSize, void* pDescriptor) const
+{
+#if DILIGENT_USE_VOLK
+    vkGetDescriptorEXT(m_VkDevice, &DescriptorInfo, DataSize, pDescriptor);
+#else
+    UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+}
+
 VkResult LogicalDevice::CopyMemoryToImage(const VkCopyMemoryToImageInfoEXT& CopyInfo) const
 {
 #if DILIGENT_USE_VOLK
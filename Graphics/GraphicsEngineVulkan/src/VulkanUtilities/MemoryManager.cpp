@@ -27,6 +27,8 @@
 
 #include "pch.h"
 #include <sstream>
+#include <algorithm>
+#include <vector>
 #include "VulkanUtilities/MemoryManager.hpp"
 
 namespace VulkanUtilities
@@ -40,14 +42,19 @@ MemoryAllocation::~MemoryAllocation()
     }
 }
 
-MemoryPage::MemoryPage(MemoryManager&        ParentMemoryMgr,
-                       VkDeviceSize          PageSize,
-                       uint32_t              MemoryTypeIndex,
-                       bool                  IsHostVisible,
-                       VkMemoryAllocateFlags AllocateFlags) :
+MemoryPage::MemoryPage(MemoryManager&                       ParentMemoryMgr,
+                       VkDeviceSize                         PageSize,
+                       uint32_t                             MemoryTypeIndex,
+                       bool                                 IsHostVisible,
+                       VkMemoryAllocateFlags                AllocateFlags,
+                       MemoryPageSizeClass                  SizeClass,
+                       const VkMemoryDedicatedAllocateInfo* pDedicatedInfo) :
     // clang-format off
     m_ParentMemoryMgr{ParentMemoryMgr},
-    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
+    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator},
+    m_MemoryTypeIndex{MemoryTypeIndex},
+    m_AllocateFlags  {AllocateFlags},
+    m_SizeClass      {SizeClass}
 // clang-format on
 {
     VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
@@ -70,7 +77,20 @@ MemoryPage::MemoryPage(MemoryManager&        ParentMemoryMgr,
         MemFlagInfo.flags = AllocateFlags;
     }
 
-    std::string MemoryName = Diligent::FormatString("Device memory page. Size: ", Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
+    VkMemoryDedicatedAllocateInfo DedicatedInfo = {};
+    if (pDedicatedInfo != nullptr)
+    {
+        VERIFY(SizeClass == MemoryPageSizeClass::Dedicated, "Dedicated allocation info is only expected for dedicated pages");
+        VERIFY((pDedicatedInfo->image != VK_NULL_HANDLE) != (pDedicatedInfo->buffer != VK_NULL_HANDLE), "Exactly one of image or buffer must be specified");
+
+        DedicatedInfo       = *pDedicatedInfo;
+        DedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+        DedicatedInfo.pNext = MemAlloc.pNext;
+        MemAlloc.pNext      = &DedicatedInfo;
+    }
+
+    std::string MemoryName = Diligent::FormatString(SizeClass == MemoryPageSizeClass::Dedicated ? "Dedicated device memory page. Size: " : "Device memory page. Size: ",
+                                                    Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
     m_VkMemory             = ParentMemoryMgr.m_LogicalDevice.AllocateDeviceMemory(MemAlloc, MemoryName.c_str());
 
     if (IsHostVisible)
@@ -163,6 +183,16 @@ MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignme
 {
     MemoryAllocation Allocation;
 
+    // Small allocations are kept in separate pages so that they do not fragment regular pages.
+    // Large device-local allocations get their own page that is released as soon as the resource
+    // is destroyed. Host-visible allocations are mostly short-living staging allocations and
+    // are always placed in regular pages that can be reused.
+    MemoryPageSizeClass SizeClass = MemoryPageSizeClass::Regular;
+    if (Size <= GetSmallAllocationThreshold(HostVisible))
+        SizeClass = MemoryPageSizeClass::Small;
+    else if (!HostVisible && Size >= GetDedicatedAllocationThreshold())
+        SizeClass = MemoryPageSizeClass::Dedicated;
+
     // On integrated GPUs, there is no difference between host-visible and GPU-only
     // memory, so MemoryTypeIndex is the same. As GPU-only pages do not have CPU address,
     // we need to use HostVisible flag to differentiate the two.
@@ -170,73 +200,266 @@ MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignme
     // even though on integrated GPUs same pages can be used for both GPU-only and staging
     // allocations. Staging allocations are short-living and will be released when upload is
     // complete, while GPU-only allocations are expected to be long-living.
-    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
+    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags, SizeClass};
     std::lock_guard<std::mutex> Lock{m_PagesMtx};
 
-    auto range = m_Pages.equal_range(PageIdx);
-    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    if (SizeClass != MemoryPageSizeClass::Dedicated)
     {
-        Allocation = page_it->second.Allocate(Size, Alignment);
-        if (Allocation.Page != nullptr)
-            break;
+        auto range = m_Pages.equal_range(PageIdx);
+        for (auto page_it = range.first; page_it != range.second; ++page_it)
+        {
+            Allocation = page_it->second.Allocate(Size, Alignment);
+            if (Allocation.Page != nullptr)
+                break;
+        }
     }
 
-    size_t stat_ind = HostVisible ? 1 : 0;
     if (Allocation.Page == nullptr)
     {
-        VkDeviceSize PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
-        while (PageSize < Size)
-            PageSize *= 2;
+        Allocation = CreatePageAndAllocate(Size, Alignment, MemoryTypeIndex, HostVisible, AllocateFlags, SizeClass, nullptr);
+    }
+
+    if (Allocation.Page != nullptr)
+    {
+        VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
+    }
+
+    OnAllocation(Allocation, HostVisible);
+
+    return Allocation;
+}
+
+MemoryAllocation MemoryManager::AllocateDedicated(const VkMemoryRequirements&          MemReqs,
+                                                  VkMemoryPropertyFlags                MemoryProps,
+                                                  const VkMemoryDedicatedAllocateInfo& DedicatedInfo)
+{
+    VERIFY(m_LogicalDevice.GetEnabledExtFeatures().DedicatedAllocation, "Dedicated allocations are not supported by the device");
+
+    const uint32_t MemoryTypeIndex = m_PhysicalDevice.GetMemoryTypeIndex(MemReqs.memoryTypeBits, MemoryProps);
+    if (MemoryTypeIndex == PhysicalDevice::InvalidMemoryTypeIndex)
+    {
+        LOG_ERROR_AND_THROW("Failed to find suitable device memory type for a dedicated allocation");
+    }
 
-        m_CurrAllocatedSize[stat_ind] += PageSize;
-        m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+    const bool HostVisible = (MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
 
-        auto it = m_Pages.emplace(PageIdx, MemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
-        LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
-                         " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
-                         "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
-        OnNewPageCreated(it->second);
-        Allocation = it->second.Allocate(Size, Alignment);
-        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+    MemoryAllocation Allocation = CreatePageAndAllocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, 0, MemoryPageSizeClass::Dedicated, &DedicatedInfo);
+    OnAllocation(Allocation, HostVisible);
+
+    return Allocation;
+}
+
+MemoryAllocation MemoryManager::AllocateForDefragmentation(VkDeviceSize Size, VkDeviceSize Alignment, const MemoryPage& SrcPage)
+{
+    const bool HostVisible = SrcPage.GetCPUMemory() != nullptr;
+    if (SrcPage.GetSizeClass() == MemoryPageSizeClass::Dedicated)
+        return MemoryAllocation{};
+
+    MemoryPageIndex             PageIdx{SrcPage.GetMemoryTypeIndex(), HostVisible, SrcPage.GetAllocateFlags(), SrcPage.GetSizeClass()};
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+    // Try the fullest pages first so that the least occupied pages are emptied
+    std::vector<MemoryPage*> DstPages;
+    auto                     range = m_Pages.equal_range(PageIdx);
+    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    {
+        MemoryPage& Page = page_it->second;
+        if (&Page != &SrcPage && !Page.IsFull() && Page.GetUsedSize() > SrcPage.GetUsedSize())
+            DstPages.push_back(&Page);
+    }
+    std::sort(DstPages.begin(), DstPages.end(),
+              [](const MemoryPage* lhs, const MemoryPage* rhs) {
+                  return lhs->GetUsedSize() > rhs->GetUsedSize();
+              });
+
+    MemoryAllocation Allocation;
+    for (MemoryPage* pPage : DstPages)
+    {
+        Allocation = pPage->Allocate(Size, Alignment);
+        if (Allocation.Page != nullptr)
+            break;
     }
 
     if (Allocation.Page != nullptr)
+        OnAllocation(Allocation, HostVisible);
+
+    return Allocation;
+}
+
+MemoryAllocation MemoryManager::CreatePageAndAllocate(VkDeviceSize                         Size,
+                                                      VkDeviceSize                         Alignment,
+                                                      uint32_t                             MemoryTypeIndex,
+                                                      bool                                 HostVisible,
+                                                      VkMemoryAllocateFlags                AllocateFlags,
+                                                      MemoryPageSizeClass                  SizeClass,
+                                                      const VkMemoryDedicatedAllocateInfo* pDedicatedInfo)
+{
+    VkDeviceSize PageSize = 0;
+    if (SizeClass == MemoryPageSizeClass::Dedicated)
     {
-        VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
+        // Dedicated page is always fully used by a single resource
+        PageSize = Diligent::AlignUp(Size, Alignment);
     }
+    else
+    {
+        PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+        if (SizeClass == MemoryPageSizeClass::Small)
+            PageSize = std::max(PageSize / SmallPageSizeRatio, Size);
+        while (PageSize < Size)
+            PageSize *= 2;
+    }
+
+    if (m_BudgetThreshold > 0)
+        EnforceBudget(MemoryTypeIndex, PageSize);
+
+    const size_t stat_ind = HostVisible ? 1 : 0;
+
+    m_CurrAllocatedSize[stat_ind] += PageSize;
+    m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+    ++m_NumPages[static_cast<size_t>(SizeClass)];
+
+    static constexpr const char* SizeClassNames[] = {"small ", "", "dedicated "};
+    static_assert(_countof(SizeClassNames) == static_cast<size_t>(MemoryPageSizeClass::Count), "Please update the array");
 
+    auto it = m_Pages.emplace(MemoryPageIndex{MemoryTypeIndex, HostVisible, AllocateFlags, SizeClass},
+                              MemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags, SizeClass, pDedicatedInfo});
+    LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': created new ", SizeClassNames[static_cast<size_t>(SizeClass)], (HostVisible ? "host-visible" : "device-local"),
+                     " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
+                     "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
+    OnNewPageCreated(it->second);
+    MemoryAllocation Allocation = it->second.Allocate(Size, Alignment);
+    DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+
+    return Allocation;
+}
+
+void MemoryManager::OnAllocation(const MemoryAllocation& Allocation, bool HostVisible)
+{
+    const size_t stat_ind = HostVisible ? 1 : 0;
     m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
     m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
+}
 
-    return Allocation;
+bool MemoryManager::UpdateBudget(VkDeviceSize ExtraSize, uint32_t ExtraSizeHeapIndex)
+{
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT Budget;
+    if (!m_LogicalDevice.GetEnabledExtFeatures().MemoryBudget || !m_PhysicalDevice.GetMemoryBudget(Budget))
+        return false;
+
+    const VkPhysicalDeviceMemoryProperties& MemoryProps = m_PhysicalDevice.GetMemoryProperties();
+
+    m_OverBudgetHeapMask = 0;
+    for (uint32_t HeapIdx = 0; HeapIdx < MemoryProps.memoryHeapCount; ++HeapIdx)
+    {
+        const VkDeviceSize Usage = Budget.heapUsage[HeapIdx] + (HeapIdx == ExtraSizeHeapIndex ? ExtraSize : 0);
+        const VkDeviceSize Limit = static_cast<VkDeviceSize>(static_cast<double>(Budget.heapBudget[HeapIdx]) * m_BudgetThreshold);
+        if (Usage > Limit)
+            m_OverBudgetHeapMask |= 1u << HeapIdx;
+    }
+
+    return true;
 }
 
-void MemoryManager::ShrinkMemory()
+void MemoryManager::EnforceBudget(uint32_t MemoryTypeIndex, VkDeviceSize PageSize)
 {
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
-    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
+    const VkPhysicalDeviceMemoryProperties& MemoryProps = m_PhysicalDevice.GetMemoryProperties();
+    VERIFY_EXPR(MemoryTypeIndex < MemoryProps.memoryTypeCount);
+    const uint32_t HeapIdx  = MemoryProps.memoryTypes[MemoryTypeIndex].heapIndex;
+    const uint32_t HeapMask = 1u << HeapIdx;
+
+    if (!UpdateBudget(PageSize, HeapIdx) || (m_OverBudgetHeapMask & HeapMask) == 0)
         return;
 
+    // Release the pages kept in the reserve to make room for the new page
+    ReleaseEmptyPages(/*IgnoreReserve = */ true, HeapMask);
+
+    UpdateBudget(PageSize, HeapIdx);
+    if ((m_OverBudgetHeapMask & HeapMask) != 0 && (m_BudgetWarningHeapMask & HeapMask) == 0)
+    {
+        // The allocation is not failed as the budget is a soft limit. The application should release some resources.
+        LOG_WARNING_MESSAGE("MemoryManager '", m_MgrName, "': memory heap ", HeapIdx, " usage exceeds ",
+                            static_cast<int>(m_BudgetThreshold * 100), "% of the budget reported by the driver. "
+                            "Allocating more memory may result in degraded performance or out-of-memory errors.");
+        m_BudgetWarningHeapMask |= HeapMask;
+    }
+}
+
+void MemoryManager::ReleaseEmptyPages(bool IgnoreReserve, uint32_t HeapMask)
+{
+    const VkPhysicalDeviceMemoryProperties& MemoryProps = m_PhysicalDevice.GetMemoryProperties();
+
     auto it = m_Pages.begin();
     while (it != m_Pages.end())
     {
         auto curr_it = it;
         ++it;
-        MemoryPage&  Page          = curr_it->second;
-        bool         IsHostVisible = Page.GetCPUMemory() != nullptr;
-        VkDeviceSize ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
-        if (Page.IsEmpty() && m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize)
-        {
-            VkDeviceSize PageSize = Page.GetPageSize();
-            m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
-            LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
-                             " page (", Diligent::FormatMemorySize(PageSize, 2),
-                             "). Current allocated size: ",
-                             Diligent::FormatMemorySize(m_CurrAllocatedSize[IsHostVisible ? 1 : 0], 2));
-            OnPageDestroy(Page);
-            m_Pages.erase(curr_it);
-        }
+        MemoryPage& Page = curr_it->second;
+        if (!Page.IsEmpty())
+            continue;
+
+        const uint32_t HeapBit = 1u << MemoryProps.memoryTypes[Page.GetMemoryTypeIndex()].heapIndex;
+        if ((HeapMask & HeapBit) == 0)
+            continue;
+
+        const bool         IsHostVisible = Page.GetCPUMemory() != nullptr;
+        const size_t       stat_ind      = IsHostVisible ? 1 : 0;
+        const VkDeviceSize ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
+
+        // Dedicated pages are never reused, so they are not kept in the reserve.
+        // Pages of the heaps that exceed the budget are not kept either.
+        const bool KeepInReserve =
+            !IgnoreReserve &&
+            Page.GetSizeClass() != MemoryPageSizeClass::Dedicated &&
+            (m_OverBudgetHeapMask & HeapBit) == 0 &&
+            m_CurrAllocatedSize[stat_ind] <= ReserveSize;
+        if (KeepInReserve)
+            continue;
+
+        VkDeviceSize PageSize = Page.GetPageSize();
+        m_CurrAllocatedSize[stat_ind] -= PageSize;
+        --m_NumPages[static_cast<size_t>(Page.GetSizeClass())];
+        LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
+                         " page (", Diligent::FormatMemorySize(PageSize, 2),
+                         "). Current allocated size: ",
+                         Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
+        OnPageDestroy(Page);
+        m_Pages.erase(curr_it);
+    }
+}
+
+void MemoryManager::ShrinkMemory()
+{
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+    // Keep the budget up to date while some heaps exceed it,
+    // so that the reserve is restored when the usage drops.
+    if (m_OverBudgetHeapMask != 0)
+        UpdateBudget();
+
+    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize &&
+        m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize &&
+        m_NumPages[static_cast<size_t>(MemoryPageSizeClass::Dedicated)] == 0 &&
+        m_OverBudgetHeapMask == 0)
+        return;
+
+    ReleaseEmptyPages(/*IgnoreReserve = */ false);
+}
+
+MemoryManager::Stats MemoryManager::GetStats()
+{
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+    Stats MgrStats;
+    for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
+    {
+        MgrStats.UsedSize[i]      = static_cast<VkDeviceSize>(m_CurrUsedSize[i].load());
+        MgrStats.AllocatedSize[i] = m_CurrAllocatedSize[i];
     }
+    MgrStats.NumPages = m_NumPages;
+
+    return MgrStats;
 }
 
 void MemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible)
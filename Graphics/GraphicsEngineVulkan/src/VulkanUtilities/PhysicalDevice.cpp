@@ -224,6 +224,12 @@ PhysicalDevice::PhysicalDevice(const CreateInfo& CI) :
 
             m_ExtFeatures.SubgroupOps      = true;
             m_ExtProperties.Subgroup.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
+
+            // Descriptor update templates are core in Vulkan 1.1
+            m_ExtFeatures.DescriptorUpdateTemplate = true;
+
+            // Dedicated allocations are core in Vulkan 1.1
+            m_ExtFeatures.DedicatedAllocation = true;
         }
 
         if (IsExtensionSupported(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME))
@@ -343,6 +349,86 @@ PhysicalDevice::PhysicalDevice(const CreateInfo& CI) :
             m_ExtFeatures.DynamicRendering.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
         }
 
+        if (IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+        {
+            m_ExtFeatures.PushDescriptor = true;
+
+            *NextProp = &m_ExtProperties.PushDescriptor;
+            NextProp  = &m_ExtProperties.PushDescriptor.pNext;
+
+            m_ExtProperties.PushDescriptor.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+        }
+
+        if (IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.DescriptorBuffer;
+            NextFeat  = &m_ExtFeatures.DescriptorBuffer.pNext;
+
+            m_ExtFeatures.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.DescriptorBuffer;
+            NextProp  = &m_ExtProperties.DescriptorBuffer.pNext;
+
+            m_ExtProperties.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        }
+
+        // VK_EXT_graphics_pipeline_library requires VK_KHR_pipeline_library
+        if (IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) && IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.GraphicsPipelineLibrary;
+            NextFeat  = &m_ExtFeatures.GraphicsPipelineLibrary.pNext;
+
+            m_ExtFeatures.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.GraphicsPipelineLibrary;
+            NextProp  = &m_ExtProperties.GraphicsPipelineLibrary.pNext;
+
+            m_ExtProperties.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.ExtendedDynamicState;
+            NextFeat  = &m_ExtFeatures.ExtendedDynamicState.pNext;
+
+            m_ExtFeatures.ExtendedDynamicState.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.ExtendedDynamicState2;
+            NextFeat  = &m_ExtFeatures.ExtendedDynamicState2.pNext;
+
+            m_ExtFeatures.ExtendedDynamicState2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.ExtendedDynamicState3;
+            NextFeat  = &m_ExtFeatures.ExtendedDynamicState3.pNext;
+
+            m_ExtFeatures.ExtendedDynamicState3.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.ExtendedDynamicState3;
+            NextProp  = &m_ExtProperties.ExtendedDynamicState3.pNext;
+
+            m_ExtProperties.ExtendedDynamicState3.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_PROPERTIES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+        {
+            // The budget is queried with vkGetPhysicalDeviceMemoryProperties2, see GetMemoryBudget()
+            m_ExtFeatures.MemoryBudget = true;
+        }
+
+        if (IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.Synchronization2;
+            NextFeat  = &m_ExtFeatures.Synchronization2.pNext;
+
+            m_ExtFeatures.Synchronization2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        }
+
         const bool HostImageCopySupported = IsExtensionSupported(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME);
         if (HostImageCopySupported)
         {
@@ -565,6 +651,27 @@ VkFormatProperties PhysicalDevice::GetPhysicalDeviceFormatProperties(VkFormat im
     }
 }
 
+bool PhysicalDevice::GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const
+{
+    Budget       = {};
+    Budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+#if DILIGENT_USE_VOLK
+    if (!m_ExtFeatures.MemoryBudget || vkGetPhysicalDeviceMemoryProperties2KHR == nullptr)
+        return false;
+
+    VkPhysicalDeviceMemoryProperties2 MemProps2{};
+    MemProps2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    MemProps2.pNext = &Budget;
+    vkGetPhysicalDeviceMemoryProperties2KHR(m_vkDevice, &MemProps2);
+    Budget.pNext = nullptr;
+
+    return true;
+#else
+    return false;
+#endif
+}
+
 bool PhysicalDevice::IsUMA() const
 {
     return m_MemoryProperties.memoryHeapCount == 1;
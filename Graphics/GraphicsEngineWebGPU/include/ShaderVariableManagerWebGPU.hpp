@@ -80,6 +80,14 @@ public:
                                         SHADER_TYPE                                ShaderStages,
                                         Uint32*                                    pNumVariables = nullptr);
 
+    // Writes the index of the variable that Initialize() creates for every resource in the given
+    // shader stage to pVarIndices[ResIndex]. Elements for resources without variables are not modified.
+    static void GetVariableIndices(const PipelineResourceSignatureWebGPUImpl& Signature,
+                                   const SHADER_RESOURCE_VARIABLE_TYPE*       AllowedVarTypes,
+                                   Uint32                                     NumAllowedTypes,
+                                   SHADER_TYPE                                ShaderType,
+                                   Uint32*                                    pVarIndices);
+
     Uint32 GetVariableCount() const { return m_NumVariables; }
 
     IObject& GetOwner() { return m_Owner; }
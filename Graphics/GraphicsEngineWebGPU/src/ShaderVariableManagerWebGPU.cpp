@@ -80,6 +80,21 @@ size_t ShaderVariableManagerWebGPU::GetRequiredMemorySize(const PipelineResource
     return (*pNumVariables) * sizeof(ShaderVariableWebGPUImpl);
 }
 
+void ShaderVariableManagerWebGPU::GetVariableIndices(const PipelineResourceSignatureWebGPUImpl& Signature,
+                                                     const SHADER_RESOURCE_VARIABLE_TYPE*       AllowedVarTypes,
+                                                     Uint32                                     NumAllowedTypes,
+                                                     SHADER_TYPE                                ShaderType,
+                                                     Uint32*                                    pVarIndices)
+{
+    // Variables are created in the order of resources, see Initialize()
+    Uint32 VarInd = 0;
+    ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
+                              [pVarIndices, &VarInd](Uint32 ResIndex) //
+                              {
+                                  pVarIndices[ResIndex] = VarInd++;
+                              });
+}
+
 // Creates shader variable for every resource whose type is one of AllowedVarTypes
 void ShaderVariableManagerWebGPU::Initialize(const PipelineResourceSignatureWebGPUImpl& Signature,
                                              IMemoryAllocator&                          Allocator,
@@ -103,6 +118,9 @@ void ShaderVariableManagerWebGPU::Initialize(const PipelineResourceSignatureWebG
                                   ++VarInd;
                               });
     VERIFY_EXPR(VarInd == m_NumVariables);
+#ifdef DILIGENT_DEBUG
+    DvpVerifyVariableOrder();
+#endif
 }
 
 void ShaderVariableManagerWebGPU::Destroy(IMemoryAllocator& Allocator)
@@ -117,13 +135,7 @@ void ShaderVariableManagerWebGPU::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableWebGPUImpl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return FindVariableByName(Name);
 }
 
 ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariable(Uint32 Index) const
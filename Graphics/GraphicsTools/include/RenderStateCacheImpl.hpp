@@ -29,6 +29,7 @@
 /// \file
 /// Definition of the Diligent::RenderStateCacheImpl class
 
+#include <memory>
 #include <unordered_map>
 #include <mutex>
 
@@ -38,6 +39,7 @@
 #include "UniqueIdentifier.hpp"
 #include "ObjectBase.hpp"
 #include "XXH128Hasher.hpp"
+#include "PipelineUsageTrace.hpp"
 
 namespace Diligent
 {
@@ -110,6 +112,8 @@ public:
         return m_ReloadVersion;
     }
 
+    virtual Bool DILIGENT_CALL_TYPE WriteUsageTrace(IFileStream* pStream) const override final;
+
     bool CreateShaderInternal(const ShaderCreateInfo& ShaderCI,
                               IShader**               ppShader);
 
@@ -156,6 +160,9 @@ private:
     std::mutex                                                          m_ReloadablePipelinesMtx;
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IPipelineState>> m_ReloadablePipelines;
 
+    // Null if the usage trace is disabled
+    std::unique_ptr<PipelineUsageTrace> m_pUsageTrace;
+
     Uint32 m_ReloadVersion = 0;
 };
 
@@ -76,6 +76,10 @@ struct RenderStateCacheCreateInfo
     /// shaders. If null, original source factory will be used.
     IShaderSourceInputStreamFactory* pReloadSource DEFAULT_INITIALIZER(nullptr);
 
+    /// Whether to record the create info hashes of the shaders and pipeline states
+    /// requested from the cache, see IRenderStateCache::WriteUsageTrace().
+    bool EnableUsageTrace DEFAULT_INITIALIZER(false);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr RenderStateCacheCreateInfo() noexcept
     {}
@@ -85,12 +89,14 @@ struct RenderStateCacheCreateInfo
         RENDER_STATE_CACHE_LOG_LEVEL     _LogLevel          = RenderStateCacheCreateInfo{}.LogLevel,
         bool                             _EnableHotReload   = RenderStateCacheCreateInfo{}.EnableHotReload,
         bool                             _OptimizeGLShaders = RenderStateCacheCreateInfo{}.OptimizeGLShaders,
-        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource) noexcept :
+        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource,
+        bool                             _EnableUsageTrace  = RenderStateCacheCreateInfo{}.EnableUsageTrace) noexcept :
         pDevice{_pDevice},
         LogLevel{_LogLevel},
         EnableHotReload{_EnableHotReload},
         OptimizeGLShaders{_OptimizeGLShaders},
-        pReloadSource{_pReloadSource}
+        pReloadSource{_pReloadSource},
+        EnableUsageTrace{_EnableUsageTrace}
     {}
 #endif
 };
@@ -258,6 +264,25 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
 
     /// The reload version is incremented every time the cache is reloaded.
     VIRTUAL Uint32 METHOD(GetReloadVersion)(THIS) CONST PURE;
+
+
+    /// Writes the usage trace to a file stream.
+
+    /// \param [in]  pStream - Pointer to the IFileStream interface to use for writing.
+    ///
+    /// \return     true if the trace was written successfully, and false otherwise.
+    ///
+    /// \remarks    The trace lists the shaders and pipeline states requested from the cache in the
+    ///             order of their first request. Every entry contains the object name, the hash of
+    ///             its create info, the request timestamp and the number of requests.
+    ///             The trace can be passed to the archiver command-line tool to build an archive
+    ///             that only contains the objects the application actually uses.
+    ///
+    ///             The trace is only recorded if the cache was created with the `EnableUsageTrace`
+    ///             member of Diligent::RenderStateCacheCreateInfo set to true.
+    ///             The trace is not cleared by Reset().
+    VIRTUAL Bool METHOD(WriteUsageTrace)(THIS_
+                                         IFileStream* pStream) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -278,6 +303,7 @@ DILIGENT_END_INTERFACE
 #    define IRenderStateCache_Reload(This, ...)                        CALL_IFACE_METHOD(RenderStateCache, Reload,                       This, __VA_ARGS__)
 #    define IRenderStateCache_GetContentVersion(This)                  CALL_IFACE_METHOD(RenderStateCache, GetContentVersion,            This)
 #    define IRenderStateCache_GetReloadVersion(This)                   CALL_IFACE_METHOD(RenderStateCache, GetReloadVersion,             This)
+#    define IRenderStateCache_WriteUsageTrace(This, ...)               CALL_IFACE_METHOD(RenderStateCache, WriteUsageTrace,              This, __VA_ARGS__)
 // clang-format on
 
 #endif
@@ -96,6 +96,17 @@ Bool RenderStateCacheImpl::WriteToStream(Uint32 ContentVersion, IFileStream* pSt
     return pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
 }
 
+Bool RenderStateCacheImpl::WriteUsageTrace(IFileStream* pStream) const
+{
+    if (!m_pUsageTrace)
+    {
+        DEV_ERROR("Usage trace is disabled. Set EnableUsageTrace member of RenderStateCacheCreateInfo to true.");
+        return false;
+    }
+
+    return m_pUsageTrace->Serialize(pStream);
+}
+
 void RenderStateCacheImpl::Reset()
 {
     m_pDearchiver->Reset();
@@ -228,6 +239,9 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
     m_pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &m_pDearchiver);
     if (!m_pDearchiver)
         LOG_ERROR_AND_THROW("Failed to create dearchiver");
+
+    if (m_CI.EnableUsageTrace)
+        m_pUsageTrace = std::make_unique<PipelineUsageTrace>();
 }
 
 #define RENDER_STATE_CACHE_LOG(Level, ...)                         \
@@ -321,6 +335,9 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
     Hasher.Update(ShaderCI, m_DeviceHash, IsDebug);
     const XXH128Hash Hash = Hasher.Digest();
 
+    if (m_pUsageTrace)
+        m_pUsageTrace->RecordShader(ShaderCI.Desc.Name, Hash.LowPart, Hash.HighPart);
+
     // First, try to check if the shader has already been requested
     {
         std::lock_guard<std::mutex> Guard{m_ShadersMtx};
@@ -768,6 +785,9 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
     Hasher.Update(PSOCreateInfo, m_DeviceHash);
     const auto Hash = Hasher.Digest();
 
+    if (m_pUsageTrace)
+        m_pUsageTrace->RecordPipeline(PSOCreateInfo.PSODesc.PipelineType, PSOCreateInfo.PSODesc.Name, Hash.LowPart, Hash.HighPart);
+
     // First, try to check if the PSO has already been requested
     {
         std::lock_guard<std::mutex> Guard{m_PipelinesMtx};
@@ -27,7 +27,6 @@
 
 #pragma once
 
-#include <list>
 #include <unordered_set>
 #include <unordered_map>
 #include <vector>
@@ -39,6 +38,7 @@
 #include "HashUtils.hpp"
 #include "Constants.h"
 #include "HLSLTokenizer.hpp"
+#include "HLSL2GLSLTokenList.hpp"
 
 namespace Diligent
 {
@@ -219,8 +219,8 @@ private:
     std::unordered_map<FunctionStubHashKey, GLSLStubInfo, FunctionStubHashKey::Hasher> m_GLSLStubs;
 
     using TokenType     = Parsing::HLSLTokenType;
-    using TokenInfo     = Parsing::HLSLTokenInfo;
-    using TokenListType = Parsing::HLSLTokenizer::TokenListType;
+    using TokenInfo     = HLSL2GLSLToken;
+    using TokenListType = HLSL2GLSLTokenList;
 
     class ConversionStream : public ObjectBase<IHLSL2GLSLConversionStream>
     {
@@ -270,11 +270,16 @@ private:
         const String& GetInputFileName() const { return m_InputFileName; }
 
     private:
+        // Processes constant buffers, structured buffers, structs and preprocessor directives
+        // in the global scope. These steps do not depend on the entry point, so for preserved
+        // streams the result is saved and reused by subsequent conversions.
+        void ProcessGlobalScope(bool UseRowMajorMatrices);
+
         void InsertIncludes(String& GLSLSource, IShaderSourceInputStreamFactory* pSourceStreamFactory);
 
         using SamplerHashType = std::unordered_map<String, bool>;
 
-        const HLSLObjectInfo* FindHLSLObject(const String& Name);
+        const HLSLObjectInfo* FindHLSLObject(const HLSL2GLSLTokenString& Name);
 
         void ParseGlobalPreprocessorDefines();
 
@@ -313,7 +318,7 @@ private:
         void   RemoveSemanticsFromBlock(TokenListType::iterator& Token, TokenType OpenBracketType, TokenType ClosingBracketType);
         void   RemoveSamplerRegister(TokenListType::iterator& Token);
 
-        TokenListType::iterator FindMacroDefinition(const std::string& MacroName);
+        TokenListType::iterator FindMacroDefinition(const HLSL2GLSLTokenString& MacroName);
 
         // IteratorType may be String::iterator or String::const_iterator.
         // While iterator is convertible to const_iterator,
@@ -459,9 +464,34 @@ private:
 
         String BuildGLSLSource();
 
-        // Tokenized source code
+        // Source code with all includes inserted.
+        // The tokens reference the source, so it must not be modified after tokenization.
+        String m_Source;
+
+        // Contiguous array of tokens referencing m_Source. The array is created
+        // once and is used to initialize m_Tokens for every conversion.
+        Parsing::HLSLTokenizer::TokenArrayType m_SourceTokens;
+
+        // Tokenized source code that is modified during the conversion.
+        // Unmodified tokens reference m_Source.
         TokenListType m_Tokens;
 
+        // Tokens after the global scope has been processed by ProcessGlobalScope()
+        struct GlobalScopeInfo
+        {
+            TokenListType Tokens;
+
+            // Positions of struct name tokens in the Tokens list
+            std::vector<size_t> StructNamePositions;
+
+            // Positions of global #define directives in the Tokens list
+            std::vector<size_t> MacroDefinitionPositions;
+
+            bool UseRowMajorMatrices = false;
+            bool IsValid             = false;
+        };
+        GlobalScopeInfo m_GlobalScope;
+
         // List of tokens defining structs
         std::unordered_map<HashMapStringKey, TokenListType::iterator> m_StructDefinitions;
 
@@ -476,6 +506,10 @@ private:
         //           defined as function arguments
         std::vector<ObjectsTypeHashType> m_Objects;
 
+        // Token literals are not null-terminated, so they are copied to this
+        // buffer to look them up in the hash maps without allocating memory
+        String m_NameBuffer;
+
         const bool m_bPreserveTokens;
         bool       m_bUseInOutLocationQualifiers = true;
         bool       m_bUseRowMajorMatrices        = false;
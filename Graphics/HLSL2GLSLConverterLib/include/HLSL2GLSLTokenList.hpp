@@ -0,0 +1,521 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "HLSLTokenizer.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// Token string used by the HLSL to GLSL converter.
+
+/// The string references a range in the tokenized source until it is modified
+/// for the first time, after which it owns a copy of its characters.
+/// Only the operations required by the converter are implemented.
+class HLSL2GLSLTokenString
+{
+public:
+    HLSL2GLSLTokenString() noexcept {}
+
+    // clang-format off
+    HLSL2GLSLTokenString(const char*  Str) : m_Str{Str}            {}
+    HLSL2GLSLTokenString(std::string  Str) : m_Str{std::move(Str)} {}
+    // clang-format on
+
+    /// Creates a string that references the [Start, End) range.
+    /// The range must outlive the string or any of its copies.
+    HLSL2GLSLTokenString(const char* Start, const char* End) noexcept :
+        m_ViewStart{Start},
+        m_ViewEnd{End}
+    {}
+
+    HLSL2GLSLTokenString& operator=(const char* Str)
+    {
+        ResetView();
+        m_Str = Str;
+        return *this;
+    }
+
+    HLSL2GLSLTokenString& operator=(std::string Str)
+    {
+        ResetView();
+        m_Str = std::move(Str);
+        return *this;
+    }
+
+    const char* data() const { return IsView() ? m_ViewStart : m_Str.data(); }
+    size_t      length() const { return IsView() ? static_cast<size_t>(m_ViewEnd - m_ViewStart) : m_Str.length(); }
+    size_t      size() const { return length(); }
+    bool        empty() const { return length() == 0; }
+
+    const char* begin() const { return data(); }
+    const char* end() const { return data() + length(); }
+
+    char back() const
+    {
+        VERIFY_EXPR(!empty());
+        return end()[-1];
+    }
+
+    /// Returns a null-terminated string. Referenced strings are copied.
+    const char* c_str()
+    {
+        return Materialize().c_str();
+    }
+
+    std::string str() const { return std::string{begin(), end()}; }
+
+    size_t find_first_of(const char* Chars) const
+    {
+        const char* Pos = std::find_first_of(begin(), end(), Chars, Chars + strlen(Chars));
+        return Pos != end() ? static_cast<size_t>(Pos - begin()) : std::string::npos;
+    }
+
+    void clear()
+    {
+        if (IsView())
+            m_ViewEnd = m_ViewStart;
+        else
+            m_Str.clear();
+    }
+
+    void pop_back()
+    {
+        VERIFY_EXPR(!empty());
+        if (IsView())
+            --m_ViewEnd;
+        else
+            m_Str.pop_back();
+    }
+
+    void push_back(char c)
+    {
+        Materialize().push_back(c);
+    }
+
+    HLSL2GLSLTokenString& append(const char* Str)
+    {
+        Materialize().append(Str);
+        return *this;
+    }
+
+    HLSL2GLSLTokenString& append(const std::string& Str)
+    {
+        Materialize().append(Str);
+        return *this;
+    }
+
+    HLSL2GLSLTokenString& append(const HLSL2GLSLTokenString& Str)
+    {
+        Materialize().append(Str.begin(), Str.end());
+        return *this;
+    }
+
+    bool operator==(const HLSL2GLSLTokenString& Str) const
+    {
+        return Equals(Str.data(), Str.length());
+    }
+    bool operator==(const std::string& Str) const
+    {
+        return Equals(Str.data(), Str.length());
+    }
+    bool operator==(const char* Str) const
+    {
+        return Equals(Str, strlen(Str));
+    }
+
+    template <typename T>
+    bool operator!=(const T& Str) const
+    {
+        return !(*this == Str);
+    }
+
+    friend std::string operator+(const HLSL2GLSLTokenString& Str, char c)
+    {
+        std::string Res{Str.begin(), Str.end()};
+        Res.push_back(c);
+        return Res;
+    }
+    friend std::string operator+(const HLSL2GLSLTokenString& Str, const char* Suffix)
+    {
+        return Str.str().append(Suffix);
+    }
+    friend std::string operator+(const HLSL2GLSLTokenString& Str, const HLSL2GLSLTokenString& Suffix)
+    {
+        return Str.str().append(Suffix.begin(), Suffix.end());
+    }
+    friend std::string operator+(const std::string& Prefix, const HLSL2GLSLTokenString& Str)
+    {
+        return std::string{Prefix}.append(Str.begin(), Str.end());
+    }
+    friend std::string operator+(const char* Prefix, const HLSL2GLSLTokenString& Str)
+    {
+        return std::string{Prefix}.append(Str.begin(), Str.end());
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const HLSL2GLSLTokenString& Str)
+    {
+        return os.write(Str.data(), Str.length());
+    }
+
+private:
+    bool IsView() const { return m_ViewStart != nullptr; }
+
+    void ResetView()
+    {
+        m_ViewStart = nullptr;
+        m_ViewEnd   = nullptr;
+    }
+
+    std::string& Materialize()
+    {
+        if (IsView())
+        {
+            m_Str.assign(m_ViewStart, m_ViewEnd);
+            ResetView();
+        }
+        return m_Str;
+    }
+
+    bool Equals(const char* Str, size_t Len) const
+    {
+        return length() == Len && (Len == 0 || memcmp(data(), Str, Len) == 0);
+    }
+
+private:
+    const char* m_ViewStart = nullptr;
+    const char* m_ViewEnd   = nullptr;
+    std::string m_Str;
+};
+
+
+/// Token processed by the HLSL to GLSL converter.
+struct HLSL2GLSLToken
+{
+    using TokenType = Parsing::HLSLTokenType;
+
+    TokenType            Type = TokenType::Undefined;
+    HLSL2GLSLTokenString Literal;
+    HLSL2GLSLTokenString Delimiter;
+    size_t               Idx = ~size_t{0};
+
+    HLSL2GLSLToken() {}
+
+    HLSL2GLSLToken(TokenType            _Type,
+                   HLSL2GLSLTokenString _Literal,
+                   HLSL2GLSLTokenString _Delimiter = "") :
+        Type{_Type},
+        Literal{std::move(_Literal)},
+        Delimiter{std::move(_Delimiter)}
+    {}
+
+    explicit HLSL2GLSLToken(const Parsing::HLSLTokenView& View) :
+        Type{View.Type},
+        Literal{View.LiteralStart, View.LiteralEnd},
+        Delimiter{View.DelimStart, View.DelimEnd},
+        Idx{View.Idx}
+    {}
+
+    void SetType(TokenType _Type)
+    {
+        Type = _Type;
+    }
+
+    TokenType GetType() const { return Type; }
+
+    bool IsBuiltInType() const { return Parsing::IsHLSLBuiltInType(Type); }
+    bool IsFlowControl() const { return Parsing::IsHLSLFlowControl(Type); }
+
+    size_t GetDelimiterLen() const
+    {
+        return Delimiter.length();
+    }
+    size_t GetLiteralLen() const
+    {
+        return Literal.length();
+    }
+    const std::pair<const char*, const char*> GetDelimiter() const
+    {
+        return {Delimiter.begin(), Delimiter.end()};
+    }
+    const std::pair<const char*, const char*> GetLiteral() const
+    {
+        return {Literal.begin(), Literal.end()};
+    }
+
+    std::ostream& OutputDelimiter(std::ostream& os) const
+    {
+        return os << Delimiter;
+    }
+    std::ostream& OutputLiteral(std::ostream& os) const
+    {
+        return os << Literal;
+    }
+};
+
+
+/// Doubly-linked list of tokens processed by the HLSL to GLSL converter.
+
+/// The list is initialized from the tokenizer's token array with a single allocation.
+/// The tokens reference the source until they are modified. Tokens inserted during the
+/// conversion are allocated in chunks. Similar to std::list, insertion and erasure do not
+/// invalidate iterators and references to other tokens.
+class HLSL2GLSLTokenList
+{
+    struct Node
+    {
+        HLSL2GLSLToken Token;
+        Node*          pPrev = nullptr;
+        Node*          pNext = nullptr;
+
+        Node() {}
+
+        explicit Node(HLSL2GLSLToken&& _Token) :
+            Token{std::move(_Token)}
+        {}
+    };
+
+public:
+    template <typename NodeType, typename ValueType>
+    class IteratorBase
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = HLSL2GLSLToken;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = ValueType*;
+        using reference         = ValueType&;
+
+        IteratorBase() noexcept {}
+
+        explicit IteratorBase(NodeType* pNode) noexcept :
+            m_pNode{pNode}
+        {}
+
+        // Allow conversion from iterator to const_iterator
+        template <typename OtherNodeType, typename OtherValueType>
+        IteratorBase(const IteratorBase<OtherNodeType, OtherValueType>& Other) noexcept :
+            m_pNode{Other.m_pNode}
+        {}
+
+        reference operator*() const { return m_pNode->Token; }
+        pointer   operator->() const { return &m_pNode->Token; }
+
+        IteratorBase& operator++()
+        {
+            m_pNode = m_pNode->pNext;
+            return *this;
+        }
+        IteratorBase operator++(int)
+        {
+            IteratorBase Tmp{*this};
+            m_pNode = m_pNode->pNext;
+            return Tmp;
+        }
+        IteratorBase& operator--()
+        {
+            m_pNode = m_pNode->pPrev;
+            return *this;
+        }
+        IteratorBase operator--(int)
+        {
+            IteratorBase Tmp{*this};
+            m_pNode = m_pNode->pPrev;
+            return Tmp;
+        }
+
+        bool operator==(const IteratorBase& Other) const { return m_pNode == Other.m_pNode; }
+        bool operator!=(const IteratorBase& Other) const { return m_pNode != Other.m_pNode; }
+
+    private:
+        template <typename, typename>
+        friend class IteratorBase;
+        friend class HLSL2GLSLTokenList;
+
+        NodeType* m_pNode = nullptr;
+    };
+    using iterator       = IteratorBase<Node, HLSL2GLSLToken>;
+    using const_iterator = IteratorBase<const Node, const HLSL2GLSLToken>;
+
+    HLSL2GLSLTokenList() noexcept
+    {
+        ResetHead();
+    }
+
+    explicit HLSL2GLSLTokenList(const Parsing::HLSLTokenizer::TokenArrayType& Tokens)
+    {
+        m_Nodes.reserve(Tokens.size());
+        for (const Parsing::HLSLTokenView& Token : Tokens)
+            m_Nodes.emplace_back(HLSL2GLSLToken{Token});
+        LinkNodes();
+    }
+
+    HLSL2GLSLTokenList(const HLSL2GLSLTokenList& Other)
+    {
+        // Copy the tokens into a single contiguous allocation
+        m_Nodes.reserve(Other.size());
+        for (const HLSL2GLSLToken& Token : Other)
+            m_Nodes.emplace_back(HLSL2GLSLToken{Token});
+        LinkNodes();
+    }
+
+    HLSL2GLSLTokenList(HLSL2GLSLTokenList&& Other) noexcept
+    {
+        ResetHead();
+        *this = std::move(Other);
+    }
+
+    HLSL2GLSLTokenList& operator=(const HLSL2GLSLTokenList& Other)
+    {
+        if (this != &Other)
+            *this = HLSL2GLSLTokenList{Other};
+        return *this;
+    }
+
+    HLSL2GLSLTokenList& operator=(HLSL2GLSLTokenList&& Other) noexcept
+    {
+        if (this == &Other)
+            return *this;
+
+        // Moving the containers does not relocate the nodes, only the head node needs to be relinked
+        m_Nodes         = std::move(Other.m_Nodes);
+        m_InsertedNodes = std::move(Other.m_InsertedNodes);
+        m_Size          = Other.m_Size;
+        if (m_Size != 0)
+        {
+            m_Head.pNext        = Other.m_Head.pNext;
+            m_Head.pPrev        = Other.m_Head.pPrev;
+            m_Head.pNext->pPrev = &m_Head;
+            m_Head.pPrev->pNext = &m_Head;
+        }
+        else
+        {
+            ResetHead();
+        }
+        Other.clear();
+        return *this;
+    }
+
+    iterator       begin() { return iterator{m_Head.pNext}; }
+    iterator       end() { return iterator{&m_Head}; }
+    const_iterator begin() const { return const_iterator{m_Head.pNext}; }
+    const_iterator end() const { return const_iterator{&m_Head}; }
+
+    size_t size() const { return m_Size; }
+    bool   empty() const { return m_Size == 0; }
+
+    /// Inserts the token before Pos and returns the iterator to the inserted token.
+    iterator insert(const iterator& Pos, HLSL2GLSLToken Token)
+    {
+        m_InsertedNodes.emplace_back(std::move(Token));
+        Node* pNode         = &m_InsertedNodes.back();
+        Node* pNext         = Pos.m_pNode;
+        pNode->pPrev        = pNext->pPrev;
+        pNode->pNext        = pNext;
+        pNext->pPrev->pNext = pNode;
+        pNext->pPrev        = pNode;
+        ++m_Size;
+        return iterator{pNode};
+    }
+
+    /// Removes the token at Pos and returns the iterator following the removed token.
+    /// The memory of removed tokens is released when the list is cleared or destroyed.
+    iterator erase(const iterator& Pos)
+    {
+        VERIFY(Pos.m_pNode != &m_Head, "End iterator can't be erased");
+        Node* pNode         = Pos.m_pNode;
+        pNode->pPrev->pNext = pNode->pNext;
+        pNode->pNext->pPrev = pNode->pPrev;
+        --m_Size;
+        return iterator{pNode->pNext};
+    }
+
+    iterator erase(iterator First, const iterator& Last)
+    {
+        while (First != Last)
+            First = erase(First);
+        return First;
+    }
+
+    void clear()
+    {
+        m_Nodes.clear();
+        m_Nodes.shrink_to_fit();
+        m_InsertedNodes.clear();
+        m_InsertedNodes.shrink_to_fit();
+        m_Size = 0;
+        ResetHead();
+    }
+
+private:
+    void ResetHead()
+    {
+        m_Head.pPrev = &m_Head;
+        m_Head.pNext = &m_Head;
+    }
+
+    void LinkNodes()
+    {
+        ResetHead();
+        Node* pPrev = &m_Head;
+        for (Node& node : m_Nodes)
+        {
+            node.pPrev   = pPrev;
+            pPrev->pNext = &node;
+            pPrev        = &node;
+        }
+        pPrev->pNext = &m_Head;
+        m_Head.pPrev = pPrev;
+        m_Size       = m_Nodes.size();
+    }
+
+private:
+    // Head node that also serves as the end of the list
+    Node m_Head;
+
+    // Nodes created from the token array or copied from another list.
+    // The vector is never resized after initialization.
+    std::vector<Node> m_Nodes;
+
+    // Nodes inserted by the converter. Unlike vector, deque does not
+    // relocate the existing elements when new elements are added.
+    std::deque<Node> m_InsertedNodes;
+
+    size_t m_Size = 0;
+};
+
+} // namespace Diligent
@@ -826,7 +826,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ParseGlobalPreprocessorDefines()
             continue;
         }
 
-        const auto Directive = RefinePreprocessorDirective(Token->Literal);
+        const auto Directive = RefinePreprocessorDirective(Token->Literal.begin(), Token->Literal.end());
 
         if (Directive == "if" ||
             Directive == "ifdef" ||
@@ -864,7 +864,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ParseGlobalPreprocessorDefines()
                     // Check that the name is on the same line
                     MacroNameToken->Delimiter.find_first_of("\r\n") == std::string::npos)
                 {
-                    m_PreprocessorDefinitions.emplace(MacroNameToken->Literal, Token);
+                    m_PreprocessorDefinitions.emplace(HashMapStringKey{MacroNameToken->Literal.str()}, Token);
                 }
             }
         }
@@ -878,9 +878,10 @@ void HLSL2GLSLConverterImpl::ConversionStream::ParseGlobalPreprocessorDefines()
     }
 }
 
-HLSL2GLSLConverterImpl::TokenListType::iterator HLSL2GLSLConverterImpl::ConversionStream::FindMacroDefinition(const std::string& MacroName)
+HLSL2GLSLConverterImpl::TokenListType::iterator HLSL2GLSLConverterImpl::ConversionStream::FindMacroDefinition(const HLSL2GLSLTokenString& MacroName)
 {
-    auto define_it = m_PreprocessorDefinitions.find(MacroName.c_str());
+    m_NameBuffer.assign(MacroName.begin(), MacroName.end());
+    auto define_it = m_PreprocessorDefinitions.find(m_NameBuffer.c_str());
     if (define_it == m_PreprocessorDefinitions.end())
         return m_Tokens.end();
 
@@ -1027,7 +1028,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessStructuredBuffer(TokenList
     if (Token->Delimiter.empty())
         Token->Delimiter = " ";
 
-    m_Tokens.insert(OpenBraceToken, TokenInfo(TokenType::Identifier, Token->Literal.c_str(), " "));
+    m_Tokens.insert(OpenBraceToken, TokenInfo(TokenType::Identifier, Token->Literal, " "));
     //          OpenBraceToken
     //              V
     // buffer g_Data{DataType g_Data;
@@ -1082,7 +1083,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessPreprocessorDirective(Toke
     while (DirectiveEnd != m_Tokens.end() && DirectiveEnd->Delimiter.find_first_of("\r\n") == std::string::npos)
         ++DirectiveEnd;
 
-    const std::string Directive = RefinePreprocessorDirective(Token->Literal);
+    const std::string Directive = RefinePreprocessorDirective(Token->Literal.begin(), Token->Literal.end());
     if (Directive == "pragma")
     {
         // # pragma pack_matrix( row_major )
@@ -1109,7 +1110,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessPreprocessorDirective(Toke
                 if (Token == End || (Token->Type != TokenType::kw_row_major && Token->Type != TokenType::kw_column_major))
                     return "";
 
-                const std::string& PackMatrix = Token->Literal;
+                const auto& PackMatrix = Token->Literal;
 
                 ++Token;
                 // # pragma pack_matrix( row_major )
@@ -1117,7 +1118,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessPreprocessorDirective(Toke
                 if (Token == End || Token->Type != TokenType::ClosingParen)
                     return "";
 
-                return PackMatrix;
+                return PackMatrix.str();
             };
             const std::string PackMatrix = ParsePragmaPackMatrix(Token, DirectiveEnd);
             if (PackMatrix == "row_major")
@@ -1247,7 +1248,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ParseSamplers(TokenListType::iter
                 const auto& SamplerName = Token->Literal;
 
                 // Add sampler state into the hash map
-                SamplersHash.insert(std::make_pair(SamplerName, bIsComparison));
+                SamplersHash.insert(std::make_pair(SamplerName.str(), bIsComparison));
 
                 ++Token;
                 // SamplerState LinearClamp ;
@@ -1583,7 +1584,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessTextureDeclaration(TokenLi
                 TexDeclToken->Literal.append("IMAGE_WRITEONLY "); // defined as 'writeonly' on GLES and as '' on desktop in GLSLDefinitions.h
         }
         TexDeclToken->Literal.append(CompleteGLSLSampler);
-        Objects.m.insert(std::make_pair(HashMapStringKey(TextureName), HLSLObjectInfo{std::move(CompleteGLSLSampler), NumComponents, ArrayDim}));
+        Objects.m.insert(std::make_pair(HashMapStringKey{TextureName.str()}, HLSLObjectInfo{std::move(CompleteGLSLSampler), NumComponents, ArrayDim}));
 
         // In global scope, multiple variables can be declared in the same statement
         if (IsGlobalScope)
@@ -1656,11 +1657,12 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessTextureDeclaration(TokenLi
 
 
 // Finds an HLSL object with the given name in object stack
-const HLSL2GLSLConverterImpl::HLSLObjectInfo* HLSL2GLSLConverterImpl::ConversionStream::FindHLSLObject(const String& Name)
+const HLSL2GLSLConverterImpl::HLSLObjectInfo* HLSL2GLSLConverterImpl::ConversionStream::FindHLSLObject(const HLSL2GLSLTokenString& Name)
 {
+    m_NameBuffer.assign(Name.begin(), Name.end());
     for (auto ScopeIt = m_Objects.rbegin(); ScopeIt != m_Objects.rend(); ++ScopeIt)
     {
-        auto It = ScopeIt->m.find(Name.c_str());
+        auto It = ScopeIt->m.find(m_NameBuffer.c_str());
         if (It != ScopeIt->m.end())
             return &It->second;
     }
@@ -1794,7 +1796,7 @@ bool HLSL2GLSLConverterImpl::ConversionStream::ProcessObjectMethod(TokenListType
     // ^
     // IdentifierToken
 
-    m_Tokens.insert(IdentifierToken, TokenInfo(TokenType::Identifier, StubIt->second.Name.c_str(), IdentifierToken->Delimiter.c_str()));
+    m_Tokens.insert(IdentifierToken, TokenInfo(TokenType::Identifier, StubIt->second.Name.c_str(), IdentifierToken->Delimiter));
     IdentifierToken->Delimiter = " ";
     // FunctionStub TestTextArr[2], TestTextArr_sampler, ...
     //              ^
@@ -2020,7 +2022,7 @@ bool HLSL2GLSLConverterImpl::ConversionStream::ProcessRWTextureStore(TokenListTy
     // ^                                              ^
     // Token                                    SemicolonToken
 
-    m_Tokens.insert(Token, TokenInfo(TokenType::Identifier, "imageStore", Token->Delimiter.c_str()));
+    m_Tokens.insert(Token, TokenInfo(TokenType::Identifier, "imageStore", Token->Delimiter));
     m_Tokens.insert(Token, TokenInfo(TokenType::OpenParen, "(", ""));
     Token->Delimiter = " ";
     // imageStore( RWTex[Location.xy] = float4(0.0, 0.0, 0.0, 1.0);
@@ -2127,7 +2129,7 @@ bool HLSL2GLSLConverterImpl::ConversionStream::ProcessRWTextureLoad(TokenListTyp
     //           ^           ^
     //  OpenStaplePos     ClosingStaplePos
 
-    m_Tokens.insert(Token, TokenInfo(TokenType::Identifier, "imageLoad", Token->Delimiter.c_str()));
+    m_Tokens.insert(Token, TokenInfo(TokenType::Identifier, "imageLoad", Token->Delimiter));
     m_Tokens.insert(Token, TokenInfo(TokenType::OpenParen, "(", ""));
     Token->Delimiter = " ";
     // imageLoad( RWTex[Location.xy]
@@ -2228,7 +2230,8 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessAtomics(const TokenListTyp
     {
         if (Token->Type == TokenType::Identifier)
         {
-            auto AtomicIt = m_Converter.m_AtomicOperations.find(Token->Literal.c_str());
+            m_NameBuffer.assign(Token->Literal.begin(), Token->Literal.end());
+            auto AtomicIt = m_Converter.m_AtomicOperations.find(m_NameBuffer.c_str());
             if (AtomicIt == m_Converter.m_AtomicOperations.end())
             {
                 ++Token;
@@ -2354,7 +2357,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ParseShaderParameter(TokenListTyp
     VERIFY_PARSER_STATE(Token, Token->IsBuiltInType() || Token->Type == TokenType::Identifier,
                         "Missing argument type");
     auto TypeToken = Token;
-    ParamInfo.Type = Token->Literal;
+    ParamInfo.Type = Token->Literal.str();
 
     if (ParamInfo.storageQualifier != ShaderParameterInfo::StorageQualifier::Ret)
     {
@@ -2363,7 +2366,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ParseShaderParameter(TokenListTyp
         //                     ^
         VERIFY_PARSER_STATE(Token, Token != m_Tokens.end(), "Unexpected EOF while parsing argument list");
         VERIFY_PARSER_STATE(Token, Token->Type == TokenType::Identifier, "Missing argument name after ", ParamInfo.Type);
-        ParamInfo.Name = Token->Literal;
+        ParamInfo.Name = Token->Literal.str();
 
         ++Token;
         VERIFY_PARSER_STATE(Token, Token != m_Tokens.end(), "Unexpected EOF");
@@ -2375,8 +2378,8 @@ void HLSL2GLSLConverterImpl::ConversionStream::ParseShaderParameter(TokenListTyp
             ProcessScope(
                 Token, m_Tokens.end(), TokenType::OpenSquareBracket, TokenType::ClosingSquareBracket,
                 [&](TokenListType::iterator& tkn, int) {
-                    ParamInfo.ArraySize.append(tkn->Delimiter);
-                    ParamInfo.ArraySize.append(tkn->Literal);
+                    ParamInfo.ArraySize.append(tkn->Delimiter.begin(), tkn->Delimiter.end());
+                    ParamInfo.ArraySize.append(tkn->Literal.begin(), tkn->Literal.end());
                     ++tkn;
                 } //
             );
@@ -2403,7 +2406,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ParseShaderParameter(TokenListTyp
                 VERIFY_PARSER_STATE(Token, Token != m_Tokens.end(), "Unexpected end of file while looking for semantic for argument \"", ParamInfo.Name, '\"');
                 VERIFY_PARSER_STATE(Token, Token->Type == TokenType::Identifier, "Missing semantic for argument \"", ParamInfo.Name, '\"');
                 // Transform to lower case -  semantics are case-insensitive
-                ParamInfo.Semantic = StrToLower(Token->Literal);
+                ParamInfo.Semantic = StrToLower(Token->Literal.str());
 
                 ++Token;
                 //          out float4 Color : SV_Target,
@@ -2423,7 +2426,8 @@ void HLSL2GLSLConverterImpl::ConversionStream::ParseShaderParameter(TokenListTyp
             }
         }
         const auto& StructName = TypeToken->Literal;
-        auto        it         = m_StructDefinitions.find(StructName.c_str());
+        m_NameBuffer.assign(StructName.begin(), StructName.end());
+        auto it = m_StructDefinitions.find(m_NameBuffer.c_str());
         if (it == m_StructDefinitions.end())
             LOG_ERROR_AND_THROW("Unable to find definition for type \'", StructName, "\'");
 
@@ -2494,8 +2498,8 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessFunctionParameters(TokenLi
     if (!bIsVoid)
     {
         ShaderParameterInfo RetParam;
-        RetParam.Type             = ActualTypeToken->Literal;
-        RetParam.Name             = FuncNameToken->Literal;
+        RetParam.Type             = ActualTypeToken->Literal.str();
+        RetParam.Name             = FuncNameToken->Literal.str();
         RetParam.storageQualifier = ShaderParameterInfo::StorageQualifier::Ret;
         Params.emplace_back(std::move(RetParam));
     }
@@ -2689,7 +2693,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessFunctionParameters(TokenLi
                     //                                   ^
                     VERIFY_PARSER_STATE(TmpToken, TmpToken != m_Tokens.end() && TmpToken->Type == TokenType::NumericConstant, "Numeric constant expected");
 
-                    ParamInfo.ArraySize     = TmpToken->Literal;
+                    ParamInfo.ArraySize     = TmpToken->Literal.str();
                     auto NumCtrlPointsToken = TmpToken;
                     ++TmpToken;
                     VERIFY_PARSER_STATE(TmpToken, TmpToken != m_Tokens.end() && TmpToken->Literal == ">", "Angle bracket expected");
@@ -2739,7 +2743,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessFunctionParameters(TokenLi
             VERIFY_PARSER_STATE(SemanticToken, SemanticToken != m_Tokens.end(), "Unexpected EOF");
             VERIFY_PARSER_STATE(SemanticToken, SemanticToken->Type == TokenType::Identifier, "Expected semantic for the return argument ");
             // Transform to lower case -  semantics are case-insensitive
-            RetParam.Semantic = StrToLower(SemanticToken->Literal);
+            RetParam.Semantic = StrToLower(SemanticToken->Literal.str());
             ++SemanticToken;
             // float4 TestPS  ( in VSOutput In ) : SV_Target
             // {
@@ -3466,7 +3470,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessHullShaderConstantFunction
         }
     }
     ReturnHandlerSS << "return;}\n";
-    m_Tokens.insert(TypeToken, TokenInfo(TokenType::TextBlock, ReturnHandlerSS.str().c_str(), TypeToken->Delimiter.c_str()));
+    m_Tokens.insert(TypeToken, TokenInfo(TokenType::TextBlock, ReturnHandlerSS.str().c_str(), TypeToken->Delimiter));
     TypeToken->Delimiter = "\n";
 
     String Prologue = PrologueSS.str();
@@ -3516,8 +3520,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessShaderAttributes(TokenList
         VERIFY_PARSER_STATE(TmpToken, TmpToken != m_Tokens.end() && TmpToken->Type == TokenType::Identifier, "Identifier expected");
         // [domain("quad")]
         //  ^
-        auto& Attrib = TmpToken->Literal;
-        StrToLowerInPlace(Attrib);
+        String Attrib = StrToLower(TmpToken->Literal.str());
 
         ++TmpToken;
         VERIFY_PARSER_STATE(TmpToken, TmpToken != m_Tokens.end(), "Unexpected end of file");
@@ -3530,8 +3533,8 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessShaderAttributes(TokenList
                 TmpToken, m_Tokens.end(), TokenType::OpenParen, TokenType::ClosingParen,
                 [&](TokenListType::iterator& tkn, int) //
                 {
-                    AttribValue.append(tkn->Delimiter);
-                    AttribValue.append(tkn->Literal);
+                    AttribValue.append(tkn->Delimiter.begin(), tkn->Delimiter.end());
+                    AttribValue.append(tkn->Literal.begin(), tkn->Literal.end());
                     ++tkn;
                 } //
             );
@@ -3771,7 +3774,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessHullShaderArguments(TokenL
     Globals  = GlobalsSS.str() + InterfaceVarsInSS.str() + InterfaceVarsOutSS.str();
 }
 
-void ParseAttributesInComment(const String& Comment, std::unordered_map<HashMapStringKey, String>& Attributes)
+void ParseAttributesInComment(const HLSL2GLSLTokenString& Comment, std::unordered_map<HashMapStringKey, String>& Attributes)
 {
     auto Pos = Comment.begin();
     //    /* partitioning = fractional_even, outputtopology = triangle_cw */
@@ -4070,7 +4073,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessReturnStatements(TokenList
     if (IsVoid)
     {
         // Insert return handler before the closing brace
-        m_Tokens.insert(Token, TokenInfo(TokenType::TextBlock, MacroName, Token->Delimiter.c_str()));
+        m_Tokens.insert(Token, TokenInfo(TokenType::TextBlock, MacroName, Token->Delimiter));
         Token->Delimiter = "\n";
         // void main ()
         // {
@@ -4189,7 +4192,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessShaderDeclaration(TokenLis
     // TypeToken
 
     // Insert global variables & return handler before the function
-    m_Tokens.insert(TypeToken, TokenInfo(TokenType::TextBlock, GlobalVariables.c_str(), TypeToken->Delimiter.c_str()));
+    m_Tokens.insert(TypeToken, TokenInfo(TokenType::TextBlock, GlobalVariables.c_str(), TypeToken->Delimiter));
     m_Tokens.insert(TypeToken, TokenInfo(TokenType::TextBlock, ReturnHandlerSS.str().c_str(), "\n"));
     TypeToken->Delimiter = "\n";
     auto BodyStartToken  = ArgsListEndToken;
@@ -4374,7 +4377,8 @@ void HLSL2GLSLConverterImpl::ConversionStream::RemoveSpecialShaderAttributes()
                 return;
             // [numthreads(16, 16, 1)]
             //  ^
-            if (m_Converter.m_SpecialShaderAttributes.find(Token->Literal.c_str()) != m_Converter.m_SpecialShaderAttributes.end())
+            m_NameBuffer.assign(Token->Literal.begin(), Token->Literal.end());
+            if (m_Converter.m_SpecialShaderAttributes.find(m_NameBuffer.c_str()) != m_Converter.m_SpecialShaderAttributes.end())
             {
                 while (Token != m_Tokens.end() && Token->Type != TokenType::ClosingSquareBracket)
                     ++Token;
@@ -4412,8 +4416,8 @@ String HLSL2GLSLConverterImpl::ConversionStream::BuildGLSLSource()
             continue;
         }
 
-        Output.append(Token.Delimiter);
-        Output.append(Token.Literal);
+        Output.append(Token.Delimiter.begin(), Token.Delimiter.end());
+        Output.append(Token.Literal.begin(), Token.Literal.end());
     }
     return Output;
 }
@@ -4452,11 +4456,11 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
         NumSymbols = pFileData->GetSize();
     }
 
-    String Source(HLSLSource, NumSymbols);
+    m_Source.assign(HLSLSource, NumSymbols);
 
-    InsertIncludes(Source, pInputStreamFactory);
+    InsertIncludes(m_Source, pInputStreamFactory);
 
-    m_Tokens = m_Converter.m_HLSLTokenizer.Tokenize(Source);
+    m_SourceTokens = m_Converter.m_HLSLTokenizer.TokenizeView(m_Source.c_str(), m_Source.length());
 }
 
 
@@ -4541,21 +4545,51 @@ void HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
     }
 }
 
-String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
-                                                         SHADER_TYPE ShaderType,
-                                                         bool        IncludeDefintions,
-                                                         const char* SamplerSuffix,
-                                                         bool        UseInOutLocationQualifiers,
-                                                         bool        UseRowMajorMatrices)
+void HLSL2GLSLConverterImpl::ConversionStream::ProcessGlobalScope(bool UseRowMajorMatrices)
 {
-    m_bUseInOutLocationQualifiers = UseInOutLocationQualifiers;
-    m_bUseRowMajorMatrices        = UseRowMajorMatrices;
-    TokenListType TokensCopy(m_bPreserveTokens ? m_Tokens : TokenListType());
+    m_StructDefinitions.clear();
+    m_PreprocessorDefinitions.clear();
 
-    Uint32 ShaderStorageBlockBinding = 0;
-    Uint32 ImageBinding              = 0;
+    if (m_GlobalScope.IsValid && m_GlobalScope.UseRowMajorMatrices == UseRowMajorMatrices)
+    {
+        m_Tokens = m_GlobalScope.Tokens;
 
-    std::unordered_map<String, bool> SamplersHash;
+        // Restore struct and macro definitions that reference the tokens
+        auto   StructNamePos = m_GlobalScope.StructNamePositions.begin();
+        auto   MacroDefPos   = m_GlobalScope.MacroDefinitionPositions.begin();
+        size_t Pos           = 0;
+        for (auto Token = m_Tokens.begin(); Token != m_Tokens.end(); ++Token, ++Pos)
+        {
+            if (StructNamePos != m_GlobalScope.StructNamePositions.end() && *StructNamePos == Pos)
+            {
+                m_StructDefinitions.emplace(Token->Literal.c_str(), Token);
+                ++StructNamePos;
+            }
+            if (MacroDefPos != m_GlobalScope.MacroDefinitionPositions.end() && *MacroDefPos == Pos)
+            {
+                auto MacroNameToken = Token;
+                ++MacroNameToken;
+                VERIFY_EXPR(MacroNameToken != m_Tokens.end());
+                m_PreprocessorDefinitions.emplace(HashMapStringKey{MacroNameToken->Literal.str()}, Token);
+                ++MacroDefPos;
+            }
+        }
+        VERIFY_EXPR(StructNamePos == m_GlobalScope.StructNamePositions.end() && MacroDefPos == m_GlobalScope.MacroDefinitionPositions.end());
+        m_bUseRowMajorMatrices = UseRowMajorMatrices;
+        return;
+    }
+
+    m_bUseRowMajorMatrices = UseRowMajorMatrices;
+
+    m_Tokens = TokenListType{m_SourceTokens};
+    if (!m_bPreserveTokens)
+    {
+        // The token array is no longer needed. Note that the source must be kept
+        // as the tokens reference it.
+        m_SourceTokens = {};
+    }
+
+    Uint32 ShaderStorageBlockBinding = 0;
 
     auto Token = m_Tokens.begin();
     // Process constant buffers, fix floating point constants,
@@ -4608,6 +4642,53 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
 
     ParseGlobalPreprocessorDefines();
 
+    if (m_bPreserveTokens)
+    {
+        m_GlobalScope.Tokens = m_Tokens;
+        m_GlobalScope.StructNamePositions.clear();
+        m_GlobalScope.MacroDefinitionPositions.clear();
+
+        std::unordered_set<const TokenInfo*> StructNameTokens;
+        for (const auto& it : m_StructDefinitions)
+            StructNameTokens.emplace(&*it.second);
+        std::unordered_set<const TokenInfo*> MacroDefTokens;
+        for (const auto& it : m_PreprocessorDefinitions)
+            MacroDefTokens.emplace(&*it.second);
+
+        size_t Pos = 0;
+        for (const TokenInfo& Tkn : m_Tokens)
+        {
+            if (StructNameTokens.find(&Tkn) != StructNameTokens.end())
+                m_GlobalScope.StructNamePositions.push_back(Pos);
+            if (MacroDefTokens.find(&Tkn) != MacroDefTokens.end())
+                m_GlobalScope.MacroDefinitionPositions.push_back(Pos);
+            ++Pos;
+        }
+        m_GlobalScope.UseRowMajorMatrices = UseRowMajorMatrices;
+        m_GlobalScope.IsValid             = true;
+    }
+}
+
+String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
+                                                         SHADER_TYPE ShaderType,
+                                                         bool        IncludeDefintions,
+                                                         const char* SamplerSuffix,
+                                                         bool        UseInOutLocationQualifiers,
+                                                         bool        UseRowMajorMatrices)
+{
+    m_bUseInOutLocationQualifiers = UseInOutLocationQualifiers;
+
+    // Objects may be left from the previous conversion that failed
+    m_Objects.clear();
+
+    ProcessGlobalScope(UseRowMajorMatrices);
+
+    Uint32 ImageBinding = 0;
+
+    std::unordered_map<String, bool> SamplersHash;
+
+    auto Token = m_Tokens.begin();
+
     auto ShaderEntryPointToken = m_Tokens.end();
     // Process textures and search for the shader entry point.
     // GLSL does not allow local variables of sampler type, so the
@@ -4792,7 +4873,7 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
 
     if (m_bPreserveTokens)
     {
-        m_Tokens.swap(TokensCopy);
+        m_Tokens.clear();
         m_StructDefinitions.clear();
         m_PreprocessorDefinitions.clear();
         m_Objects.clear();
@@ -28,8 +28,14 @@
 #pragma once
 
 #include <vector>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <unordered_map>
+
 #include "Shader.h"
 #include "DataBlob.h"
+#include "RefCntAutoPtr.hpp"
 
 namespace Diligent
 {
@@ -53,6 +59,80 @@ enum class SpirvVersion
 void InitializeGlslang();
 void FinalizeGlslang();
 
+/// Shader compilation session.
+
+/// A compile session may be shared by multiple threads that compile a batch of shaders.
+/// The session caches the contents of the shader include files, so that every file is
+/// read from the input stream factory only once for the whole batch.
+///
+/// \note  The session does not track modifications of the include files. An application
+///        that reloads shaders should either use a new session or call ClearIncludeCache().
+class CompileSession
+{
+public:
+    CompileSession() = default;
+
+    // clang-format off
+    CompileSession           (const CompileSession&) = delete;
+    CompileSession           (CompileSession&&)      = delete;
+    CompileSession& operator=(const CompileSession&) = delete;
+    CompileSession& operator=(CompileSession&&)      = delete;
+    // clang-format on
+
+    /// Returns the contents of the include file, reading it through the stream
+    /// factory if the file has not been loaded by this session yet.
+
+    /// \param [in] pStreamFactory - Shader source stream factory.
+    /// \param [in] Name           - Include file name.
+    /// \return     Data blob with the file contents, or null if the file could not be opened.
+    ///
+    /// \remarks    This method is thread-safe.
+    RefCntAutoPtr<IDataBlob> GetIncludeFile(IShaderSourceInputStreamFactory* pStreamFactory, const char* Name);
+
+    /// Releases all cached include files.
+    void ClearIncludeCache();
+
+    struct Statistics
+    {
+        /// The number of include files read through the stream factory.
+        Uint32 NumIncludeFileReads = 0;
+
+        /// The number of include requests served from the cache.
+        Uint32 NumIncludeCacheHits = 0;
+    };
+    Statistics GetStatistics() const;
+
+private:
+    struct IncludeFileKey
+    {
+        const IShaderSourceInputStreamFactory* pStreamFactory = nullptr;
+        std::string                            Name;
+
+        bool operator==(const IncludeFileKey& rhs) const
+        {
+            return pStreamFactory == rhs.pStreamFactory && Name == rhs.Name;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const IncludeFileKey& Key) const;
+        };
+    };
+
+    struct IncludeFileData
+    {
+        // Keep the factory alive so that its address can't be reused by another factory.
+        RefCntAutoPtr<IShaderSourceInputStreamFactory> pStreamFactory;
+        RefCntAutoPtr<IDataBlob>                       pData;
+    };
+
+    std::mutex                                                                  m_IncludeCacheMtx;
+    std::unordered_map<IncludeFileKey, IncludeFileData, IncludeFileKey::Hasher> m_IncludeCache;
+
+    std::atomic<Uint32> m_NumIncludeFileReads{0};
+    std::atomic<Uint32> m_NumIncludeCacheHits{0};
+};
+
 struct GLSLtoSPIRVAttribs
 {
     SHADER_TYPE                      ShaderType    = SHADER_TYPE_UNKNOWN;
@@ -64,6 +144,9 @@ struct GLSLtoSPIRVAttribs
     IDataBlob**                      ppCompilerOutput           = nullptr;
     bool                             AssignBindings             = true;
     bool                             UseRowMajorMatrices        = false;
+
+    /// Optional compile session that caches include files.
+    CompileSession* pSession = nullptr;
 };
 
 std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs);
@@ -71,7 +154,8 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs);
 std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       SpirvVersion            Version,
                                       const char*             ExtraDefinitions,
-                                      IDataBlob**             ppCompilerOutput);
+                                      IDataBlob**             ppCompilerOutput,
+                                      CompileSession*         pSession = nullptr);
 
 } // namespace GLSLangUtils
 
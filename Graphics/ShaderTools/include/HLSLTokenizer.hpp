@@ -28,6 +28,7 @@
 
 #include <unordered_map>
 #include <list>
+#include <vector>
 
 #include "ParsingTools.hpp"
 #include "HLSLKeywords.h"
@@ -74,6 +75,110 @@ enum class HLSLTokenType
 };
 // clang-format on
 
+inline bool IsHLSLBuiltInType(HLSLTokenType Type)
+{
+    static_assert(static_cast<int>(HLSLTokenType::kw_bool) == 1 && static_cast<int>(HLSLTokenType::kw_void) == 191,
+                  "If you updated built-in types, double check that all types are defined between bool and void");
+    return Type >= HLSLTokenType::kw_bool && Type <= HLSLTokenType::kw_void;
+}
+
+inline bool IsHLSLFlowControl(HLSLTokenType Type)
+{
+    static_assert(static_cast<int>(HLSLTokenType::kw_break) == 192 && static_cast<int>(HLSLTokenType::kw_while) == 202,
+                  "If you updated control flow keywords, double check that all keywords are defined between break and while");
+    return Type >= HLSLTokenType::kw_break && Type <= HLSLTokenType::kw_while;
+}
+
+/// Lightweight token that references the delimiter and the literal in the source buffer
+/// instead of owning copies of them. The source buffer must outlive the token.
+struct HLSLTokenView
+{
+    using TokenType = HLSLTokenType;
+
+    TokenType   Type         = TokenType::Undefined;
+    const char* DelimStart   = nullptr;
+    const char* DelimEnd     = nullptr;
+    const char* LiteralStart = nullptr;
+    const char* LiteralEnd   = nullptr;
+    size_t      Idx          = ~size_t{0};
+
+    HLSLTokenView() {}
+
+    HLSLTokenView(TokenType   _Type,
+                  const char* _DelimStart,
+                  const char* _DelimEnd,
+                  const char* _LiteralStart,
+                  const char* _LiteralEnd,
+                  size_t      _Idx) :
+        Type{_Type},
+        DelimStart{_DelimStart},
+        DelimEnd{_DelimEnd},
+        LiteralStart{_LiteralStart},
+        LiteralEnd{_LiteralEnd},
+        Idx{_Idx}
+    {}
+
+    void SetType(TokenType _Type)
+    {
+        Type = _Type;
+    }
+
+    TokenType GetType() const { return Type; }
+
+    bool CompareLiteral(const char* Str) const
+    {
+        const size_t Len = GetLiteralLen();
+        if (Len == 0)
+            return *Str == '\0';
+        return strncmp(LiteralStart, Str, Len) == 0 && Str[Len] == '\0';
+    }
+
+    bool CompareLiteral(const char* Start, const char* End) const
+    {
+        const size_t Len = End - Start;
+        return GetLiteralLen() == Len && (Len == 0 || strncmp(LiteralStart, Start, Len) == 0);
+    }
+
+    void ExtendLiteral(const char* Start, const char* End)
+    {
+        // Literals are only extended by the characters that immediately follow them
+        VERIFY(Start == LiteralEnd, "Token literal can only be extended by adjacent characters");
+        (void)Start;
+        LiteralEnd = End;
+    }
+
+    bool IsBuiltInType() const { return IsHLSLBuiltInType(Type); }
+    bool IsFlowControl() const { return IsHLSLFlowControl(Type); }
+
+    size_t GetDelimiterLen() const
+    {
+        return DelimEnd - DelimStart;
+    }
+    size_t GetLiteralLen() const
+    {
+        return LiteralEnd - LiteralStart;
+    }
+    const std::pair<const char*, const char*> GetDelimiter() const
+    {
+        return {DelimStart, DelimEnd};
+    }
+    const std::pair<const char*, const char*> GetLiteral() const
+    {
+        return {LiteralStart, LiteralEnd};
+    }
+
+    std::ostream& OutputDelimiter(std::ostream& os) const
+    {
+        os.write(DelimStart, GetDelimiterLen());
+        return os;
+    }
+    std::ostream& OutputLiteral(std::ostream& os) const
+    {
+        os.write(LiteralStart, GetLiteralLen());
+        return os;
+    }
+};
+
 struct HLSLTokenInfo
 {
     using TokenType = HLSLTokenType;
@@ -95,6 +200,13 @@ struct HLSLTokenInfo
         Idx{_Idx}
     {}
 
+    explicit HLSLTokenInfo(const HLSLTokenView& View) :
+        Type{View.Type},
+        Literal{View.LiteralStart, View.LiteralEnd},
+        Delimiter{View.DelimStart, View.DelimEnd},
+        Idx{View.Idx}
+    {}
+
     void SetType(TokenType _Type)
     {
         Type = _Type;
@@ -122,19 +234,8 @@ struct HLSLTokenInfo
         Literal.append(Start, End);
     }
 
-    bool IsBuiltInType() const
-    {
-        static_assert(static_cast<int>(TokenType::kw_bool) == 1 && static_cast<int>(TokenType::kw_void) == 191,
-                      "If you updated built-in types, double check that all types are defined between bool and void");
-        return Type >= TokenType::kw_bool && Type <= TokenType::kw_void;
-    }
-
-    bool IsFlowControl() const
-    {
-        static_assert(static_cast<int>(TokenType::kw_break) == 192 && static_cast<int>(TokenType::kw_while) == 202,
-                      "If you updated control flow keywords, double check that all keywords are defined between break and while");
-        return Type >= TokenType::kw_break && Type <= TokenType::kw_while;
-    }
+    bool IsBuiltInType() const { return IsHLSLBuiltInType(Type); }
+    bool IsFlowControl() const { return IsHLSLFlowControl(Type); }
 
     static HLSLTokenInfo Create(TokenType                          _Type,
                                 const std::string::const_iterator& DelimStart,
@@ -189,10 +290,31 @@ public:
     using TokenListType = std::list<HLSLTokenInfo>;
     TokenListType Tokenize(const String& Source) const;
 
+    /// Tokenizes the source into a contiguous array of tokens that reference
+    /// the source buffer. No per-token memory allocations are performed.
+
+    /// \param [in] Source    - Source string. The string must stay alive and
+    ///                         unmodified as long as the tokens are in use.
+    /// \param [in] SourceLen - Source string length.
+    /// \return                Token array. Similar to Tokenize(), the first token is
+    ///                         an empty token that facilitates backwards searching.
+    ///                         In case of a parsing error, an empty array is returned.
+    using TokenArrayType = std::vector<HLSLTokenView>;
+    TokenArrayType TokenizeView(const char* Source, size_t SourceLen) const;
+
+    /// Creates a mutable token list from the token array.
+    static TokenListType MakeTokenList(const TokenArrayType& Tokens);
+
 private:
+    HLSLTokenType GetTokenType(const char* Start, const char* End) const;
+
     // HLSL keyword -> token info hash map
     // Example: "Texture2D" -> TokenInfo{TokenType::Texture2D, "Texture2D"}
     std::unordered_map<HashMapStringKey, HLSLTokenInfo> m_Keywords;
+
+    // The length of the longest keyword. Identifiers that are longer than this
+    // can't be keywords and are not looked up in the hash map.
+    size_t m_MaxKeywordLen = 0;
 };
 
 } // namespace Parsing
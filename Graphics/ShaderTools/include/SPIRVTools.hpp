@@ -27,8 +27,12 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <atomic>
+#include <string>
 
 #include "FlagEnum.h"
+#include "LRUCache.hpp"
 
 #include "spirv-tools/libspirv.h"
 
@@ -45,8 +49,116 @@ enum SPIRV_OPTIMIZATION_FLAGS : Uint32
 DEFINE_FLAG_ENUM_OPERATORS(SPIRV_OPTIMIZATION_FLAGS);
 
 
+class SPIRVOptimizationCache;
+
+/// Runs the SPIRV optimizer passes on the source SPIRV.
+
+/// \param [in] SrcSPIRV  - Source SPIRV.
+/// \param [in] TargetEnv - Target environment. If SPV_ENV_MAX, the environment is
+///                         derived from the SPIRV version.
+/// \param [in] Passes    - Optimization passes to run.
+/// \param [in] pCache    - Optional optimization cache. If not null, the optimized module is
+///                         looked up in the cache first.
+/// \return     Optimized SPIRV, or an empty vector if the optimization failed.
 std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV,
                                     spv_target_env               TargetEnv,
-                                    SPIRV_OPTIMIZATION_FLAGS     Passes);
+                                    SPIRV_OPTIMIZATION_FLAGS     Passes,
+                                    SPIRVOptimizationCache*      pCache = nullptr);
+
+
+/// Content-addressed cache of optimized SPIRV modules.
+///
+/// Optimized modules are keyed by the hash of the source SPIRV, the target environment and
+/// the optimization passes. The cache has an in-memory tier and an optional on-disk tier.
+/// The source SPIRV is kept with every cached module and is compared on lookup, so hash
+/// collisions never result in a wrong module.
+///
+/// All methods are thread-safe.
+class SPIRVOptimizationCache
+{
+public:
+    struct CreateInfo
+    {
+        /// Maximum size of the in-memory tier, in bytes. Zero disables the in-memory tier.
+        size_t MaxMemorySize = size_t{64} << 20;
+
+        /// Optional directory of the on-disk tier. If null or empty, the on-disk tier is disabled.
+        /// The directory is created if it does not exist.
+        const char* CacheDirectory = nullptr;
+    };
+
+    explicit SPIRVOptimizationCache(const CreateInfo& CI);
+
+    // clang-format off
+    SPIRVOptimizationCache           (const SPIRVOptimizationCache&) = delete;
+    SPIRVOptimizationCache           (SPIRVOptimizationCache&&)      = delete;
+    SPIRVOptimizationCache& operator=(const SPIRVOptimizationCache&) = delete;
+    SPIRVOptimizationCache& operator=(SPIRVOptimizationCache&&)      = delete;
+    // clang-format on
+
+    /// Returns the optimized module from the cache, or runs the optimizer and adds the result
+    /// to the cache. See OptimizeSPIRV() for parameter description.
+    std::vector<uint32_t> Optimize(const std::vector<uint32_t>& SrcSPIRV,
+                                   spv_target_env               TargetEnv,
+                                   SPIRV_OPTIMIZATION_FLAGS     Passes);
+
+    /// Releases all modules in the in-memory tier. The on-disk tier is not affected.
+    void ClearMemoryCache();
+
+    struct Statistics
+    {
+        /// The number of modules found in the in-memory tier.
+        Uint32 NumMemoryHits = 0;
+
+        /// The number of modules loaded from the on-disk tier.
+        Uint32 NumDiskHits = 0;
+
+        /// The number of times the optimizer was run.
+        Uint32 NumMisses = 0;
+    };
+    Statistics GetStatistics() const;
+
+private:
+    struct ModuleKey
+    {
+        size_t                   Hash      = 0;
+        size_t                   SrcSize   = 0;
+        spv_target_env           TargetEnv = SPV_ENV_MAX;
+        SPIRV_OPTIMIZATION_FLAGS Passes    = SPIRV_OPTIMIZATION_FLAG_NONE;
+
+        bool operator==(const ModuleKey& rhs) const
+        {
+            return Hash == rhs.Hash && SrcSize == rhs.SrcSize && TargetEnv == rhs.TargetEnv && Passes == rhs.Passes;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const ModuleKey& Key) const
+            {
+                return Key.Hash;
+            }
+        };
+    };
+
+    struct ModuleData
+    {
+        std::vector<uint32_t> SrcSPIRV;
+        std::vector<uint32_t> OptimizedSPIRV;
+    };
+    using ModuleDataPtr = std::shared_ptr<const ModuleData>;
+
+    std::string   GetDiskCachePath(const ModuleKey& Key) const;
+    ModuleDataPtr LoadFromDisk(const ModuleKey& Key, const std::vector<uint32_t>& SrcSPIRV) const;
+    void          SaveToDisk(const ModuleKey& Key, const ModuleData& Data) const;
+
+private:
+    const std::string m_CacheDirectory;
+
+    LRUCache<ModuleKey, ModuleDataPtr, ModuleKey::Hasher> m_MemoryCache;
+
+    std::atomic<Uint32> m_NumMemoryHits{0};
+    std::atomic<Uint32> m_NumDiskHits{0};
+    std::atomic<Uint32> m_NumMisses{0};
+};
 
 } // namespace Diligent
@@ -30,6 +30,9 @@
 #include <functional>
 #include <string>
 #include <memory>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "GraphicsTypes.h"
 #include "Shader.h"
@@ -140,6 +143,94 @@ bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(
 ///  Unrolls all include files into a single file
 std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(false);
 
+
+/// Shader include preprocessor.
+///
+/// The preprocessor caches the contents of every file it loads together with the
+/// locations of the include directives in this file, so that every file is read and
+/// scanned only once for all shaders processed by the same preprocessor instance.
+///
+/// \note  The preprocessor is not thread-safe and does not track file modifications.
+///        Call Clear() or use a new instance to reload the files.
+class ShaderIncludePreprocessor
+{
+public:
+    /// Same as ProcessShaderIncludes(), but uses the file cache.
+    bool ProcessIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler) noexcept;
+
+    /// Same as UnrollShaderIncludes(), but uses the file cache.
+
+    /// \param [in] ShaderCI        - Shader create info.
+    /// \param [in] EmitLineMarkers - Whether to emit #line directives at the start and end of every
+    ///                               unrolled include file so that compiler messages refer to the
+    ///                               original file names and line numbers.
+    ///
+    /// \note  GLSL does not support file names in #line directives, so line markers should only
+    ///        be used with HLSL source code.
+    std::string UnrollIncludes(const ShaderCreateInfo& ShaderCI, bool EmitLineMarkers = false) noexcept(false);
+
+    /// Releases all cached files.
+    void Clear();
+
+private:
+    struct IncludeDirective
+    {
+        std::string Path;
+
+        // Offsets of the directive start and end in the source
+        size_t Start = 0;
+        size_t End   = 0;
+
+        // One-based number of the line that contains the directive
+        Uint32 Line = 0;
+    };
+
+    struct FileInfo
+    {
+        ShaderSourceFileData          SourceData;
+        std::vector<IncludeDirective> Includes;
+
+        RefCntAutoPtr<IShaderSourceInputStreamFactory> pStreamFactory;
+    };
+
+    struct FileKey
+    {
+        const IShaderSourceInputStreamFactory* pStreamFactory = nullptr;
+        std::string                            Path;
+
+        bool operator==(const FileKey& rhs) const
+        {
+            return pStreamFactory == rhs.pStreamFactory && Path == rhs.Path;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const FileKey& Key) const;
+        };
+    };
+
+    static void FindIncludeDirectives(const ShaderCreateInfo& ShaderCI, FileInfo& Info) noexcept(false);
+
+    // Returns the cached file info. If ShaderCI.Source is not null, the source is not cached and
+    // the info is written to SourceInfo.
+    const FileInfo& GetFileInfo(const ShaderCreateInfo& ShaderCI, FileInfo& SourceInfo) noexcept(false);
+
+    template <typename IncludeHandlerType>
+    void ProcessIncludesImpl(const ShaderCreateInfo&          ShaderCI,
+                             std::unordered_set<std::string>& Includes,
+                             IncludeHandlerType&&             IncludeHandler) noexcept(false);
+
+    template <typename WriterType>
+    void UnrollIncludesImpl(const ShaderCreateInfo&          ShaderCI,
+                            const FileInfo&                  Info,
+                            std::unordered_set<std::string>& AllIncludes,
+                            bool                             EmitLineMarkers,
+                            WriterType&&                     Writer) noexcept(false);
+
+private:
+    std::unordered_map<FileKey, FileInfo, FileKey::Hasher> m_Files;
+};
+
 std::string GetShaderCodeTypeName(SHADER_CODE_BASIC_TYPE     BasicType,
                                   SHADER_CODE_VARIABLE_CLASS Class,
                                   Uint32                     NumRows,
@@ -46,6 +46,7 @@
 #include "DebugUtilities.hpp"
 #include "DataBlobImpl.hpp"
 #include "RefCntAutoPtr.hpp"
+#include "HashUtils.hpp"
 #include "ShaderToolsCommon.hpp"
 #ifdef USE_SPIRV_TOOLS
 #    include "SPIRVTools.hpp"
@@ -229,6 +230,13 @@ TBuiltInResource InitResources()
     return Resources;
 }
 
+// Built-in resources are immutable, so a single instance is shared by all compilation threads.
+const TBuiltInResource& GetBuiltInResources()
+{
+    static const TBuiltInResource Resources = InitResources();
+    return Resources;
+}
+
 void LogCompilerError(const char* DebugOutputMessage,
                       const char* InfoLog,
                       const char* InfoDebugLog,
@@ -265,7 +273,7 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
 {
     Shader.setAutoMapBindings(true);
     Shader.setAutoMapLocations(true);
-    TBuiltInResource Resources = InitResources();
+    const TBuiltInResource& Resources = GetBuiltInResources();
 
     bool ParseResult = pIncluder != nullptr ?
         Shader.parse(&Resources, 100, shProfile, false, false, messages, *pIncluder) :
@@ -298,8 +306,10 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
 class IncluderImpl : public ::glslang::TShader::Includer
 {
 public:
-    IncluderImpl(IShaderSourceInputStreamFactory* pInputStreamFactory) :
-        m_pInputStreamFactory(pInputStreamFactory)
+    IncluderImpl(IShaderSourceInputStreamFactory* pInputStreamFactory,
+                 CompileSession*                  pSession) :
+        m_pInputStreamFactory{pInputStreamFactory},
+        m_pSession{pSession}
     {}
 
     // For the "system" or <>-style includes; search the "system" paths.
@@ -308,16 +318,12 @@ public:
                                          size_t /*inclusionDepth*/)
     {
         DEV_CHECK_ERR(m_pInputStreamFactory != nullptr, "The shader source contains #include directives, but no input stream factory was provided");
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pInputStreamFactory->CreateInputStream(headerName, &pSourceStream);
-        if (pSourceStream == nullptr)
-        {
-            LOG_ERROR("Failed to open shader include file '", headerName, "'. Check that the file exists");
+        RefCntAutoPtr<IDataBlob> pFileData = m_pSession != nullptr ?
+            m_pSession->GetIncludeFile(m_pInputStreamFactory, headerName) :
+            ReadIncludeFile(m_pInputStreamFactory, headerName);
+        if (pFileData == nullptr)
             return nullptr;
-        }
 
-        RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
-        pSourceStream->ReadBlob(pFileData);
         IncludeResult* pNewInclude =
             new IncludeResult{
                 headerName,
@@ -347,8 +353,24 @@ public:
         m_DataBlobs.erase(IncldRes);
     }
 
+    static RefCntAutoPtr<IDataBlob> ReadIncludeFile(IShaderSourceInputStreamFactory* pInputStreamFactory, const char* Name)
+    {
+        RefCntAutoPtr<IFileStream> pSourceStream;
+        pInputStreamFactory->CreateInputStream(Name, &pSourceStream);
+        if (pSourceStream == nullptr)
+        {
+            LOG_ERROR("Failed to open shader include file '", Name, "'. Check that the file exists");
+            return {};
+        }
+
+        RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
+        pSourceStream->ReadBlob(pFileData);
+        return RefCntAutoPtr<IDataBlob>{pFileData};
+    }
+
 private:
     IShaderSourceInputStreamFactory* const                       m_pInputStreamFactory;
+    CompileSession* const                                        m_pSession;
     std::unordered_set<std::unique_ptr<IncludeResult>>           m_IncludeRes;
     std::unordered_map<IncludeResult*, RefCntAutoPtr<IDataBlob>> m_DataBlobs;
 };
@@ -426,10 +448,59 @@ spv_target_env SpirvVersionToSpvTargetEnv(SpirvVersion Version)
 
 } // namespace
 
+size_t CompileSession::IncludeFileKey::Hasher::operator()(const IncludeFileKey& Key) const
+{
+    return ComputeHash(Key.pStreamFactory, Key.Name);
+}
+
+RefCntAutoPtr<IDataBlob> CompileSession::GetIncludeFile(IShaderSourceInputStreamFactory* pStreamFactory, const char* Name)
+{
+    VERIFY_EXPR(pStreamFactory != nullptr && Name != nullptr);
+
+    IncludeFileKey Key{pStreamFactory, Name};
+    {
+        std::lock_guard<std::mutex> Lock{m_IncludeCacheMtx};
+
+        auto it = m_IncludeCache.find(Key);
+        if (it != m_IncludeCache.end())
+        {
+            m_NumIncludeCacheHits.fetch_add(1);
+            return it->second.pData;
+        }
+    }
+
+    // Read the file outside of the lock. If another thread reads the same
+    // file concurrently, the first inserted copy is used.
+    RefCntAutoPtr<IDataBlob> pFileData = IncluderImpl::ReadIncludeFile(pStreamFactory, Name);
+    if (pFileData == nullptr)
+        return {};
+    m_NumIncludeFileReads.fetch_add(1);
+
+    std::lock_guard<std::mutex> Lock{m_IncludeCacheMtx};
+
+    auto it = m_IncludeCache.emplace(std::move(Key), IncludeFileData{RefCntAutoPtr<IShaderSourceInputStreamFactory>{pStreamFactory}, std::move(pFileData)}).first;
+    return it->second.pData;
+}
+
+void CompileSession::ClearIncludeCache()
+{
+    std::lock_guard<std::mutex> Lock{m_IncludeCacheMtx};
+    m_IncludeCache.clear();
+}
+
+CompileSession::Statistics CompileSession::GetStatistics() const
+{
+    Statistics Stats;
+    Stats.NumIncludeFileReads = m_NumIncludeFileReads.load();
+    Stats.NumIncludeCacheHits = m_NumIncludeCacheHits.load();
+    return Stats;
+}
+
 std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       SpirvVersion            Version,
                                       const char*             ExtraDefinitions,
-                                      IDataBlob**             ppCompilerOutput)
+                                      IDataBlob**             ppCompilerOutput,
+                                      CompileSession*         pSession)
 {
     EShLanguage        ShLang = ShaderTypeToShLanguage(ShaderCI.Desc.ShaderType);
     ::glslang::TShader Shader{ShLang};
@@ -478,7 +549,7 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     // Make the behavior consistent with DX:
     Shader.setDxPositionW(true);
 
-    IncluderImpl Includer{ShaderCI.pShaderSourceStreamFactory};
+    IncluderImpl Includer{ShaderCI.pShaderSourceStreamFactory, pSession};
 
     std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, SourceData.Source, SourceData.SourceLength, true, shProfile, ppCompilerOutput);
     if (SPIRV.empty())
@@ -527,7 +598,7 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
         AppendShaderMacros(Preamble, Attribs.Macros);
     Shader.setPreamble(Preamble.c_str());
 
-    IncluderImpl Includer{Attribs.pShaderSourceStreamFactory};
+    IncluderImpl Includer{Attribs.pShaderSourceStreamFactory, Attribs.pSession};
 
     std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, Attribs.ShaderSource, Attribs.SourceCodeLen, Attribs.AssignBindings, shProfile, Attribs.ppCompilerOutput);
     if (SPIRV.empty())
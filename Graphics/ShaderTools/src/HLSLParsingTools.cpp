@@ -34,8 +34,8 @@ namespace Diligent
 namespace Parsing
 {
 
-static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLTokenizer::TokenListType::const_iterator& Token,
-                                                                       HLSLTokenizer::TokenListType::const_iterator  End)
+static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLTokenizer::TokenArrayType::const_iterator& Token,
+                                                                       HLSLTokenizer::TokenArrayType::const_iterator  End)
 {
     // RWTexture2D<unorm  /*format=rg8*/ float4>  g_RWTex;
     // ^
@@ -43,11 +43,11 @@ static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLToken
     ++Token;
     // RWTexture2D<unorm  /*format=rg8*/ float4>  g_RWTex;
     //            ^
-    if (Token == End || Token->Literal != "<")
+    if (Token == End || !Token->CompareLiteral("<"))
         return {};
 
     TEXTURE_FORMAT Fmt = TEX_FORMAT_UNKNOWN;
-    while (Token != End && Token->Literal != ">")
+    while (Token != End && !Token->CompareLiteral(">"))
     {
         ++Token;
         if (Token != End)
@@ -58,7 +58,7 @@ static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLToken
             //                                   ^
             // RWTexture2D< unorm float4 /*format=rg8*/> g_RWTex;
             //                                         ^
-            std::string FormatStr = ExtractGLSLImageFormatFromComment(Token->Delimiter.begin(), Token->Delimiter.end());
+            std::string FormatStr = ExtractGLSLImageFormatFromComment(Token->DelimStart, Token->DelimEnd);
             if (!FormatStr.empty())
             {
                 Fmt = ParseGLSLImageFormat(FormatStr);
@@ -80,13 +80,13 @@ static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLToken
     if (Token->Type != HLSLTokenType::Identifier)
         return {};
 
-    return {Token->Literal, Fmt};
+    return {std::string{Token->LiteralStart, Token->LiteralEnd}, Fmt};
 }
 
 std::unordered_map<HashMapStringKey, TEXTURE_FORMAT> ExtractGLSLImageFormatsFromHLSL(const std::string& HLSLSource)
 {
-    HLSLTokenizer                      Tokenizer;
-    const HLSLTokenizer::TokenListType Tokens = Tokenizer.Tokenize(HLSLSource);
+    HLSLTokenizer                       Tokenizer;
+    const HLSLTokenizer::TokenArrayType Tokens = Tokenizer.TokenizeView(HLSLSource.c_str(), HLSLSource.length());
 
     std::unordered_map<HashMapStringKey, TEXTURE_FORMAT> ImageFormats;
 
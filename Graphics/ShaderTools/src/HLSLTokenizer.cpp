@@ -26,6 +26,8 @@
 
 #include "HLSLTokenizer.hpp"
 
+#include <algorithm>
+
 namespace Diligent
 {
 
@@ -38,6 +40,32 @@ HLSLTokenizer::HLSLTokenizer()
 #define DEFINE_KEYWORD(keyword) m_Keywords.insert(std::make_pair(#keyword, HLSLTokenInfo(HLSLTokenType::kw_##keyword, #keyword)));
     ITERATE_HLSL_KEYWORDS(DEFINE_KEYWORD)
 #undef DEFINE_KEYWORD
+
+    for (const auto& Keyword : m_Keywords)
+        m_MaxKeywordLen = std::max(m_MaxKeywordLen, Keyword.second.Literal.length());
+}
+
+HLSLTokenType HLSLTokenizer::GetTokenType(const char* Start, const char* End) const
+{
+    const size_t Len = End - Start;
+    if (Len > m_MaxKeywordLen)
+        return HLSLTokenType::Identifier;
+
+    // Copy the literal to a null-terminated buffer on the stack to avoid allocating
+    // a string for every identifier.
+    constexpr size_t MaxBufferLen = 64;
+    VERIFY(m_MaxKeywordLen < MaxBufferLen, "Keyword is too long");
+    char Buffer[MaxBufferLen];
+    memcpy(Buffer, Start, Len);
+    Buffer[Len] = '\0';
+
+    auto KeywordIt = m_Keywords.find(HashMapStringKey{Buffer});
+    if (KeywordIt != m_Keywords.end())
+    {
+        VERIFY(KeywordIt->second.Literal == Buffer, "Inconsistent literal");
+        return KeywordIt->second.Type;
+    }
+    return HLSLTokenType::Identifier;
 }
 
 HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
@@ -57,13 +85,40 @@ HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
             },
             [&](const std::string::const_iterator& Start, const std::string::const_iterator& End) //
             {
-                auto KeywordIt = m_Keywords.find(HashMapStringKey{std::string{Start, End}});
-                if (KeywordIt != m_Keywords.end())
-                {
-                    VERIFY(std::string(Start, End) == KeywordIt->second.Literal, "Inconsistent literal");
-                    return KeywordIt->second.Type;
-                }
-                return HLSLTokenType::Identifier;
+                return Start != End ? GetTokenType(&*Start, &*Start + (End - Start)) : HLSLTokenType::Identifier;
+            });
+    }
+    catch (...)
+    {
+        return {};
+    }
+}
+
+HLSLTokenizer::TokenArrayType HLSLTokenizer::TokenizeView(const char* Source, size_t SourceLen) const
+{
+    if (Source == nullptr)
+    {
+        VERIFY(SourceLen == 0, "Source is null, but its length is not zero");
+        Source    = "";
+        SourceLen = 0;
+    }
+
+    try
+    {
+        size_t TokenIdx = 0;
+        return Parsing::Tokenize<HLSLTokenView, TokenArrayType>(
+            Source, Source + SourceLen,
+            [&TokenIdx](HLSLTokenType Type,
+                        const char*   DelimStart,
+                        const char*   DelimEnd,
+                        const char*   LiteralStart,
+                        const char*   LiteralEnd) //
+            {
+                return HLSLTokenView{Type, DelimStart, DelimEnd, LiteralStart, LiteralEnd, TokenIdx++};
+            },
+            [&](const char* Start, const char* End) //
+            {
+                return GetTokenType(Start, End);
             });
     }
     catch (...)
@@ -72,6 +127,14 @@ HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
     }
 }
 
+HLSLTokenizer::TokenListType HLSLTokenizer::MakeTokenList(const TokenArrayType& Tokens)
+{
+    TokenListType TokenList;
+    for (const HLSLTokenView& Token : Tokens)
+        TokenList.emplace_back(Token);
+    return TokenList;
+}
+
 } // namespace Parsing
 
 } // namespace Diligent
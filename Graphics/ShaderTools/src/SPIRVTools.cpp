@@ -25,7 +25,13 @@
  */
 
 #include "SPIRVTools.hpp"
+
+#include <cstdio>
+
 #include "DebugUtilities.hpp"
+#include "HashUtils.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
 
 #include "spirv-tools/optimizer.hpp"
 
@@ -105,14 +111,10 @@ spv_target_env SpvTargetEnvFromSPIRV(const std::vector<uint32_t>& SPIRV)
     }
 }
 
-} // namespace
-
-std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+std::vector<uint32_t> OptimizeSPIRVImpl(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
 {
     VERIFY_EXPR(Passes != SPIRV_OPTIMIZATION_FLAG_NONE);
-
-    if (TargetEnv == SPV_ENV_MAX)
-        TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
+    VERIFY_EXPR(TargetEnv != SPV_ENV_MAX);
 
     spvtools::Optimizer SpirvOptimizer(TargetEnv);
     SpirvOptimizer.SetMessageConsumer(SpvOptimizerMessageConsumer);
@@ -153,4 +155,192 @@ std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_t
     return OptimizedSPIRV;
 }
 
+} // namespace
+
+std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV,
+                                    spv_target_env               TargetEnv,
+                                    SPIRV_OPTIMIZATION_FLAGS     Passes,
+                                    SPIRVOptimizationCache*      pCache)
+{
+    if (pCache != nullptr)
+        return pCache->Optimize(SrcSPIRV, TargetEnv, Passes);
+
+    if (TargetEnv == SPV_ENV_MAX)
+        TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
+
+    return OptimizeSPIRVImpl(SrcSPIRV, TargetEnv, Passes);
+}
+
+
+namespace
+{
+
+struct SPIRVCacheFileHeader
+{
+    static constexpr Uint32 ExpectedMagic   = 0x43565053; // 'SPVC'
+    static constexpr Uint32 ExpectedVersion = 1;
+
+    Uint32 Magic         = ExpectedMagic;
+    Uint32 Version       = ExpectedVersion;
+    Uint32 TargetEnv     = 0;
+    Uint32 Passes        = 0;
+    Uint32 SrcSize       = 0; // In words
+    Uint32 OptimizedSize = 0; // In words
+};
+
+} // namespace
+
+SPIRVOptimizationCache::SPIRVOptimizationCache(const CreateInfo& CI) :
+    m_CacheDirectory{CI.CacheDirectory != nullptr ? CI.CacheDirectory : ""},
+    m_MemoryCache{CI.MaxMemorySize}
+{
+    if (!m_CacheDirectory.empty() && !FileSystem::PathExists(m_CacheDirectory.c_str()))
+    {
+        if (!FileSystem::CreateDirectory(m_CacheDirectory.c_str()))
+            LOG_WARNING_MESSAGE("Failed to create SPIRV optimization cache directory '", m_CacheDirectory, "'. On-disk cache will not be used.");
+    }
+}
+
+std::string SPIRVOptimizationCache::GetDiskCachePath(const ModuleKey& Key) const
+{
+    char FileName[64];
+    std::snprintf(FileName, sizeof(FileName), "%016llx_%x_%x.spv",
+                  static_cast<unsigned long long>(Key.Hash), static_cast<Uint32>(Key.TargetEnv), static_cast<Uint32>(Key.Passes));
+
+    std::string Path = m_CacheDirectory;
+    if (!FileSystem::IsSlash(Path.back()))
+        Path.push_back(FileSystem::SlashSymbol);
+    Path.append(FileName);
+    return Path;
+}
+
+SPIRVOptimizationCache::ModuleDataPtr SPIRVOptimizationCache::LoadFromDisk(const ModuleKey& Key, const std::vector<uint32_t>& SrcSPIRV) const
+{
+    const std::string Path = GetDiskCachePath(Key);
+    if (!FileSystem::FileExists(Path.c_str()))
+        return {};
+
+    std::vector<Uint8> FileData;
+    if (!FileWrapper::ReadWholeFile(Path.c_str(), FileData, /*Silent = */ true))
+        return {};
+
+    SPIRVCacheFileHeader Header;
+    if (FileData.size() < sizeof(Header))
+        return {};
+    memcpy(&Header, FileData.data(), sizeof(Header));
+
+    if (Header.Magic != SPIRVCacheFileHeader::ExpectedMagic ||
+        Header.Version != SPIRVCacheFileHeader::ExpectedVersion ||
+        Header.TargetEnv != static_cast<Uint32>(Key.TargetEnv) ||
+        Header.Passes != static_cast<Uint32>(Key.Passes) ||
+        Header.SrcSize != SrcSPIRV.size() ||
+        FileData.size() != sizeof(Header) + (size_t{Header.SrcSize} + size_t{Header.OptimizedSize}) * sizeof(uint32_t))
+    {
+        return {};
+    }
+
+    const Uint8* pSrcData = FileData.data() + sizeof(Header);
+    if (memcmp(pSrcData, SrcSPIRV.data(), SrcSPIRV.size() * sizeof(uint32_t)) != 0)
+    {
+        // Hash collision
+        return {};
+    }
+
+    std::shared_ptr<ModuleData> pData = std::make_shared<ModuleData>();
+    pData->SrcSPIRV                   = SrcSPIRV;
+    pData->OptimizedSPIRV.resize(Header.OptimizedSize);
+    memcpy(pData->OptimizedSPIRV.data(), pSrcData + SrcSPIRV.size() * sizeof(uint32_t), pData->OptimizedSPIRV.size() * sizeof(uint32_t));
+
+    return pData;
+}
+
+void SPIRVOptimizationCache::SaveToDisk(const ModuleKey& Key, const ModuleData& Data) const
+{
+    SPIRVCacheFileHeader Header;
+    Header.TargetEnv     = static_cast<Uint32>(Key.TargetEnv);
+    Header.Passes        = static_cast<Uint32>(Key.Passes);
+    Header.SrcSize       = static_cast<Uint32>(Data.SrcSPIRV.size());
+    Header.OptimizedSize = static_cast<Uint32>(Data.OptimizedSPIRV.size());
+
+    std::vector<Uint8> FileData(sizeof(Header) + (Data.SrcSPIRV.size() + Data.OptimizedSPIRV.size()) * sizeof(uint32_t));
+    Uint8*             pDst = FileData.data();
+    memcpy(pDst, &Header, sizeof(Header));
+    pDst += sizeof(Header);
+    memcpy(pDst, Data.SrcSPIRV.data(), Data.SrcSPIRV.size() * sizeof(uint32_t));
+    pDst += Data.SrcSPIRV.size() * sizeof(uint32_t);
+    memcpy(pDst, Data.OptimizedSPIRV.data(), Data.OptimizedSPIRV.size() * sizeof(uint32_t));
+
+    const std::string Path = GetDiskCachePath(Key);
+    if (!FileWrapper::WriteFile(Path.c_str(), FileData.data(), FileData.size(), /*Silent = */ true))
+        LOG_WARNING_MESSAGE("Failed to write SPIRV optimization cache file '", Path, "'.");
+}
+
+std::vector<uint32_t> SPIRVOptimizationCache::Optimize(const std::vector<uint32_t>& SrcSPIRV,
+                                                       spv_target_env               TargetEnv,
+                                                       SPIRV_OPTIMIZATION_FLAGS     Passes)
+{
+    if (TargetEnv == SPV_ENV_MAX)
+        TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
+
+    ModuleKey Key;
+    Key.Hash      = ComputeHash(ComputeHashRaw(SrcSPIRV.data(), SrcSPIRV.size() * sizeof(uint32_t)), SrcSPIRV.size(), static_cast<Uint32>(TargetEnv), static_cast<Uint32>(Passes));
+    Key.SrcSize   = SrcSPIRV.size();
+    Key.TargetEnv = TargetEnv;
+    Key.Passes    = Passes;
+
+    bool          IsNewModule = false;
+    ModuleDataPtr pData       = m_MemoryCache.Get(
+        Key,
+        [&](ModuleDataPtr& Data, size_t& Size) {
+            IsNewModule = true;
+
+            if (!m_CacheDirectory.empty())
+                Data = LoadFromDisk(Key, SrcSPIRV);
+
+            if (Data)
+            {
+                m_NumDiskHits.fetch_add(1);
+            }
+            else
+            {
+                m_NumMisses.fetch_add(1);
+
+                std::shared_ptr<ModuleData> pNewData = std::make_shared<ModuleData>();
+                pNewData->SrcSPIRV                   = SrcSPIRV;
+                pNewData->OptimizedSPIRV             = OptimizeSPIRVImpl(SrcSPIRV, TargetEnv, Passes);
+                // Failed optimizations are only cached in memory
+                if (!m_CacheDirectory.empty() && !pNewData->OptimizedSPIRV.empty())
+                    SaveToDisk(Key, *pNewData);
+                Data = std::move(pNewData);
+            }
+
+            Size = (Data->SrcSPIRV.size() + Data->OptimizedSPIRV.size()) * sizeof(uint32_t);
+        });
+
+    if (!IsNewModule)
+        m_NumMemoryHits.fetch_add(1);
+
+    if (!pData || pData->SrcSPIRV != SrcSPIRV)
+    {
+        // Hash collision with another module in the cache
+        return OptimizeSPIRVImpl(SrcSPIRV, TargetEnv, Passes);
+    }
+
+    return pData->OptimizedSPIRV;
+}
+
+void SPIRVOptimizationCache::ClearMemoryCache()
+{
+    m_MemoryCache.Clear();
+}
+
+SPIRVOptimizationCache::Statistics SPIRVOptimizationCache::GetStatistics() const
+{
+    Statistics Stats;
+    Stats.NumMemoryHits = m_NumMemoryHits.load();
+    Stats.NumDiskHits   = m_NumDiskHits.load();
+    Stats.NumMisses     = m_NumMisses.load();
+    return Stats;
+}
+
 } // namespace Diligent
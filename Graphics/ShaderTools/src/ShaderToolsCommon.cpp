@@ -28,6 +28,7 @@
 #include "ShaderToolsCommon.hpp"
 
 #include <unordered_set>
+#include <algorithm>
 
 #include "BasicFileSystem.hpp"
 #include "DebugUtilities.hpp"
@@ -35,6 +36,7 @@
 #include "StringDataBlobImpl.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ParsingTools.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
@@ -422,41 +424,98 @@ static void ProcessIncludeErrorHandler(const ShaderCreateInfo& ShaderCI, const s
     throw std::pair<std::string, std::string>{std::move(FileInfo), Error};
 }
 
-template <typename IncludeHandlerType>
-void ProcessShaderIncludesImpl(const ShaderCreateInfo& ShaderCI, std::unordered_set<std::string>& Includes, IncludeHandlerType&& IncludeHandler) noexcept(false)
+size_t ShaderIncludePreprocessor::FileKey::Hasher::operator()(const FileKey& Key) const
 {
-    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+    return ComputeHash(Key.pStreamFactory, Key.Path);
+}
 
-    ShaderIncludePreprocessInfo FileInfo;
-    FileInfo.Source       = SourceData.Source;
-    FileInfo.SourceLength = SourceData.SourceLength;
-    FileInfo.FilePath     = ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : "";
+void ShaderIncludePreprocessor::FindIncludeDirectives(const ShaderCreateInfo& ShaderCI, FileInfo& Info) noexcept(false)
+{
+    const char* const Source         = Info.SourceData.Source;
+    size_t            LineCountStart = 0;
+    Uint32            Line           = 1;
 
     FindIncludes(
-        FileInfo.Source, FileInfo.SourceLength,
-        [&](const std::string& FilePath, size_t Start, size_t End) //
+        Source, Info.SourceData.SourceLength,
+        [&](const std::string& Path, size_t Start, size_t End) //
         {
-            if (!Includes.insert(FilePath).second)
-                return;
-
-            ShaderCreateInfo IncludeCI{ShaderCI};
-            IncludeCI.FilePath     = FilePath.c_str();
-            IncludeCI.Source       = nullptr;
-            IncludeCI.SourceLength = 0;
-            ProcessShaderIncludesImpl(IncludeCI, Includes, IncludeHandler);
+            Line += static_cast<Uint32>(std::count(Source + LineCountStart, Source + Start, '\n'));
+            LineCountStart = Start;
+
+            IncludeDirective Include;
+            Include.Path  = Path;
+            Include.Start = Start;
+            Include.End   = End;
+            Include.Line  = Line;
+            Info.Includes.emplace_back(std::move(Include));
         },
         std::bind(ProcessIncludeErrorHandler, ShaderCI, std::placeholders::_1));
+}
+
+const ShaderIncludePreprocessor::FileInfo& ShaderIncludePreprocessor::GetFileInfo(const ShaderCreateInfo& ShaderCI, FileInfo& SourceInfo) noexcept(false)
+{
+    if (ShaderCI.Source != nullptr)
+    {
+        // Source strings are not cached as they may change between calls
+        SourceInfo.SourceData = ReadShaderSourceFile(ShaderCI);
+        FindIncludeDirectives(ShaderCI, SourceInfo);
+        return SourceInfo;
+    }
+
+    FileKey Key{ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : ""};
+
+    auto it = m_Files.find(Key);
+    if (it != m_Files.end())
+        return it->second;
+
+    FileInfo NewInfo;
+    NewInfo.SourceData     = ReadShaderSourceFile(ShaderCI); // May throw
+    NewInfo.pStreamFactory = ShaderCI.pShaderSourceStreamFactory;
+    FindIncludeDirectives(ShaderCI, NewInfo); // May throw
+
+    // References to unordered_map elements remain valid after insertion of new elements
+    return m_Files.emplace(std::move(Key), std::move(NewInfo)).first->second;
+}
+
+static ShaderCreateInfo GetIncludeCreateInfo(const ShaderCreateInfo& ShaderCI, const std::string& Path)
+{
+    ShaderCreateInfo IncludeCI{ShaderCI};
+    IncludeCI.FilePath     = Path.c_str();
+    IncludeCI.Source       = nullptr;
+    IncludeCI.SourceLength = 0;
+    return IncludeCI;
+}
+
+template <typename IncludeHandlerType>
+void ShaderIncludePreprocessor::ProcessIncludesImpl(const ShaderCreateInfo& ShaderCI, std::unordered_set<std::string>& Includes, IncludeHandlerType&& IncludeHandler) noexcept(false)
+{
+    FileInfo        SourceInfo;
+    const FileInfo& Info = GetFileInfo(ShaderCI, SourceInfo);
+
+    for (const IncludeDirective& Include : Info.Includes)
+    {
+        if (!Includes.insert(Include.Path).second)
+            continue;
+
+        ProcessIncludesImpl(GetIncludeCreateInfo(ShaderCI, Include.Path), Includes, IncludeHandler);
+    }
 
     if (IncludeHandler)
-        IncludeHandler(FileInfo);
+    {
+        ShaderIncludePreprocessInfo ProcessInfo;
+        ProcessInfo.Source       = Info.SourceData.Source;
+        ProcessInfo.SourceLength = Info.SourceData.SourceLength;
+        ProcessInfo.FilePath     = ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : "";
+        IncludeHandler(ProcessInfo);
+    }
 }
 
-bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler) noexcept
+bool ShaderIncludePreprocessor::ProcessIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler) noexcept
 {
     try
     {
         std::unordered_set<std::string> Includes;
-        ProcessShaderIncludesImpl(ShaderCI, Includes, IncludeHandler);
+        ProcessIncludesImpl(ShaderCI, Includes, IncludeHandler);
         return true;
     }
     catch (const std::pair<std::string, std::string>& ErrInfo)
@@ -471,52 +530,97 @@ bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(
     }
 }
 
-static std::string UnrollShaderIncludesImpl(ShaderCreateInfo ShaderCI, std::unordered_set<std::string>& AllIncludes) noexcept(false)
+template <typename WriterType>
+static void WriteLineMarker(WriterType&& Writer, Uint32 Line, const char* FileName)
 {
-    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+    const std::string LineStr = std::to_string(Line);
 
-    ShaderCI.Source       = SourceData.Source;
-    ShaderCI.SourceLength = SourceData.SourceLength;
-    ShaderCI.FilePath     = nullptr;
+    // Start the directive from the new line as the preceding text may not end with one
+    Writer("\n#line ", 7);
+    Writer(LineStr.c_str(), LineStr.length());
+    if (FileName != nullptr)
+    {
+        Writer(" \"", 2);
+        Writer(FileName, strlen(FileName));
+        Writer("\"", 1);
+    }
+    Writer("\n", 1);
+}
 
-    std::stringstream Stream;
+template <typename WriterType>
+void ShaderIncludePreprocessor::UnrollIncludesImpl(const ShaderCreateInfo&          ShaderCI,
+                                                   const FileInfo&                  Info,
+                                                   std::unordered_set<std::string>& AllIncludes,
+                                                   bool                             EmitLineMarkers,
+                                                   WriterType&&                     Writer) noexcept(false)
+{
+    const char* const Source         = Info.SourceData.Source;
     size_t            PrevIncludeEnd = 0;
+    for (const IncludeDirective& Include : Info.Includes)
+    {
+        // Insert text before the include start
+        Writer(Source + PrevIncludeEnd, Include.Start - PrevIncludeEnd);
 
-    FindIncludes(
-        ShaderCI.Source, ShaderCI.SourceLength, [&](const std::string& Path, size_t IncludeStart, size_t IncludeEnd) {
-            // Insert text before the include start
-            Stream.write(ShaderCI.Source + PrevIncludeEnd, IncludeStart - PrevIncludeEnd);
+        if (AllIncludes.insert(Include.Path).second)
+        {
+            // Process the #include directive
+            const ShaderCreateInfo IncludeCI = GetIncludeCreateInfo(ShaderCI, Include.Path);
 
-            if (AllIncludes.insert(Path).second)
-            {
-                // Process the #include directive
-                ShaderCreateInfo IncludeCI{ShaderCI};
-                IncludeCI.Source            = nullptr;
-                IncludeCI.SourceLength      = 0;
-                IncludeCI.FilePath          = Path.c_str();
-                std::string UnrolledInclude = UnrollShaderIncludesImpl(IncludeCI, AllIncludes);
-                Stream << UnrolledInclude;
-            }
+            FileInfo        SourceInfo;
+            const FileInfo& IncludeInfo = GetFileInfo(IncludeCI, SourceInfo);
 
-            PrevIncludeEnd = IncludeEnd;
-        },
-        std::bind(ProcessIncludeErrorHandler, ShaderCI, std::placeholders::_1));
+            if (EmitLineMarkers)
+                WriteLineMarker(Writer, 1, IncludeCI.FilePath);
 
-    // Insert text after the last include
-    Stream.write(ShaderCI.Source + PrevIncludeEnd, ShaderCI.SourceLength - PrevIncludeEnd);
+            UnrollIncludesImpl(IncludeCI, IncludeInfo, AllIncludes, EmitLineMarkers, Writer);
 
-    return Stream.str();
+            // The text that follows the directive is on the directive's line
+            if (EmitLineMarkers)
+                WriteLineMarker(Writer, Include.Line, ShaderCI.FilePath);
+        }
+
+        PrevIncludeEnd = Include.End;
+    }
+
+    // Insert text after the last include
+    Writer(Source + PrevIncludeEnd, Info.SourceData.SourceLength - PrevIncludeEnd);
 }
 
-std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(false)
+std::string ShaderIncludePreprocessor::UnrollIncludes(const ShaderCreateInfo& ShaderCI, bool EmitLineMarkers) noexcept(false)
 {
-    std::unordered_set<std::string> Includes;
-    if (ShaderCI.FilePath != nullptr)
-        Includes.emplace(ShaderCI.FilePath);
-
     try
     {
-        return UnrollShaderIncludesImpl(ShaderCI, Includes);
+        FileInfo        SourceInfo;
+        const FileInfo& Info = GetFileInfo(ShaderCI, SourceInfo);
+
+        // Files are cached, so compute the unrolled size first to allocate the buffer only once
+        size_t UnrolledSize = 0;
+        {
+            std::unordered_set<std::string> AllIncludes;
+            if (ShaderCI.FilePath != nullptr)
+                AllIncludes.emplace(ShaderCI.FilePath);
+
+            UnrollIncludesImpl(ShaderCI, Info, AllIncludes, EmitLineMarkers,
+                               [&UnrolledSize](const char*, size_t Length) {
+                                   UnrolledSize += Length;
+                               });
+        }
+
+        std::string Unrolled;
+        Unrolled.reserve(UnrolledSize);
+        {
+            std::unordered_set<std::string> AllIncludes;
+            if (ShaderCI.FilePath != nullptr)
+                AllIncludes.emplace(ShaderCI.FilePath);
+
+            UnrollIncludesImpl(ShaderCI, Info, AllIncludes, EmitLineMarkers,
+                               [&Unrolled](const char* Str, size_t Length) {
+                                   Unrolled.append(Str, Length);
+                               });
+        }
+        VERIFY_EXPR(Unrolled.length() == UnrolledSize);
+
+        return Unrolled;
     }
     catch (const std::pair<std::string, std::string>& ErrInfo)
     {
@@ -526,6 +630,21 @@ std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(fals
     // Let other exceptions (e.g. 'Failed to load shader source file...') pass through
 }
 
+void ShaderIncludePreprocessor::Clear()
+{
+    m_Files.clear();
+}
+
+bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler) noexcept
+{
+    return ShaderIncludePreprocessor{}.ProcessIncludes(ShaderCI, std::move(IncludeHandler));
+}
+
+std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(false)
+{
+    return ShaderIncludePreprocessor{}.UnrollIncludes(ShaderCI);
+}
+
 std::string GetShaderCodeTypeName(SHADER_CODE_BASIC_TYPE     BasicType,
                                   SHADER_CODE_VARIABLE_CLASS Class,
                                   Uint32                     NumRows,
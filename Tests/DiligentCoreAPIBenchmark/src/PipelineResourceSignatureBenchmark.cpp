@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<IPipelineResourceSignature> CreateSetResourcesSignature(IRenderDevice* pDevice, Uint32 NumTextures, Uint32 ArraySize)
+{
+    std::vector<String>               Names;
+    std::vector<PipelineResourceDesc> Resources;
+    for (Uint32 i = 0; i < NumTextures; ++i)
+        Names.emplace_back("g_Texture" + std::to_string(i));
+    for (Uint32 i = 0; i < NumTextures; ++i)
+        Resources.emplace_back(SHADER_TYPE_PIXEL, Names[i].c_str(), ArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    Resources.emplace_back(SHADER_TYPE_VERTEX, "g_Buffer", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "SetResources benchmark";
+    PRSDesc.Resources    = Resources.data();
+    PRSDesc.NumResources = static_cast<Uint32>(Resources.size());
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    return pPRS;
+}
+
+// Compares CPU cost of binding resources one variable at a time with the cost of SetResources()
+TEST(PipelineResourceSignatureBenchmark, SetResources)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumTextures   = 16;
+    constexpr Uint32 ArraySize     = 4;
+    constexpr Uint32 NumIterations = 2000;
+
+    auto pPRS = CreateSetResourcesSignature(pDevice, NumTextures, ArraySize);
+    ASSERT_TRUE(pPRS);
+
+    auto pTexture = pEnv->CreateTexture("SetResources benchmark texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 16, 16);
+    ASSERT_TRUE(pTexture);
+    IDeviceObject* pSRV = pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    std::array<IDeviceObject*, ArraySize> ppSRVs;
+    ppSRVs.fill(pSRV);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB);
+    ASSERT_TRUE(pSRB);
+
+    std::vector<IShaderResourceVariable*>      Vars;
+    std::vector<ShaderResourceVariableBinding> Bindings;
+    for (Uint32 i = 0; i < NumTextures; ++i)
+    {
+        const Uint32 VarIndex = pPRS->GetSRBVariableIndex(SHADER_TYPE_PIXEL, ("g_Texture" + std::to_string(i)).c_str());
+        ASSERT_NE(VarIndex, ~0u);
+        Vars.push_back(pSRB->GetVariableByIndex(SHADER_TYPE_PIXEL, VarIndex));
+        Bindings.emplace_back(SHADER_TYPE_PIXEL, VarIndex, ppSRVs.data(), 0, ArraySize);
+    }
+
+    Timer T;
+
+    const double PerVariableStart = T.GetElapsedTime();
+    for (Uint32 iter = 0; iter < NumIterations; ++iter)
+    {
+        for (IShaderResourceVariable* pVar : Vars)
+            pVar->SetArray(ppSRVs.data(), 0, ArraySize, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+    }
+    const double PerVariableTime = T.GetElapsedTime() - PerVariableStart;
+
+    const double BatchedStart = T.GetElapsedTime();
+    for (Uint32 iter = 0; iter < NumIterations; ++iter)
+    {
+        pSRB->SetResources(Bindings.data(), static_cast<Uint32>(Bindings.size()), SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+    }
+    const double BatchedTime = T.GetElapsedTime() - BatchedStart;
+
+    for (IShaderResourceVariable* pVar : Vars)
+        EXPECT_EQ(pVar->Get(ArraySize - 1), pSRV);
+
+    const Uint32 NumResources = NumIterations * NumTextures * ArraySize;
+    LOG_INFO_MESSAGE("Bound ", NumResources, " resources (", NumTextures, " variables x ", ArraySize, " elements, ", NumIterations, " iterations):"
+                                                                                                                                    "\n  IShaderResourceVariable::SetArray:     ",
+                     PerVariableTime * 1000, " ms (", NumResources / std::max(PerVariableTime, 1e-6) / 1e6, " M resources/s)"
+                                                                                                            "\n  IShaderResourceBinding::SetResources: ",
+                     BatchedTime * 1000, " ms (", NumResources / std::max(BatchedTime, 1e-6) / 1e6, " M resources/s)");
+}
+
+// Measures CPU cost of committing an SRB with dynamic resources.
+// In Vulkan, run with --Features.DescriptorUpdateTemplate=Disabled to compare descriptor update templates with vkUpdateDescriptorSets.
+TEST(PipelineResourceSignatureBenchmark, CommitDynamicResources)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumTextures = 8;
+    constexpr Uint32 ArraySize   = 2;
+    constexpr Uint32 NumFrames   = 20;
+    constexpr Uint32 NumCommits  = 500;
+
+    std::vector<String>               Names;
+    std::vector<PipelineResourceDesc> Resources;
+    for (Uint32 i = 0; i < NumTextures; ++i)
+        Names.emplace_back("g_Texture" + std::to_string(i));
+    for (Uint32 i = 0; i < NumTextures; ++i)
+        Resources.emplace_back(SHADER_TYPE_PIXEL, Names[i].c_str(), ArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    Resources.emplace_back(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "g_Constants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Commit dynamic resources benchmark";
+    PRSDesc.Resources    = Resources.data();
+    PRSDesc.NumResources = static_cast<Uint32>(Resources.size());
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    auto pTexture = pEnv->CreateTexture("Commit benchmark texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 16, 16);
+    ASSERT_TRUE(pTexture);
+    auto pBuffer = pEnv->CreateBuffer(BufferDesc{"Commit benchmark buffer", 256, BIND_UNIFORM_BUFFER, USAGE_DEFAULT});
+    ASSERT_TRUE(pBuffer);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB);
+    ASSERT_TRUE(pSRB);
+
+    std::array<IDeviceObject*, ArraySize> ppSRVs;
+    ppSRVs.fill(pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    for (Uint32 i = 0; i < NumTextures; ++i)
+        pSRB->GetVariableByName(SHADER_TYPE_PIXEL, Names[i].c_str())->SetArray(ppSRVs.data(), 0, ArraySize);
+    pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "g_Constants")->Set(pBuffer);
+
+    // Transition resources once so that the loop below only measures descriptor writes
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    Timer T;
+
+    double CommitTime = 0;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        const double FrameStart = T.GetElapsedTime();
+        for (Uint32 i = 0; i < NumCommits; ++i)
+            pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_NONE);
+        CommitTime += T.GetElapsedTime() - FrameStart;
+
+        // Release dynamic descriptor sets
+        pContext->Flush();
+        pContext->FinishFrame();
+    }
+
+    const Uint32 TotalCommits = NumFrames * NumCommits;
+    LOG_INFO_MESSAGE("Committed SRB with ", NumTextures * ArraySize + 1, " dynamic descriptors ", TotalCommits, " times: ",
+                     CommitTime * 1000, " ms (", CommitTime * 1e9 / TotalCommits, " ns per commit)");
+}
+
+} // namespace
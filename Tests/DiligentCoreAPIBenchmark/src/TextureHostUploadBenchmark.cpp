@@ -0,0 +1,114 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+#include "GraphicsAccessories.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TextureDesc GetHostUploadTextureDesc(Uint32 Size, MISC_TEXTURE_FLAGS MiscFlags)
+{
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Host upload test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.Width     = Size;
+    TexDesc.Height    = Size;
+    TexDesc.MipLevels = 0;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.MiscFlags = MiscFlags;
+    return TexDesc;
+}
+
+void UpdateMip(IDeviceContext* pContext, ITexture* pTexture, Uint32 Mip, const std::vector<Uint8>& MipData)
+{
+    const MipLevelProperties MipAttribs = GetMipLevelProperties(pTexture->GetDesc(), Mip);
+
+    TextureSubResData SubResData{MipData.data(), MipAttribs.RowSize};
+    pContext->UpdateTexture(pTexture, Mip, 0, Box{0, MipAttribs.LogicalWidth, 0, MipAttribs.LogicalHeight}, SubResData,
+                            RESOURCE_STATE_TRANSITION_MODE_NONE, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+}
+
+// Compares the time it takes to upload a full mip chain with and without MISC_TEXTURE_FLAG_HOST_UPLOAD
+TEST(TextureHostUploadBenchmark, MipChainUpload)
+{
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 TexSize       = 512;
+    constexpr Uint32 NumIterations = 16;
+
+    const char* UploadPaths[] = {"Device upload", "Host upload"};
+    for (Uint32 HostUpload = 0; HostUpload < 2; ++HostUpload)
+    {
+        GPUTestingEnvironment::ScopedReleaseResources AutoReleaseResources;
+
+        const TextureDesc TexDesc = GetHostUploadTextureDesc(TexSize, HostUpload ? MISC_TEXTURE_FLAG_HOST_UPLOAD : MISC_TEXTURE_FLAG_NONE);
+
+        RefCntAutoPtr<ITexture> pTexture;
+        pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+        ASSERT_NE(pTexture, nullptr);
+        const Uint32 MipLevels = pTexture->GetDesc().MipLevels;
+
+        std::vector<std::vector<Uint8>> MipData(MipLevels);
+        Uint64                          ChainSize = 0;
+        for (Uint32 mip = 0; mip < MipLevels; ++mip)
+        {
+            MipData[mip].resize(static_cast<size_t>(GetMipLevelProperties(pTexture->GetDesc(), mip).MipSize), Uint8{0x7F});
+            ChainSize += MipData[mip].size();
+        }
+
+        Timer  T;
+        double StartTime = T.GetElapsedTime();
+        for (Uint32 i = 0; i < NumIterations; ++i)
+        {
+            for (Uint32 mip = 0; mip < MipLevels; ++mip)
+                UpdateMip(pContext, pTexture, mip, MipData[mip]);
+        }
+        pContext->WaitForIdle();
+        const double ElapsedTime = T.GetElapsedTime() - StartTime;
+
+        LOG_INFO_MESSAGE(UploadPaths[HostUpload], ": ", NumIterations, " x ", ChainSize / 1024, " KB mip chain in ", ElapsedTime * 1000, " ms (",
+                         static_cast<double>(ChainSize * NumIterations) / (1 << 20) / std::max(ElapsedTime, 1e-6), " MB/s)");
+    }
+}
+
+} // namespace
@@ -0,0 +1,347 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+#include "TempDirectory.hpp"
+
+#include "ArchiveBuilder.hpp"
+#include "PipelineDescFile.hpp"
+#include "Dearchiver.h"
+#include "GraphicsAccessories.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(PipelineDescFileTest, Parse)
+{
+    static constexpr char Text[] =
+        "# Comment\n"
+        "[Options]\n"
+        "ShaderDirs = shaders;common\n"
+        "\n"
+        "  [ Shader   MeshVS ]  \n"
+        "File=Mesh.vsh\r\n"
+        "Macros = A=1 B=2\n"
+        "; Another comment\n"
+        "[GraphicsPipeline Mesh Pipeline]\n"
+        "VS = MeshVS";
+
+    PipelineDescFile DescFile;
+    ASSERT_TRUE(DescFile.Parse(Text, "Test.txt"));
+    ASSERT_EQ(DescFile.Sections.size(), size_t{3});
+
+    const PipelineDescFile::Section& Options = DescFile.Sections[0];
+    EXPECT_EQ(Options.Type, "Options");
+    EXPECT_EQ(Options.Name, "");
+    EXPECT_EQ(Options.Line, size_t{2});
+    ASSERT_NE(Options.Find("ShaderDirs"), nullptr);
+    EXPECT_EQ(*Options.Find("ShaderDirs"), "shaders;common");
+
+    const PipelineDescFile::Section& Shader = DescFile.Sections[1];
+    EXPECT_EQ(Shader.Type, "Shader");
+    EXPECT_EQ(Shader.Name, "MeshVS");
+    EXPECT_EQ(Shader.Line, size_t{5});
+    ASSERT_EQ(Shader.Values.size(), size_t{2});
+    EXPECT_EQ(Shader.Values[0].first, "File");
+    EXPECT_EQ(Shader.Values[1].first, "Macros");
+    // Keys are case-insensitive
+    ASSERT_NE(Shader.Find("file"), nullptr);
+    EXPECT_EQ(*Shader.Find("file"), "Mesh.vsh");
+    // Only the first '=' separates the key from the value
+    ASSERT_NE(Shader.Find("Macros"), nullptr);
+    EXPECT_EQ(*Shader.Find("Macros"), "A=1 B=2");
+    EXPECT_EQ(Shader.Find("Entry"), nullptr);
+
+    const PipelineDescFile::Section& Pipeline = DescFile.Sections[2];
+    EXPECT_EQ(Pipeline.Type, "GraphicsPipeline");
+    EXPECT_EQ(Pipeline.Name, "Mesh Pipeline");
+    EXPECT_EQ(Pipeline.Line, size_t{9});
+    ASSERT_NE(Pipeline.Find("VS"), nullptr);
+    EXPECT_EQ(*Pipeline.Find("VS"), "MeshVS");
+
+    // Parsing the new text discards the previous sections
+    ASSERT_TRUE(DescFile.Parse("", "Empty.txt"));
+    EXPECT_TRUE(DescFile.Sections.empty());
+}
+
+TEST(PipelineDescFileTest, ParseErrors)
+{
+    static constexpr struct
+    {
+        const char* Text;
+        const char* Error;
+    } TestCases[] = {
+        {"[Shader\n", "Test.txt(1): missing closing bracket in section header"},
+        {"[ ]\n", "Test.txt(1): empty section header"},
+        {"[Shader A]\nFile\n", "Test.txt(2): expected 'Key = Value'"},
+        {"# Comment\nFile = A.vsh\n", "Test.txt(2): key-value pair outside of a section"},
+        {"[Shader A]\n = A.vsh\n", "Test.txt(2): empty key"},
+        {"[Shader A]\nFile = A.vsh\nfile = B.vsh\n", "Test.txt(3): duplicate key 'file' in section [Shader A]"},
+    };
+
+    for (const auto& TestCase : TestCases)
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{TestCase.Error};
+
+        PipelineDescFile DescFile;
+        EXPECT_FALSE(DescFile.Parse(TestCase.Text, "Test.txt")) << TestCase.Text;
+    }
+}
+
+constexpr Uint32 ContentVersion = 1234;
+
+constexpr char DescFileText[] = R"(
+[Shader MeshVS]
+File = BuilderVS.vsh
+
+[Shader MeshPS]
+File = BuilderPS.psh
+
+[Shader ShadowPS]
+File = BuilderShadowPS.psh
+
+[GraphicsPipeline Mesh]
+VS           = MeshVS
+PS           = MeshPS
+RTVFormats   = RGBA8_UNORM
+DSVFormat    = D32_FLOAT
+InputLayout  = Float32x3
+Permutations = USE_RED=0,1
+
+[GraphicsPipeline Shadow]
+VS          = MeshVS
+PS          = ShadowPS
+RTVFormats  = RGBA8_UNORM
+DSVFormat   = D32_FLOAT
+InputLayout = Float32x3
+)";
+
+constexpr char VSSource[] = R"(
+struct VSInput
+{
+    float3 Pos : ATTRIB0;
+};
+
+void main(in VSInput VSIn, out float4 Pos : SV_Position)
+{
+    Pos = float4(VSIn.Pos, 1.0);
+}
+)";
+
+constexpr char PSSource[] = R"(
+#include "BuilderCommon.fxh"
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return GetColor();
+}
+)";
+
+constexpr char CommonSource[] = R"(
+float4 GetColor()
+{
+#if USE_RED
+    return float4(1.0, 0.0, 0.0, 1.0);
+#else
+    return float4(0.0, 1.0, 0.0, 1.0);
+#endif
+}
+)";
+
+constexpr char ShadowPSSource[] = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float4(0.0, 0.0, 0.0, 1.0);
+}
+)";
+
+void WriteTextFile(const std::string& Path, const char* Text)
+{
+    ASSERT_TRUE(FileWrapper::WriteFile(Path.c_str(), Text, strlen(Text)));
+}
+
+// Writes the description file and the shaders to the temporary directory
+// and returns the builder settings that use them.
+ArchiveBuilderSettings CreateSettings(const std::string& Dir)
+{
+    WriteTextFile(Dir + FileSystem::SlashSymbol + "Pipelines.txt", DescFileText);
+    WriteTextFile(Dir + FileSystem::SlashSymbol + "BuilderVS.vsh", VSSource);
+    WriteTextFile(Dir + FileSystem::SlashSymbol + "BuilderPS.psh", PSSource);
+    WriteTextFile(Dir + FileSystem::SlashSymbol + "BuilderCommon.fxh", CommonSource);
+    WriteTextFile(Dir + FileSystem::SlashSymbol + "BuilderShadowPS.psh", ShadowPSSource);
+
+    ArchiveBuilderSettings Settings;
+    Settings.DescFilePath   = Dir + FileSystem::SlashSymbol + "Pipelines.txt";
+    Settings.OutputPath     = Dir + FileSystem::SlashSymbol + "Pipelines.bin";
+    Settings.DeviceFlags    = RenderDeviceTypeToArchiveDataFlag(GPUTestingEnvironment::GetInstance()->GetDevice()->GetDeviceInfo().Type);
+    Settings.ContentVersion = ContentVersion;
+    return Settings;
+}
+
+// Loads the archive and checks that all pipelines can be unpacked
+void VerifyArchive(const std::string& ArchivePath)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCreateInfo{}, &pDearchiver);
+    ASSERT_NE(pDearchiver, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pArchive;
+    ASSERT_TRUE(FileWrapper::ReadWholeFile(ArchivePath.c_str(), &pArchive));
+    ASSERT_TRUE(pDearchiver->LoadArchive(pArchive, ContentVersion));
+
+    for (const char* PSOName : {"Mesh(USE_RED=0)", "Mesh(USE_RED=1)", "Shadow"})
+    {
+        PipelineStateUnpackInfo UnpackInfo;
+        UnpackInfo.Name         = PSOName;
+        UnpackInfo.pDevice      = pDevice;
+        UnpackInfo.PipelineType = PIPELINE_TYPE_GRAPHICS;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+        ASSERT_NE(pPSO, nullptr) << PSOName;
+        EXPECT_EQ(pPSO->GetGraphicsPipelineDesc().NumRenderTargets, 1u);
+        EXPECT_EQ(pPSO->GetGraphicsPipelineDesc().RTVFormats[0], TEX_FORMAT_RGBA8_UNORM);
+        EXPECT_EQ(pPSO->GetGraphicsPipelineDesc().DSVFormat, TEX_FORMAT_D32_FLOAT);
+    }
+}
+
+TEST(ArchiveBuilderTest, Build)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+    if (!pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    TempDirectory TmpDir;
+
+    for (ARCHIVE_COMPRESSION Compression : {ARCHIVE_COMPRESSION_NONE, ARCHIVE_COMPRESSION_LZ})
+    {
+        ArchiveBuilderSettings Settings = CreateSettings(TmpDir.Get());
+        Settings.Compression            = Compression;
+
+        ArchiveBuilder Builder{pArchiverFactory, Settings};
+        ASSERT_TRUE(Builder.Build());
+
+        const ArchiveBuilder::Statistics& Stats = Builder.GetStatistics();
+        EXPECT_EQ(Stats.NumPipelines, size_t{3});
+        EXPECT_EQ(Stats.NumBuiltPipelines, size_t{3});
+        EXPECT_EQ(Stats.NumCachedPipelines, size_t{0});
+        // MeshVS is compiled for every permutation of Mesh and once for Shadow
+        EXPECT_EQ(Stats.NumShaders, size_t{6});
+        EXPECT_GT(Stats.ArchiveSize, size_t{0});
+        EXPECT_FALSE(Stats.Stages.empty());
+
+        VerifyArchive(Settings.OutputPath);
+    }
+}
+
+TEST(ArchiveBuilderTest, IncrementalBuild)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+    if (!pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    TempDirectory          TmpDir;
+    ArchiveBuilderSettings Settings = CreateSettings(TmpDir.Get());
+    Settings.CacheDir               = TmpDir.Get() + FileSystem::SlashSymbol + "Cache";
+
+    std::vector<Uint8> RefArchive;
+    {
+        ArchiveBuilder Builder{pArchiverFactory, Settings};
+        ASSERT_TRUE(Builder.Build());
+        EXPECT_EQ(Builder.GetStatistics().NumBuiltPipelines, size_t{3});
+        EXPECT_EQ(Builder.GetStatistics().NumCachedPipelines, size_t{0});
+        ASSERT_TRUE(FileWrapper::ReadWholeFile(Settings.OutputPath.c_str(), RefArchive));
+    }
+    VerifyArchive(Settings.OutputPath);
+
+    {
+        // Nothing has changed: all pipelines are loaded from the cache
+        ArchiveBuilder Builder{pArchiverFactory, Settings};
+        ASSERT_TRUE(Builder.Build());
+        EXPECT_EQ(Builder.GetStatistics().NumBuiltPipelines, size_t{0});
+        EXPECT_EQ(Builder.GetStatistics().NumCachedPipelines, size_t{3});
+        EXPECT_EQ(Builder.GetStatistics().NumShaders, size_t{0});
+
+        std::vector<Uint8> Archive;
+        ASSERT_TRUE(FileWrapper::ReadWholeFile(Settings.OutputPath.c_str(), Archive));
+        EXPECT_EQ(Archive, RefArchive);
+    }
+
+    // BuilderCommon.fxh is only included by MeshPS, so only Mesh permutations must be rebuilt
+    WriteTextFile(TmpDir.Get() + FileSystem::SlashSymbol + "BuilderCommon.fxh", R"(
+float4 GetColor()
+{
+    return float4(0.0, 0.0, USE_RED, 1.0);
+}
+)");
+    {
+        ArchiveBuilder Builder{pArchiverFactory, Settings};
+        ASSERT_TRUE(Builder.Build());
+        EXPECT_EQ(Builder.GetStatistics().NumBuiltPipelines, size_t{2});
+        EXPECT_EQ(Builder.GetStatistics().NumCachedPipelines, size_t{1});
+    }
+    VerifyArchive(Settings.OutputPath);
+}
+
+TEST(ArchiveBuilderTest, InvalidDescription)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+    if (!pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    TempDirectory          TmpDir;
+    ArchiveBuilderSettings Settings = CreateSettings(TmpDir.Get());
+    WriteTextFile(Settings.DescFilePath, "[Shader MeshVS]\nFile = BuilderVS.vsh\n\n[Texture Tex]\nFile = Tex.png\n");
+
+    TestingEnvironment::ErrorScope ExpectedErrors{"Archive build failed at stage 'Parse'", "(4): unknown section type 'Texture'"};
+
+    ArchiveBuilder Builder{pArchiverFactory, Settings};
+    EXPECT_FALSE(Builder.Build());
+    EXPECT_FALSE(FileSystem::FileExists(Settings.OutputPath.c_str()));
+}
+
+} // namespace
@@ -25,6 +25,9 @@
  */
 
 #include <array>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "GPUTestingEnvironment.hpp"
@@ -42,7 +45,12 @@
 #include "InlineShaders/RayTracingTestHLSL.h"
 #include "RayTracingTestConstants.hpp"
 
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+#include "../../../Graphics/GraphicsEngine/include/PipelineUsageTrace.hpp"
 #include "Timer.hpp"
+#include "ThreadPool.hpp"
+#include "ObjectBase.hpp"
 
 using namespace Diligent;
 using namespace Diligent::Testing;
@@ -376,6 +384,38 @@ TEST(ArchiveTest, AppendDeviceData)
 }
 
 
+TEST(ArchiveTest, CompressArchive)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice          = pEnv->GetDevice();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    DearchiverCreateInfo       DearchiverCI{};
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &pDearchiver);
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    constexpr char PRS1Name[] = "ArchiveTest.CompressArchive - PRS 1";
+    constexpr char PRS2Name[] = "ArchiveTest.CompressArchive - PRS 2";
+
+    RefCntAutoPtr<IDataBlob>                  pArchive;
+    RefCntAutoPtr<IPipelineResourceSignature> pRefPRS_1;
+    RefCntAutoPtr<IPipelineResourceSignature> pRefPRS_2;
+    ArchivePRS(pArchive, PRS1Name, PRS2Name, pRefPRS_1, pRefPRS_2, GetDeviceBits());
+
+    RefCntAutoPtr<IDataBlob> pCompressedArchive;
+    ASSERT_TRUE(pArchiverFactory->CompressArchive(pArchive, ARCHIVE_COMPRESSION_LZ, &pCompressedArchive));
+    EXPECT_LE(pCompressedArchive->GetSize(), pArchive->GetSize());
+    UnpackPRS(pCompressedArchive, PRS1Name, PRS2Name, pRefPRS_1, pRefPRS_2);
+
+    RefCntAutoPtr<IDataBlob> pDecompressedArchive;
+    ASSERT_TRUE(pArchiverFactory->CompressArchive(pCompressedArchive, ARCHIVE_COMPRESSION_NONE, &pDecompressedArchive));
+    ASSERT_EQ(pDecompressedArchive->GetSize(), pArchive->GetSize());
+    EXPECT_EQ(memcmp(pDecompressedArchive->GetConstDataPtr(), pArchive->GetConstDataPtr(), pArchive->GetSize()), 0);
+}
+
+
 class TestBrokenShader : public testing::TestWithParam<std::tuple<ARCHIVE_DEVICE_DATA_FLAGS, bool>>
 {};
 
@@ -1292,6 +1332,96 @@ TEST(ArchiveTest, Shaders_Async)
     ArchiveGraphicsShaders(true);
 }
 
+class CountingShaderSourceFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    using TBase = ObjectBase<IShaderSourceInputStreamFactory>;
+
+    CountingShaderSourceFactory(IReferenceCounters* pRefCounters, IShaderSourceInputStreamFactory* pFactory) :
+        TBase{pRefCounters},
+        m_pFactory{pFactory}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            ++m_NumStreams[Name];
+        }
+        m_pFactory->CreateInputStream2(Name, Flags, ppStream);
+    }
+
+    Uint32 GetNumStreams(const char* Name)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        return m_NumStreams[Name];
+    }
+
+private:
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pFactory;
+
+    std::mutex                              m_Mtx;
+    std::unordered_map<std::string, Uint32> m_NumStreams;
+};
+
+// Shaders created by the same serialization device share the include files
+TEST(ArchiveTest, SharedShaderIncludes)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+    if (!pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    // Include files are unrolled when shaders are archived for OpenGL
+    if ((GetDeviceBits() & ARCHIVE_DEVICE_DATA_FLAG_GL) == 0)
+        GTEST_SKIP() << "OpenGL is not supported by archiver";
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    SerializationDeviceCreateInfo       SerializationDeviceCI;
+    pArchiverFactory->CreateSerializationDevice(SerializationDeviceCI, &pSerializationDevice);
+    ASSERT_NE(pSerializationDevice, nullptr);
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pDefaultFactory;
+    pArchiverFactory->CreateDefaultShaderSourceStreamFactory("shaders/Archiver", &pDefaultFactory);
+    ASSERT_NE(pDefaultFactory, nullptr);
+
+    RefCntAutoPtr<CountingShaderSourceFactory> pShaderSourceFactory{MakeNewRCObj<CountingShaderSourceFactory>()(pDefaultFactory)};
+
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("TEST_MACRO", 1);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Macros                     = Macros;
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    ShaderCI.Desc     = {"Shared includes test vertex shader", SHADER_TYPE_VERTEX, true};
+    ShaderCI.FilePath = "VertexShader.vsh";
+    RefCntAutoPtr<IShader> pSerializedVS;
+    pSerializationDevice->CreateShader(ShaderCI, ShaderArchiveInfo{ARCHIVE_DEVICE_DATA_FLAG_GL}, &pSerializedVS);
+    ASSERT_NE(pSerializedVS, nullptr);
+    EXPECT_EQ(pShaderSourceFactory->GetNumStreams("Common.h"), 1u);
+
+    // Both shaders include Common.h
+    ShaderCI.Desc     = {"Shared includes test pixel shader", SHADER_TYPE_PIXEL, true};
+    ShaderCI.FilePath = "PixelShader.psh";
+    RefCntAutoPtr<IShader> pSerializedPS;
+    pSerializationDevice->CreateShader(ShaderCI, ShaderArchiveInfo{ARCHIVE_DEVICE_DATA_FLAG_GL}, &pSerializedPS);
+    ASSERT_NE(pSerializedPS, nullptr);
+    EXPECT_EQ(pShaderSourceFactory->GetNumStreams("PixelShader.psh"), 1u);
+    EXPECT_EQ(pShaderSourceFactory->GetNumStreams("Common.h"), 1u);
+}
+
 namespace HLSL
 {
 
@@ -1562,6 +1692,385 @@ TEST(ArchiveTest, ComputePipeline_SplitArchive_Async)
     TestComputePipeline(PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES, /*CompileAsync = */ true);
 }
 
+// Creates an archive with NumPSOs compute pipelines that share the same signature and shader
+void CreateComputePipelineArchive(const char* Prefix, Uint32 NumPSOs, std::vector<std::string>& PSONames, IDataBlob** ppArchive)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice          = pEnv->GetDevice();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    {
+        SerializationDeviceCreateInfo SerDeviceCI;
+        SerDeviceCI.DeviceInfo.Features.SeparablePrograms = pDevice->GetDeviceInfo().Features.SeparablePrograms;
+        pArchiverFactory->CreateSerializationDevice(SerDeviceCI, &pSerializationDevice);
+        ASSERT_NE(pSerializationDevice, nullptr);
+    }
+
+    constexpr PipelineResourceDesc Resources[] = {
+        {SHADER_TYPE_COMPUTE, "g_tex2DUAV", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC, PIPELINE_RESOURCE_FLAG_NONE, {WEB_GPU_BINDING_TYPE_WRITE_ONLY_TEXTURE_UAV, RESOURCE_DIM_TEX_2D, TEX_FORMAT_RGBA8_UNORM}},
+    };
+
+    const std::string PRSName = std::string{Prefix} + " - PRS";
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = PRSName.c_str();
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSerializedPRS;
+    pSerializationDevice->CreatePipelineResourceSignature(PRSDesc, ResourceSignatureArchiveInfo{GetDeviceBits()}, &pSerializedPRS);
+    ASSERT_NE(pSerializedPRS, nullptr);
+
+    ShaderCreateInfo       ShaderCI;
+    RefCntAutoPtr<IShader> pSerializedCS;
+    CreateComputeShader(nullptr, pSerializationDevice, ShaderCI, nullptr, &pSerializedCS);
+    ASSERT_NE(pSerializedCS, nullptr);
+
+    RefCntAutoPtr<IArchiver> pArchiver;
+    pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+    ASSERT_NE(pArchiver, nullptr);
+
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        PSONames.emplace_back(std::string{Prefix} + " - PSO " + std::to_string(i));
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name         = PSONames.back().c_str();
+        PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.pCS                  = pSerializedCS;
+
+        IPipelineResourceSignature* Signatures[] = {pSerializedPRS};
+        PSOCreateInfo.ResourceSignaturesCount    = _countof(Signatures);
+        PSOCreateInfo.ppResourceSignatures       = Signatures;
+
+        PipelineStateArchiveInfo ArchiveInfo;
+        ArchiveInfo.DeviceFlags = GetDeviceBits();
+#if PLATFORM_MACOS
+        // Compute shaders are not supported in OpenGL on MacOS
+        ArchiveInfo.DeviceFlags &= ~(ARCHIVE_DEVICE_DATA_FLAG_GL | ARCHIVE_DEVICE_DATA_FLAG_GLES);
+#endif
+        RefCntAutoPtr<IPipelineState> pSerializedPSO;
+        pSerializationDevice->CreateComputePipelineState(PSOCreateInfo, ArchiveInfo, &pSerializedPSO);
+        ASSERT_NE(pSerializedPSO, nullptr);
+        ASSERT_TRUE(pArchiver->AddPipelineState(pSerializedPSO));
+    }
+
+    pArchiver->SerializeToBlob(ContentVersion, ppArchive);
+    ASSERT_NE(*ppArchive, nullptr);
+}
+
+void TestUnpackPipelineStates(bool UseThreadPool, bool Asynchronous)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice          = pEnv->GetDevice();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    DearchiverCreateInfo       DearchiverCI{};
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &pDearchiver);
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32         NumPSOs = 16;
+    std::vector<std::string> PSONames;
+    {
+        RefCntAutoPtr<IDataBlob> pArchive;
+        CreateComputePipelineArchive("ArchiveTest.UnpackPipelineStates", NumPSOs, PSONames, &pArchive);
+        ASSERT_NE(pArchive, nullptr);
+        ASSERT_TRUE(pDearchiver->LoadArchive(pArchive, ContentVersion));
+    }
+
+    std::vector<PipelineStateUnpackInfo> UnpackInfos(NumPSOs);
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        UnpackInfos[i].Name         = PSONames[i].c_str();
+        UnpackInfos[i].pDevice      = pDevice;
+        UnpackInfos[i].PipelineType = PIPELINE_TYPE_COMPUTE;
+    }
+    // Duplicate request
+    UnpackInfos.push_back(UnpackInfos[3]);
+    // Missing pipeline
+    UnpackInfos.push_back(UnpackInfos[0]);
+    UnpackInfos.back().Name = "ArchiveTest.UnpackPipelineStates - Missing PSO";
+
+    RefCntAutoPtr<IThreadPool> pThreadPool;
+    if (UseThreadPool)
+    {
+        pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+        ASSERT_NE(pThreadPool, nullptr);
+    }
+
+    PipelineStateBatchUnpackInfo BatchInfo;
+    BatchInfo.pUnpackInfos = UnpackInfos.data();
+    BatchInfo.NumPipelines = static_cast<Uint32>(UnpackInfos.size());
+    BatchInfo.pThreadPool  = pThreadPool;
+    BatchInfo.Asynchronous = Asynchronous;
+
+    std::vector<IPipelineState*>   pPSOs(UnpackInfos.size());
+    std::vector<PSO_UNPACK_STATUS> Statuses(UnpackInfos.size(), PSO_UNPACK_STATUS_COUNT);
+    EXPECT_EQ(pDearchiver->UnpackPipelineStates(BatchInfo, pPSOs.data(), Statuses.data()), NumPSOs + 1);
+
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        ASSERT_NE(pPSOs[i], nullptr) << i;
+        EXPECT_EQ(Statuses[i], PSO_UNPACK_STATUS_SUCCESS) << i;
+        EXPECT_STREQ(pPSOs[i]->GetDesc().Name, PSONames[i].c_str());
+        // Shared signature must be unpacked once
+        EXPECT_EQ(pPSOs[i]->GetResourceSignature(0), pPSOs[0]->GetResourceSignature(0));
+        EXPECT_EQ(pPSOs[i]->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY) << i;
+    }
+    EXPECT_EQ(Statuses[NumPSOs], PSO_UNPACK_STATUS_SUCCESS);
+    EXPECT_EQ(pPSOs[NumPSOs], pPSOs[3]);
+    EXPECT_EQ(Statuses[NumPSOs + 1], PSO_UNPACK_STATUS_NOT_FOUND);
+    EXPECT_EQ(pPSOs[NumPSOs + 1], nullptr);
+
+    // Pipelines must be taken from the cache
+    {
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDearchiver->UnpackPipelineState(UnpackInfos[5], &pPSO);
+        EXPECT_EQ(pPSO, pPSOs[5]);
+    }
+
+    for (IPipelineState* pPSO : pPSOs)
+    {
+        if (pPSO != nullptr)
+            pPSO->Release();
+    }
+}
+
+TEST(ArchiveTest, UnpackPipelineStates)
+{
+    TestUnpackPipelineStates(/*UseThreadPool = */ false, /*Asynchronous = */ false);
+}
+
+TEST(ArchiveTest, UnpackPipelineStates_ThreadPool)
+{
+    TestUnpackPipelineStates(/*UseThreadPool = */ true, /*Asynchronous = */ false);
+}
+
+TEST(ArchiveTest, UnpackPipelineStates_Async)
+{
+    TestUnpackPipelineStates(/*UseThreadPool = */ true, /*Asynchronous = */ true);
+}
+
+void TestPrefetchPipelineStates(bool UseThreadPool)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice          = pEnv->GetDevice();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    DearchiverCreateInfo       DearchiverCI{};
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &pDearchiver);
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32         NumPSOs = 8;
+    std::vector<std::string> PSONames;
+    {
+        RefCntAutoPtr<IDataBlob> pArchive;
+        CreateComputePipelineArchive("ArchiveTest.PrefetchPipelineStates", NumPSOs, PSONames, &pArchive);
+        ASSERT_NE(pArchive, nullptr);
+        ASSERT_TRUE(pDearchiver->LoadArchive(pArchive, ContentVersion));
+    }
+
+    RefCntAutoPtr<IThreadPool> pThreadPool;
+    if (UseThreadPool)
+    {
+        pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+        ASSERT_NE(pThreadPool, nullptr);
+    }
+
+    // Prefetch the first half of the pipelines
+    std::vector<PipelineStatePrefetchItem> Items;
+    for (Uint32 i = 0; i < NumPSOs / 2; ++i)
+        Items.push_back({PSONames[i].c_str(), PIPELINE_TYPE_COMPUTE});
+    // Missing pipeline
+    Items.push_back({"ArchiveTest.PrefetchPipelineStates - Missing PSO", PIPELINE_TYPE_COMPUTE});
+
+    PipelineStatePrefetchInfo PrefetchInfo;
+    PrefetchInfo.pDevice      = pDevice;
+    PrefetchInfo.pPipelines   = Items.data();
+    PrefetchInfo.NumPipelines = static_cast<Uint32>(Items.size());
+    PrefetchInfo.pThreadPool  = pThreadPool;
+    EXPECT_EQ(pDearchiver->PrefetchPipelineStates(PrefetchInfo), NumPSOs / 2);
+    // Pipelines that are being prefetched are skipped
+    EXPECT_EQ(pDearchiver->PrefetchPipelineStates(PrefetchInfo), 0u);
+
+    if (pThreadPool)
+        pThreadPool->WaitForAllTasks();
+
+    DearchiverPrefetchStats Stats;
+    pDearchiver->GetPrefetchStats(Stats);
+    EXPECT_EQ(Stats.NumRequested, 2 * (NumPSOs / 2 + 1));
+    EXPECT_EQ(Stats.NumPrefetched, NumPSOs / 2);
+    EXPECT_EQ(Stats.NumSkipped, NumPSOs / 2 + 2);
+    EXPECT_EQ(Stats.NumFailed, 0u);
+    EXPECT_GT(Stats.PendingDataSize, Uint64{0});
+
+    std::vector<RefCntAutoPtr<IPipelineState>> pPSOs(NumPSOs);
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        PipelineStateUnpackInfo UnpackInfo;
+        UnpackInfo.Name         = PSONames[i].c_str();
+        UnpackInfo.pDevice      = pDevice;
+        UnpackInfo.PipelineType = PIPELINE_TYPE_COMPUTE;
+        pDearchiver->UnpackPipelineState(UnpackInfo, &pPSOs[i]);
+        ASSERT_NE(pPSOs[i], nullptr) << i;
+        EXPECT_EQ(pPSOs[i]->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY) << i;
+    }
+
+    pDearchiver->GetPrefetchStats(Stats);
+    EXPECT_EQ(Stats.NumHits, NumPSOs / 2);
+    EXPECT_EQ(Stats.NumMisses, NumPSOs / 2);
+    // Prefetched data is released when the pipelines are unpacked
+    EXPECT_EQ(Stats.PendingDataSize, Uint64{0});
+
+    // Unpacked pipelines are not prefetched again
+    EXPECT_EQ(pDearchiver->PrefetchPipelineStates(PrefetchInfo), 0u);
+
+    // Pipelines that do not fit into the memory budget are skipped
+    pPSOs.clear();
+    pDearchiver->Reset();
+    {
+        RefCntAutoPtr<IDataBlob> pArchive;
+        PSONames.clear();
+        CreateComputePipelineArchive("ArchiveTest.PrefetchPipelineStates", NumPSOs, PSONames, &pArchive);
+        ASSERT_NE(pArchive, nullptr);
+        ASSERT_TRUE(pDearchiver->LoadArchive(pArchive, ContentVersion));
+    }
+    Items.clear();
+    for (Uint32 i = 0; i < NumPSOs / 2; ++i)
+        Items.push_back({PSONames[i].c_str(), PIPELINE_TYPE_COMPUTE});
+    PrefetchInfo.pPipelines         = Items.data();
+    PrefetchInfo.NumPipelines       = static_cast<Uint32>(Items.size());
+    PrefetchInfo.MaxPendingDataSize = 1;
+    EXPECT_EQ(pDearchiver->PrefetchPipelineStates(PrefetchInfo), NumPSOs / 2);
+    if (pThreadPool)
+        pThreadPool->WaitForAllTasks();
+
+    pDearchiver->GetPrefetchStats(Stats);
+    EXPECT_EQ(Stats.NumPrefetched, 0u);
+    EXPECT_EQ(Stats.NumSkipped, NumPSOs / 2);
+    EXPECT_EQ(Stats.PendingDataSize, Uint64{0});
+}
+
+TEST(ArchiveTest, PrefetchPipelineStates)
+{
+    TestPrefetchPipelineStates(/*UseThreadPool = */ false);
+}
+
+TEST(ArchiveTest, PrefetchPipelineStates_ThreadPool)
+{
+    TestPrefetchPipelineStates(/*UseThreadPool = */ true);
+}
+
+TEST(ArchiveTest, UsageTrace)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice          = pEnv->GetDevice();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    DearchiverCreateInfo       DearchiverCI{};
+    DearchiverCI.EnableUsageTrace = True;
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &pDearchiver);
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32         NumPSOs = 4;
+    std::vector<std::string> PSONames;
+    RefCntAutoPtr<IDataBlob> pArchive;
+    CreateComputePipelineArchive("ArchiveTest.UsageTrace", NumPSOs, PSONames, &pArchive);
+    ASSERT_NE(pArchive, nullptr);
+    ASSERT_TRUE(pDearchiver->LoadArchive(pArchive, ContentVersion));
+
+    auto UnpackPSO = [&](const char* Name) {
+        PipelineStateUnpackInfo UnpackInfo;
+        UnpackInfo.Name         = Name;
+        UnpackInfo.pDevice      = pDevice;
+        UnpackInfo.PipelineType = PIPELINE_TYPE_COMPUTE;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+        return pPSO;
+    };
+
+    // Unpack the pipelines in the reverse order
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+        EXPECT_NE(UnpackPSO(PSONames[NumPSOs - 1 - i].c_str()), nullptr);
+    EXPECT_NE(UnpackPSO(PSONames[NumPSOs - 1].c_str()), nullptr);
+    // Missing pipelines are recorded too
+    EXPECT_EQ(UnpackPSO("ArchiveTest.UsageTrace - Missing PSO"), nullptr);
+
+    RefCntAutoPtr<DataBlobImpl>     pTraceData = DataBlobImpl::Create();
+    RefCntAutoPtr<MemoryFileStream> pStream    = MemoryFileStream::Create(pTraceData);
+    ASSERT_TRUE(pDearchiver->WriteUsageTrace(pStream));
+
+    std::vector<PipelineUsageTrace::Entry> Entries;
+    ASSERT_TRUE(PipelineUsageTrace::Deserialize(pTraceData->GetConstDataPtr(), pTraceData->GetSize(), Entries));
+    ASSERT_EQ(Entries.size(), NumPSOs + 1);
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        EXPECT_EQ(Entries[i].PipelineType, PIPELINE_TYPE_COMPUTE);
+        EXPECT_EQ(Entries[i].Name, PSONames[NumPSOs - 1 - i]);
+        EXPECT_EQ(Entries[i].NumRequests, i == 0 ? 2u : 1u);
+    }
+    EXPECT_EQ(Entries[NumPSOs].Name, "ArchiveTest.UsageTrace - Missing PSO");
+
+    // Prefetch the pipelines recorded in the trace
+    {
+        RefCntAutoPtr<IDearchiver> pPrefetchDearchiver;
+        pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCreateInfo{}, &pPrefetchDearchiver);
+        ASSERT_NE(pPrefetchDearchiver, nullptr);
+        ASSERT_TRUE(pPrefetchDearchiver->LoadArchive(pArchive, ContentVersion));
+
+        PipelineStatePrefetchInfo PrefetchInfo;
+        PrefetchInfo.pDevice     = pDevice;
+        PrefetchInfo.pUsageTrace = pTraceData;
+        EXPECT_EQ(pPrefetchDearchiver->PrefetchPipelineStates(PrefetchInfo), NumPSOs);
+
+        DearchiverPrefetchStats Stats;
+        pPrefetchDearchiver->GetPrefetchStats(Stats);
+        EXPECT_EQ(Stats.NumRequested, NumPSOs + 1);
+        EXPECT_EQ(Stats.NumPrefetched, NumPSOs);
+        // The missing pipeline is skipped
+        EXPECT_EQ(Stats.NumSkipped, 1u);
+
+        for (Uint32 i = 0; i < NumPSOs; ++i)
+        {
+            PipelineStateUnpackInfo UnpackInfo;
+            UnpackInfo.Name         = PSONames[i].c_str();
+            UnpackInfo.pDevice      = pDevice;
+            UnpackInfo.PipelineType = PIPELINE_TYPE_COMPUTE;
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            pPrefetchDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+            EXPECT_NE(pPSO, nullptr) << i;
+        }
+
+        pPrefetchDearchiver->GetPrefetchStats(Stats);
+        EXPECT_EQ(Stats.NumHits, NumPSOs);
+        EXPECT_EQ(Stats.PendingDataSize, Uint64{0});
+    }
+}
+
 void TestRayTracingPipeline(bool CompileAsync = false)
 {
     GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
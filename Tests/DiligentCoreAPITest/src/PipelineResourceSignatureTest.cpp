@@ -2031,4 +2031,367 @@ TEST_F(PipelineResourceSignatureTest, UnusedNullResources)
     pSwapChain->Present();
 }
 
+TEST_F(PipelineResourceSignatureTest, SRBVariableIndex)
+{
+    auto* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "SRB variable index test";
+
+    // clang-format off
+    std::vector<PipelineResourceDesc> Resources =
+    {
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "g_StaticBuffer", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+        {SHADER_TYPE_PIXEL,                      "g_Texture",      1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "g_BufferSRV",    1, SHADER_RESOURCE_TYPE_BUFFER_SRV,      SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_VERTEX,                     "g_Array",        4, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        // Samplers have no variables in some backends
+        {SHADER_TYPE_PIXEL,                      "g_Sampler",      1, SHADER_RESOURCE_TYPE_SAMPLER,         SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    // clang-format on
+
+    const bool SeparablePrograms = pDevice->GetDeviceInfo().Features.SeparablePrograms != DEVICE_FEATURE_STATE_DISABLED;
+    if (SeparablePrograms)
+    {
+        // Resources with the same name in different shader stages
+        Resources.emplace_back(SHADER_TYPE_VERTEX, "g_Buffer", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+        Resources.emplace_back(SHADER_TYPE_PIXEL, "g_Buffer", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    }
+    PRSDesc.Resources    = Resources.data();
+    PRSDesc.NumResources = static_cast<Uint32>(Resources.size());
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB0, pSRB1;
+    pPRS->CreateShaderResourceBinding(&pSRB0);
+    pPRS->CreateShaderResourceBinding(&pSRB1);
+    ASSERT_TRUE(pSRB0 && pSRB1);
+
+    for (SHADER_TYPE ShaderType : {SHADER_TYPE_VERTEX, SHADER_TYPE_PIXEL})
+    {
+        for (const PipelineResourceDesc& Res : Resources)
+        {
+            const Uint32 Index = pPRS->GetSRBVariableIndex(ShaderType, Res.Name);
+
+            IShaderResourceVariable* pVar0 = pSRB0->GetVariableByName(ShaderType, Res.Name);
+            if (pVar0 == nullptr)
+            {
+                EXPECT_EQ(Index, ~0u) << Res.Name;
+                continue;
+            }
+            EXPECT_EQ(Index, pVar0->GetIndex()) << Res.Name;
+
+            IShaderResourceVariable* pVar1 = pSRB1->GetVariableByIndex(ShaderType, Index);
+            ASSERT_NE(pVar1, nullptr) << Res.Name;
+            EXPECT_EQ(pVar1, pSRB1->GetVariableByName(ShaderType, Res.Name));
+
+            ShaderResourceDesc ResDesc;
+            pVar1->GetResourceDesc(ResDesc);
+            EXPECT_STREQ(ResDesc.Name, Res.Name);
+        }
+
+        EXPECT_EQ(pPRS->GetSRBVariableIndex(ShaderType, "g_StaticBuffer"), ~0u);
+        EXPECT_EQ(pPRS->GetSRBVariableIndex(ShaderType, "g_Missing"), ~0u);
+    }
+
+    if (SeparablePrograms)
+    {
+        // Variables with the same name in different stages reference different resources
+        IShaderResourceVariable* pVSBuffer = pSRB0->GetVariableByName(SHADER_TYPE_VERTEX, "g_Buffer");
+        IShaderResourceVariable* pPSBuffer = pSRB0->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffer");
+        ASSERT_TRUE(pVSBuffer != nullptr && pPSBuffer != nullptr);
+        EXPECT_EQ(pVSBuffer->GetType(), SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+        EXPECT_EQ(pPSBuffer->GetType(), SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    }
+
+    EXPECT_NE(pPRS->GetStaticVariableByName(SHADER_TYPE_PIXEL, "g_StaticBuffer"), nullptr);
+    EXPECT_EQ(pPRS->GetStaticVariableByName(SHADER_TYPE_PIXEL, "g_Texture"), nullptr);
+}
+
+// Dynamic resources of the signature with binding index 0 are written with push descriptors when
+// the Vulkan backend is created with EngineVkCreateInfo::UsePushDescriptors (--vk_push_descriptors).
+// Every draw must use the dynamic resources of the most recently committed SRB, even if the SRB
+// has been committed before or the resources of the committed SRB have been changed.
+TEST_F(PipelineResourceSignatureTest, RebindDynamicResources)
+{
+    auto* const pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice  = pEnv->GetDevice();
+    auto*       pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetDeviceInfo().Features.SeparablePrograms)
+    {
+        GTEST_SKIP();
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    float ClearColor[] = {0.25, 0.625, 0.375, 0.875};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    static constexpr Uint32 StaticTexArraySize  = 2;
+    static constexpr Uint32 MutableTexArraySize = 4;
+    static constexpr Uint32 DynamicTexArraySize = 3;
+
+    // The second half of the textures is used as incorrect dynamic resources
+    static constexpr Uint32 NumRefTextures = 3 + StaticTexArraySize + MutableTexArraySize + DynamicTexArraySize;
+    ReferenceTextures       RefTextures{
+        NumRefTextures * 2,
+        128, 128,
+        USAGE_DEFAULT,
+        BIND_SHADER_RESOURCE,
+        TEXTURE_VIEW_SHADER_RESOURCE //
+    };
+
+    static constexpr size_t Tex2D_StaticIdx = 2;
+    static constexpr size_t Tex2D_MutIdx    = 0;
+    static constexpr size_t Tex2D_DynIdx    = 1;
+
+    static constexpr size_t Tex2DArr_StaticIdx = 7;
+    static constexpr size_t Tex2DArr_MutIdx    = 3;
+    static constexpr size_t Tex2DArr_DynIdx    = 9;
+
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("STATIC_TEX_ARRAY_SIZE", static_cast<int>(StaticTexArraySize));
+    Macros.AddShaderMacro("MUTABLE_TEX_ARRAY_SIZE", static_cast<int>(MutableTexArraySize));
+    Macros.AddShaderMacro("DYNAMIC_TEX_ARRAY_SIZE", static_cast<int>(DynamicTexArraySize));
+
+    Macros.AddShaderMacro("Tex2D_Static_Ref", RefTextures.GetColor(Tex2D_StaticIdx));
+    Macros.AddShaderMacro("Tex2D_Mut_Ref", RefTextures.GetColor(Tex2D_MutIdx));
+    Macros.AddShaderMacro("Tex2D_Dyn_Ref", RefTextures.GetColor(Tex2D_DynIdx));
+    for (Uint32 i = 0; i < StaticTexArraySize; ++i)
+        Macros.AddShaderMacro((std::string{"Tex2DArr_Static_Ref"} + std::to_string(i)).c_str(), RefTextures.GetColor(Tex2DArr_StaticIdx + i));
+    for (Uint32 i = 0; i < MutableTexArraySize; ++i)
+        Macros.AddShaderMacro((std::string{"Tex2DArr_Mut_Ref"} + std::to_string(i)).c_str(), RefTextures.GetColor(Tex2DArr_MutIdx + i));
+    for (Uint32 i = 0; i < DynamicTexArraySize; ++i)
+        Macros.AddShaderMacro((std::string{"Tex2DArr_Dyn_Ref"} + std::to_string(i)).c_str(), RefTextures.GetColor(Tex2DArr_DynIdx + i));
+
+    auto ModifyShaderCI = [pEnv](ShaderCreateInfo& ShaderCI) {
+        if (pEnv->NeedWARPResourceArrayIndexingBugWorkaround())
+        {
+            ShaderCI.ShaderCompiler = SHADER_COMPILER_DEFAULT;
+            ShaderCI.HLSLVersion    = ShaderVersion{5, 0};
+        }
+        ShaderCI.WebGPUEmulatedArrayIndexSuffix = "_";
+    };
+
+    const char* ShaderPath = "shaders/ShaderResourceLayout/Textures.hlsl";
+
+    auto pVS = CreateShaderFromFile(SHADER_TYPE_VERTEX, ShaderPath, "VSMain", "PRS rebind dynamic resources test: VS", Macros, ModifyShaderCI);
+    auto pPS = CreateShaderFromFile(SHADER_TYPE_PIXEL, ShaderPath, "PSMain", "PRS rebind dynamic resources test: PS", Macros, ModifyShaderCI);
+    ASSERT_TRUE(pVS && pPS);
+
+    // Signature 0 has both a regular and a dynamic descriptor set, so that the push
+    // descriptor set is bound between the regular sets of signatures 0 and 1.
+    // clang-format off
+    PipelineResourceDesc Resources0[]
+    {
+        {SHADER_TYPE_VS_PS, "g_Tex2D_Mut",    1,                   SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VS_PS, "g_Tex2D_Dyn",    1,                   SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_VS_PS, "g_Tex2DArr_Mut", MutableTexArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VS_PS, "g_Tex2DArr_Dyn", DynamicTexArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    PipelineResourceDesc Resources1[]
+    {
+        {SHADER_TYPE_VS_PS, "g_Tex2D_Static",    1,                  SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+        {SHADER_TYPE_VS_PS, "g_Tex2DArr_Static", StaticTexArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+        {SHADER_TYPE_VS_PS, "g_Sampler",         1,                  SHADER_RESOURCE_TYPE_SAMPLER,     SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    };
+    // clang-format on
+
+    std::vector<RefCntAutoPtr<IPipelineResourceSignature>> pPRS(2);
+    {
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "Rebind dynamic resources test 0";
+        PRSDesc.BindingIndex = 0;
+        PRSDesc.Resources    = Resources0;
+        PRSDesc.NumResources = _countof(Resources0);
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS[0]);
+        ASSERT_TRUE(pPRS[0]);
+
+        PRSDesc.Name         = "Rebind dynamic resources test 1";
+        PRSDesc.BindingIndex = 1;
+        PRSDesc.Resources    = Resources1;
+        PRSDesc.NumResources = _countof(Resources1);
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS[1]);
+        ASSERT_TRUE(pPRS[1]);
+    }
+
+    auto pPSO = CreateGraphicsPSO(pVS, pPS, pPRS);
+    ASSERT_TRUE(pPSO);
+
+    SET_STATIC_VAR(pPRS[1], SHADER_TYPE_VERTEX, "g_Tex2D_Static", Set, RefTextures.GetViewObjects(Tex2D_StaticIdx)[0]);
+    SET_STATIC_VAR(pPRS[1], SHADER_TYPE_VERTEX, "g_Tex2DArr_Static", SetArray, RefTextures.GetViewObjects(Tex2DArr_StaticIdx), 0, StaticTexArraySize);
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+    {
+        RefCntAutoPtr<ISampler> pSampler;
+        pDevice->CreateSampler(SamplerDesc{}, &pSampler);
+        SET_STATIC_VAR(pPRS[1], SHADER_TYPE_VERTEX, "g_Sampler", Set, pSampler);
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> pStaticSRB;
+    pPRS[1]->CreateShaderResourceBinding(&pStaticSRB, true);
+    ASSERT_NE(pStaticSRB, nullptr);
+
+    auto CreateSRB = [&](size_t DynTexOffset) {
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        pPRS[0]->CreateShaderResourceBinding(&pSRB, true);
+        if (pSRB)
+        {
+            SET_SRB_VAR(pSRB, SHADER_TYPE_VERTEX, "g_Tex2D_Mut", Set, RefTextures.GetViewObjects(Tex2D_MutIdx)[0]);
+            SET_SRB_VAR(pSRB, SHADER_TYPE_PIXEL, "g_Tex2DArr_Mut", SetArray, RefTextures.GetViewObjects(Tex2DArr_MutIdx), 0, MutableTexArraySize);
+            SET_SRB_VAR(pSRB, SHADER_TYPE_PIXEL, "g_Tex2D_Dyn", Set, RefTextures.GetViewObjects(DynTexOffset + Tex2D_DynIdx)[0]);
+            SET_SRB_VAR(pSRB, SHADER_TYPE_VERTEX, "g_Tex2DArr_Dyn", SetArray, RefTextures.GetViewObjects(DynTexOffset + Tex2DArr_DynIdx), 0, DynamicTexArraySize);
+        }
+        return pSRB;
+    };
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB      = CreateSRB(0);
+    RefCntAutoPtr<IShaderResourceBinding> pWrongSRB = CreateSRB(NumRefTextures);
+    ASSERT_TRUE(pSRB && pWrongSRB);
+
+    ITextureView* ppRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(ppRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->CommitShaderResources(pStaticSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    // Every draw overwrites the result of the previous one, so the final image is only
+    // correct if the last draw uses the correct dynamic resources.
+    DrawAttribs DrawAttrs{6, DRAW_FLAG_VERIFY_ALL};
+
+    // Switch between different SRBs
+    pContext->CommitShaderResources(pWrongSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Draw(DrawAttrs);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Draw(DrawAttrs);
+
+    // Commit the SRB again after its dynamic resources have been changed
+    SET_SRB_VAR(pSRB, SHADER_TYPE_PIXEL, "g_Tex2D_Dyn", Set, RefTextures.GetViewObjects(NumRefTextures + Tex2D_DynIdx)[0]);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Draw(DrawAttrs);
+    SET_SRB_VAR(pSRB, SHADER_TYPE_PIXEL, "g_Tex2D_Dyn", Set, RefTextures.GetViewObjects(Tex2D_DynIdx)[0]);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Draw(DrawAttrs);
+
+    // Resetting the pipeline must not lose the dynamic resources
+    pContext->SetPipelineState(pPSO);
+    pContext->Draw(DrawAttrs);
+
+    pSwapChain->Present();
+}
+
+namespace
+{
+
+RefCntAutoPtr<IPipelineResourceSignature> CreateSetResourcesTestSignature(IRenderDevice* pDevice, Uint32 NumTextures, Uint32 ArraySize)
+{
+    std::vector<String>               Names;
+    std::vector<PipelineResourceDesc> Resources;
+    for (Uint32 i = 0; i < NumTextures; ++i)
+        Names.emplace_back("g_Texture" + std::to_string(i));
+    for (Uint32 i = 0; i < NumTextures; ++i)
+        Resources.emplace_back(SHADER_TYPE_PIXEL, Names[i].c_str(), ArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    Resources.emplace_back(SHADER_TYPE_VERTEX, "g_Buffer", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "SetResources test";
+    PRSDesc.Resources    = Resources.data();
+    PRSDesc.NumResources = static_cast<Uint32>(Resources.size());
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    return pPRS;
+}
+
+} // namespace
+
+TEST_F(PipelineResourceSignatureTest, SetResources)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumTextures = 4;
+    constexpr Uint32 ArraySize   = 8;
+
+    auto pPRS = CreateSetResourcesTestSignature(pDevice, NumTextures, ArraySize);
+    ASSERT_TRUE(pPRS);
+
+    std::array<RefCntAutoPtr<ITexture>, ArraySize> pTextures;
+    std::array<IDeviceObject*, ArraySize>          ppSRVs{};
+    for (Uint32 i = 0; i < ArraySize; ++i)
+    {
+        pTextures[i] = pEnv->CreateTexture(("SetResources test texture " + std::to_string(i)).c_str(), TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 16, 16);
+        ASSERT_TRUE(pTextures[i]);
+        ppSRVs[i] = pTextures[i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    }
+
+    auto pBuffer = pEnv->CreateBuffer(BufferDesc{"SetResources test buffer", 256, BIND_UNIFORM_BUFFER, USAGE_DEFAULT});
+    ASSERT_TRUE(pBuffer);
+    IDeviceObject* pBufferObj = pBuffer;
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB);
+    ASSERT_TRUE(pSRB);
+
+    std::vector<ShaderResourceVariableBinding> Bindings;
+    for (Uint32 i = 0; i < NumTextures; ++i)
+    {
+        const Uint32 VarIndex = pPRS->GetSRBVariableIndex(SHADER_TYPE_PIXEL, ("g_Texture" + std::to_string(i)).c_str());
+        ASSERT_NE(VarIndex, ~0u);
+        // Set every texture array in two parts to exercise the element range
+        Bindings.emplace_back(SHADER_TYPE_PIXEL, VarIndex, &ppSRVs[0], 0, ArraySize / 2);
+        Bindings.emplace_back(SHADER_TYPE_PIXEL, VarIndex, &ppSRVs[ArraySize / 2], ArraySize / 2, ArraySize / 2);
+    }
+    const Uint32 BufferIndex = pPRS->GetSRBVariableIndex(SHADER_TYPE_VERTEX, "g_Buffer");
+    ASSERT_NE(BufferIndex, ~0u);
+    Bindings.emplace_back(SHADER_TYPE_VERTEX, BufferIndex, &pBufferObj);
+
+    {
+        // The whole batch is validated before anything is bound, so an invalid record
+        // at the end of the batch must leave all variables unchanged
+        std::vector<ShaderResourceVariableBinding> InvalidBindings = Bindings;
+        InvalidBindings.emplace_back(SHADER_TYPE_PIXEL, NumTextures, &ppSRVs[0]);
+
+        {
+            TestingEnvironment::ErrorScope ExpectedErrors{"variable index 4 of binding 9 is out of range"};
+            pSRB->SetResources(InvalidBindings.data(), static_cast<Uint32>(InvalidBindings.size()), SET_SHADER_RESOURCE_FLAG_NONE);
+        }
+
+        // The element range is checked in all build configurations
+        InvalidBindings.back() = ShaderResourceVariableBinding{SHADER_TYPE_PIXEL, Bindings[0].VariableIndex, &ppSRVs[0], ArraySize - 1, 2};
+        {
+            TestingEnvironment::ErrorScope ExpectedErrors{"element range (7 .. 8) of binding 9 is out of array bounds 0 .. 7"};
+            pSRB->SetResources(InvalidBindings.data(), static_cast<Uint32>(InvalidBindings.size()), SET_SHADER_RESOURCE_FLAG_NONE);
+        }
+
+        for (const ShaderResourceVariableBinding& Binding : Bindings)
+            EXPECT_EQ(pSRB->GetVariableByIndex(Binding.ShaderType, Binding.VariableIndex)->Get(Binding.FirstElement), nullptr);
+    }
+
+    pSRB->SetResources(Bindings.data(), static_cast<Uint32>(Bindings.size()), SET_SHADER_RESOURCE_FLAG_NONE);
+
+    for (Uint32 i = 0; i < NumTextures; ++i)
+    {
+        IShaderResourceVariable* pVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, ("g_Texture" + std::to_string(i)).c_str());
+        ASSERT_NE(pVar, nullptr);
+        for (Uint32 elem = 0; elem < ArraySize; ++elem)
+            EXPECT_EQ(pVar->Get(elem), ppSRVs[elem]) << "g_Texture" << i << '[' << elem << ']';
+    }
+    EXPECT_EQ(pSRB->GetVariableByIndex(SHADER_TYPE_VERTEX, BufferIndex)->Get(), pBufferObj);
+
+    // Overwrite one element of the first array
+    const ShaderResourceVariableBinding Overwrite{SHADER_TYPE_PIXEL, Bindings[0].VariableIndex, &ppSRVs[0], ArraySize - 1, 1};
+    pSRB->SetResources(&Overwrite, 1, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+    EXPECT_EQ(pSRB->GetVariableByIndex(SHADER_TYPE_PIXEL, Bindings[0].VariableIndex)->Get(ArraySize - 1), ppSRVs[0]);
+}
+
 } // namespace Diligent
@@ -34,6 +34,9 @@
 #include "GraphicsTypesX.hpp"
 #include "CallbackWrapper.hpp"
 #include "ResourceLayoutTestCommon.hpp"
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+#include "../../../Graphics/GraphicsEngine/include/PipelineUsageTrace.hpp"
 
 #include "InlineShaders/RayTracingTestHLSL.h"
 #include "InlineShaders/DrawCommandTestHLSL.h"
@@ -836,6 +839,69 @@ TEST(RenderStateCacheTest, CreateComputePSO_Sign_Async)
     TestComputePSO(/*UseSignature = */ true, /*CompileAsync = */ true);
 }
 
+TEST(RenderStateCacheTest, UsageTrace)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    RenderStateCacheCreateInfo CacheCI{pDevice};
+    CacheCI.EnableUsageTrace = true;
+
+    RefCntAutoPtr<IRenderStateCache> pCache;
+    CreateRenderStateCache(CacheCI, &pCache);
+    ASSERT_TRUE(pCache);
+
+    RefCntAutoPtr<IShader> pCS;
+    CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, false);
+    ASSERT_NE(pCS, nullptr);
+
+    for (Uint32 i = 0; i < 2; ++i)
+    {
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache, i > 0, pCS, /*UseSignature = */ false, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+    }
+
+    RefCntAutoPtr<DataBlobImpl>     pTraceData = DataBlobImpl::Create();
+    RefCntAutoPtr<MemoryFileStream> pStream    = MemoryFileStream::Create(pTraceData);
+    ASSERT_TRUE(pCache->WriteUsageTrace(pStream));
+
+    std::vector<PipelineUsageTrace::Entry> Entries;
+    ASSERT_TRUE(PipelineUsageTrace::Deserialize(pTraceData->GetConstDataPtr(), pTraceData->GetSize(), Entries));
+    ASSERT_EQ(Entries.size(), 2u);
+
+    EXPECT_TRUE(Entries[0].IsShader());
+    EXPECT_STREQ(Entries[0].Name.c_str(), "RenderStateCache - CS");
+    EXPECT_EQ(Entries[0].NumRequests, 1u);
+
+    EXPECT_EQ(Entries[1].PipelineType, PIPELINE_TYPE_COMPUTE);
+    EXPECT_STREQ(Entries[1].Name.c_str(), "Render State Cache Test");
+    EXPECT_EQ(Entries[1].NumRequests, 2u);
+    EXPECT_GE(Entries[1].FirstUseTime, Entries[0].FirstUseTime);
+
+    for (const PipelineUsageTrace::Entry& Entry : Entries)
+        EXPECT_TRUE(Entry.HashLow != 0 || Entry.HashHigh != 0);
+
+    // The trace is not recorded by default
+    {
+        auto pCache2 = CreateCache(pDevice, /*HotReload = */ false);
+        ASSERT_TRUE(pCache2);
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"Usage trace is disabled"};
+        EXPECT_FALSE(pCache2->WriteUsageTrace(pStream));
+    }
+}
+
 void CreateRayTracingShaders(IRenderStateCache*               pCache,
                              IShaderSourceInputStreamFactory* pShaderSourceFactory,
                              RefCntAutoPtr<IShader>&          pRayGen,
@@ -24,6 +24,8 @@
  *  of the possibility of such damages.
  */
 
+#include <cstdlib>
+
 #include "GPUTestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
 
@@ -134,4 +136,98 @@ TEST(ResourceStateTest, DiscardSubresource)
     pContext->Flush();
 }
 
+// Clears the render target, splits its transition to copy source, and verifies the contents.
+// If FlushBeforeEnd is true, the context is flushed between the begin and end barriers, so
+// the begin barrier must be completed in the first command buffer.
+void TestSplitBarrier(bool FlushBeforeEnd)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Split barrier test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.BindFlags = BIND_RENDER_TARGET;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+
+    TexDesc.Name           = "Split barrier test staging texture";
+    TexDesc.BindFlags      = BIND_NONE;
+    TexDesc.Usage          = USAGE_STAGING;
+    TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<ITexture> pStagingTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pStagingTex);
+    ASSERT_NE(pStagingTex, nullptr);
+
+    ITextureView* pRTV = pTexture->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const float ClearColor[] = {0.4f, 0.1f, 0.2f, 1.f};
+    pContext->ClearRenderTarget(pRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+    pContext->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    ASSERT_EQ(pTexture->GetState(), RESOURCE_STATE_RENDER_TARGET);
+
+    StateTransitionDesc Barrier{pTexture, RESOURCE_STATE_RENDER_TARGET, RESOURCE_STATE_COPY_SOURCE, STATE_TRANSITION_FLAG_NONE};
+    Barrier.TransitionType = STATE_TRANSITION_TYPE_BEGIN;
+    pContext->TransitionResourceStates(1, &Barrier);
+
+    if (FlushBeforeEnd)
+        pContext->Flush();
+
+    Barrier.TransitionType = STATE_TRANSITION_TYPE_END;
+    Barrier.Flags          = STATE_TRANSITION_FLAG_UPDATE_STATE;
+    pContext->TransitionResourceStates(1, &Barrier);
+    EXPECT_EQ(pTexture->GetState(), RESOURCE_STATE_COPY_SOURCE);
+
+    CopyTextureAttribs CopyAttribs{pTexture, RESOURCE_STATE_TRANSITION_MODE_VERIFY, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+    pContext->CopyTexture(CopyAttribs);
+    pContext->WaitForIdle();
+
+    MappedTextureSubresource MappedSubres;
+    pContext->MapTextureSubresource(pStagingTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedSubres);
+    ASSERT_NE(MappedSubres.pData, nullptr);
+
+    bool DataOK = true;
+    for (Uint32 y = 0; y < TexDesc.Height && DataOK; ++y)
+    {
+        const Uint8* pRow = static_cast<const Uint8*>(MappedSubres.pData) + y * MappedSubres.Stride;
+        for (Uint32 x = 0; x < TexDesc.Width * 4 && DataOK; ++x)
+        {
+            const int Expected = static_cast<int>(ClearColor[x % 4] * 255.f + 0.5f);
+            DataOK             = std::abs(static_cast<int>(pRow[x]) - Expected) <= 1;
+        }
+    }
+    EXPECT_TRUE(DataOK);
+
+    pContext->UnmapTextureSubresource(pStagingTex, 0, 0);
+}
+
+TEST(ResourceStateTest, SplitBarrier)
+{
+    const auto& DeviceInfo = GPUTestingEnvironment::GetInstance()->GetDevice()->GetDeviceInfo();
+    if (DeviceInfo.Type != RENDER_DEVICE_TYPE_D3D12 && DeviceInfo.Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Split barriers are only supported in D3D12 and Vulkan backends";
+
+    TestSplitBarrier(false);
+}
+
+TEST(ResourceStateTest, SplitBarrierAcrossFlush)
+{
+    const auto& DeviceInfo = GPUTestingEnvironment::GetInstance()->GetDevice()->GetDeviceInfo();
+    if (DeviceInfo.Type != RENDER_DEVICE_TYPE_D3D12 && DeviceInfo.Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Split barriers are only supported in D3D12 and Vulkan backends";
+
+    TestSplitBarrier(true);
+}
+
 } // namespace
@@ -0,0 +1,218 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+#include "GraphicsAccessories.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TextureDesc GetHostUploadTextureDesc(Uint32 Size, MISC_TEXTURE_FLAGS MiscFlags)
+{
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Host upload test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.Width     = Size;
+    TexDesc.Height    = Size;
+    TexDesc.MipLevels = 0;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.MiscFlags = MiscFlags;
+    return TexDesc;
+}
+
+void UpdateMip(IDeviceContext* pContext, ITexture* pTexture, Uint32 Mip, const std::vector<Uint8>& MipData)
+{
+    const MipLevelProperties MipAttribs = GetMipLevelProperties(pTexture->GetDesc(), Mip);
+
+    TextureSubResData SubResData{MipData.data(), MipAttribs.RowSize};
+    pContext->UpdateTexture(pTexture, Mip, 0, Box{0, MipAttribs.LogicalWidth, 0, MipAttribs.LogicalHeight}, SubResData,
+                            RESOURCE_STATE_TRANSITION_MODE_NONE, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+}
+
+RefCntAutoPtr<ITexture> CreateStagingTexture(IRenderDevice* pDevice, ITexture* pTexture)
+{
+    TextureDesc StagingTexDesc    = pTexture->GetDesc();
+    StagingTexDesc.Name           = "Host upload test staging texture";
+    StagingTexDesc.BindFlags      = BIND_NONE;
+    StagingTexDesc.Usage          = USAGE_STAGING;
+    StagingTexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    StagingTexDesc.MiscFlags      = MISC_TEXTURE_FLAG_NONE;
+
+    RefCntAutoPtr<ITexture> pStagingTex;
+    pDevice->CreateTexture(StagingTexDesc, nullptr, &pStagingTex);
+    return pStagingTex;
+}
+
+void GenerateMipData(const TextureDesc& TexDesc, Uint32 Mip, FastRandInt& rnd, std::vector<Uint8>& MipData)
+{
+    MipData.resize(static_cast<size_t>(GetMipLevelProperties(TexDesc, Mip).MipSize));
+    for (Uint8& texel : MipData)
+        texel = static_cast<Uint8>(rnd());
+}
+
+void VerifyTextureData(IDeviceContext* pContext, ITexture* pTexture, ITexture* pStagingTex, const std::vector<std::vector<Uint8>>& RefData)
+{
+    const Uint32 MipLevels = pTexture->GetDesc().MipLevels;
+    for (Uint32 mip = 0; mip < MipLevels; ++mip)
+    {
+        CopyTextureAttribs CopyAttribs{pTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+        CopyAttribs.SrcMipLevel = mip;
+        CopyAttribs.DstMipLevel = mip;
+        pContext->CopyTexture(CopyAttribs);
+    }
+    pContext->WaitForIdle();
+
+    for (Uint32 mip = 0; mip < MipLevels; ++mip)
+    {
+        MappedTextureSubresource MappedSubres;
+        pContext->MapTextureSubresource(pStagingTex, mip, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedSubres);
+
+        const MipLevelProperties MipAttribs = GetMipLevelProperties(pTexture->GetDesc(), mip);
+
+        bool DataOK = true;
+        for (Uint32 row = 0; row < MipAttribs.StorageHeight; ++row)
+        {
+            const Uint8* pSrcRow = reinterpret_cast<const Uint8*>(MappedSubres.pData) + row * MappedSubres.Stride;
+            const Uint8* pRefRow = &RefData[mip][static_cast<size_t>(row * MipAttribs.RowSize)];
+            if (memcmp(pSrcRow, pRefRow, static_cast<size_t>(MipAttribs.RowSize)) != 0)
+                DataOK = false;
+        }
+        EXPECT_TRUE(DataOK) << "Mip: " << mip;
+
+        pContext->UnmapTextureSubresource(pStagingTex, mip, 0);
+    }
+}
+
+TEST(TextureHostUpload, UpdateMips)
+{
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const TextureDesc TexDesc = GetHostUploadTextureDesc(128, MISC_TEXTURE_FLAG_HOST_UPLOAD);
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+    const Uint32 MipLevels = pTexture->GetDesc().MipLevels;
+
+    RefCntAutoPtr<ITexture> pStagingTex = CreateStagingTexture(pDevice, pTexture);
+    ASSERT_NE(pStagingTex, nullptr);
+
+    FastRandInt rnd{0, 0, 255};
+
+    std::vector<std::vector<Uint8>> RefData(MipLevels);
+    for (Uint32 mip = 0; mip < MipLevels; ++mip)
+        GenerateMipData(pTexture->GetDesc(), mip, rnd, RefData[mip]);
+
+    // Stream the mip levels starting from the smallest one
+    for (Uint32 mip = MipLevels; mip > 0; --mip)
+        UpdateMip(pContext, pTexture, mip - 1, RefData[mip - 1]);
+
+    // Update a region that does not start at the origin
+    {
+        const Uint32             Mip        = 1;
+        const MipLevelProperties MipAttribs = GetMipLevelProperties(pTexture->GetDesc(), Mip);
+        const Box                Region{8, 24, 4, 20};
+
+        std::vector<Uint8>& MipData = RefData[Mip];
+        for (Uint32 y = Region.MinY; y < Region.MaxY; ++y)
+        {
+            for (Uint32 x = Region.MinX * 4; x < Region.MaxX * 4; ++x)
+                MipData[static_cast<size_t>(y * MipAttribs.RowSize + x)] = static_cast<Uint8>(rnd());
+        }
+
+        TextureSubResData SubResData{&MipData[static_cast<size_t>(Region.MinY * MipAttribs.RowSize + Region.MinX * 4)], MipAttribs.RowSize};
+        pContext->UpdateTexture(pTexture, Mip, 0, Region, SubResData,
+                                RESOURCE_STATE_TRANSITION_MODE_NONE, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    VerifyTextureData(pContext, pTexture, pStagingTex, RefData);
+}
+
+// The texture state is updated when a transition is recorded, before the GPU executes it.
+// The updates that follow a pending transition must not be written to the image by the host.
+TEST(TextureHostUpload, TransitionBeforeUpdate)
+{
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const TextureDesc TexDesc = GetHostUploadTextureDesc(64, MISC_TEXTURE_FLAG_HOST_UPLOAD);
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+    const Uint32 MipLevels = pTexture->GetDesc().MipLevels;
+
+    RefCntAutoPtr<ITexture> pStagingTex = CreateStagingTexture(pDevice, pTexture);
+    ASSERT_NE(pStagingTex, nullptr);
+
+    FastRandInt rnd{1, 0, 255};
+
+    std::vector<std::vector<Uint8>> RefData(MipLevels);
+    for (Uint32 mip = 0; mip < MipLevels; ++mip)
+    {
+        GenerateMipData(pTexture->GetDesc(), mip, rnd, RefData[mip]);
+        UpdateMip(pContext, pTexture, mip, RefData[mip]);
+    }
+
+    // Record the transition, but do not submit it
+    StateTransitionDesc Barrier{pTexture, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pContext->TransitionResourceStates(1, &Barrier);
+
+    GenerateMipData(pTexture->GetDesc(), 0, rnd, RefData[0]);
+    UpdateMip(pContext, pTexture, 0, RefData[0]);
+
+    // Transition the texture back to the shader resource state and wait until the transition is executed,
+    // after which the texture can be updated by the host again
+    Barrier = StateTransitionDesc{pTexture, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pContext->TransitionResourceStates(1, &Barrier);
+    pContext->WaitForIdle();
+
+    GenerateMipData(pTexture->GetDesc(), 1, rnd, RefData[1]);
+    UpdateMip(pContext, pTexture, 1, RefData[1]);
+
+    VerifyTextureData(pContext, pTexture, pStagingTex, RefData);
+}
+
+} // namespace
@@ -0,0 +1,208 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <vector>
+
+#define VK_NO_PROTOTYPES
+#include "vulkan/vulkan.h"
+
+#include "DeviceContextVk.h"
+#include "RenderDeviceVk.h"
+#include "BufferVk.h"
+#include "GPUTestingEnvironment.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 VertexBufferSize = 4096;
+
+// Creates vertex buffers and releases every other one so that memory pages are half empty.
+std::vector<RefCntAutoPtr<IBuffer>> CreateFragmentedBuffers(IRenderDevice* pDevice, Uint32 NumBuffers, std::vector<std::vector<Uint8>>& RefData)
+{
+    FastRandInt rnd{0, 0, 255};
+
+    std::vector<RefCntAutoPtr<IBuffer>> Buffers;
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        std::vector<Uint8> Data(VertexBufferSize);
+        for (Uint8& Byte : Data)
+            Byte = static_cast<Uint8>(rnd());
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Defragmentation test vertex buffer";
+        BuffDesc.Size      = VertexBufferSize;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+
+        BufferData InitData{Data.data(), VertexBufferSize};
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pBuffer);
+        if (!pBuffer)
+            return {};
+
+        if (i % 2 == 0)
+        {
+            Buffers.emplace_back(std::move(pBuffer));
+            RefData.emplace_back(std::move(Data));
+        }
+    }
+    return Buffers;
+}
+
+void VerifyBufferData(IRenderDevice* pDevice, IDeviceContext* pContext, IBuffer* pBuffer, const std::vector<Uint8>& RefData)
+{
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Defragmentation test staging buffer";
+    StagingDesc.Size           = VertexBufferSize;
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, VertexBufferSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    void* pData = nullptr;
+    pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    EXPECT_EQ(memcmp(pData, RefData.data(), VertexBufferSize), 0);
+    pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+}
+
+// Runs the defragmentation until there is nothing left to move
+void Defragment(IDeviceContextVk* pContextVk)
+{
+    MemoryDefragmentationAttribsVk Attribs;
+    Attribs.MaxAllocationsToMove = 8;
+    for (Uint32 i = 0; i < 64 && pContextVk->DefragmentMemory(Attribs); ++i)
+    {
+    }
+}
+
+TEST(MemoryDefragmentationVk, RelocatedBuffersKeepData)
+{
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "Memory defragmentation is only supported in Vulkan";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    RefCntAutoPtr<IRenderDeviceVk>  pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_TRUE(pContextVk && pDeviceVk);
+
+    std::vector<std::vector<Uint8>>     RefData;
+    std::vector<RefCntAutoPtr<IBuffer>> Buffers = CreateFragmentedBuffers(pDevice, 128, RefData);
+    ASSERT_FALSE(Buffers.empty());
+
+    MemoryStatsVk StatsBefore;
+    pDeviceVk->GetMemoryStatsVk(StatsBefore);
+
+    Defragment(pContextVk);
+
+    MemoryStatsVk StatsAfter;
+    pDeviceVk->GetMemoryStatsVk(StatsAfter);
+    LOG_INFO_MESSAGE("Defragmentation moved ", StatsAfter.NumAllocationsMoved - StatsBefore.NumAllocationsMoved, " buffers (",
+                     StatsAfter.NumBytesMoved - StatsBefore.NumBytesMoved, " bytes)");
+
+    for (size_t i = 0; i < Buffers.size(); ++i)
+        VerifyBufferData(pDevice, pContext, Buffers[i], RefData[i]);
+}
+
+TEST(MemoryDefragmentationVk, SkipBuffersUsedByCommandLists)
+{
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "Memory defragmentation is only supported in Vulkan";
+    if (pEnv->GetNumDeferredContexts() == 0)
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_TRUE(pContextVk);
+
+    std::vector<std::vector<Uint8>>     RefData;
+    std::vector<RefCntAutoPtr<IBuffer>> Buffers = CreateFragmentedBuffers(pDevice, 128, RefData);
+    ASSERT_FALSE(Buffers.empty());
+
+    std::vector<VkBuffer> VkBuffers(Buffers.size());
+    for (size_t i = 0; i < Buffers.size(); ++i)
+    {
+        RefCntAutoPtr<IBufferVk> pBufferVk{Buffers[i], IID_BufferVk};
+        ASSERT_NE(pBufferVk, nullptr);
+        VkBuffers[i] = pBufferVk->GetVkBuffer();
+    }
+
+    IDeviceContext* pDeferredCtx = pEnv->GetDeferredContext(0);
+    pDeferredCtx->Begin(0);
+    for (size_t i = 0; i < Buffers.size(); ++i)
+    {
+        IBuffer*     pVBs[]    = {Buffers[i]};
+        const Uint64 Offsets[] = {0};
+        pDeferredCtx->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_NONE, SET_VERTEX_BUFFERS_FLAG_RESET);
+    }
+    RefCntAutoPtr<ICommandList> pCmdList;
+    pDeferredCtx->FinishCommandList(&pCmdList);
+    ASSERT_NE(pCmdList, nullptr);
+
+    // The command list references the buffers, so none of them must be moved
+    Defragment(pContextVk);
+    for (size_t i = 0; i < Buffers.size(); ++i)
+    {
+        RefCntAutoPtr<IBufferVk> pBufferVk{Buffers[i], IID_BufferVk};
+        EXPECT_EQ(pBufferVk->GetVkBuffer(), VkBuffers[i]) << "Buffer " << i << " was moved while referenced by a command list";
+    }
+
+    ICommandList* pCmdLists[] = {pCmdList};
+    pContext->ExecuteCommandLists(1, pCmdLists);
+    pCmdList.Release();
+    pDeferredCtx->FinishFrame();
+
+    // Once the command list is executed, the buffers can be moved
+    Defragment(pContextVk);
+
+    for (size_t i = 0; i < Buffers.size(); ++i)
+        VerifyBufferData(pDevice, pContext, Buffers[i], RefData[i]);
+}
+
+} // namespace
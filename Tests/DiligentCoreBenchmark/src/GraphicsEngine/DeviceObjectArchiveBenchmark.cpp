@@ -0,0 +1,150 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/DeviceObjectArchive.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/EngineMemory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+using DeviceType   = DeviceObjectArchive::DeviceType;
+using ResourceType = DeviceObjectArchive::ResourceType;
+
+SerializedData MakeTestData(Uint32 Seed, size_t Size)
+{
+    SerializedData Data{Size, GetRawAllocator()};
+    for (size_t i = 0; i < Size; ++i)
+        Data.Ptr<Uint8>()[i] = static_cast<Uint8>(Seed * 31 + i);
+    return Data;
+}
+
+// Fills the data with text that compresses similar to shader sources
+SerializedData MakeCompressibleData(Uint32 Seed, size_t Size)
+{
+    static const char* Words[] = {"float4 ", "Color ", "= ", "g_Texture.Sample(", "g_Sampler, ", "UV", ");\n", "return ", "PSInput ", "struct ", "cbuffer "};
+
+    SerializedData Data{Size, GetRawAllocator()};
+    FastRandInt    Rnd{Seed, 0, static_cast<int>(sizeof(Words) / sizeof(Words[0])) - 1};
+    for (size_t Pos = 0; Pos < Size;)
+    {
+        const char*  Word = Words[Rnd()];
+        const size_t Len  = std::min(strlen(Word), Size - Pos);
+        std::memcpy(Data.Ptr<char>() + Pos, Word, Len);
+        Pos += Len;
+    }
+    return Data;
+}
+
+void InitCompressibleArchive(DeviceObjectArchive& Archive, Uint32 NumResources, Uint32 NumShaders, size_t ShaderSize)
+{
+    for (Uint32 res = 0; res < NumResources; ++res)
+    {
+        const std::string Name = "Pipeline " + std::to_string(res);
+        auto&             Data = Archive.GetResourceData(ResourceType::GraphicsPipeline, Name.c_str());
+
+        Data.Common = MakeCompressibleData(res, 512 + res % 7);
+        // Small blobs are not compressed, so the archive contains mixed data
+        Data.DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)] = MakeTestData(res, 8);
+    }
+
+    auto& Shaders = Archive.GetDeviceShaders(DeviceType::Vulkan);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+        Shaders.emplace_back(MakeCompressibleData(1000 + i, ShaderSize + i));
+}
+
+TEST(DeviceObjectArchiveBenchmark, Compression)
+{
+    DeviceObjectArchive RefArchive;
+    InitCompressibleArchive(RefArchive, 2048, 2048, 16384);
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{std::max(std::thread::hardware_concurrency(), 2u)});
+
+    RefCntAutoPtr<IDataBlob> pData;
+    RefArchive.Serialize(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    DeviceObjectArchive::CompressionInfo CompressionInfo;
+    CompressionInfo.pCodec      = &DeviceObjectArchive::GetLZCodec();
+    CompressionInfo.pThreadPool = pThreadPool;
+    RefArchive.SetCompression(CompressionInfo);
+
+    Timer T;
+
+    RefCntAutoPtr<IDataBlob> pCompressedData;
+    const double             StartCompress = T.GetElapsedTime();
+    RefArchive.Serialize(&pCompressedData);
+    const double CompressTime = T.GetElapsedTime() - StartCompress;
+    ASSERT_NE(pCompressedData, nullptr);
+
+    LOG_INFO_MESSAGE("Archive size: ", pData->GetSize() / 1024, " KB uncompressed, ", pCompressedData->GetSize() / 1024, " KB compressed (",
+                     std::fixed, std::setprecision(1), 100.0 * pCompressedData->GetSize() / pData->GetSize(), "%). Compression time: ",
+                     CompressTime * 1000, " ms");
+
+    auto LoadArchive = [&](const IDataBlob* pArchiveData, IThreadPool* pPool) {
+        const double        StartTime = T.GetElapsedTime();
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pArchiveData}};
+        const double        OpenTime = T.GetElapsedTime() - StartTime;
+
+        if (pPool != nullptr)
+            Archive.Decompress(pPool);
+
+        size_t TotalSize = 0;
+        for (const auto& it : Archive.GetNamedResources())
+            TotalSize += Archive.GetUncompressedData(it.second.Common).Size();
+        for (size_t i = 0; i < RefArchive.GetDeviceShaders(DeviceType::Vulkan).size(); ++i)
+            TotalSize += Archive.GetSerializedShader(DeviceType::Vulkan, i).Size();
+        EXPECT_GT(TotalSize, size_t{0});
+
+        return std::make_pair(OpenTime, T.GetElapsedTime() - StartTime);
+    };
+
+    const auto Uncompressed = LoadArchive(pData, nullptr);
+    const auto Compressed   = LoadArchive(pCompressedData, nullptr);
+    const auto Parallel     = LoadArchive(pCompressedData, pThreadPool);
+
+    LOG_INFO_MESSAGE("Open / open and access all data time, ms:"
+                     "\n  uncompressed:          ",
+                     Uncompressed.first * 1000, " / ", Uncompressed.second * 1000,
+                     "\n  compressed:            ", Compressed.first * 1000, " / ", Compressed.second * 1000,
+                     "\n  compressed (parallel): ", Parallel.first * 1000, " / ", Parallel.second * 1000);
+}
+
+} // namespace
@@ -0,0 +1,286 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+#include "EngineFactoryNull.h"
+#include "RefCntAutoPtr.hpp"
+#include "Timer.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Measures CPU-side cost of the common engine API calls using the Null backend.
+// The Null device performs all object creation and command validation that is shared
+// by all backends, but does not submit any work to a GPU, so the reported time is the
+// engine overhead that the application pays on the CPU.
+class NullDeviceBenchmark : public ::testing::Test
+{
+protected:
+    static constexpr Uint32 NumIterations = 100000;
+    // Object creation is much more expensive, so use fewer iterations
+    static constexpr Uint32 NumObjects = NumIterations / 100;
+
+    void SetUp() override
+    {
+        EngineNullCreateInfo EngineCI;
+        GetEngineFactoryNull()->CreateDeviceAndContextsNull(EngineCI, &m_pDevice, &m_pContext);
+        ASSERT_NE(m_pDevice, nullptr);
+        ASSERT_NE(m_pContext, nullptr);
+
+        CreateResources();
+        CreateSignature();
+        ASSERT_NE(m_pSignature, nullptr);
+
+        for (Uint32 i = 0; i < _countof(m_pPSO); ++i)
+        {
+            CreatePipelineState(&m_pPSO[i]);
+            ASSERT_NE(m_pPSO[i], nullptr);
+        }
+
+        m_pSignature->CreateShaderResourceBinding(&m_pSRB, true);
+        ASSERT_NE(m_pSRB, nullptr);
+        m_pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(m_pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+
+        ITextureView* pRTV = m_pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+        m_pContext->SetRenderTargets(1, &pRTV, m_pDepthBuffer->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        void* pData = nullptr;
+        m_pContext->MapBuffer(m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+        m_pContext->UnmapBuffer(m_pConstants, MAP_WRITE);
+    }
+
+    // Runs the callback NumCalls times and reports the average time per call
+    template <typename CallbackType>
+    void Measure(const char* Name, Uint32 NumCalls, CallbackType&& Callback)
+    {
+        // Warm up caches and lazily initialized state
+        for (Uint32 i = 0; i < std::min(NumCalls, 100u); ++i)
+            Callback(i);
+
+        Timer        T;
+        const double StartTime = T.GetElapsedTime();
+        for (Uint32 i = 0; i < NumCalls; ++i)
+            Callback(i);
+        const double ElapsedTime = T.GetElapsedTime() - StartTime;
+
+        m_pContext->Flush();
+        m_pContext->FinishFrame();
+
+        LOG_INFO_MESSAGE(Name, ": ", ElapsedTime * 1e+9 / NumCalls, " ns/call (", NumCalls, " calls)");
+    }
+
+    void CreateResources()
+    {
+        {
+            BufferDesc BuffDesc;
+            BuffDesc.Name      = "Vertex buffer";
+            BuffDesc.Size      = sizeof(float) * 3 * 3;
+            BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+            BuffDesc.Usage     = USAGE_DEFAULT;
+            m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pVertexBuffer);
+            ASSERT_NE(m_pVertexBuffer, nullptr);
+        }
+
+        {
+            BufferDesc BuffDesc;
+            BuffDesc.Name           = "Constants";
+            BuffDesc.Size           = 256;
+            BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+            BuffDesc.Usage          = USAGE_DYNAMIC;
+            BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+            m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pConstants);
+            ASSERT_NE(m_pConstants, nullptr);
+        }
+
+        {
+            TextureDesc TexDesc;
+            TexDesc.Name      = "Texture";
+            TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+            TexDesc.Width     = 256;
+            TexDesc.Height    = 256;
+            TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+            TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+            m_pDevice->CreateTexture(TexDesc, nullptr, &m_pTexture);
+            ASSERT_NE(m_pTexture, nullptr);
+
+            TexDesc.Name      = "Render target";
+            TexDesc.BindFlags = BIND_RENDER_TARGET;
+            m_pDevice->CreateTexture(TexDesc, nullptr, &m_pRenderTarget);
+            ASSERT_NE(m_pRenderTarget, nullptr);
+
+            TexDesc.Name      = "Depth buffer";
+            TexDesc.Format    = TEX_FORMAT_D32_FLOAT;
+            TexDesc.BindFlags = BIND_DEPTH_STENCIL;
+            m_pDevice->CreateTexture(TexDesc, nullptr, &m_pDepthBuffer);
+            ASSERT_NE(m_pDepthBuffer, nullptr);
+        }
+    }
+
+    void CreateSignature()
+    {
+        // Null shaders have no reflection, so resources are described by an explicit signature
+        const PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "g_Constants", SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+            {SHADER_TYPE_PIXEL, "g_Texture", SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        };
+
+        const ImmutableSamplerDesc ImmutableSamplers[] = {
+            {SHADER_TYPE_PIXEL, "g_Texture", SamplerDesc{}},
+        };
+
+        PipelineResourceSignatureDesc SignDesc;
+        SignDesc.Name                       = "Benchmark signature";
+        SignDesc.Resources                  = Resources;
+        SignDesc.NumResources               = _countof(Resources);
+        SignDesc.ImmutableSamplers          = ImmutableSamplers;
+        SignDesc.NumImmutableSamplers       = _countof(ImmutableSamplers);
+        SignDesc.UseCombinedTextureSamplers = true;
+        m_pDevice->CreatePipelineResourceSignature(SignDesc, &m_pSignature);
+        if (m_pSignature)
+            m_pSignature->GetStaticVariableByName(SHADER_TYPE_VERTEX, "g_Constants")->Set(m_pConstants);
+    }
+
+    void CreatePipelineState(IPipelineState** ppPSO)
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.EntryPoint     = "main";
+        ShaderCI.Source         = "void main() {}";
+
+        RefCntAutoPtr<IShader> pVS;
+        ShaderCI.Desc = {"Benchmark VS", SHADER_TYPE_VERTEX, true};
+        m_pDevice->CreateShader(ShaderCI, &pVS);
+
+        RefCntAutoPtr<IShader> pPS;
+        ShaderCI.Desc = {"Benchmark PS", SHADER_TYPE_PIXEL, true};
+        m_pDevice->CreateShader(ShaderCI, &pPS);
+
+        const LayoutElement LayoutElems[] = {
+            LayoutElement{0, 0, 3, VT_FLOAT32, False},
+        };
+
+        IPipelineResourceSignature* ppSignatures[] = {m_pSignature};
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name = "Benchmark PSO";
+
+        GraphicsPipelineDesc& GraphicsPipeline{PSOCreateInfo.GraphicsPipeline};
+        GraphicsPipeline.NumRenderTargets             = 1;
+        GraphicsPipeline.RTVFormats[0]                = TEX_FORMAT_RGBA8_UNORM;
+        GraphicsPipeline.DSVFormat                    = TEX_FORMAT_D32_FLOAT;
+        GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        GraphicsPipeline.InputLayout.LayoutElements   = LayoutElems;
+        GraphicsPipeline.InputLayout.NumElements      = _countof(LayoutElems);
+        GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = True;
+
+        PSOCreateInfo.pVS                     = pVS;
+        PSOCreateInfo.pPS                     = pPS;
+        PSOCreateInfo.ppResourceSignatures    = ppSignatures;
+        PSOCreateInfo.ResourceSignaturesCount = _countof(ppSignatures);
+
+        m_pDevice->CreateGraphicsPipelineState(PSOCreateInfo, ppPSO);
+    }
+
+    void SetDrawState(Uint32 PSOIdx)
+    {
+        IBuffer* pVBs[] = {m_pVertexBuffer};
+        m_pContext->SetPipelineState(m_pPSO[PSOIdx]);
+        m_pContext->CommitShaderResources(m_pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        m_pContext->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    }
+
+    RefCntAutoPtr<IRenderDevice>              m_pDevice;
+    RefCntAutoPtr<IDeviceContext>             m_pContext;
+    RefCntAutoPtr<IBuffer>                    m_pVertexBuffer;
+    RefCntAutoPtr<IBuffer>                    m_pConstants;
+    RefCntAutoPtr<ITexture>                   m_pTexture;
+    RefCntAutoPtr<ITexture>                   m_pRenderTarget;
+    RefCntAutoPtr<ITexture>                   m_pDepthBuffer;
+    RefCntAutoPtr<IPipelineResourceSignature> m_pSignature;
+    RefCntAutoPtr<IPipelineState>             m_pPSO[2];
+    RefCntAutoPtr<IShaderResourceBinding>     m_pSRB;
+};
+
+TEST_F(NullDeviceBenchmark, StateChanges)
+{
+    IBuffer* pVBs[] = {m_pVertexBuffer};
+
+    Measure("IDeviceContext::SetPipelineState", NumIterations, [&](Uint32 i) {
+        m_pContext->SetPipelineState(m_pPSO[i & 1]);
+    });
+
+    m_pContext->SetPipelineState(m_pPSO[0]);
+    Measure("IDeviceContext::CommitShaderResources", NumIterations, [&](Uint32) {
+        m_pContext->CommitShaderResources(m_pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    });
+
+    Measure("IDeviceContext::SetVertexBuffers", NumIterations, [&](Uint32) {
+        m_pContext->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    });
+
+    Measure("IDeviceContext::MapBuffer/UnmapBuffer", NumIterations, [&](Uint32) {
+        void* pData = nullptr;
+        m_pContext->MapBuffer(m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+        m_pContext->UnmapBuffer(m_pConstants, MAP_WRITE);
+    });
+}
+
+TEST_F(NullDeviceBenchmark, Draw)
+{
+    SetDrawState(0);
+    Measure("IDeviceContext::Draw", NumIterations, [&](Uint32) {
+        m_pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    });
+
+    Measure("Draw call (PSO + SRB + VB + Draw)", NumIterations, [&](Uint32 i) {
+        SetDrawState(i & 1);
+        m_pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    });
+}
+
+TEST_F(NullDeviceBenchmark, ObjectCreation)
+{
+    Measure("IPipelineResourceSignature::CreateShaderResourceBinding", NumObjects, [&](Uint32) {
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        m_pSignature->CreateShaderResourceBinding(&pSRB, true);
+        ASSERT_NE(pSRB, nullptr);
+    });
+
+    Measure("IRenderDevice::CreateGraphicsPipelineState", NumObjects, [&](Uint32) {
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreatePipelineState(&pPSO);
+        ASSERT_NE(pPSO, nullptr);
+    });
+}
+
+} // namespace
@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "../../../../Graphics/GraphicsEngine/include/PSOSerializer.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/EngineMemory.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "PipelineState.h"
+#include "Serializer.hpp"
+#include "Timer.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+using TPRSNames = DeviceObjectArchive::TPRSNames;
+
+TEST(PSOSerializerBenchmark, SinglePassSerialization)
+{
+    constexpr Uint32 NumPipelines = 20000;
+
+    const String PRSNames[] = {"Global Resource Signature", "Material Resource Signature", "Object Resource Signature"};
+
+    std::vector<String>                          PSONames(NumPipelines);
+    std::vector<GraphicsPipelineStateCreateInfo> PSOCreateInfos(NumPipelines);
+
+    std::vector<LayoutElement> LayoutElements(8);
+    for (Uint32 i = 0; i < LayoutElements.size(); ++i)
+        LayoutElements[i] = LayoutElement{i, i / 4, 4, VT_FLOAT32};
+
+    TPRSNames SrcPRSNames = {};
+    for (size_t i = 0; i < _countof(PRSNames); ++i)
+        SrcPRSNames[i] = PRSNames[i].c_str();
+
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        PSONames[i] = "Graphics pipeline state " + std::to_string(i);
+
+        GraphicsPipelineStateCreateInfo& CI  = PSOCreateInfos[i];
+        CI.PSODesc.Name                      = PSONames[i].c_str();
+        CI.ResourceSignaturesCount           = _countof(PRSNames);
+        CI.GraphicsPipeline.NumRenderTargets = static_cast<Uint8>(1 + i % 8);
+        for (Uint32 rt = 0; rt < CI.GraphicsPipeline.NumRenderTargets; ++rt)
+            CI.GraphicsPipeline.RTVFormats[rt] = TEX_FORMAT_RGBA8_UNORM;
+        CI.GraphicsPipeline.DSVFormat                  = TEX_FORMAT_D32_FLOAT;
+        CI.GraphicsPipeline.InputLayout.LayoutElements = LayoutElements.data();
+        CI.GraphicsPipeline.InputLayout.NumElements    = 1 + i % static_cast<Uint32>(LayoutElements.size());
+    }
+
+    const char* RPName = "Render pass";
+
+    Timer T;
+
+    std::vector<SerializedData> RefData(NumPipelines);
+
+    const double MeasureWriteStart = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        Serializer<SerializerMode::Measure> MSer;
+        PSOSerializer<SerializerMode::Measure>::SerializeCreateInfo(MSer, PSOCreateInfos[i], SrcPRSNames, nullptr, RPName);
+        RefData[i] = MSer.AllocateData(GetRawAllocator());
+
+        Serializer<SerializerMode::Write> WSer{RefData[i]};
+        PSOSerializer<SerializerMode::Write>::SerializeCreateInfo(WSer, PSOCreateInfos[i], SrcPRSNames, nullptr, RPName);
+    }
+    const double MeasureWriteTime = T.GetElapsedTime() - MeasureWriteStart;
+
+    std::vector<SerializedData> Data(NumPipelines);
+
+    const double SinglePassStart = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        SerializationBuffer Buffer{GetRawAllocator()};
+
+        Serializer<SerializerMode::Write> Ser{Buffer};
+        PSOSerializer<SerializerMode::Write>::SerializeCreateInfo(Ser, PSOCreateInfos[i], SrcPRSNames, nullptr, RPName);
+        Data[i] = Buffer.GetData(GetRawAllocator());
+    }
+    const double SinglePassTime = T.GetElapsedTime() - SinglePassStart;
+
+    // All pipelines serialized into one buffer, e.g. when writing an archive
+    const double        SingleBufferStart = T.GetElapsedTime();
+    SerializationBuffer SharedBuffer{GetRawAllocator()};
+    {
+        Serializer<SerializerMode::Write> Ser{SharedBuffer};
+        for (Uint32 i = 0; i < NumPipelines; ++i)
+            PSOSerializer<SerializerMode::Write>::SerializeCreateInfo(Ser, PSOCreateInfos[i], SrcPRSNames, nullptr, RPName);
+    }
+    const double SingleBufferTime = T.GetElapsedTime() - SingleBufferStart;
+
+    size_t TotalSize = 0;
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        ASSERT_EQ(Data[i], RefData[i]) << "Pipeline " << i;
+        TotalSize += Data[i].Size();
+    }
+    EXPECT_EQ(SharedBuffer.GetSize(), TotalSize);
+
+    LOG_INFO_MESSAGE("Serialized ", NumPipelines, " graphics pipelines (", TotalSize / 1024, " KB):"
+                                                                                             "\n  measure + write:           ",
+                     MeasureWriteTime * 1000, " ms"
+                                              "\n  single pass:               ",
+                     SinglePassTime * 1000, " ms"
+                                            "\n  single pass, shared buffer: ",
+                     SingleBufferTime * 1000, " ms");
+}
+
+} // namespace
@@ -0,0 +1,159 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <thread>
+#include <algorithm>
+
+#include "GLSLangUtils.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class GLSLangBenchmark : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GLSLangUtils::InitializeGlslang();
+    }
+
+    static void TearDownTestSuite()
+    {
+        GLSLangUtils::FinalizeGlslang();
+    }
+};
+
+// Creates the batch of HLSL shaders: every source file is compiled with NumVariants different macro values.
+struct HLSLShaderBatch
+{
+    HLSLShaderBatch(IShaderSourceInputStreamFactory* pFactory, Uint32 NumVariants)
+    {
+        static constexpr struct
+        {
+            const char* FilePath;
+            SHADER_TYPE Type;
+        } Sources[] = {
+            {"BatchVS.hlsl", SHADER_TYPE_VERTEX},
+            {"BatchPS.hlsl", SHADER_TYPE_PIXEL},
+            {"BatchCS.hlsl", SHADER_TYPE_COMPUTE},
+        };
+
+        const size_t NumShaders = NumVariants * _countof(Sources);
+        ScaleValues.reserve(NumShaders);
+        Macros.reserve(NumShaders * 2);
+        ShaderCIs.reserve(NumShaders);
+        for (Uint32 variant = 0; variant < NumVariants; ++variant)
+        {
+            for (const auto& Src : Sources)
+            {
+                ScaleValues.emplace_back(std::to_string(variant + 1) + ".0");
+
+                const size_t FirstMacro = Macros.size();
+                Macros.emplace_back("SCALE", ScaleValues.back().c_str());
+                Macros.emplace_back("USE_SRGB", (variant & 0x01) != 0 ? "1" : "0");
+
+                ShaderCreateInfo ShaderCI;
+                ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+                ShaderCI.FilePath                   = Src.FilePath;
+                ShaderCI.Desc                       = {Src.FilePath, Src.Type};
+                ShaderCI.EntryPoint                 = "main";
+                ShaderCI.Macros                     = {&Macros[FirstMacro], 2};
+                ShaderCI.pShaderSourceStreamFactory = pFactory;
+                ShaderCIs.emplace_back(ShaderCI);
+            }
+        }
+    }
+
+    std::vector<std::string>      ScaleValues;
+    std::vector<ShaderMacro>      Macros;
+    std::vector<ShaderCreateInfo> ShaderCIs;
+};
+
+// Compiles the shader batch with 1..N threads and reports the compilation time
+TEST_F(GLSLangBenchmark, HLSLThreadScaling)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/GLSLang", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    HLSLShaderBatch Batch{pShaderSourceFactory, 16};
+    const size_t    NumShaders = Batch.ShaderCIs.size();
+
+    Timer  T;
+    double StartTime = T.GetElapsedTime();
+
+    std::vector<std::vector<unsigned int>> RefSPIRVs(NumShaders);
+    for (size_t i = 0; i < NumShaders; ++i)
+    {
+        RefSPIRVs[i] = GLSLangUtils::HLSLtoSPIRV(Batch.ShaderCIs[i], GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+        ASSERT_FALSE(RefSPIRVs[i].empty()) << Batch.ShaderCIs[i].FilePath;
+    }
+
+    const double RefTime = T.GetElapsedTime() - StartTime;
+    LOG_INFO_MESSAGE("Compiled ", NumShaders, " HLSL shaders in the calling thread without compile session: ", RefTime * 1000, " ms");
+
+    const Uint32 MaxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    for (Uint32 NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+    {
+        // The calling thread also compiles shaders, so the pool has one thread less
+        RefCntAutoPtr<IThreadPool> pThreadPool;
+        if (NumThreads > 1)
+        {
+            ThreadPoolCreateInfo ThreadPoolCI;
+            ThreadPoolCI.NumThreads = NumThreads - 1;
+            pThreadPool             = CreateThreadPool(ThreadPoolCI);
+            ASSERT_NE(pThreadPool, nullptr);
+        }
+
+        GLSLangUtils::CompileSession Session;
+
+        StartTime = T.GetElapsedTime();
+
+        std::vector<std::vector<unsigned int>> SPIRVs(NumShaders);
+        ProcessInParallel(pThreadPool, NumShaders,
+                          [&](size_t i) {
+                              SPIRVs[i] = GLSLangUtils::HLSLtoSPIRV(Batch.ShaderCIs[i], GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr, &Session);
+                          });
+
+        const double Time = T.GetElapsedTime() - StartTime;
+        LOG_INFO_MESSAGE("Compiled ", NumShaders, " HLSL shaders using ", NumThreads, (NumThreads > 1 ? " threads: " : " thread: "),
+                         Time * 1000, " ms (", RefTime / std::max(Time, 1e-6), "x)");
+
+        for (size_t i = 0; i < NumShaders; ++i)
+            EXPECT_EQ(SPIRVs[i], RefSPIRVs[i]) << Batch.ShaderCIs[i].FilePath;
+    }
+}
+
+} // namespace
@@ -0,0 +1,95 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "HLSL2GLSLConverter.h"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
+#include "DataBlobImpl.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(HLSL2GLSLConverterBenchmark, Conversion)
+{
+    // The benchmark runs from the unit test assets directory and uses the converter test shaders
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory("../../DiligentCoreAPITest/assets/shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pSource;
+    {
+        RefCntAutoPtr<IFileStream> pStream;
+        pShaderSourceFactory->CreateInputStream("VS_PS.hlsl", &pStream);
+        ASSERT_NE(pStream, nullptr);
+        pSource = DataBlobImpl::Create();
+        pStream->ReadBlob(pSource);
+    }
+    const char*  HLSLSource = pSource->GetConstDataPtr<char>();
+    const size_t SourceLen  = pSource->GetSize();
+
+    RefCntAutoPtr<IHLSL2GLSLConverter> pConverter;
+    CreateHLSL2GLSLConverter(&pConverter);
+    ASSERT_NE(pConverter, nullptr);
+
+    constexpr Uint32 NumIterations = 20;
+
+    Timer  T;
+    double StartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+        pConverter->CreateStream("VS_PS.hlsl", pShaderSourceFactory, HLSLSource, SourceLen, &pStream);
+        ASSERT_NE(pStream, nullptr);
+    }
+    const double TokenizationTime = (T.GetElapsedTime() - StartTime) / NumIterations;
+
+    RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+    pConverter->CreateStream("VS_PS.hlsl", pShaderSourceFactory, HLSLSource, SourceLen, &pStream);
+    ASSERT_NE(pStream, nullptr);
+
+    StartTime = T.GetElapsedTime();
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        for (const auto& EntryPoint : {std::make_pair("TestVS", SHADER_TYPE_VERTEX), std::make_pair("TestPS", SHADER_TYPE_PIXEL)})
+        {
+            RefCntAutoPtr<IDataBlob> pGLSL;
+            pStream->Convert(EntryPoint.first, EntryPoint.second, true, "_sampler", true, false, &pGLSL);
+            ASSERT_NE(pGLSL, nullptr);
+        }
+    }
+    const double ConversionTime = (T.GetElapsedTime() - StartTime) / (NumIterations * 2);
+
+    LOG_INFO_MESSAGE("HLSL2GLSL conversion of VS_PS.hlsl (", SourceLen, " bytes): tokenization ", TokenizationTime * 1000, " ms (",
+                     static_cast<double>(SourceLen) / (TokenizationTime * (1 << 20)), " MB/s), conversion ", ConversionTime * 1000, " ms (",
+                     static_cast<double>(SourceLen) / (ConversionTime * (1 << 20)), " MB/s)");
+}
+
+} // namespace
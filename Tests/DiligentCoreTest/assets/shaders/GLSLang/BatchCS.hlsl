@@ -0,0 +1,16 @@
+#include "Lighting.fxh"
+
+cbuffer cbConstants
+{
+    Constants g_Constants;
+};
+
+RWTexture2D<float4 /*format = rgba8*/> g_Output;
+Texture2D<float4>                      g_Normals;
+
+[numthreads(8, 8, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    float3 Normal = g_Normals.Load(int3(DTid.xy, 0)).xyz;
+    g_Output[DTid.xy] = float4(ApplyLighting(g_Constants, Normal, float3(SCALE, SCALE, SCALE)), 1.0);
+}
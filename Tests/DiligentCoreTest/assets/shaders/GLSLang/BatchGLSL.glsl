@@ -0,0 +1,16 @@
+#version 450
+#extension GL_GOOGLE_include_directive : enable
+
+#include "Common.glsl"
+
+layout(std140) uniform cbConstants
+{
+    mat4 g_WorldViewProj;
+};
+
+layout(location = 0) in vec3 in_Pos;
+
+void main()
+{
+    gl_Position = g_WorldViewProj * vec4(Scale(in_Pos), 1.0);
+}
@@ -0,0 +1,22 @@
+#include "Lighting.fxh"
+
+cbuffer cbConstants
+{
+    Constants g_Constants;
+};
+
+Texture2D    g_Texture;
+SamplerState g_Texture_sampler;
+
+struct PSInput
+{
+    float4 Pos    : SV_Position;
+    float3 Normal : NORMAL;
+    float2 UV     : TEX_COORD;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    float4 BaseColor = g_Texture.Sample(g_Texture_sampler, PSIn.UV * SCALE);
+    return float4(ApplyLighting(g_Constants, PSIn.Normal, BaseColor.rgb), BaseColor.a);
+}
@@ -0,0 +1,23 @@
+#include "Common.fxh"
+
+cbuffer cbConstants
+{
+    Constants g_Constants;
+};
+
+struct VSOutput
+{
+    float4 Pos    : SV_Position;
+    float3 Normal : NORMAL;
+    float2 UV     : TEX_COORD;
+};
+
+void main(in  float3   Pos    : ATTRIB0,
+          in  float3   Normal : ATTRIB1,
+          in  float2   UV     : ATTRIB2,
+          out VSOutput VSOut)
+{
+    VSOut.Pos    = mul(float4(Pos * SCALE, 1.0), g_Constants.WorldViewProj);
+    VSOut.Normal = Normal;
+    VSOut.UV     = UV;
+}
@@ -0,0 +1,9 @@
+#ifndef _COMMON_GLSL_
+#define _COMMON_GLSL_
+
+vec3 Scale(vec3 Pos)
+{
+    return Pos * float(SCALE);
+}
+
+#endif // _COMMON_GLSL_
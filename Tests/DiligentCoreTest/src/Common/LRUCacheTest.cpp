@@ -126,6 +126,35 @@ TEST(Common_LRUCache, ReleaseQueue)
     }
 }
 
+TEST(Common_LRUCache, Clear)
+{
+    LRUCache<int, CacheData> Cache{16};
+
+    Uint32 NumInits = 0;
+    auto   GetData  = [&](int Key) {
+        return Cache.Get(Key,
+                         [&](CacheData& Data, size_t& Size) //
+                         {
+                             ++NumInits;
+                             Data.Value = static_cast<Uint32>(Key);
+                             Size       = 2;
+                         });
+    };
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(GetData(i).Value, static_cast<Uint32>(i));
+    EXPECT_EQ(NumInits, 4u);
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{8});
+
+    Cache.Clear();
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{0});
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(GetData(i).Value, static_cast<Uint32>(i));
+    EXPECT_EQ(NumInits, 8u);
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{8});
+}
+
 
 TEST(Common_LRUCache, Exceptions)
 {
@@ -0,0 +1,160 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "LZCompression.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<Uint8> Compress(const std::vector<Uint8>& Src)
+{
+    std::vector<Uint8> Dst(GetLZMaxCompressedSize(Src.size()));
+
+    const size_t CompressedSize = LZCompress(Src.data(), Src.size(), Dst.data(), Dst.size());
+    EXPECT_NE(CompressedSize, size_t{0});
+    Dst.resize(CompressedSize);
+    return Dst;
+}
+
+void TestRoundTrip(const std::vector<Uint8>& Src)
+{
+    const std::vector<Uint8> Compressed = Compress(Src);
+    EXPECT_LE(Compressed.size(), GetLZMaxCompressedSize(Src.size()));
+
+    std::vector<Uint8> Decompressed(Src.size());
+    ASSERT_TRUE(LZDecompress(Compressed.data(), Compressed.size(), Decompressed.data(), Decompressed.size()));
+    EXPECT_EQ(Decompressed, Src);
+}
+
+std::vector<Uint8> MakeRandomData(size_t Size, Uint32 Seed)
+{
+    FastRandInt        Rnd{Seed, 0, 255};
+    std::vector<Uint8> Data(Size);
+    for (Uint8& Byte : Data)
+        Byte = static_cast<Uint8>(Rnd());
+    return Data;
+}
+
+std::vector<Uint8> MakeTextData(size_t Size)
+{
+    static const std::vector<std::string> Words = {"float4 ", "Color ", "= ", "g_Texture.Sample(", "g_Sampler, ", "UV", ");\n", "return ", "PSInput ", "struct "};
+
+    FastRandInt        Rnd{7, 0, static_cast<int>(Words.size()) - 1};
+    std::vector<Uint8> Data;
+    while (Data.size() < Size)
+    {
+        const std::string& Word = Words[Rnd()];
+        Data.insert(Data.end(), Word.begin(), Word.end());
+    }
+    Data.resize(Size);
+    return Data;
+}
+
+TEST(Common_LZCompression, RoundTrip)
+{
+    TestRoundTrip({});
+    TestRoundTrip({42});
+    TestRoundTrip({1, 2, 3});
+    TestRoundTrip(std::vector<Uint8>(17, 0xAB));
+    TestRoundTrip(std::vector<Uint8>(100000, 0));
+
+    for (size_t Size : {5, 16, 255, 256, 4096, 70000, 300000})
+    {
+        TestRoundTrip(MakeRandomData(Size, static_cast<Uint32>(Size)));
+        TestRoundTrip(MakeTextData(Size));
+    }
+
+    // Long literal runs followed by long matches
+    {
+        std::vector<Uint8> Data = MakeRandomData(1000, 1);
+        Data.insert(Data.end(), Data.begin(), Data.end());
+        Data.resize(Data.size() + 600, 0xCD);
+        TestRoundTrip(Data);
+    }
+}
+
+TEST(Common_LZCompression, CompressionRatio)
+{
+    const std::vector<Uint8> Text = MakeTextData(65536);
+    EXPECT_LT(Compress(Text).size(), Text.size() / 2);
+
+    const std::vector<Uint8> Zeros(65536);
+    EXPECT_LT(Compress(Zeros).size(), size_t{512});
+    // Highly compressible data must still fit into the max decompressed size
+    EXPECT_LE(Zeros.size(), GetLZMaxDecompressedSize(Compress(Zeros).size()));
+
+    // Incompressible data must fit into the max compressed size
+    const std::vector<Uint8> Random = MakeRandomData(65536, 123);
+    EXPECT_LE(Compress(Random).size(), GetLZMaxCompressedSize(Random.size()));
+}
+
+TEST(Common_LZCompression, SmallDstBuffer)
+{
+    const std::vector<Uint8> Src = MakeRandomData(1024, 5);
+    std::vector<Uint8>       Dst(512);
+    EXPECT_EQ(LZCompress(Src.data(), Src.size(), Dst.data(), Dst.size()), size_t{0});
+}
+
+TEST(Common_LZCompression, InvalidData)
+{
+    const std::vector<Uint8> Src        = MakeTextData(4096);
+    const std::vector<Uint8> Compressed = Compress(Src);
+
+    std::vector<Uint8> Dst(Src.size());
+
+    // Wrong decompressed size
+    EXPECT_FALSE(LZDecompress(Compressed.data(), Compressed.size(), Dst.data(), Dst.size() - 1));
+    Dst.resize(Src.size() + 1);
+    EXPECT_FALSE(LZDecompress(Compressed.data(), Compressed.size(), Dst.data(), Dst.size()));
+    Dst.resize(Src.size());
+
+    // Truncated stream
+    EXPECT_FALSE(LZDecompress(Compressed.data(), Compressed.size() - 1, Dst.data(), Dst.size()));
+    EXPECT_FALSE(LZDecompress(Compressed.data(), Compressed.size() / 2, Dst.data(), Dst.size()));
+
+    // Random garbage must never result in out-of-bounds access
+    for (Uint32 i = 0; i < 64; ++i)
+    {
+        std::vector<Uint8> Corrupted = Compressed;
+        FastRandInt        Rnd{i, 0, static_cast<int>(Corrupted.size() - 1)};
+        for (int j = 0; j < 8; ++j)
+            Corrupted[Rnd()] ^= static_cast<Uint8>(1 + j);
+        LZDecompress(Corrupted.data(), Corrupted.size(), Dst.data(), Dst.size());
+    }
+}
+
+} // namespace
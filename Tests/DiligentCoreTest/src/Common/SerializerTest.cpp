@@ -26,8 +26,12 @@
 
 #include <cstring>
 
+#include <vector>
+
 #include "Serializer.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
 
 #include "gtest/gtest.h"
 
@@ -172,4 +176,171 @@ TEST(SerializerTest, SerializerTest)
     }
 }
 
+template <typename SerializerType>
+void WriteTestData(SerializerType& Ser, DynamicLinearAllocator& Allocator)
+{
+    std::vector<Uint8> LargeData(300);
+    for (size_t i = 0; i < LargeData.size(); ++i)
+        LargeData[i] = static_cast<Uint8>(i * 7 + 3);
+
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const std::string Str   = "String " + std::to_string(i);
+        const char* const pStr  = Str.c_str();
+        const Uint64      U64   = 0x0123456789ABCDEFull + i;
+        const Uint8       U8    = static_cast<Uint8>(i);
+        const Uint32      Count = 3;
+        const Uint16      Array[Count]{static_cast<Uint16>(i), static_cast<Uint16>(i + 1), static_cast<Uint16>(i + 2)};
+
+        EXPECT_TRUE(Ser(U8, pStr, U64));
+        EXPECT_TRUE(Ser.SerializeArrayRaw(&Allocator, Array, Count));
+        EXPECT_TRUE(Ser.SerializeBytes(LargeData.data(), LargeData.size() - i * 11, 16));
+    }
+}
+
+TEST(SerializerTest, SinglePassWrite)
+{
+    IMemoryAllocator&      RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+    DynamicLinearAllocator TmpAllocator{RawAllocator};
+
+    Serializer<SerializerMode::Measure> MSer;
+    WriteTestData(MSer, TmpAllocator);
+
+    SerializedData RefData = MSer.AllocateData(RawAllocator);
+    {
+        Serializer<SerializerMode::Write> WSer{RefData};
+        WriteTestData(WSer, TmpAllocator);
+        EXPECT_TRUE(WSer.IsEnded());
+    }
+
+    for (size_t ChunkSize : {size_t{64}, size_t{100}, size_t{1024}, SerializationBuffer::DefaultChunkSize})
+    {
+        SerializationBuffer Buffer{RawAllocator, ChunkSize};
+        {
+            Serializer<SerializerMode::Write> WSer{Buffer};
+            WriteTestData(WSer, TmpAllocator);
+            EXPECT_EQ(WSer.GetSize(), RefData.Size());
+        }
+        EXPECT_EQ(Buffer.GetSize(), RefData.Size());
+
+        SerializedData Data = Buffer.GetData(RawAllocator);
+        EXPECT_EQ(Data, RefData) << "Chunk size: " << ChunkSize;
+    }
+}
+
+template <typename SerializerType>
+void WritePatchedData(SerializerType& Ser)
+{
+    const size_t SizeOffset = Ser.template Reserve<Uint32>();
+
+    const size_t Start = Ser.GetSize();
+    for (Uint32 i = 0; i < 100; ++i)
+        EXPECT_TRUE(Ser(i));
+    const char* const Str = "Patched string";
+    EXPECT_TRUE(Ser(Str));
+    const Uint32 Size = static_cast<Uint32>(Ser.GetSize() - Start);
+
+    const size_t HashOffset = Ser.template Reserve<Uint64>();
+    EXPECT_TRUE(Ser(Size));
+
+    EXPECT_TRUE(Ser.Patch(SizeOffset, Size));
+    EXPECT_TRUE(Ser.Patch(HashOffset, Uint64{0x0123456789ABCDEFull}));
+}
+
+void VerifyPatchedData(const SerializedData& Data)
+{
+    Serializer<SerializerMode::Read> RSer{Data};
+
+    Uint32 Size = 0;
+    EXPECT_TRUE(RSer(Size));
+    for (Uint32 i = 0; i < 100; ++i)
+    {
+        Uint32 Val = ~0u;
+        EXPECT_TRUE(RSer(Val));
+        EXPECT_EQ(Val, i);
+    }
+    const char* Str = nullptr;
+    EXPECT_TRUE(RSer(Str));
+    EXPECT_STREQ(Str, "Patched string");
+
+    Uint64 Hash = 0;
+    EXPECT_TRUE(RSer(Hash));
+    EXPECT_EQ(Hash, 0x0123456789ABCDEFull);
+
+    Uint32 Size2 = 0;
+    EXPECT_TRUE(RSer(Size2));
+    EXPECT_EQ(Size, Size2);
+    EXPECT_EQ(Size, Uint32{100 * sizeof(Uint32) + sizeof(Uint32) + sizeof("Patched string")});
+    EXPECT_TRUE(RSer.IsEnded());
+}
+
+TEST(SerializerTest, ReserveAndPatch)
+{
+    IMemoryAllocator& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    // Measure + write
+    {
+        Serializer<SerializerMode::Measure> MSer;
+        WritePatchedData(MSer);
+
+        SerializedData Data = MSer.AllocateData(RawAllocator);
+
+        Serializer<SerializerMode::Write> WSer{Data};
+        WritePatchedData(WSer);
+        EXPECT_TRUE(WSer.IsEnded());
+
+        VerifyPatchedData(Data);
+    }
+
+    // Single pass, patched values cross chunk boundaries
+    for (size_t ChunkSize : {size_t{64}, size_t{66}, size_t{4096}})
+    {
+        SerializationBuffer Buffer{RawAllocator, ChunkSize};
+        {
+            Serializer<SerializerMode::Write> WSer{Buffer};
+            WritePatchedData(WSer);
+        }
+        VerifyPatchedData(Buffer.GetData(RawAllocator));
+    }
+}
+
+TEST(SerializerTest, StreamWrite)
+{
+    IMemoryAllocator&      RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+    DynamicLinearAllocator TmpAllocator{RawAllocator};
+
+    SerializationBuffer RefBuffer{RawAllocator};
+    {
+        Serializer<SerializerMode::Write> WSer{RefBuffer};
+        WriteTestData(WSer, TmpAllocator);
+        WritePatchedData(WSer);
+    }
+    SerializedData RefData = RefBuffer.GetData(RawAllocator);
+
+    for (size_t ChunkSize : {size_t{64}, size_t{66}, size_t{1000}, SerializationBuffer::DefaultChunkSize})
+    {
+        RefCntAutoPtr<DataBlobImpl>     pStreamData = DataBlobImpl::Create();
+        RefCntAutoPtr<MemoryFileStream> pStream     = MemoryFileStream::Create(pStreamData);
+
+        // The data is written starting at the current stream position
+        const Uint32 Header = 0xABCD1234u;
+        pStream->Write(&Header, sizeof(Header));
+
+        {
+            SerializationBuffer Buffer{pStream, RawAllocator, ChunkSize};
+            {
+                Serializer<SerializerMode::Write> WSer{Buffer};
+                WriteTestData(WSer, TmpAllocator);
+                WritePatchedData(WSer);
+            }
+            EXPECT_TRUE(Buffer.Flush());
+            EXPECT_EQ(Buffer.GetSize(), RefData.Size());
+        }
+
+        ASSERT_EQ(pStreamData->GetSize(), sizeof(Header) + RefData.Size()) << "Chunk size: " << ChunkSize;
+        EXPECT_EQ(*pStreamData->GetConstDataPtr<Uint32>(), Header);
+        EXPECT_EQ(std::memcmp(pStreamData->GetConstDataPtr<Uint8>() + sizeof(Header), RefData.Ptr(), RefData.Size()), 0) << "Chunk size: " << ChunkSize;
+    }
+}
+
 } // namespace
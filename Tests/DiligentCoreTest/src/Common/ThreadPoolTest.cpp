@@ -30,6 +30,7 @@
 
 #include <array>
 #include <cmath>
+#include <vector>
 
 #include "ThreadSignal.hpp"
 
@@ -442,4 +443,46 @@ TEST(Common_ThreadPool, ReRunTasks)
         EXPECT_EQ(ReRunCounters[i], 0) << i;
 }
 
+TEST(Common_ThreadPool, ProcessInParallel)
+{
+    constexpr size_t NumItems = 1000;
+
+    auto TestProcessInParallel = [&](IThreadPool* pThreadPool, size_t Count, size_t MaxTasks) {
+        std::vector<std::atomic<int>> Counters(NumItems);
+        for (std::atomic<int>& Counter : Counters)
+            Counter = 0;
+
+        ProcessInParallel(
+            pThreadPool, Count,
+            [&Counters](size_t i) {
+                Counters[i].fetch_add(1);
+            },
+            MaxTasks);
+
+        for (size_t i = 0; i < NumItems; ++i)
+            EXPECT_EQ(Counters[i], i < Count ? 1 : 0) << i;
+    };
+
+    TestProcessInParallel(nullptr, NumItems, 64);
+
+    {
+        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+        ASSERT_NE(pThreadPool, nullptr);
+        for (size_t Count : {size_t{0}, size_t{1}, size_t{2}, size_t{17}, NumItems})
+        {
+            TestProcessInParallel(pThreadPool, Count, 64);
+            TestProcessInParallel(pThreadPool, Count, 3);
+        }
+        EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    }
+
+    {
+        // The calling thread must process all items when there are no worker threads
+        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+        ASSERT_NE(pThreadPool, nullptr);
+        TestProcessInParallel(pThreadPool, NumItems, 16);
+        EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    }
+}
+
 } // namespace
@@ -0,0 +1,934 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/DeviceObjectArchive.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/EngineMemory.h"
+#include "../../../../Graphics/GraphicsEngine/include/PSOSerializer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+using DeviceType   = DeviceObjectArchive::DeviceType;
+using ResourceType = DeviceObjectArchive::ResourceType;
+
+SerializedData MakeTestData(Uint32 Seed, size_t Size)
+{
+    SerializedData Data{Size, GetRawAllocator()};
+    for (size_t i = 0; i < Size; ++i)
+        Data.Ptr<Uint8>()[i] = static_cast<Uint8>(Seed * 31 + i);
+    return Data;
+}
+
+struct TestResource
+{
+    ResourceType Type;
+    const char*  Name;
+};
+
+// clang-format off
+constexpr TestResource TestResources[] =
+{
+    {ResourceType::ResourceSignature, "Signature 2"},
+    {ResourceType::GraphicsPipeline,  "Pipeline 1"},
+    {ResourceType::ResourceSignature, "Signature 1"},
+    {ResourceType::RenderPass,        "Render Pass"},
+    {ResourceType::GraphicsPipeline,  "Pipeline 2"},
+    {ResourceType::ComputePipeline,   "Pipeline 1"},
+};
+// clang-format on
+
+void InitTestArchive(DeviceObjectArchive& Archive, bool Reverse)
+{
+    constexpr Uint32 NumResources = _countof(TestResources);
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        const Uint32        res  = Reverse ? NumResources - 1 - i : i;
+        const TestResource& Res  = TestResources[res];
+        auto&               Data = Archive.GetResourceData(Res.Type, Res.Name);
+
+        Data.Common = MakeTestData(res, 16 + res * 5);
+        // Leave some device data empty
+        Data.DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)] = MakeTestData(res + 100, 4 + res);
+        if (res % 2 == 0)
+            Data.DeviceSpecific[static_cast<size_t>(DeviceType::Direct3D12)] = MakeTestData(res + 200, 3 + res);
+    }
+
+    auto& VkShaders = Archive.GetDeviceShaders(DeviceType::Vulkan);
+    for (Uint32 i = 0; i < 3; ++i)
+        VkShaders.emplace_back(MakeTestData(i + 300, 40 + i * 7));
+
+    Archive.GetDeviceShaders(DeviceType::Direct3D12).emplace_back(MakeTestData(400, 25));
+}
+
+// Fills the data with text that compresses similar to shader sources
+SerializedData MakeCompressibleData(Uint32 Seed, size_t Size)
+{
+    static const char* Words[] = {"float4 ", "Color ", "= ", "g_Texture.Sample(", "g_Sampler, ", "UV", ");\n", "return ", "PSInput ", "struct ", "cbuffer "};
+
+    SerializedData Data{Size, GetRawAllocator()};
+    FastRandInt    Rnd{Seed, 0, static_cast<int>(sizeof(Words) / sizeof(Words[0])) - 1};
+    for (size_t Pos = 0; Pos < Size;)
+    {
+        const char*  Word = Words[Rnd()];
+        const size_t Len  = std::min(strlen(Word), Size - Pos);
+        std::memcpy(Data.Ptr<char>() + Pos, Word, Len);
+        Pos += Len;
+    }
+    return Data;
+}
+
+void InitCompressibleArchive(DeviceObjectArchive& Archive, Uint32 NumResources, Uint32 NumShaders, size_t ShaderSize)
+{
+    for (Uint32 res = 0; res < NumResources; ++res)
+    {
+        const std::string Name = "Pipeline " + std::to_string(res);
+        auto&             Data = Archive.GetResourceData(ResourceType::GraphicsPipeline, Name.c_str());
+
+        Data.Common = MakeCompressibleData(res, 512 + res % 7);
+        // Small blobs are not compressed, so the archive contains mixed data
+        Data.DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)] = MakeTestData(res, 8);
+    }
+
+    auto& Shaders = Archive.GetDeviceShaders(DeviceType::Vulkan);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+        Shaders.emplace_back(MakeCompressibleData(1000 + i, ShaderSize + i));
+}
+
+bool IsInsideBlob(const SerializedData& Data, const IDataBlob* pBlob)
+{
+    const Uint8* pStart = static_cast<const Uint8*>(pBlob->GetConstDataPtr());
+    const Uint8* pPtr   = Data.Ptr<const Uint8>();
+    return pPtr >= pStart && pPtr + Data.Size() <= pStart + pBlob->GetSize();
+}
+
+void VerifyTestArchive(const DeviceObjectArchive& Archive, DeviceObjectArchive& RefArchive)
+{
+    const auto& RefResources = RefArchive.GetNamedResources();
+    const auto& Resources    = Archive.GetNamedResources();
+    ASSERT_EQ(Resources.size(), RefResources.size());
+    for (const auto& ref_it : RefResources)
+    {
+        auto it = Resources.find(ref_it.first);
+        ASSERT_NE(it, Resources.end()) << ref_it.first.GetName();
+
+        EXPECT_EQ(Archive.GetUncompressedData(it->second.Common), ref_it.second.Common);
+
+        for (size_t dev = 0; dev < static_cast<size_t>(DeviceType::Count); ++dev)
+        {
+            const SerializedData& DevData = Archive.GetDeviceSpecificData(ref_it.first.GetType(), ref_it.first.GetName(), static_cast<DeviceType>(dev));
+            EXPECT_EQ(DevData, ref_it.second.DeviceSpecific[dev]);
+            EXPECT_EQ(Archive.GetUncompressedData(it->second.DeviceSpecific[dev]), ref_it.second.DeviceSpecific[dev]);
+        }
+    }
+
+    for (size_t dev = 0; dev < static_cast<size_t>(DeviceType::Count); ++dev)
+    {
+        const auto& RefShaders = RefArchive.GetDeviceShaders(static_cast<DeviceType>(dev));
+        for (size_t i = 0; i < RefShaders.size(); ++i)
+            EXPECT_EQ(Archive.GetSerializedShader(static_cast<DeviceType>(dev), i), RefShaders[i]);
+        EXPECT_FALSE(Archive.GetSerializedShader(static_cast<DeviceType>(dev), RefShaders.size()));
+    }
+}
+
+// Writes the archive in the legacy sequential format (version 8)
+RefCntAutoPtr<IDataBlob> SerializeVersion8(DeviceObjectArchive& Archive)
+{
+    auto SerializeArchive = [&Archive](auto& Ser) {
+        Uint32      MagicNumber    = DeviceObjectArchive::HeaderMagicNumber;
+        Uint32      Version        = 8;
+        Uint32      APIVersion     = DILIGENT_API_VERSION;
+        Uint32      ContentVersion = Archive.GetContentVersion();
+        const char* GitHash        = "Test hash";
+        EXPECT_TRUE(Ser(MagicNumber, Version, APIVersion, ContentVersion, GitHash));
+
+        const auto& Resources    = Archive.GetNamedResources();
+        Uint32      NumResources = static_cast<Uint32>(Resources.size());
+        EXPECT_TRUE(Ser(NumResources));
+        for (const auto& it : Resources)
+        {
+            ResourceType ResType = it.first.GetType();
+            const char*  Name    = it.first.GetName();
+            EXPECT_TRUE(Ser(ResType, Name));
+            EXPECT_TRUE(Ser.Serialize(it.second.Common));
+            for (const SerializedData& DevData : it.second.DeviceSpecific)
+                EXPECT_TRUE(Ser.Serialize(DevData));
+        }
+
+        for (size_t dev = 0; dev < static_cast<size_t>(DeviceType::Count); ++dev)
+        {
+            const auto& Shaders    = Archive.GetDeviceShaders(static_cast<DeviceType>(dev));
+            Uint32      NumShaders = static_cast<Uint32>(Shaders.size());
+            EXPECT_TRUE(Ser(NumShaders));
+            for (const SerializedData& Shader : Shaders)
+                EXPECT_TRUE(Ser.Serialize(Shader));
+        }
+    };
+
+    Serializer<SerializerMode::Measure> Measurer;
+    SerializeArchive(Measurer);
+
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create(Measurer.GetSize());
+    std::memset(pData->GetDataPtr(), 0, pData->GetSize());
+
+    Serializer<SerializerMode::Write> Writer{SerializedData{pData->GetDataPtr(), pData->GetSize()}};
+    SerializeArchive(Writer);
+    EXPECT_TRUE(Writer.IsEnded());
+
+    return RefCntAutoPtr<IDataBlob>{pData};
+}
+
+TEST(DeviceObjectArchiveTest, SerializeDeserialize)
+{
+    DeviceObjectArchive RefArchive{123};
+    InitTestArchive(RefArchive, false);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    RefArchive.Serialize(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    for (bool MakeCopy : {false, true})
+    {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData, 123, MakeCopy}};
+        EXPECT_EQ(Archive.GetContentVersion(), 123u);
+        EXPECT_EQ(Archive.GetData() == pData, !MakeCopy);
+        VerifyTestArchive(Archive, RefArchive);
+
+        // The archive must reference the source data without making copies
+        for (const auto& it : Archive.GetNamedResources())
+        {
+            EXPECT_TRUE(IsInsideBlob(it.second.Common, Archive.GetData()));
+            for (const SerializedData& DevData : it.second.DeviceSpecific)
+            {
+                if (DevData)
+                    EXPECT_TRUE(IsInsideBlob(DevData, Archive.GetData()));
+            }
+        }
+    }
+
+    // Serializing the deserialized archive must produce the same data
+    {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+
+        RefCntAutoPtr<IDataBlob> pData2;
+        Archive.Serialize(&pData2);
+        ASSERT_NE(pData2, nullptr);
+        ASSERT_EQ(pData2->GetSize(), pData->GetSize());
+        EXPECT_EQ(std::memcmp(pData2->GetConstDataPtr(), pData->GetConstDataPtr(), pData->GetSize()), 0);
+    }
+}
+
+TEST(DeviceObjectArchiveTest, DeterministicLayout)
+{
+    DeviceObjectArchive Archive1;
+    InitTestArchive(Archive1, false);
+    DeviceObjectArchive Archive2;
+    InitTestArchive(Archive2, true);
+
+    RefCntAutoPtr<IDataBlob> pData1;
+    Archive1.Serialize(&pData1);
+    RefCntAutoPtr<IDataBlob> pData2;
+    Archive2.Serialize(&pData2);
+    ASSERT_TRUE(pData1 && pData2);
+
+    // The index is sorted, so the order in which resources were added must not matter
+    ASSERT_EQ(pData1->GetSize(), pData2->GetSize());
+    EXPECT_EQ(std::memcmp(pData1->GetConstDataPtr(), pData2->GetConstDataPtr(), pData1->GetSize()), 0);
+}
+
+TEST(DeviceObjectArchiveTest, SerializeToStream)
+{
+    for (bool Compress : {false, true})
+    {
+        DeviceObjectArchive RefArchive{3};
+        InitCompressibleArchive(RefArchive, 8, 4, 1024);
+        if (Compress)
+        {
+            DeviceObjectArchive::CompressionInfo CompressionInfo;
+            CompressionInfo.pCodec = &DeviceObjectArchive::GetLZCodec();
+            RefArchive.SetCompression(CompressionInfo);
+        }
+
+        RefCntAutoPtr<IDataBlob> pData;
+        RefArchive.Serialize(&pData);
+        ASSERT_NE(pData, nullptr);
+
+        // Data written to the stream must be identical to the data written to the blob
+        RefCntAutoPtr<DataBlobImpl>      pStreamData = DataBlobImpl::Create();
+        RefCntAutoPtr<MemoryFileStream> pStream     = MemoryFileStream::Create(pStreamData);
+        EXPECT_TRUE(RefArchive.Serialize(pStream));
+        ASSERT_EQ(pStreamData->GetSize(), pData->GetSize());
+        EXPECT_EQ(std::memcmp(pStreamData->GetConstDataPtr(), pData->GetConstDataPtr(), pData->GetSize()), 0);
+    }
+}
+
+TEST(DeviceObjectArchiveTest, ReadVersion8)
+{
+    DeviceObjectArchive RefArchive{7};
+    InitTestArchive(RefArchive, false);
+
+    RefCntAutoPtr<IDataBlob> pData = SerializeVersion8(RefArchive);
+
+    DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData, 7}};
+    EXPECT_EQ(Archive.GetContentVersion(), 7u);
+    VerifyTestArchive(Archive, RefArchive);
+
+    // The archive is always saved in the latest version
+    RefCntAutoPtr<IDataBlob> pNewData;
+    Archive.Serialize(&pNewData);
+    ASSERT_NE(pNewData, nullptr);
+    DeviceObjectArchive NewArchive{DeviceObjectArchive::CreateInfo{pNewData, 7}};
+    VerifyTestArchive(NewArchive, RefArchive);
+}
+
+TEST(DeviceObjectArchiveTest, InvalidIndex)
+{
+    DeviceObjectArchive RefArchive;
+    InitTestArchive(RefArchive, false);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    RefArchive.Serialize(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    // Drop the last shader from the archive data. The index is still intact,
+    // but the shader location is now out of bounds.
+    const size_t                LastShaderSize = RefArchive.GetDeviceShaders(DeviceType::Vulkan).back().Size();
+    RefCntAutoPtr<DataBlobImpl> pTruncatedData = DataBlobImpl::Create(pData->GetSize() - LastShaderSize, pData->GetConstDataPtr());
+
+    TestingEnvironment::ErrorScope ExpectedErrors{
+        "Failed to read the device object archive index",
+        "Failed to read the shader data location",
+        "is out of the archive bounds",
+    };
+
+    DeviceObjectArchive Archive;
+    EXPECT_FALSE(Archive.Deserialize(DeviceObjectArchive::CreateInfo{pTruncatedData}));
+    EXPECT_TRUE(Archive.GetNamedResources().empty());
+}
+
+TEST(DeviceObjectArchiveTest, MisalignedBlobOffset)
+{
+    DeviceObjectArchive RefArchive;
+    InitTestArchive(RefArchive, false);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    RefArchive.Serialize(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    // Find the location of the first Vulkan shader in the index (size, no codec, uncompressed size)
+    // and shift its offset by one byte. The blob is still within the archive bounds.
+    const Uint32 ShaderSize = static_cast<Uint32>(RefArchive.GetDeviceShaders(DeviceType::Vulkan).front().Size());
+    ASSERT_GT(ShaderSize, 0u);
+    const Uint32 Pattern[] = {ShaderSize, static_cast<Uint32>(DeviceObjectArchive::CodecId::None), ShaderSize};
+    Uint8* const pBytes    = static_cast<Uint8*>(pData->GetDataPtr());
+    Uint8* const pLocation = std::search(pBytes, pBytes + pData->GetSize(),
+                                         reinterpret_cast<const Uint8*>(Pattern), reinterpret_cast<const Uint8*>(Pattern) + sizeof(Pattern));
+    ASSERT_NE(pLocation, pBytes + pData->GetSize());
+    Uint64 Offset = 0;
+    std::memcpy(&Offset, pLocation - sizeof(Offset), sizeof(Offset));
+    ++Offset;
+    std::memcpy(pLocation - sizeof(Offset), &Offset, sizeof(Offset));
+
+    TestingEnvironment::ErrorScope ExpectedErrors{
+        "Failed to read the device object archive index",
+        "Failed to read the shader data location",
+        "is not aligned to 8 bytes",
+    };
+
+    DeviceObjectArchive Archive;
+    EXPECT_FALSE(Archive.Deserialize(DeviceObjectArchive::CreateInfo{pData}));
+}
+
+// Test codec that drops the trailing zero byte and stores the data in reverse order
+class TrimZeroCodec final : public DeviceObjectArchive::Codec
+{
+public:
+    virtual Uint32 GetId() const override final
+    {
+        return static_cast<Uint32>(DeviceObjectArchive::CodecId::FirstCustom) + 1;
+    }
+
+    virtual size_t GetMaxCompressedSize(size_t SrcSize) const override final
+    {
+        return SrcSize;
+    }
+
+    virtual size_t Compress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity) const override final
+    {
+        const Uint8* pSrcBytes = static_cast<const Uint8*>(pSrc);
+        if (SrcSize < 2 || pSrcBytes[SrcSize - 1] != 0 || DstCapacity < SrcSize - 1)
+            return 0;
+        std::reverse_copy(pSrcBytes, pSrcBytes + SrcSize - 1, static_cast<Uint8*>(pDst));
+        return SrcSize - 1;
+    }
+
+    virtual size_t GetMaxDecompressedSize(size_t SrcSize) const override final
+    {
+        return SrcSize + 1;
+    }
+
+    virtual bool Decompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize) const override final
+    {
+        if (DstSize != SrcSize + 1)
+            return false;
+        std::reverse_copy(static_cast<const Uint8*>(pSrc), static_cast<const Uint8*>(pSrc) + SrcSize, static_cast<Uint8*>(pDst));
+        static_cast<Uint8*>(pDst)[SrcSize] = 0;
+        return true;
+    }
+};
+
+TEST(DeviceObjectArchiveTest, Compression)
+{
+    DeviceObjectArchive RefArchive{5};
+    InitCompressibleArchive(RefArchive, 32, 16, 4096);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    RefArchive.Serialize(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    DeviceObjectArchive::CompressionInfo CompressionInfo;
+    CompressionInfo.pCodec = &DeviceObjectArchive::GetLZCodec();
+    RefArchive.SetCompression(CompressionInfo);
+
+    RefCntAutoPtr<IDataBlob> pCompressedData;
+    RefArchive.Serialize(&pCompressedData);
+    ASSERT_NE(pCompressedData, nullptr);
+    EXPECT_LT(pCompressedData->GetSize(), pData->GetSize() / 2);
+
+    {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pCompressedData, 5}};
+
+        // Compressed data is not decompressed until it is accessed
+        const auto& Resources = Archive.GetNamedResources();
+        for (const auto& it : Resources)
+        {
+            // The data slot references the compressed bytes in the archive
+            EXPECT_TRUE(IsInsideBlob(it.second.Common, pCompressedData));
+            EXPECT_LT(it.second.Common.Size(), Archive.GetUncompressedData(it.second.Common).Size());
+            // Small blobs are stored uncompressed
+            EXPECT_TRUE(it.second.DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)]);
+        }
+        VerifyTestArchive(Archive, RefArchive);
+
+        // Decompressing the archive must restore the original data
+        Archive.SetCompression({});
+        RefCntAutoPtr<IDataBlob> pDecompressedData;
+        Archive.Serialize(&pDecompressedData);
+        ASSERT_NE(pDecompressedData, nullptr);
+        ASSERT_EQ(pDecompressedData->GetSize(), pData->GetSize());
+        EXPECT_EQ(std::memcmp(pDecompressedData->GetConstDataPtr(), pData->GetConstDataPtr(), pData->GetSize()), 0);
+    }
+
+    // Parallel decompression
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pCompressedData, 5}};
+        Archive.Decompress(pThreadPool);
+        VerifyTestArchive(Archive, RefArchive);
+    }
+
+    // Modifying the archive resolves compressed data
+    {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pCompressedData, 5}};
+        Archive.RemoveDeviceData(DeviceType::Direct3D12);
+        for (const auto& it : Archive.GetNamedResources())
+        {
+            EXPECT_TRUE(it.second.Common);
+            EXPECT_FALSE(IsInsideBlob(it.second.Common, pCompressedData));
+        }
+        VerifyTestArchive(Archive, RefArchive);
+    }
+}
+
+TEST(DeviceObjectArchiveTest, MixedCompression)
+{
+    DeviceObjectArchive RefArchive1;
+    InitCompressibleArchive(RefArchive1, 8, 4, 1024);
+
+    DeviceObjectArchive::CompressionInfo CompressionInfo;
+    CompressionInfo.pCodec = &DeviceObjectArchive::GetLZCodec();
+    RefArchive1.SetCompression(CompressionInfo);
+
+    RefCntAutoPtr<IDataBlob> pData1;
+    RefArchive1.Serialize(&pData1);
+
+    // Signatures do not reference shaders, so the archives can be merged
+    DeviceObjectArchive RefArchive2;
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        const std::string Name = "Signature " + std::to_string(i);
+        auto&             Data = RefArchive2.GetResourceData(ResourceType::ResourceSignature, Name.c_str());
+
+        Data.Common = MakeTestData(i, 40 + i);
+        // Only the common data will be compressed by the custom codec
+        Data.Common.Ptr<Uint8>()[Data.Common.Size() - 1] = 0;
+        Data.DeviceSpecific[static_cast<size_t>(DeviceType::Direct3D11)] = MakeTestData(i + 10, 20);
+    }
+
+    const TrimZeroCodec CustomCodec;
+    CompressionInfo.pCodec = &CustomCodec;
+    CompressionInfo.MinBlobSize = 16;
+    RefArchive2.SetCompression(CompressionInfo);
+
+    RefCntAutoPtr<IDataBlob> pData2;
+    RefArchive2.Serialize(&pData2);
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{
+            "Failed to read the device object archive index",
+            "Failed to read the data location of resource",
+            "Data blob is compressed with unknown codec",
+        };
+
+        DeviceObjectArchive Archive;
+        EXPECT_FALSE(Archive.Deserialize(DeviceObjectArchive::CreateInfo{pData2}));
+    }
+
+    const DeviceObjectArchive::Codec* Codecs[] = {&CustomCodec};
+
+    DeviceObjectArchive::CreateInfo CI{pData2};
+    CI.ppCodecs  = Codecs;
+    CI.NumCodecs = 1;
+    DeviceObjectArchive Archive2{CI};
+    VerifyTestArchive(Archive2, RefArchive2);
+
+    // Merge archives compressed with different codecs
+    DeviceObjectArchive Archive1{DeviceObjectArchive::CreateInfo{pData1}};
+    Archive1.Merge(Archive2);
+
+    RefCntAutoPtr<IDataBlob> pMergedData;
+    Archive1.Serialize(&pMergedData);
+
+    DeviceObjectArchive MergedArchive{DeviceObjectArchive::CreateInfo{pMergedData}};
+    EXPECT_EQ(MergedArchive.GetNamedResources().size(), RefArchive1.GetNamedResources().size() + RefArchive2.GetNamedResources().size());
+    for (const auto& it : RefArchive2.GetNamedResources())
+    {
+        EXPECT_EQ(MergedArchive.GetDeviceSpecificData(it.first.GetType(), it.first.GetName(), DeviceType::Direct3D11),
+                  it.second.DeviceSpecific[static_cast<size_t>(DeviceType::Direct3D11)]);
+    }
+}
+
+SerializedData SerializeShaderIndices(const std::vector<Uint32>& Indices)
+{
+    const DeviceObjectArchive::ShaderIndexArray IndexArray{Indices.data(), static_cast<Uint32>(Indices.size())};
+
+    Serializer<SerializerMode::Measure> Measurer;
+    PSOSerializer<SerializerMode::Measure>::SerializeShaderIndices(Measurer, IndexArray, nullptr);
+    SerializedData Data = Measurer.AllocateData(GetRawAllocator());
+
+    Serializer<SerializerMode::Write> Writer{Data};
+    PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Writer, IndexArray, nullptr);
+    EXPECT_TRUE(Writer.IsEnded());
+    return Data;
+}
+
+std::vector<Uint32> DeserializeShaderIndices(const SerializedData& Data)
+{
+    DynamicLinearAllocator Allocator{GetRawAllocator()};
+
+    DeviceObjectArchive::ShaderIndexArray IndexArray;
+    Serializer<SerializerMode::Read>      Reader{Data};
+    EXPECT_TRUE(PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Reader, IndexArray, &Allocator));
+    return std::vector<Uint32>{IndexArray.pIndices, IndexArray.pIndices + IndexArray.Count};
+}
+
+TEST(DeviceObjectArchiveTest, MergeDeduplicatesShaders)
+{
+    constexpr size_t VkIdx = static_cast<size_t>(DeviceType::Vulkan);
+
+    DeviceObjectArchive Archive1;
+    {
+        auto& Data                 = Archive1.GetResourceData(ResourceType::GraphicsPipeline, "Pipeline 1");
+        Data.Common                = MakeTestData(1, 32);
+        Data.DeviceSpecific[VkIdx] = SerializeShaderIndices({0, 1});
+
+        auto& Shaders = Archive1.GetDeviceShaders(DeviceType::Vulkan);
+        Shaders.emplace_back(MakeTestData(10, 64));
+        Shaders.emplace_back(MakeTestData(11, 64));
+    }
+
+    DeviceObjectArchive Archive2;
+    {
+        auto& Data                 = Archive2.GetResourceData(ResourceType::GraphicsPipeline, "Pipeline 2");
+        Data.Common                = MakeTestData(2, 32);
+        Data.DeviceSpecific[VkIdx] = SerializeShaderIndices({0, 1});
+
+        // The first shader is the same as the second shader in Archive1
+        auto& Shaders = Archive2.GetDeviceShaders(DeviceType::Vulkan);
+        Shaders.emplace_back(MakeTestData(11, 64));
+        Shaders.emplace_back(MakeTestData(12, 64));
+    }
+
+    Archive1.Merge(Archive2);
+
+    const auto& Shaders = Archive1.GetDeviceShaders(DeviceType::Vulkan);
+    ASSERT_EQ(Shaders.size(), 3u);
+    EXPECT_EQ(Shaders[1], MakeTestData(11, 64));
+    EXPECT_EQ(Shaders[2], MakeTestData(12, 64));
+
+    EXPECT_EQ(DeserializeShaderIndices(Archive1.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "Pipeline 1", DeviceType::Vulkan)), (std::vector<Uint32>{0, 1}));
+    EXPECT_EQ(DeserializeShaderIndices(Archive1.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "Pipeline 2", DeviceType::Vulkan)), (std::vector<Uint32>{1, 2}));
+}
+
+// Creates an archive with pipelines that reference shaders with the given seeds
+void InitPipelineArchive(DeviceObjectArchive& Archive, const std::vector<std::pair<const char*, std::vector<Uint32>>>& Pipelines)
+{
+    constexpr size_t VkIdx = static_cast<size_t>(DeviceType::Vulkan);
+
+    auto& Shaders = Archive.GetDeviceShaders(DeviceType::Vulkan);
+    for (const auto& Pipeline : Pipelines)
+    {
+        std::vector<Uint32> ShaderIndices;
+        for (Uint32 Seed : Pipeline.second)
+        {
+            const SerializedData ShaderData = MakeCompressibleData(Seed, 256 + Seed);
+
+            auto it = std::find(Shaders.begin(), Shaders.end(), ShaderData);
+            if (it == Shaders.end())
+                it = Shaders.emplace(Shaders.end(), ShaderData.MakeCopy(GetRawAllocator()));
+            ShaderIndices.emplace_back(static_cast<Uint32>(it - Shaders.begin()));
+        }
+
+        auto& Data                 = Archive.GetResourceData(ResourceType::GraphicsPipeline, Pipeline.first);
+        Data.Common                = MakeCompressibleData(Pipeline.first[strlen(Pipeline.first) - 1], 512);
+        Data.DeviceSpecific[VkIdx] = SerializeShaderIndices(ShaderIndices);
+    }
+}
+
+TEST(DeviceObjectArchiveTest, MergeMultipleArchives)
+{
+    DeviceObjectArchive Archive0;
+    InitPipelineArchive(Archive0, {{"Pipeline 1", {1, 2}}});
+
+    DeviceObjectArchive Archive1;
+    InitPipelineArchive(Archive1, {{"Pipeline 2", {2, 3}}});
+
+    // Shader 3 is not present in Archive0, but must not be duplicated as it was added by Archive1
+    DeviceObjectArchive Archive2;
+    InitPipelineArchive(Archive2, {{"Pipeline 3", {3, 4}}});
+
+    const DeviceObjectArchive* pSrcArchives[] = {&Archive1, &Archive2};
+    Archive0.Merge(pSrcArchives, _countof(pSrcArchives));
+
+    const auto& Shaders = Archive0.GetDeviceShaders(DeviceType::Vulkan);
+    ASSERT_EQ(Shaders.size(), 4u);
+    for (Uint32 i = 0; i < Shaders.size(); ++i)
+        EXPECT_EQ(Shaders[i], MakeCompressibleData(i + 1, 256 + i + 1));
+
+    EXPECT_EQ(DeserializeShaderIndices(Archive0.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "Pipeline 1", DeviceType::Vulkan)), (std::vector<Uint32>{0, 1}));
+    EXPECT_EQ(DeserializeShaderIndices(Archive0.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "Pipeline 2", DeviceType::Vulkan)), (std::vector<Uint32>{1, 2}));
+    EXPECT_EQ(DeserializeShaderIndices(Archive0.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "Pipeline 3", DeviceType::Vulkan)), (std::vector<Uint32>{2, 3}));
+}
+
+RefCntAutoPtr<IDataBlob> SerializeArchive(DeviceObjectArchive& Archive, bool Compress)
+{
+    DeviceObjectArchive::CompressionInfo CompressionInfo;
+    if (Compress)
+        CompressionInfo.pCodec = &DeviceObjectArchive::GetLZCodec();
+    Archive.SetCompression(CompressionInfo);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    return pData;
+}
+
+TEST(DeviceObjectArchiveTest, MergeStreams)
+{
+    DeviceObjectArchive Archive1{7};
+    InitPipelineArchive(Archive1, {{"Pipeline 1", {1, 2}}, {"Pipeline 2", {2, 3}}});
+
+    DeviceObjectArchive Archive2{7};
+    // Shaders 2 and 3 are shared with Archive1, but have different indices.
+    // "Pipeline 2" is the same as in Archive1 and must not be duplicated.
+    InitPipelineArchive(Archive2, {{"Pipeline 3", {4, 3}}, {"Pipeline 2", {2, 3}}, {"Pipeline 4", {2}}});
+
+    for (bool Compress : {false, true})
+    {
+        // Compressed archives are merged without decompressing resource and shader data
+        RefCntAutoPtr<IDataBlob> pData1 = SerializeArchive(Archive1, Compress);
+        RefCntAutoPtr<IDataBlob> pData2 = SerializeArchive(Archive2, Compress);
+        ASSERT_TRUE(pData1 && pData2);
+
+        RefCntAutoPtr<IFileStream> pSrcStreams[] = {MemoryFileStream::Create(pData1), MemoryFileStream::Create(pData2)};
+        IFileStream*               ppSrcStreams[] = {pSrcStreams[0], pSrcStreams[1]};
+
+        RefCntAutoPtr<DataBlobImpl>     pMergedData = DataBlobImpl::Create();
+        RefCntAutoPtr<MemoryFileStream> pDstStream  = MemoryFileStream::Create(pMergedData);
+        ASSERT_TRUE(DeviceObjectArchive::MergeStreams(ppSrcStreams, _countof(ppSrcStreams), pDstStream));
+
+        DeviceObjectArchive MergedArchive{DeviceObjectArchive::CreateInfo{pMergedData}};
+        if (Compress)
+        {
+            // Compressed data is copied as is. Check it before non-const accessors decompress the blobs.
+            for (const auto& it : MergedArchive.GetNamedResources())
+                EXPECT_NE(&MergedArchive.GetUncompressedData(it.second.Common), &it.second.Common);
+        }
+        EXPECT_EQ(MergedArchive.GetContentVersion(), 7u);
+        EXPECT_EQ(MergedArchive.GetNamedResources().size(), 4u);
+        EXPECT_EQ(MergedArchive.GetDeviceShaders(DeviceType::Vulkan).size(), 4u);
+
+        // The result must be the same as merging the archives in memory
+        DeviceObjectArchive RefArchive{7};
+        RefArchive.Merge(Archive1);
+        RefArchive.Merge(Archive2);
+        VerifyTestArchive(MergedArchive, RefArchive);
+
+        EXPECT_EQ(DeserializeShaderIndices(MergedArchive.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "Pipeline 3", DeviceType::Vulkan)), (std::vector<Uint32>{3, 2}));
+        EXPECT_EQ(DeserializeShaderIndices(MergedArchive.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "Pipeline 4", DeviceType::Vulkan)), (std::vector<Uint32>{1}));
+    }
+}
+
+TEST(DeviceObjectArchiveTest, MergeStreamsInvalidArchive)
+{
+    DeviceObjectArchive Archive;
+    InitTestArchive(Archive, false);
+
+    RefCntAutoPtr<IDataBlob> pData8 = SerializeVersion8(Archive);
+    RefCntAutoPtr<IDataBlob> pData  = SerializeArchive(Archive, false);
+
+    TestingEnvironment::ErrorScope ExpectedErrors{
+        "Failed to read the index of source archive 1",
+        "Device object archive version 8 can't be read from a stream",
+    };
+
+    RefCntAutoPtr<IFileStream> pSrcStreams[] = {MemoryFileStream::Create(pData), MemoryFileStream::Create(pData8)};
+    IFileStream*               ppSrcStreams[] = {pSrcStreams[0], pSrcStreams[1]};
+
+    RefCntAutoPtr<DataBlobImpl>     pMergedData = DataBlobImpl::Create();
+    RefCntAutoPtr<MemoryFileStream> pDstStream  = MemoryFileStream::Create(pMergedData);
+    EXPECT_FALSE(DeviceObjectArchive::MergeStreams(ppSrcStreams, _countof(ppSrcStreams), pDstStream));
+    EXPECT_EQ(pMergedData->GetSize(), 0u);
+}
+
+TEST(DeviceObjectArchiveTest, ReadIndex)
+{
+    DeviceObjectArchive Archive{5};
+    for (Uint32 i = 0; i < 2048; ++i)
+    {
+        const std::string Name = "Resource with a long name to make the index large " + std::to_string(i);
+        Archive.GetResourceData(ResourceType::ResourceSignature, Name.c_str()).Common = MakeTestData(i, 1024);
+    }
+
+    RefCntAutoPtr<IDataBlob> pData = SerializeArchive(Archive, false);
+    ASSERT_NE(pData, nullptr);
+
+    DeviceObjectArchive::ArchiveIndex Index;
+    EXPECT_TRUE(DeviceObjectArchive::ReadIndex(MemoryFileStream::Create(pData), Index));
+    EXPECT_EQ(Index.ContentVersion, 5u);
+    EXPECT_EQ(Index.Version, DeviceObjectArchive::ArchiveVersion);
+    ASSERT_EQ(Index.Resources.size(), 2048u);
+
+    Uint64 FirstBlobOffset = pData->GetSize();
+    for (const DeviceObjectArchive::ArchiveIndex::Resource& Res : Index.Resources)
+    {
+        EXPECT_EQ(Res.Type, ResourceType::ResourceSignature);
+        EXPECT_EQ(Res.Blobs[0].Size, 1024u);
+        EXPECT_EQ(Res.Blobs[0].Offset % DeviceObjectArchive::BlobAlignment, 0u);
+        FirstBlobOffset = std::min(FirstBlobOffset, Res.Blobs[0].Offset);
+    }
+
+    // Exactly the index is read from the stream
+    EXPECT_LE(Index.Data.size(), FirstBlobOffset);
+    EXPECT_LT(FirstBlobOffset - Index.Data.size(), DeviceObjectArchive::BlobAlignment);
+}
+
+TEST(DeviceObjectArchiveTest, InvalidIndexSize)
+{
+    DeviceObjectArchive RefArchive;
+    InitTestArchive(RefArchive, false);
+
+    RefCntAutoPtr<IDataBlob> pRefData;
+    RefArchive.Serialize(&pRefData);
+    ASSERT_NE(pRefData, nullptr);
+
+    // The index size follows the magic number and the version
+    constexpr size_t IndexSizeOffset = sizeof(Uint32) * 2;
+
+    Uint32 IndexSize = 0;
+    std::memcpy(&IndexSize, pRefData->GetConstDataPtr<Uint8>() + IndexSizeOffset, sizeof(IndexSize));
+
+    auto PatchIndexSize = [&](Uint32 NewIndexSize) {
+        RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::MakeCopy(pRefData);
+        std::memcpy(pData->GetDataPtr<Uint8>() + IndexSizeOffset, &NewIndexSize, sizeof(NewIndexSize));
+        return pData;
+    };
+
+    {
+        RefCntAutoPtr<DataBlobImpl> pData = PatchIndexSize(static_cast<Uint32>(pRefData->GetSize() + 1));
+        {
+            TestingEnvironment::ErrorScope ExpectedErrors{"exceeds the archive size"};
+
+            DeviceObjectArchive Archive;
+            EXPECT_FALSE(Archive.Deserialize(DeviceObjectArchive::CreateInfo{pData}));
+        }
+        {
+            TestingEnvironment::ErrorScope ExpectedErrors{"Invalid device object archive index size"};
+
+            DeviceObjectArchive::ArchiveIndex Index;
+            EXPECT_FALSE(DeviceObjectArchive::ReadIndex(MemoryFileStream::Create(pData), Index));
+        }
+    }
+
+    {
+        RefCntAutoPtr<DataBlobImpl> pData = PatchIndexSize(IndexSize - 8);
+        {
+            TestingEnvironment::ErrorScope ExpectedErrors{"does not match the actual size"};
+
+            DeviceObjectArchive Archive;
+            EXPECT_FALSE(Archive.Deserialize(DeviceObjectArchive::CreateInfo{pData}));
+        }
+        {
+            TestingEnvironment::ErrorScope ExpectedErrors{"Unexpected end of the device object archive index data"};
+
+            DeviceObjectArchive::ArchiveIndex Index;
+            EXPECT_FALSE(DeviceObjectArchive::ReadIndex(MemoryFileStream::Create(pData), Index));
+        }
+    }
+
+    {
+        RefCntAutoPtr<DataBlobImpl> pData = PatchIndexSize(IndexSize + 8);
+        {
+            TestingEnvironment::ErrorScope ExpectedErrors{"does not match the actual size"};
+
+            DeviceObjectArchive::ArchiveIndex Index;
+            EXPECT_FALSE(DeviceObjectArchive::ReadIndex(MemoryFileStream::Create(pData), Index));
+        }
+    }
+}
+
+TEST(DeviceObjectArchiveTest, DiffStreams)
+{
+    DeviceObjectArchive Archive0;
+    InitPipelineArchive(Archive0, {{"Pipeline 1", {1, 2}}, {"Pipeline 2", {2, 3}}, {"Pipeline 3", {4}}, {"Pipeline 4", {5}}});
+    Archive0.GetResourceData(ResourceType::RenderPass, "Render Pass").Common = MakeTestData(1, 32);
+
+    DeviceObjectArchive Archive1;
+    // Shaders are added in a different order, so the indices are different
+    // - "Pipeline 1" is the same
+    // - "Pipeline 2" references a different shader
+    // - "Pipeline 3" is removed
+    // - "Pipeline 4" is the same
+    // - "Pipeline 5" is added
+    // - "Render Pass" has different data
+    InitPipelineArchive(Archive1, {{"Pipeline 5", {6}}, {"Pipeline 4", {5}}, {"Pipeline 2", {2, 7}}, {"Pipeline 1", {1, 2}}});
+    Archive1.GetResourceData(ResourceType::RenderPass, "Render Pass").Common = MakeTestData(2, 32);
+
+    using DiffType = DeviceObjectArchive::DiffType;
+    for (bool Compress : {false, true})
+    {
+        RefCntAutoPtr<IDataBlob> pData0 = SerializeArchive(Archive0, false);
+        RefCntAutoPtr<IDataBlob> pData1 = SerializeArchive(Archive1, Compress);
+        ASSERT_TRUE(pData0 && pData1);
+
+        std::vector<DeviceObjectArchive::ResourceDiff> Diffs;
+        ASSERT_TRUE(DeviceObjectArchive::DiffStreams(MemoryFileStream::Create(pData0), MemoryFileStream::Create(pData1), Diffs));
+        ASSERT_EQ(Diffs.size(), 4u);
+
+        EXPECT_EQ(Diffs[0].ResType, ResourceType::GraphicsPipeline);
+        EXPECT_EQ(Diffs[0].Name, "Pipeline 2");
+        EXPECT_EQ(Diffs[0].Type, DiffType::Modified);
+
+        EXPECT_EQ(Diffs[1].Name, "Pipeline 3");
+        EXPECT_EQ(Diffs[1].Type, DiffType::Removed);
+
+        EXPECT_EQ(Diffs[2].Name, "Pipeline 5");
+        EXPECT_EQ(Diffs[2].Type, DiffType::Added);
+
+        EXPECT_EQ(Diffs[3].ResType, ResourceType::RenderPass);
+        EXPECT_EQ(Diffs[3].Name, "Render Pass");
+        EXPECT_EQ(Diffs[3].Type, DiffType::Modified);
+
+        // Compressed and uncompressed archives with the same content are equal
+        RefCntAutoPtr<IDataBlob> pData0Compressed = SerializeArchive(Archive0, !Compress);
+        EXPECT_TRUE(DeviceObjectArchive::DiffStreams(MemoryFileStream::Create(pData0), MemoryFileStream::Create(pData0Compressed), Diffs));
+        EXPECT_TRUE(Diffs.empty());
+    }
+}
+
+TEST(DeviceObjectArchiveTest, CorruptedUncompressedSize)
+{
+    DeviceObjectArchive RefArchive;
+    InitCompressibleArchive(RefArchive, 4, 4, 1024);
+
+    DeviceObjectArchive::CompressionInfo CompressionInfo;
+    CompressionInfo.pCodec = &DeviceObjectArchive::GetLZCodec();
+    RefArchive.SetCompression(CompressionInfo);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    RefArchive.Serialize(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    // Find the codec and the uncompressed size of the first shader in the index
+    // and replace the size with the value that the compressed data can't expand to.
+    const Uint32 Pattern[] = {static_cast<Uint32>(DeviceObjectArchive::CodecId::LZ), 1024};
+    Uint8* const pBytes    = static_cast<Uint8*>(pData->GetDataPtr());
+    Uint8* const pLocation = std::search(pBytes, pBytes + pData->GetSize(),
+                                         reinterpret_cast<const Uint8*>(Pattern), reinterpret_cast<const Uint8*>(Pattern) + sizeof(Pattern));
+    ASSERT_NE(pLocation, pBytes + pData->GetSize());
+    const Uint32 CorruptedSize = 0xFFFFFF00u;
+    std::memcpy(pLocation + sizeof(Uint32), &CorruptedSize, sizeof(CorruptedSize));
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{
+            "Failed to read the device object archive index",
+            "Failed to read the shader data location",
+            "Uncompressed size of the data blob",
+        };
+
+        DeviceObjectArchive Archive;
+        EXPECT_FALSE(Archive.Deserialize(DeviceObjectArchive::CreateInfo{pData}));
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{
+            "Failed to read data from archive 1",
+            "Uncompressed size of the data blob",
+        };
+
+        RefCntAutoPtr<IDataBlob> pRefData = SerializeArchive(RefArchive, false);
+
+        std::vector<DeviceObjectArchive::ResourceDiff> Diffs;
+        EXPECT_FALSE(DeviceObjectArchive::DiffStreams(MemoryFileStream::Create(pRefData), MemoryFileStream::Create(pData), Diffs));
+    }
+}
+
+} // namespace
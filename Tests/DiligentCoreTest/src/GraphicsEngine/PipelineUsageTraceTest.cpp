@@ -0,0 +1,183 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "../../../../Graphics/GraphicsEngine/include/PipelineUsageTrace.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(PipelineUsageTraceTest, Record)
+{
+    PipelineUsageTrace Trace;
+
+    Trace.RecordPipeline(PIPELINE_TYPE_GRAPHICS, "Pipeline 1", 1, 2);
+    Trace.RecordShader("Shader 1");
+    Trace.RecordPipeline(PIPELINE_TYPE_COMPUTE, "Pipeline 2");
+    Trace.RecordPipeline(PIPELINE_TYPE_GRAPHICS, "Pipeline 1", 1, 2);
+    // Same name, but different create info
+    Trace.RecordPipeline(PIPELINE_TYPE_GRAPHICS, "Pipeline 1", 3, 4);
+    // Same name, but different type
+    Trace.RecordPipeline(PIPELINE_TYPE_COMPUTE, "Pipeline 1", 1, 2);
+    Trace.RecordShader("Shader 1");
+    Trace.RecordShader(nullptr);
+
+    const std::vector<PipelineUsageTrace::Entry> Entries = Trace.GetEntries();
+    ASSERT_EQ(Entries.size(), 6u);
+    EXPECT_EQ(Trace.GetNumEntries(), 6u);
+
+    EXPECT_EQ(Entries[0].PipelineType, PIPELINE_TYPE_GRAPHICS);
+    EXPECT_EQ(Entries[0].Name, "Pipeline 1");
+    EXPECT_EQ(Entries[0].HashLow, 1u);
+    EXPECT_EQ(Entries[0].HashHigh, 2u);
+    EXPECT_EQ(Entries[0].NumRequests, 2u);
+
+    EXPECT_TRUE(Entries[1].IsShader());
+    EXPECT_EQ(Entries[1].Name, "Shader 1");
+    EXPECT_EQ(Entries[1].NumRequests, 2u);
+
+    EXPECT_EQ(Entries[2].PipelineType, PIPELINE_TYPE_COMPUTE);
+    EXPECT_EQ(Entries[2].Name, "Pipeline 2");
+    EXPECT_EQ(Entries[2].NumRequests, 1u);
+
+    EXPECT_EQ(Entries[3].HashLow, 3u);
+    EXPECT_EQ(Entries[3].HashHigh, 4u);
+    EXPECT_EQ(Entries[4].PipelineType, PIPELINE_TYPE_COMPUTE);
+    EXPECT_EQ(Entries[4].Name, "Pipeline 1");
+
+    EXPECT_TRUE(Entries[5].IsShader());
+    EXPECT_EQ(Entries[5].Name, "");
+
+    for (size_t i = 1; i < Entries.size(); ++i)
+        EXPECT_GE(Entries[i].FirstUseTime, Entries[i - 1].FirstUseTime);
+
+    Trace.Clear();
+    EXPECT_EQ(Trace.GetNumEntries(), 0u);
+    Trace.RecordShader("Shader 1");
+    EXPECT_EQ(Trace.GetEntries()[0].NumRequests, 1u);
+}
+
+TEST(PipelineUsageTraceTest, SerializeDeserialize)
+{
+    PipelineUsageTrace Trace;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const std::string Name = "Object " + std::to_string(i % 10);
+        if (i % 3 == 0)
+            Trace.RecordShader(Name.c_str(), i, ~Uint64{i});
+        else
+            Trace.RecordPipeline(i % 2 == 0 ? PIPELINE_TYPE_GRAPHICS : PIPELINE_TYPE_COMPUTE, Name.c_str(), i % 10);
+    }
+    const std::vector<PipelineUsageTrace::Entry> RefEntries = Trace.GetEntries();
+
+    RefCntAutoPtr<IDataBlob> pBlob;
+    Trace.Serialize(&pBlob);
+    ASSERT_NE(pBlob, nullptr);
+
+    std::vector<PipelineUsageTrace::Entry> Entries;
+    EXPECT_TRUE(PipelineUsageTrace::Deserialize(pBlob->GetConstDataPtr(), pBlob->GetSize(), Entries));
+    EXPECT_EQ(Entries, RefEntries);
+
+    // The stream contains the same data as the blob
+    RefCntAutoPtr<DataBlobImpl>     pStreamData = DataBlobImpl::Create();
+    RefCntAutoPtr<MemoryFileStream> pStream     = MemoryFileStream::Create(pStreamData);
+    EXPECT_TRUE(Trace.Serialize(pStream));
+    ASSERT_EQ(pStreamData->GetSize(), pBlob->GetSize());
+    EXPECT_EQ(memcmp(pStreamData->GetConstDataPtr(), pBlob->GetConstDataPtr(), pBlob->GetSize()), 0);
+}
+
+TEST(PipelineUsageTraceTest, InvalidData)
+{
+    PipelineUsageTrace Trace;
+    Trace.RecordPipeline(PIPELINE_TYPE_GRAPHICS, "Pipeline", 1, 2);
+    Trace.RecordShader("Shader");
+
+    RefCntAutoPtr<IDataBlob> pBlob;
+    Trace.Serialize(&pBlob);
+    ASSERT_NE(pBlob, nullptr);
+
+    std::vector<PipelineUsageTrace::Entry> Entries;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to read pipeline usage trace entry 1"};
+        EXPECT_FALSE(PipelineUsageTrace::Deserialize(pBlob->GetConstDataPtr(), pBlob->GetSize() - 1, Entries));
+        EXPECT_TRUE(Entries.empty());
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Invalid pipeline usage trace header"};
+        EXPECT_FALSE(PipelineUsageTrace::Deserialize(pBlob->GetConstDataPtr(), 8, Entries));
+    }
+
+    {
+        RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create(pBlob->GetSize(), pBlob->GetConstDataPtr());
+        pData->GetDataPtr<Uint32>()[1]    = PipelineUsageTrace::TraceVersion + 1;
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"Unsupported pipeline usage trace version"};
+        EXPECT_FALSE(PipelineUsageTrace::Deserialize(pData->GetConstDataPtr(), pData->GetSize(), Entries));
+    }
+}
+
+TEST(PipelineUsageTraceTest, RecordInParallel)
+{
+    PipelineUsageTrace Trace;
+
+    constexpr Uint32 NumThreads  = 4;
+    constexpr Uint32 NumRequests = 1000;
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&Trace]() {
+            for (Uint32 i = 0; i < NumRequests; ++i)
+                Trace.RecordPipeline(PIPELINE_TYPE_GRAPHICS, "Pipeline", i % 10);
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    const std::vector<PipelineUsageTrace::Entry> Entries = Trace.GetEntries();
+    ASSERT_EQ(Entries.size(), 10u);
+    for (const PipelineUsageTrace::Entry& Entry : Entries)
+        EXPECT_EQ(Entry.NumRequests, NumThreads * NumRequests / 10);
+
+    // Entries are created in the order of first use, so their timestamps must not decrease
+    for (size_t i = 1; i < Entries.size(); ++i)
+        EXPECT_LE(Entries[i - 1].FirstUseTime, Entries[i].FirstUseTime);
+}
+
+} // namespace
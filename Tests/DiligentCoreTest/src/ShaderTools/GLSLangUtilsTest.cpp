@@ -0,0 +1,241 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GLSLangUtils.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
+#include "DataBlobImpl.hpp"
+#include "ThreadPool.hpp"
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class GLSLangUtilsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GLSLangUtils::InitializeGlslang();
+    }
+
+    static void TearDownTestSuite()
+    {
+        GLSLangUtils::FinalizeGlslang();
+    }
+};
+
+RefCntAutoPtr<IShaderSourceInputStreamFactory> CreateShaderSourceFactory()
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/GLSLang", &pShaderSourceFactory);
+    return pShaderSourceFactory;
+}
+
+// Creates the batch of HLSL shaders: every source file is compiled with NumVariants different macro values.
+struct HLSLShaderBatch
+{
+    HLSLShaderBatch(IShaderSourceInputStreamFactory* pFactory, Uint32 NumVariants)
+    {
+        static constexpr struct
+        {
+            const char* FilePath;
+            SHADER_TYPE Type;
+        } Sources[] = {
+            {"BatchVS.hlsl", SHADER_TYPE_VERTEX},
+            {"BatchPS.hlsl", SHADER_TYPE_PIXEL},
+            {"BatchCS.hlsl", SHADER_TYPE_COMPUTE},
+        };
+
+        const size_t NumShaders = NumVariants * _countof(Sources);
+        ScaleValues.reserve(NumShaders);
+        Macros.reserve(NumShaders * 2);
+        ShaderCIs.reserve(NumShaders);
+        for (Uint32 variant = 0; variant < NumVariants; ++variant)
+        {
+            for (const auto& Src : Sources)
+            {
+                ScaleValues.emplace_back(std::to_string(variant + 1) + ".0");
+
+                const size_t FirstMacro = Macros.size();
+                Macros.emplace_back("SCALE", ScaleValues.back().c_str());
+                Macros.emplace_back("USE_SRGB", (variant & 0x01) != 0 ? "1" : "0");
+
+                ShaderCreateInfo ShaderCI;
+                ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+                ShaderCI.FilePath                   = Src.FilePath;
+                ShaderCI.Desc                       = {Src.FilePath, Src.Type};
+                ShaderCI.EntryPoint                 = "main";
+                ShaderCI.Macros                     = {&Macros[FirstMacro], 2};
+                ShaderCI.pShaderSourceStreamFactory = pFactory;
+                ShaderCIs.emplace_back(ShaderCI);
+            }
+        }
+    }
+
+    std::vector<std::string>      ScaleValues;
+    std::vector<ShaderMacro>      Macros;
+    std::vector<ShaderCreateInfo> ShaderCIs;
+};
+
+TEST_F(GLSLangUtilsTest, CompileSession)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory = CreateShaderSourceFactory();
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    HLSLShaderBatch Batch{pShaderSourceFactory, 2};
+
+    GLSLangUtils::CompileSession Session;
+    for (const ShaderCreateInfo& ShaderCI : Batch.ShaderCIs)
+    {
+        const std::vector<unsigned int> RefSPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+        ASSERT_FALSE(RefSPIRV.empty()) << ShaderCI.FilePath;
+
+        const std::vector<unsigned int> SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr, &Session);
+        EXPECT_EQ(SPIRV, RefSPIRV) << ShaderCI.FilePath;
+    }
+
+    // Common.fxh and Lighting.fxh must only be read once
+    GLSLangUtils::CompileSession::Statistics Stats = Session.GetStatistics();
+    EXPECT_EQ(Stats.NumIncludeFileReads, 2u);
+    EXPECT_GT(Stats.NumIncludeCacheHits, 0u);
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to parse shader source", "Failed to open shader include file 'Missing.fxh'"};
+
+        static constexpr char Source[] = "#include \"Missing.fxh\"\nfloat4 main() : SV_Target { return float4(0.0, 0.0, 0.0, 0.0); }\n";
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.Source                     = Source;
+        ShaderCI.SourceLength               = sizeof(Source) - 1;
+        ShaderCI.Desc                       = {"Missing include test", SHADER_TYPE_PIXEL};
+        ShaderCI.EntryPoint                 = "main";
+        ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+        EXPECT_TRUE(GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr, &Session).empty());
+    }
+
+    Session.ClearIncludeCache();
+    EXPECT_FALSE(GLSLangUtils::HLSLtoSPIRV(Batch.ShaderCIs[0], GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr, &Session).empty());
+    EXPECT_EQ(Session.GetStatistics().NumIncludeFileReads, 3u);
+}
+
+TEST_F(GLSLangUtilsTest, GLSLParallelCompile)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory = CreateShaderSourceFactory();
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    RefCntAutoPtr<IFileStream> pSourceStream;
+    pShaderSourceFactory->CreateInputStream("BatchGLSL.glsl", &pSourceStream);
+    ASSERT_NE(pSourceStream, nullptr);
+    RefCntAutoPtr<DataBlobImpl> pSource = DataBlobImpl::Create();
+    pSourceStream->ReadBlob(pSource);
+
+    constexpr Uint32 NumShaders = 8;
+
+    std::vector<std::string>                      ScaleValues(NumShaders);
+    std::vector<ShaderMacro>                      Macros(NumShaders);
+    std::vector<GLSLangUtils::GLSLtoSPIRVAttribs> Attribs(NumShaders);
+    std::vector<std::vector<unsigned int>>        RefSPIRVs(NumShaders);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        ScaleValues[i] = std::to_string(i + 1);
+        Macros[i]      = {"SCALE", ScaleValues[i].c_str()};
+
+        Attribs[i].ShaderType                 = SHADER_TYPE_VERTEX;
+        Attribs[i].ShaderSource               = pSource->GetConstDataPtr<char>();
+        Attribs[i].SourceCodeLen              = static_cast<int>(pSource->GetSize());
+        Attribs[i].Macros                     = {&Macros[i], 1};
+        Attribs[i].pShaderSourceStreamFactory = pShaderSourceFactory;
+
+        RefSPIRVs[i] = GLSLangUtils::GLSLtoSPIRV(Attribs[i]);
+        ASSERT_FALSE(RefSPIRVs[i].empty());
+    }
+
+    ThreadPoolCreateInfo ThreadPoolCI;
+    ThreadPoolCI.NumThreads                = 4;
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    GLSLangUtils::CompileSession           Session;
+    std::vector<std::vector<unsigned int>> SPIRVs(NumShaders);
+    ProcessInParallel(pThreadPool, NumShaders,
+                      [&](size_t i) {
+                          GLSLangUtils::GLSLtoSPIRVAttribs ShaderAttribs = Attribs[i];
+                          ShaderAttribs.pSession                         = &Session;
+                          SPIRVs[i]                                      = GLSLangUtils::GLSLtoSPIRV(ShaderAttribs);
+                      });
+    for (Uint32 i = 0; i < NumShaders; ++i)
+        EXPECT_EQ(SPIRVs[i], RefSPIRVs[i]);
+
+    // Concurrent requests may read the same file more than once before it is cached
+    const GLSLangUtils::CompileSession::Statistics Stats = Session.GetStatistics();
+    EXPECT_GE(Stats.NumIncludeFileReads, 1u);
+    EXPECT_EQ(Stats.NumIncludeFileReads + Stats.NumIncludeCacheHits, NumShaders);
+}
+
+TEST_F(GLSLangUtilsTest, HLSLParallelCompile)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory = CreateShaderSourceFactory();
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    HLSLShaderBatch Batch{pShaderSourceFactory, 4};
+    const size_t    NumShaders = Batch.ShaderCIs.size();
+
+    std::vector<std::vector<unsigned int>> RefSPIRVs(NumShaders);
+    for (size_t i = 0; i < NumShaders; ++i)
+    {
+        RefSPIRVs[i] = GLSLangUtils::HLSLtoSPIRV(Batch.ShaderCIs[i], GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+        ASSERT_FALSE(RefSPIRVs[i].empty()) << Batch.ShaderCIs[i].FilePath;
+    }
+
+    ThreadPoolCreateInfo ThreadPoolCI;
+    ThreadPoolCI.NumThreads                = 4;
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    GLSLangUtils::CompileSession           Session;
+    std::vector<std::vector<unsigned int>> SPIRVs(NumShaders);
+    ProcessInParallel(pThreadPool, NumShaders,
+                      [&](size_t i) {
+                          SPIRVs[i] = GLSLangUtils::HLSLtoSPIRV(Batch.ShaderCIs[i], GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr, &Session);
+                      });
+    for (size_t i = 0; i < NumShaders; ++i)
+        EXPECT_EQ(SPIRVs[i], RefSPIRVs[i]) << Batch.ShaderCIs[i].FilePath;
+
+    // Concurrent requests may read Common.fxh and Lighting.fxh more than once before they are cached
+    EXPECT_GE(Session.GetStatistics().NumIncludeFileReads, 2u);
+    EXPECT_GT(Session.GetStatistics().NumIncludeCacheHits, 0u);
+}
+
+} // namespace
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "HLSLTokenizer.hpp"
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Parsing;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static constexpr char g_TestHLSL[] = R"(
+#include "Common.fxh"
+
+cbuffer Constants : register(b0)
+{
+    float4x4 g_WorldViewProj;
+    float4   g_Color;
+};
+
+Texture2D<float4>  g_Tex;
+SamplerState       g_Tex_sampler; // Sampler
+
+RWTexture2D<unorm float4 /*format=rgba8*/> g_RWTex;
+
+[numthreads(8, 8, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    float4 Color = g_Tex.SampleLevel(g_Tex_sampler, float2(DTid.xy) * 0.5f, 0);
+    int i = 0;
+    i += 1;
+    i <<= 2;
+    if (i >= 10 && i != 15)
+        --i;
+    g_RWTex[DTid.xy] = Color * g_Color + float4(-1.0, +2.0, 3e-5, .5);
+}
+)";
+
+TEST(HLSLTokenizer, TokenizeView)
+{
+    HLSLTokenizer Tokenizer;
+
+    const std::string Source{g_TestHLSL};
+
+    const HLSLTokenizer::TokenListType  TokenList  = Tokenizer.Tokenize(Source);
+    const HLSLTokenizer::TokenArrayType TokenArray = Tokenizer.TokenizeView(Source.c_str(), Source.length());
+    ASSERT_FALSE(TokenArray.empty());
+    ASSERT_EQ(TokenList.size(), TokenArray.size());
+
+    size_t Idx = 0;
+    for (const HLSLTokenInfo& Token : TokenList)
+    {
+        const HLSLTokenView& View = TokenArray[Idx];
+        EXPECT_EQ(Token.Type, View.Type) << Token.Literal;
+        EXPECT_EQ(Token.Literal, std::string(View.LiteralStart, View.LiteralEnd));
+        EXPECT_EQ(Token.Delimiter, std::string(View.DelimStart, View.DelimEnd));
+        EXPECT_EQ(Token.Idx, View.Idx);
+        if (Idx > 0)
+        {
+            // Tokens must reference the source buffer
+            EXPECT_GE(View.DelimStart, Source.c_str());
+            EXPECT_LE(View.LiteralEnd, Source.c_str() + Source.length());
+        }
+        ++Idx;
+    }
+
+    EXPECT_EQ(BuildSource(TokenArray), Source);
+
+    const HLSLTokenizer::TokenListType TokenListFromArray = HLSLTokenizer::MakeTokenList(TokenArray);
+    EXPECT_EQ(BuildSource(TokenListFromArray), Source);
+}
+
+TEST(HLSLTokenizer, TokenizeView_Errors)
+{
+    HLSLTokenizer Tokenizer;
+
+    EXPECT_EQ(Tokenizer.TokenizeView("", 0).size(), size_t{1});
+    EXPECT_EQ(Tokenizer.TokenizeView(nullptr, 0).size(), size_t{1});
+
+    TestingEnvironment::ErrorScope ExpectedErrors{"Unable to tokenize string", "Unable to find matching closing quotes"};
+
+    const char* Source = "float4 \"unterminated string";
+    EXPECT_TRUE(Tokenizer.TokenizeView(Source, strlen(Source)).empty());
+}
+
+} // namespace
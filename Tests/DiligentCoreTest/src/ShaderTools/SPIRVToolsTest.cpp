@@ -0,0 +1,158 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SPIRVTools.hpp"
+#include "ThreadPool.hpp"
+#include "TempDirectory.hpp"
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Minimal compute shader:
+//      OpCapability Shader
+//      OpMemoryModel Logical GLSL450
+//      OpEntryPoint GLCompute %1 "main"
+//      OpExecutionMode %1 LocalSize X 1 1
+// %2 = OpTypeVoid
+// %3 = OpTypeFunction %2
+// %1 = OpFunction %2 None %3
+// %4 = OpLabel
+//      OpReturn
+//      OpFunctionEnd
+std::vector<uint32_t> MakeComputeShaderSPIRV(uint32_t LocalSizeX)
+{
+    return {
+        0x07230203, 0x00010000, 0, 5, 0,
+        0x00020011, 1,
+        0x0003000E, 0, 1,
+        0x0005000F, 5, 1, 0x6E69616D, 0,
+        0x00060010, 1, 17, LocalSizeX, 1, 1,
+        0x00020013, 2,
+        0x00030021, 3, 2,
+        0x00050036, 2, 1, 0, 3,
+        0x000200F8, 4,
+        0x000100FD,
+        0x00010038,
+    };
+}
+
+TEST(SPIRVToolsTest, OptimizationCache)
+{
+    const std::vector<uint32_t> SrcSPIRV = MakeComputeShaderSPIRV(8);
+    const std::vector<uint32_t> RefSPIRV = OptimizeSPIRV(SrcSPIRV, SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+    ASSERT_FALSE(RefSPIRV.empty());
+
+    TempDirectory TmpDir;
+
+    SPIRVOptimizationCache::CreateInfo CacheCI;
+    CacheCI.CacheDirectory = TmpDir.Get().c_str();
+    {
+        SPIRVOptimizationCache Cache{CacheCI};
+
+        EXPECT_EQ(Cache.Optimize(SrcSPIRV, SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE), RefSPIRV);
+        EXPECT_EQ(OptimizeSPIRV(SrcSPIRV, SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE, &Cache), RefSPIRV);
+
+        SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumMisses, 1u);
+        EXPECT_EQ(Stats.NumMemoryHits, 1u);
+        EXPECT_EQ(Stats.NumDiskHits, 0u);
+
+        // Different passes must not hit the cache
+        EXPECT_FALSE(Cache.Optimize(SrcSPIRV, SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE | SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION).empty());
+        EXPECT_EQ(Cache.GetStatistics().NumMisses, 2u);
+
+        Cache.ClearMemoryCache();
+        EXPECT_EQ(Cache.Optimize(SrcSPIRV, SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE), RefSPIRV);
+        Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumMisses, 2u);
+        EXPECT_EQ(Stats.NumDiskHits, 1u);
+    }
+
+    {
+        // New cache instance with the same directory must load the module from disk
+        SPIRVOptimizationCache Cache{CacheCI};
+        EXPECT_EQ(Cache.Optimize(SrcSPIRV, SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE), RefSPIRV);
+
+        const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumMisses, 0u);
+        EXPECT_EQ(Stats.NumDiskHits, 1u);
+    }
+
+    {
+        // Memory-only cache
+        SPIRVOptimizationCache Cache{SPIRVOptimizationCache::CreateInfo{}};
+        EXPECT_EQ(Cache.Optimize(SrcSPIRV, SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE), RefSPIRV);
+        EXPECT_EQ(Cache.Optimize(SrcSPIRV, SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE), RefSPIRV);
+
+        const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumMisses, 1u);
+        EXPECT_EQ(Stats.NumMemoryHits, 1u);
+        EXPECT_EQ(Stats.NumDiskHits, 0u);
+    }
+}
+
+TEST(SPIRVToolsTest, CacheThreadSafety)
+{
+    constexpr Uint32 NumModules = 32;
+
+    std::vector<std::vector<uint32_t>> SrcSPIRVs(NumModules);
+    std::vector<std::vector<uint32_t>> RefSPIRVs(NumModules);
+    for (Uint32 i = 0; i < NumModules; ++i)
+    {
+        // Every module is used twice
+        SrcSPIRVs[i] = MakeComputeShaderSPIRV(1 + i / 2);
+        RefSPIRVs[i] = OptimizeSPIRV(SrcSPIRVs[i], SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+        ASSERT_FALSE(RefSPIRVs[i].empty());
+    }
+
+    ThreadPoolCreateInfo ThreadPoolCI;
+    ThreadPoolCI.NumThreads                = 4;
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    SPIRVOptimizationCache Cache{SPIRVOptimizationCache::CreateInfo{}};
+
+    std::vector<std::vector<uint32_t>> SPIRVs(NumModules);
+    ProcessInParallel(pThreadPool, NumModules,
+                      [&](size_t i) {
+                          SPIRVs[i] = OptimizeSPIRV(SrcSPIRVs[i], SPV_ENV_VULKAN_1_0, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE, &Cache);
+                      });
+    EXPECT_EQ(SPIRVs, RefSPIRVs);
+
+    // Every module must be optimized only once, even if it is requested by several threads at the same time
+    const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+    EXPECT_EQ(Stats.NumMisses, NumModules / 2);
+    EXPECT_EQ(Stats.NumMemoryHits, NumModules / 2);
+}
+
+} // namespace
@@ -29,6 +29,7 @@
 #include "ShaderToolsCommon.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
 #include "RenderDevice.h"
+#include "ObjectBase.hpp"
 #include "TestingEnvironment.hpp"
 
 #include "gtest/gtest.h"
@@ -194,6 +195,140 @@ TEST(ShaderPreprocessTest, UnrollIncludes)
     }
 }
 
+TEST(ShaderPreprocessTest, UnrollIncludesWithLineMarkers)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/ShaderPreprocessor", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.Name                  = "TestShader";
+    ShaderCI.FilePath                   = "InlineIncludeShaderTest.hlsl";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    constexpr char RefString[] =
+        "// Start InlineIncludeShaderTest.hlsl\n"
+        "\n#line 1 \"InlineIncludeShaderCommon1.hlsl\"\n"
+        "// Start InlineIncludeShaderCommon1.hlsl\n"
+        "\n#line 1 \"InlineIncludeShaderCommon0.hlsl\"\n"
+        "// #include \"InlineIncludeShaderCommon0.hlsl\"\n"
+        "\n#line 2 \"InlineIncludeShaderCommon1.hlsl\"\n"
+        "\n"
+        "#define MACRO\n"
+        "// End InlineIncludeShaderCommon1.hlsl\n"
+        "\n#line 2 \"InlineIncludeShaderTest.hlsl\"\n"
+        "\n"
+        "\n#line 1 \"InlineIncludeShaderCommon2.hlsl\"\n"
+        "// Start InlineIncludeShaderCommon2.hlsl\n"
+        "\n"
+        "\n"
+        "\n"
+        "// End InlineIncludeShaderCommon2.hlsl\n"
+        "\n#line 3 \"InlineIncludeShaderTest.hlsl\"\n"
+        "\n"
+        "\n"
+        "\n"
+        "\n"
+        "// End InlineIncludeShaderTest.hlsl\n";
+
+    ShaderIncludePreprocessor Preprocessor;
+    EXPECT_EQ(Preprocessor.UnrollIncludes(ShaderCI, true), RefString);
+    // Second run uses cached files
+    EXPECT_EQ(Preprocessor.UnrollIncludes(ShaderCI, true), RefString);
+    EXPECT_EQ(Preprocessor.UnrollIncludes(ShaderCI), UnrollShaderIncludes(ShaderCI));
+
+    // Source string without file name
+    constexpr char Source[] =
+        "// Line 1\n"
+        "#include \"InlineIncludeShaderCommon0.hlsl\"\n"
+        "// Line 3\n";
+    ShaderCI.FilePath     = nullptr;
+    ShaderCI.Source       = Source;
+    ShaderCI.SourceLength = sizeof(Source) - 1;
+
+    constexpr char RefString2[] =
+        "// Line 1\n"
+        "\n#line 1 \"InlineIncludeShaderCommon0.hlsl\"\n"
+        "// #include \"InlineIncludeShaderCommon0.hlsl\"\n"
+        "\n#line 2\n"
+        "\n"
+        "// Line 3\n";
+    EXPECT_EQ(Preprocessor.UnrollIncludes(ShaderCI, true), RefString2);
+}
+
+class CountingShaderSourceFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    using TBase = ObjectBase<IShaderSourceInputStreamFactory>;
+
+    CountingShaderSourceFactory(IReferenceCounters* pRefCounters, IShaderSourceInputStreamFactory* pFactory) :
+        TBase{pRefCounters},
+        m_pFactory{pFactory}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        ++NumStreams;
+        m_pFactory->CreateInputStream2(Name, Flags, ppStream);
+    }
+
+    Uint32 NumStreams = 0;
+
+private:
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pFactory;
+};
+
+TEST(ShaderPreprocessTest, IncludePreprocessorCache)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pDefaultFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/ShaderPreprocessor", &pDefaultFactory);
+    ASSERT_NE(pDefaultFactory, nullptr);
+
+    RefCntAutoPtr<CountingShaderSourceFactory> pShaderSourceFactory{MakeNewRCObj<CountingShaderSourceFactory>()(pDefaultFactory)};
+
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.Name                  = "TestShader";
+    ShaderCI.FilePath                   = "InlineIncludeShaderTest.hlsl";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    const std::string RefUnrolled = UnrollShaderIncludes(ShaderCI);
+    EXPECT_EQ(pShaderSourceFactory->NumStreams, 4u);
+
+    std::vector<std::string> RefFiles;
+    EXPECT_TRUE(ProcessShaderIncludes(ShaderCI, [&](const ShaderIncludePreprocessInfo& ProcessInfo) {
+        RefFiles.emplace_back(ProcessInfo.FilePath);
+    }));
+
+    pShaderSourceFactory->NumStreams = 0;
+
+    ShaderIncludePreprocessor Preprocessor;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(Preprocessor.UnrollIncludes(ShaderCI), RefUnrolled);
+
+        std::vector<std::string> Files;
+        EXPECT_TRUE(Preprocessor.ProcessIncludes(ShaderCI, [&](const ShaderIncludePreprocessInfo& ProcessInfo) {
+            Files.emplace_back(ProcessInfo.FilePath);
+        }));
+        EXPECT_EQ(Files, RefFiles);
+    }
+    // Every file must be read only once
+    EXPECT_EQ(pShaderSourceFactory->NumStreams, 4u);
+
+    Preprocessor.Clear();
+    EXPECT_EQ(Preprocessor.UnrollIncludes(ShaderCI), RefUnrolled);
+    EXPECT_EQ(pShaderSourceFactory->NumStreams, 8u);
+}
+
 TEST(ShaderPreprocessTest, ShaderSourceLanguageDefiniton)
 {
     EXPECT_EQ(ParseShaderSourceLanguageDefinition(""), SHADER_SOURCE_LANGUAGE_DEFAULT);
@@ -59,6 +59,11 @@ public:
         Uint32             AdapterId              = DEFAULT_ADAPTER_ID;
         Uint32             NumDeferredContexts    = 4;
         bool               EnableDeviceSimulation = false;
+        bool               UseVkPushDescriptors   = false;
+        bool               UseVkDescrBuffers      = false;
+        bool               UseVkPipelineLibrary   = false;
+        bool               UseVkExtDynamicState   = false;
+        bool               UseVkSync2             = false;
 
         DeviceFeatures   Features{DEVICE_FEATURE_STATE_OPTIONAL};
         DeviceFeaturesVk FeaturesVk{DEVICE_FEATURE_STATE_OPTIONAL};
@@ -61,6 +61,10 @@
 #    include "EngineFactoryWebGPU.h"
 #endif
 
+#if NULL_SUPPORTED
+#    include "EngineFactoryNull.h"
+#endif
+
 #if ARCHIVER_SUPPORTED
 #    include "ArchiverFactoryLoader.h"
 #endif
@@ -96,6 +100,10 @@ GPUTestingEnvironment* CreateTestingEnvironmentMtl(const GPUTestingEnvironment::
 GPUTestingEnvironment* CreateTestingEnvironmentWebGPU(const GPUTestingEnvironment::CreateInfo& CI, const SwapChainDesc& SCDesc);
 #endif
 
+#if NULL_SUPPORTED
+GPUTestingEnvironment* CreateTestingEnvironmentNull(const GPUTestingEnvironment::CreateInfo& CI, const SwapChainDesc& SCDesc);
+#endif
+
 Uint32 GPUTestingEnvironment::FindAdapter(const std::vector<GraphicsAdapterInfo>& Adapters,
                                           ADAPTER_TYPE                            AdapterType,
                                           Uint32                                  AdapterId)
@@ -428,10 +436,15 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
             EngineCI.UploadHeapPageSize        = 32 * 1024;
             //EngineCI.DeviceLocalMemoryReserveSize = 32 << 20;
             //EngineCI.HostVisibleMemoryReserveSize = 48 << 20;
-            EngineCI.Features                  = EnvCI.Features;
-            EngineCI.FeaturesVk                = EnvCI.FeaturesVk;
-            EngineCI.IgnoreDebugMessageCount   = static_cast<Uint32>(IgnoreDebugMessages.size());
-            EngineCI.ppIgnoreDebugMessageNames = IgnoreDebugMessages.data();
+            EngineCI.Features                   = EnvCI.Features;
+            EngineCI.FeaturesVk                 = EnvCI.FeaturesVk;
+            EngineCI.IgnoreDebugMessageCount    = static_cast<Uint32>(IgnoreDebugMessages.size());
+            EngineCI.ppIgnoreDebugMessageNames  = IgnoreDebugMessages.data();
+            EngineCI.UsePushDescriptors         = EnvCI.UseVkPushDescriptors;
+            EngineCI.UseDescriptorBuffers       = EnvCI.UseVkDescrBuffers;
+            EngineCI.UseGraphicsPipelineLibrary = EnvCI.UseVkPipelineLibrary;
+            EngineCI.UseExtendedDynamicState    = EnvCI.UseVkExtDynamicState;
+            EngineCI.UseSynchronization2        = EnvCI.UseVkSync2;
 
             NumDeferredCtx               = EnvCI.NumDeferredContexts;
             EngineCI.NumDeferredContexts = NumDeferredCtx / 2;
@@ -495,6 +508,30 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
         }
 #endif
         break;
+#if NULL_SUPPORTED
+        case RENDER_DEVICE_TYPE_NULL:
+        {
+#    if EXPLICITLY_LOAD_ENGINE_NULL_DLL
+            GetEngineFactoryNullType GetEngineFactoryNull = LoadGraphicsEngineNull();
+            if (GetEngineFactoryNull == nullptr)
+            {
+                LOG_ERROR_AND_THROW("Failed to load the engine");
+            }
+#    endif
+            IEngineFactoryNull* pFactoryNull = GetEngineFactoryNull();
+            pFactoryNull->SetMessageCallback(MessageCallback);
+            pFactoryNull->SetBreakOnError(false);
+
+            EngineNullCreateInfo EngineCI;
+            EngineCI.Features = EnvCI.Features;
+
+            // Null backend does not support deferred contexts
+            NumDeferredCtx = 0;
+            ppContexts.resize(std::max(size_t{1}, ContextCI.size()) + NumDeferredCtx);
+            pFactoryNull->CreateDeviceAndContextsNull(EngineCI, &m_pDevice, ppContexts.data());
+        }
+        break;
+#endif
         default:
             LOG_ERROR_AND_THROW("Unknown device type");
             break;
@@ -876,6 +913,19 @@ void GPUTestingEnvironment::SetDefaultCompiler(SHADER_COMPILER compiler)
             }
             break;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            switch (compiler)
+            {
+                case SHADER_COMPILER_DEFAULT:
+                    m_ShaderCompiler = compiler;
+                    break;
+
+                default:
+                    LOG_WARNING_MESSAGE(GetShaderCompilerTypeString(compiler), " is not supported by Null backend. Using default compiler");
+                    m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
+            }
+            break;
+
         default:
             LOG_WARNING_MESSAGE("Unexpected device type");
             m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
@@ -989,6 +1039,10 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.deviceType = RENDER_DEVICE_TYPE_WEBGPU;
         }
+        else if (strcmp(arg, "--mode=null") == 0)
+        {
+            TestEnvCI.deviceType = RENDER_DEVICE_TYPE_NULL;
+        }
         else if (AdapterArgName.compare(0, AdapterArgName.length(), arg, AdapterArgName.length()) == 0)
         {
             const char* AdapterStr = arg + AdapterArgName.length();
@@ -1009,6 +1063,26 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.EnableDeviceSimulation = true;
         }
+        else if (strcmp(arg, "--vk_push_descriptors") == 0)
+        {
+            TestEnvCI.UseVkPushDescriptors = true;
+        }
+        else if (strcmp(arg, "--vk_descriptor_buffers") == 0)
+        {
+            TestEnvCI.UseVkDescrBuffers = true;
+        }
+        else if (strcmp(arg, "--vk_graphics_pipeline_library") == 0)
+        {
+            TestEnvCI.UseVkPipelineLibrary = true;
+        }
+        else if (strcmp(arg, "--vk_extended_dynamic_state") == 0)
+        {
+            TestEnvCI.UseVkExtDynamicState = true;
+        }
+        else if (strcmp(arg, "--vk_synchronization2") == 0)
+        {
+            TestEnvCI.UseVkSync2 = true;
+        }
         else if (ParseFeatureState(arg, TestEnvCI.Features, TestEnvCI.FeaturesVk))
         {
             // Feature state has been updated by ParseFeatureState
@@ -1075,6 +1149,12 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
                 break;
 #endif
 
+#if NULL_SUPPORTED
+            case RENDER_DEVICE_TYPE_NULL:
+                pEnv = CreateTestingEnvironmentNull(TestEnvCI, SCDesc);
+                break;
+#endif
+
             default:
                 LOG_ERROR_AND_THROW("Unsupported device type");
         }
@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "Null/TestingSwapChainNull.hpp"
+#include "Null/TestingEnvironmentNull.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+TestingSwapChainNull::TestingSwapChainNull(IReferenceCounters*     pRefCounters,
+                                           TestingEnvironmentNull* pEnv,
+                                           const SwapChainDesc&    SCDesc) :
+    TBase //
+    {
+        pRefCounters,
+        pEnv->GetDevice(),
+        pEnv->GetDeviceContext(),
+        SCDesc //
+    }
+{
+}
+
+void TestingSwapChainNull::TakeSnapshot(ITexture* pCopyFrom)
+{
+}
+
+void TestingSwapChainNull::CompareWithSnapshot(ITexture* pTexture)
+{
+    if (pTexture == nullptr)
+        pTexture = m_pRenderTarget;
+
+    if (pTexture == m_pRenderTarget)
+    {
+        m_pContext->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    }
+
+    // Still record the copy so that it goes through the command validation
+    CopyTextureAttribs CopyInfo //
+        {
+            pTexture,
+            RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+            m_pStagingTexture,
+            RESOURCE_STATE_TRANSITION_MODE_TRANSITION //
+        };
+    m_pContext->CopyTexture(CopyInfo);
+    m_pContext->WaitForIdle();
+}
+
+void CreateTestingSwapChainNull(TestingEnvironmentNull* pEnv,
+                                const SwapChainDesc&    SCDesc,
+                                ISwapChain**            ppSwapChain)
+{
+    TestingSwapChainNull* pTestingSC(MakeNewRCObj<TestingSwapChainNull>()(pEnv, SCDesc));
+    pTestingSC->QueryInterface(IID_SwapChain, reinterpret_cast<IObject**>(ppSwapChain));
+}
+
+} // namespace Testing
+
+} // namespace Diligent
@@ -31,6 +31,10 @@ void TestDearchiver_CInterface(IDearchiver* pDearchiver)
     IDearchiver_LoadArchive(pDearchiver, (IDataBlob*)NULL, 1234, false);
     IDearchiver_UnpackShader(pDearchiver, (const ShaderUnpackInfo*)NULL, (IShader**)NULL);
     IDearchiver_UnpackPipelineState(pDearchiver, (const PipelineStateUnpackInfo*)NULL, (IPipelineState**)NULL);
+    IDearchiver_UnpackPipelineStates(pDearchiver, (const PipelineStateBatchUnpackInfo*)NULL, (IPipelineState**)NULL, (PSO_UNPACK_STATUS*)NULL);
+    IDearchiver_PrefetchPipelineStates(pDearchiver, (const PipelineStatePrefetchInfo*)NULL);
+    IDearchiver_GetPrefetchStats(pDearchiver, (DearchiverPrefetchStats*)NULL);
+    IDearchiver_WriteUsageTrace(pDearchiver, (IFileStream*)NULL);
     IDearchiver_UnpackResourceSignature(pDearchiver, (const ResourceSignatureUnpackInfo*)NULL, (IPipelineResourceSignature**)NULL);
     IDearchiver_UnpackRenderPass(pDearchiver, (const RenderPassUnpackInfo*)NULL, (IRenderPass**)NULL);
     IDearchiver_Store(pDearchiver, (IDataBlob**)NULL);
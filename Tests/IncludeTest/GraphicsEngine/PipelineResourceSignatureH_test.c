@@ -45,6 +45,9 @@ void TestPipelineResourceSignature(struct IPipelineResourceSignature* pSign)
     bool Comp = IPipelineResourceSignature_IsCompatibleWith(pSign, (const struct IPipelineResourceSignature*)NULL);
     (void)Comp;
 
+    Uint32 VarIndex = IPipelineResourceSignature_GetSRBVariableIndex(pSign, SHADER_TYPE_PIXEL, "g_Texture");
+    (void)VarIndex;
+
     IPipelineResourceSignature_InitializeStaticSRBResources(pSign, (struct IShaderResourceBinding*)NULL);
 
     IPipelineResourceSignature_CopyStaticResources(pSign, (struct IPipelineResourceSignature*)NULL);
@@ -32,4 +32,8 @@ void TestDeviceContextVk_CInterface(IDeviceContextVk* pCtx)
 {
     IDeviceContextVk_TransitionImageLayout(pCtx, (ITexture*)NULL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
     IDeviceContextVk_BufferMemoryBarrier(pCtx, (IBuffer*)NULL, VK_ACCESS_HOST_READ_BIT);
+
+    MemoryDefragmentationAttribsVk DefragAttribs = {0};
+    Bool                           MoreWork = IDeviceContextVk_DefragmentMemory(pCtx, &DefragAttribs);
+    (void)MoreWork;
 }